@@ -0,0 +1,146 @@
+/******************************************************************************
+ * Copyright (c) 2019 Philipp Schubert.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Philipp Schubert and others
+ *****************************************************************************/
+
+/*
+ * Generates synthetic C++ programs whose size scales with a parameter, such
+ * that the benchmarks can measure how the analyses scale with
+ *   - call-chain:       the depth of a chain of calls,
+ *   - virtual-dispatch: the number of targets of a virtual call,
+ *   - large-function:   the number of statements of a function.
+ *
+ * Each program reads a value by getchar() and writes a value derived from it
+ * by putchar(), i.e. from a taint source to a taint sink.
+ */
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+namespace {
+
+void emitPrologue(std::ostream &OS, const std::string &Kind, unsigned Size) {
+  OS << "// generated by phasar-benchmark-gen " << Kind << ' ' << Size
+     << "\n\n"
+     << "extern \"C\" int getchar();\n"
+     << "extern \"C\" int putchar(int);\n\n";
+}
+
+void emitCallChain(std::ostream &OS, unsigned Size) {
+  // the functions are emitted in reverse order, such that each callee is
+  // defined before its caller
+  OS << "int f" << Size - 1 << "(int x) { return x * 2 + " << Size - 1
+     << "; }\n\n";
+  for (unsigned Idx = Size - 1; Idx-- > 0;) {
+    OS << "int f" << Idx << "(int x) {\n"
+       << "  int y = x + " << Idx << ";\n"
+       << "  return f" << Idx + 1 << "(y) - " << Idx % 7 << ";\n"
+       << "}\n\n";
+  }
+  OS << "int main(int argc, char **argv) {\n"
+     << "  int x = getchar();\n"
+     << "  int r = f0(x) + f0(argc);\n"
+     << "  putchar(r);\n"
+     << "  return 0;\n"
+     << "}\n";
+}
+
+void emitVirtualDispatch(std::ostream &OS, unsigned Size) {
+  OS << "struct Base {\n"
+     << "  virtual ~Base() = default;\n"
+     << "  virtual int apply(int x) = 0;\n"
+     << "};\n\n";
+  for (unsigned Idx = 0; Idx < Size; ++Idx) {
+    OS << "struct Derived" << Idx << " : Base {\n"
+       << "  int apply(int x) override { return x * " << Idx + 1 << " + "
+       << Idx << "; }\n"
+       << "};\n\n";
+  }
+  OS << "Base *create(int kind) {\n"
+     << "  switch (kind) {\n";
+  for (unsigned Idx = 0; Idx < Size; ++Idx) {
+    OS << "  case " << Idx << ":\n"
+       << "    return new Derived" << Idx << "();\n";
+  }
+  OS << "  default:\n"
+     << "    return nullptr;\n"
+     << "  }\n"
+     << "}\n\n"
+     << "int main(int argc, char **argv) {\n"
+     << "  int x = getchar();\n"
+     << "  for (int i = 0; i < argc; ++i) {\n"
+     << "    Base *b = create(i % " << Size << ");\n"
+     << "    if (b) {\n"
+     << "      x = b->apply(x);\n"
+     << "      delete b;\n"
+     << "    }\n"
+     << "  }\n"
+     << "  putchar(x);\n"
+     << "  return 0;\n"
+     << "}\n";
+}
+
+void emitLargeFunction(std::ostream &OS, unsigned Size) {
+  OS << "int compute(int a, int b) {\n"
+     << "  int v0 = a;\n";
+  for (unsigned Idx = 1; Idx < Size; ++Idx) {
+    OS << "  int v" << Idx << " = v" << Idx - 1 << " * " << Idx % 5 + 1
+       << " + b;\n";
+    // every few statements branch, such that the control-flow graph is not a
+    // single basic block
+    if (Idx % 4 == 0) {
+      OS << "  if (v" << Idx << " % " << Idx % 11 + 2 << " == 0) {\n"
+         << "    v" << Idx << " = v" << Idx << " - a;\n"
+         << "  } else {\n"
+         << "    v" << Idx << " = v" << Idx << " + " << Idx << ";\n"
+         << "  }\n";
+    }
+  }
+  OS << "  return v" << Size - 1 << ";\n"
+     << "}\n\n"
+     << "int main(int argc, char **argv) {\n"
+     << "  int x = getchar();\n"
+     << "  putchar(compute(x, argc));\n"
+     << "  return 0;\n"
+     << "}\n";
+}
+
+} // anonymous namespace
+
+int main(int argc, char **argv) {
+  if (argc != 4) {
+    std::cerr << "usage: " << argv[0]
+              << " <call-chain|virtual-dispatch|large-function> <size> "
+                 "<output file>\n";
+    return 1;
+  }
+  std::string Kind(argv[1]);
+  long Size = std::strtol(argv[2], nullptr, 10);
+  if (Size < 1) {
+    std::cerr << "The size must be a positive number!\n";
+    return 1;
+  }
+  std::ofstream OFS(argv[3]);
+  if (!OFS) {
+    std::cerr << "Could not write file: " << argv[3] << '\n';
+    return 1;
+  }
+  emitPrologue(OFS, Kind, Size);
+  if (Kind == "call-chain") {
+    emitCallChain(OFS, Size);
+  } else if (Kind == "virtual-dispatch") {
+    emitVirtualDispatch(OFS, Size);
+  } else if (Kind == "large-function") {
+    emitLargeFunction(OFS, Size);
+  } else {
+    std::cerr << "Unknown kind of benchmark program: " << Kind << '\n';
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,658 @@
+/******************************************************************************
+ * Copyright (c) 2019 Philipp Schubert.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Philipp Schubert and others
+ *****************************************************************************/
+
+/*
+ * Measures the time and memory that PhASAR's phases take on a set of LLVM IR
+ * modules: loading the ProjectIRDB, building the type hierarchy, the points-to
+ * information and the call graph with each resolver, and solving each data-flow
+ * analysis. Every module is benchmarked in a child process of its own, such
+ * that its peak resident set size is not polluted by the other modules and a
+ * crashing phase does not abort the whole benchmark run.
+ *
+ * The memory of a phase is reported as the growth of the peak resident set
+ * size during the phase (rss_growth_kib), which baselines are compared on,
+ * and as the peak of the process up to the end of the phase (peak_rss_kib),
+ * which includes the memory of all earlier phases.
+ *
+ * The results are written as JSON and, if a baseline, i.e. the results of an
+ * earlier run, is given, compared against it to report regressions.
+ */
+
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "boost/filesystem.hpp"
+#include "boost/program_options.hpp"
+
+#include "nlohmann/json.hpp"
+
+#include "llvm/IR/Instructions.h"
+#include "llvm/IR/Module.h"
+
+#include "phasar/Config/Configuration.h"
+#include "phasar/DB/ProjectIRDB.h"
+#include "phasar/PhasarLLVM/AnalysisStrategy/HelperAnalyses.h"
+#include "phasar/PhasarLLVM/AnalysisStrategy/WholeProgramAnalysis.h"
+#include "phasar/PhasarLLVM/ControlFlow/LLVMBasedICFG.h"
+#include "phasar/PhasarLLVM/DataFlowSolver/IfdsIde/Problems/IDEInstInteractionAnalysis.h"
+#include "phasar/PhasarLLVM/DataFlowSolver/IfdsIde/Problems/IDELinearConstantAnalysis.h"
+#include "phasar/PhasarLLVM/DataFlowSolver/IfdsIde/Problems/IDESolverTest.h"
+#include "phasar/PhasarLLVM/DataFlowSolver/IfdsIde/Problems/IDETaintAnalysis.h"
+#include "phasar/PhasarLLVM/DataFlowSolver/IfdsIde/Problems/IDETypeStateAnalysis.h"
+#include "phasar/PhasarLLVM/DataFlowSolver/IfdsIde/Problems/IFDSConstAnalysis.h"
+#include "phasar/PhasarLLVM/DataFlowSolver/IfdsIde/Problems/IFDSFieldSensTaintAnalysis.h"
+#include "phasar/PhasarLLVM/DataFlowSolver/IfdsIde/Problems/IFDSLinearConstantAnalysis.h"
+#include "phasar/PhasarLLVM/DataFlowSolver/IfdsIde/Problems/IFDSSolverTest.h"
+#include "phasar/PhasarLLVM/DataFlowSolver/IfdsIde/Problems/IFDSTaintAnalysis.h"
+#include "phasar/PhasarLLVM/DataFlowSolver/IfdsIde/Problems/IFDSTypeAnalysis.h"
+#include "phasar/PhasarLLVM/DataFlowSolver/IfdsIde/Problems/IFDSUninitializedVariables.h"
+#include "phasar/PhasarLLVM/DataFlowSolver/IfdsIde/Problems/TypeStateDescriptions/OpenSSLEVPKDFDescription.h"
+#include "phasar/PhasarLLVM/DataFlowSolver/IfdsIde/Solver/IDESolver.h"
+#include "phasar/PhasarLLVM/DataFlowSolver/IfdsIde/Solver/IFDSSolver.h"
+#include "phasar/PhasarLLVM/DataFlowSolver/Mono/Problems/InterMonoSolverTest.h"
+#include "phasar/PhasarLLVM/DataFlowSolver/Mono/Problems/InterMonoTaintAnalysis.h"
+#include "phasar/PhasarLLVM/DataFlowSolver/Mono/Problems/IntraMonoFullConstantPropagation.h"
+#include "phasar/PhasarLLVM/DataFlowSolver/Mono/Problems/IntraMonoSolverTest.h"
+#include "phasar/PhasarLLVM/DataFlowSolver/Mono/Solver/InterMonoSolver.h"
+#include "phasar/PhasarLLVM/DataFlowSolver/Mono/Solver/IntraMonoSolver.h"
+#include "phasar/PhasarLLVM/Pointer/LLVMPointsToInfo.h"
+#include "phasar/PhasarLLVM/TypeHierarchy/LLVMTypeHierarchy.h"
+#include "phasar/PhasarLLVM/Utils/DataFlowAnalysisType.h"
+#include "phasar/Utils/Logger.h"
+
+using namespace psr;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// the call-graph resolvers that are implemented, VTA is not
+const std::vector<CallGraphAnalysisType> Resolvers = {
+    CallGraphAnalysisType::NORESOLVE, CallGraphAnalysisType::CHA,
+    CallGraphAnalysisType::RTA, CallGraphAnalysisType::DTA,
+    CallGraphAnalysisType::OTF};
+
+struct BenchmarkOptions {
+  PointerAnalysisType PTATy = PointerAnalysisType::CFLAnders;
+  // the call graph the data-flow analyses are solved on
+  CallGraphAnalysisType CGTy = CallGraphAnalysisType::OTF;
+  std::vector<DataFlowAnalysisType> DataFlowAnalyses;
+  unsigned Repetitions = 3;
+  bool Log = false;
+};
+
+struct Tolerances {
+  // relative slow-down of a phase that is reported as a regression
+  double Time = 0.1;
+  // relative increase of the RSS growth of a phase that is reported as a
+  // regression
+  double RSS = 0.1;
+  // absolute slow-down in milliseconds below which timings are noise
+  double MinTimeMs = 5;
+  // absolute increase of the RSS growth in KiB below which it is noise
+  double MinRSSKiB = 1024;
+};
+
+double millisecondsSince(Clock::time_point Start) {
+  return std::chrono::duration<double, std::milli>(Clock::now() - Start)
+      .count();
+}
+
+long getPeakRSSInKiB() {
+  struct rusage Usage;
+  getrusage(RUSAGE_SELF, &Usage);
+  return Usage.ru_maxrss;
+}
+
+size_t countInstructions(const ProjectIRDB &IRDB) {
+  size_t Count = 0;
+  for (const auto *F : IRDB.getAllFunctions()) {
+    Count += F->getInstructionCount();
+  }
+  return Count;
+}
+
+std::vector<std::string> getPhases(const BenchmarkOptions &Opts) {
+  std::vector<std::string> Phases = {
+      "ProjectIRDB", "LLVMTypeHierarchy",
+      "LLVMPointsToInfo/" + to_string(Opts.PTATy)};
+  for (auto CGTy : Resolvers) {
+    Phases.push_back("LLVMBasedICFG/" + to_string(CGTy));
+  }
+  for (auto DataFlowAnalysis : Opts.DataFlowAnalyses) {
+    Phases.push_back(to_string(DataFlowAnalysis));
+  }
+  return Phases;
+}
+
+/**
+ * Constructs and solves an analysis, its destruction is not measured.
+ */
+template <typename WPATy, typename... ArgTys>
+double solve(std::shared_ptr<HelperAnalyses<>> HA, ArgTys... Args) {
+  auto Start = Clock::now();
+  WPATy WPA(HA, Args...);
+  WPA.solve();
+  return millisecondsSince(Start);
+}
+
+double solve(DataFlowAnalysisType DataFlowAnalysis,
+             std::shared_ptr<HelperAnalyses<>> HA) {
+  switch (DataFlowAnalysis) {
+  case DataFlowAnalysisType::IFDSUninitializedVariables:
+    return solve<WholeProgramAnalysis<IFDSSolver_P<IFDSUninitializedVariables>,
+                                      IFDSUninitializedVariables>>(HA);
+  case DataFlowAnalysisType::IFDSConstAnalysis:
+    return solve<WholeProgramAnalysis<IFDSSolver_P<IFDSConstAnalysis>,
+                                      IFDSConstAnalysis>>(HA);
+  case DataFlowAnalysisType::IFDSTaintAnalysis:
+    return solve<WholeProgramAnalysis<IFDSSolver_P<IFDSTaintAnalysis>,
+                                      IFDSTaintAnalysis>>(
+        HA, new IFDSTaintAnalysis::ConfigurationTy());
+  case DataFlowAnalysisType::IDETaintAnalysis:
+    return solve<WholeProgramAnalysis<IDESolver_P<IDETaintAnalysis>,
+                                      IDETaintAnalysis>>(HA);
+  case DataFlowAnalysisType::IDEOpenSSLTypeStateAnalysis: {
+    OpenSSLEVPKDFDescription TSDesc;
+    auto Start = Clock::now();
+    WholeProgramAnalysis<IDESolver_P<IDETypeStateAnalysis>,
+                         IDETypeStateAnalysis>
+        WPA(HA, &TSDesc);
+    WPA.solve();
+    double Time = millisecondsSince(Start);
+    // the description is not owned by the analysis
+    WPA.releaseConfiguration();
+    return Time;
+  }
+  case DataFlowAnalysisType::IFDSTypeAnalysis:
+    return solve<WholeProgramAnalysis<IFDSSolver_P<IFDSTypeAnalysis>,
+                                      IFDSTypeAnalysis>>(HA);
+  case DataFlowAnalysisType::IFDSSolverTest:
+    return solve<
+        WholeProgramAnalysis<IFDSSolver_P<IFDSSolverTest>, IFDSSolverTest>>(
+        HA);
+  case DataFlowAnalysisType::IFDSLinearConstantAnalysis:
+    return solve<WholeProgramAnalysis<IFDSSolver_P<IFDSLinearConstantAnalysis>,
+                                      IFDSLinearConstantAnalysis>>(HA);
+  case DataFlowAnalysisType::IFDSFieldSensTaintAnalysis:
+    return solve<WholeProgramAnalysis<IFDSSolver_P<IFDSFieldSensTaintAnalysis>,
+                                      IFDSFieldSensTaintAnalysis>>(
+        HA, new IFDSFieldSensTaintAnalysis::ConfigurationTy());
+  case DataFlowAnalysisType::IDELinearConstantAnalysis:
+    return solve<WholeProgramAnalysis<IDESolver_P<IDELinearConstantAnalysis>,
+                                      IDELinearConstantAnalysis>>(HA);
+  case DataFlowAnalysisType::IDESolverTest:
+    return solve<
+        WholeProgramAnalysis<IDESolver_P<IDESolverTest>, IDESolverTest>>(HA);
+  case DataFlowAnalysisType::IDEInstInteractionAnalysis:
+    return solve<WholeProgramAnalysis<IDESolver_P<IDEInstInteractionAnalysis>,
+                                      IDEInstInteractionAnalysis>>(HA);
+  case DataFlowAnalysisType::IntraMonoFullConstantPropagation:
+    return solve<WholeProgramAnalysis<
+        IntraMonoSolver_P<IntraMonoFullConstantPropagation>,
+        IntraMonoFullConstantPropagation>>(HA);
+  case DataFlowAnalysisType::IntraMonoSolverTest:
+    return solve<WholeProgramAnalysis<IntraMonoSolver_P<IntraMonoSolverTest>,
+                                      IntraMonoSolverTest>>(HA);
+  case DataFlowAnalysisType::InterMonoSolverTest:
+    return solve<WholeProgramAnalysis<InterMonoSolver_P<InterMonoSolverTest, 3>,
+                                      InterMonoSolverTest>>(HA);
+  case DataFlowAnalysisType::InterMonoTaintAnalysis:
+    return solve<
+        WholeProgramAnalysis<InterMonoSolver_P<InterMonoTaintAnalysis, 3>,
+                             InterMonoTaintAnalysis>>(
+        HA, new InterMonoTaintAnalysis::ConfigurationTy());
+  default:
+    throw std::invalid_argument("Data-flow analysis '" +
+                                to_string(DataFlowAnalysis) +
+                                "' cannot be benchmarked!");
+  }
+}
+
+/**
+ * Runs all phases on the module at Path and writes one JSON record per phase
+ * as a line into the file descriptor Fd. Runs in the child process.
+ */
+void benchmarkModule(const std::string &Path, const BenchmarkOptions &Opts,
+                     int Fd) {
+  size_t Instructions = 0;
+  Clock::time_point Start;
+  long PeakRSSAtStart = 0;
+  auto start = [&Start, &PeakRSSAtStart]() {
+    PeakRSSAtStart = getPeakRSSInKiB();
+    Start = Clock::now();
+  };
+  auto report = [&Fd, &Instructions, &PeakRSSAtStart](
+                    const std::string &Phase, const std::string &Status,
+                    double TimeMs = 0) {
+    long PeakRSS = getPeakRSSInKiB();
+    nlohmann::json Record = {{"phase", Phase},
+                             {"status", Status},
+                             {"time_ms", TimeMs},
+                             {"rss_growth_kib", PeakRSS - PeakRSSAtStart},
+                             {"peak_rss_kib", PeakRSS},
+                             {"instructions", Instructions}};
+    std::string Line = Record.dump() + '\n';
+    for (size_t Written = 0; Written < Line.size();) {
+      ssize_t N = write(Fd, Line.data() + Written, Line.size() - Written);
+      if (N < 0 && errno != EINTR) {
+        return;
+      }
+      Written += std::max<ssize_t>(N, 0);
+    }
+  };
+  start();
+  ProjectIRDB IRDB({Path});
+  double Time = millisecondsSince(Start);
+  Instructions = countInstructions(IRDB);
+  report("ProjectIRDB", "ok", Time);
+  start();
+  LLVMTypeHierarchy TH(IRDB);
+  report("LLVMTypeHierarchy", "ok", millisecondsSince(Start));
+  start();
+  LLVMPointsToInfo PT(IRDB, Opts.PTATy);
+  report("LLVMPointsToInfo/" + to_string(Opts.PTATy), "ok",
+         millisecondsSince(Start));
+  // the call graph and the analyses require an entry point
+  std::set<std::string> EntryPoints;
+  if (IRDB.getFunctionDefinition("main")) {
+    EntryPoints.insert("main");
+  }
+  std::unique_ptr<LLVMBasedICFG> ICF;
+  for (auto CGTy : Resolvers) {
+    std::string Phase = "LLVMBasedICFG/" + to_string(CGTy);
+    start();
+    if (EntryPoints.empty()) {
+      report(Phase, "skipped");
+      continue;
+    }
+    auto CG =
+        std::make_unique<LLVMBasedICFG>(IRDB, CGTy, EntryPoints, &TH, &PT);
+    report(Phase, "ok", millisecondsSince(Start));
+    if (CGTy == Opts.CGTy) {
+      ICF = std::move(CG);
+    }
+  }
+  auto HA = std::make_shared<HelperAnalyses<>>(IRDB, EntryPoints, &PT,
+                                               ICF.get(), &TH);
+  for (auto DataFlowAnalysis : Opts.DataFlowAnalyses) {
+    start();
+    if (EntryPoints.empty()) {
+      report(to_string(DataFlowAnalysis), "skipped");
+      continue;
+    }
+    report(to_string(DataFlowAnalysis), "ok", solve(DataFlowAnalysis, HA));
+  }
+}
+
+/**
+ * Benchmarks the module at Path in a child process and returns the records of
+ * all phases. If the child fails, the phase it was running is recorded as
+ * failed and the remaining ones as not run.
+ */
+std::vector<nlohmann::json>
+runIsolated(const std::string &Path, const BenchmarkOptions &Opts,
+            const std::vector<std::string> &Phases) {
+  int Pipe[2];
+  if (pipe(Pipe) != 0) {
+    throw std::runtime_error("Could not create a pipe!");
+  }
+  // otherwise the child would write the parent's buffered output again
+  std::cout.flush();
+  pid_t Pid = fork();
+  if (Pid < 0) {
+    throw std::runtime_error("Could not fork a benchmark process!");
+  }
+  if (Pid == 0) {
+    close(Pipe[0]);
+    // the logger starts a thread, hence it is only initialized after forking
+    initializeLogger(Opts.Log);
+    int ExitCode = 0;
+    try {
+      benchmarkModule(Path, Opts, Pipe[1]);
+    } catch (const std::exception &E) {
+      std::cerr << Path << ": " << E.what() << '\n';
+      ExitCode = 1;
+    }
+    close(Pipe[1]);
+    flushLogger();
+    // the parent's atexit handlers and static objects are not run
+    _exit(ExitCode);
+  }
+  close(Pipe[1]);
+  std::string Output;
+  char Buffer[4096];
+  for (;;) {
+    ssize_t N = read(Pipe[0], Buffer, sizeof(Buffer));
+    if (N < 0 && errno == EINTR) {
+      continue;
+    }
+    if (N <= 0) {
+      break;
+    }
+    Output.append(Buffer, N);
+  }
+  close(Pipe[0]);
+  int Status = 0;
+  while (waitpid(Pid, &Status, 0) < 0 && errno == EINTR) {
+  }
+  std::vector<nlohmann::json> Records;
+  std::istringstream Lines(Output);
+  for (std::string Line; std::getline(Lines, Line);) {
+    Records.push_back(nlohmann::json::parse(Line));
+  }
+  bool Failed = !WIFEXITED(Status) || WEXITSTATUS(Status) != 0;
+  size_t Finished = Records.size();
+  for (size_t Idx = Finished; Idx < Phases.size(); ++Idx) {
+    Records.push_back(
+        {{"phase", Phases[Idx]},
+         {"status", Failed && Idx == Finished ? "failed" : "not run"}});
+  }
+  return Records;
+}
+
+/**
+ * Aggregates the records of all repetitions of a phase: the timings are
+ * summarized by their median and the memory by its maximum.
+ */
+nlohmann::json aggregate(const std::string &Module,
+                         const std::vector<nlohmann::json> &Records) {
+  nlohmann::json Result = {{"module", Module},
+                           {"phase", Records.front()["phase"]}};
+  for (const auto &Record : Records) {
+    if (Record["status"] != "ok") {
+      Result["status"] = Record["status"];
+      return Result;
+    }
+  }
+  std::vector<double> Times;
+  long RSSGrowth = 0;
+  long PeakRSS = 0;
+  for (const auto &Record : Records) {
+    Times.push_back(Record["time_ms"].get<double>());
+    RSSGrowth = std::max(RSSGrowth, Record["rss_growth_kib"].get<long>());
+    PeakRSS = std::max(PeakRSS, Record["peak_rss_kib"].get<long>());
+  }
+  std::sort(Times.begin(), Times.end());
+  size_t Mid = Times.size() / 2;
+  double Median =
+      Times.size() % 2 ? Times[Mid] : (Times[Mid - 1] + Times[Mid]) / 2;
+  size_t Instructions = Records.front()["instructions"].get<size_t>();
+  Result["status"] = "ok";
+  Result["time_ms"] = Median;
+  Result["time_ms_min"] = Times.front();
+  Result["time_ms_max"] = Times.back();
+  Result["rss_growth_kib"] = RSSGrowth;
+  Result["peak_rss_kib"] = PeakRSS;
+  Result["instructions"] = Instructions;
+  // instructions per second, as a measure that is comparable across modules
+  Result["throughput"] = Median > 0 ? Instructions / (Median / 1000) : 0.0;
+  return Result;
+}
+
+nlohmann::json compareWithBaseline(const nlohmann::json &Results,
+                                   const nlohmann::json &Baseline,
+                                   const Tolerances &Tol) {
+  std::map<std::pair<std::string, std::string>, const nlohmann::json *>
+      BaselineResults;
+  for (const auto &Result : Baseline["benchmarks"]) {
+    BaselineResults[{Result["module"].get<std::string>(),
+                     Result["phase"].get<std::string>()}] = &Result;
+  }
+  nlohmann::json Regressions = nlohmann::json::array();
+  auto regression = [&Regressions](const nlohmann::json &Result,
+                                   const std::string &Metric,
+                                   const nlohmann::json &Base,
+                                   const nlohmann::json &Current) {
+    nlohmann::json Regression = {{"module", Result["module"]},
+                                 {"phase", Result["phase"]},
+                                 {"metric", Metric},
+                                 {"baseline", Base},
+                                 {"current", Current}};
+    if (Base.is_number() && Base.get<double>() > 0) {
+      Regression["ratio"] = Current.get<double>() / Base.get<double>();
+    }
+    Regressions.push_back(Regression);
+  };
+  for (const auto &Result : Results) {
+    auto Search = BaselineResults.find({Result["module"].get<std::string>(),
+                                        Result["phase"].get<std::string>()});
+    if (Search == BaselineResults.end() ||
+        (*Search->second)["status"] != "ok") {
+      continue;
+    }
+    const auto &Base = *Search->second;
+    if (Result["status"] != "ok") {
+      regression(Result, "status", Base["status"], Result["status"]);
+      continue;
+    }
+    double BaseTime = Base["time_ms"].get<double>();
+    double Time = Result["time_ms"].get<double>();
+    if (Time > BaseTime * (1 + Tol.Time) && Time - BaseTime >= Tol.MinTimeMs) {
+      regression(Result, "time_ms", Base["time_ms"], Result["time_ms"]);
+    }
+    // the peak RSS includes the memory of the earlier phases, hence only the
+    // growth during the phase is attributed to it
+    if (!Base.contains("rss_growth_kib")) {
+      continue;
+    }
+    double BaseGrowth = Base["rss_growth_kib"].get<double>();
+    double Growth = Result["rss_growth_kib"].get<double>();
+    if (Growth > BaseGrowth * (1 + Tol.RSS) &&
+        Growth - BaseGrowth >= Tol.MinRSSKiB) {
+      regression(Result, "rss_growth_kib", Base["rss_growth_kib"],
+                 Result["rss_growth_kib"]);
+    }
+  }
+  return Regressions;
+}
+
+/**
+ * Returns the LLVM IR files in Dir, named by their path relative to the parent
+ * of Dir, such that the names do not depend on where Dir is located.
+ */
+std::vector<std::pair<std::string, std::string>>
+collectModules(const boost::filesystem::path &Dir) {
+  std::vector<std::pair<std::string, std::string>> Modules;
+  for (boost::filesystem::recursive_directory_iterator It(Dir), End; It != End;
+       ++It) {
+    if (boost::filesystem::is_regular_file(It->path()) &&
+        (It->path().extension() == ".ll" || It->path().extension() == ".bc")) {
+      Modules.emplace_back(
+          Dir.filename().string() + "/" +
+              boost::filesystem::relative(It->path(), Dir).generic_string(),
+          It->path().string());
+    }
+  }
+  std::sort(Modules.begin(), Modules.end());
+  return Modules;
+}
+
+} // anonymous namespace
+
+int main(int argc, const char **argv) {
+  BenchmarkOptions Opts;
+  Tolerances Tol;
+  // clang-format off
+  boost::program_options::options_description Options("Allowed options");
+  Options.add_options()
+      ("help,h", "Print help message")
+      ("module,m", boost::program_options::value<std::vector<std::string>>()->multitoken()->composing(), "LLVM IR module(s) to be benchmarked")
+      ("module-dir", boost::program_options::value<std::vector<std::string>>()->multitoken()->composing(), "Directories whose LLVM IR modules are benchmarked")
+      ("filter", boost::program_options::value<std::string>(), "Only benchmark the modules whose name contains the given string")
+      ("data-flow-analysis,D", boost::program_options::value<std::vector<std::string>>()->multitoken()->composing(), "Data-flow analyses to be benchmarked (default: all)")
+      ("pointer-analysis,P", boost::program_options::value<std::string>()->default_value("CFLAnders"), "Points-to analysis to be benchmarked and used (CFLSteens, CFLAnders)")
+      ("call-graph-analysis,C", boost::program_options::value<std::string>()->default_value("OTF"), "Call graph the data-flow analyses are solved on (NORESOLVE, CHA, RTA, DTA, OTF)")
+      ("repetitions,r", boost::program_options::value<unsigned>(&Opts.Repetitions)->default_value(3), "Number of times each module is benchmarked")
+      ("out,o", boost::program_options::value<std::string>()->default_value("benchmark-results.json"), "File the results are written to")
+      ("baseline,b", boost::program_options::value<std::string>(), "Results of an earlier run that the results are compared against")
+      ("time-tolerance", boost::program_options::value<double>(&Tol.Time)->default_value(0.1), "Relative slow-down of a phase that is reported as a regression")
+      ("rss-tolerance", boost::program_options::value<double>(&Tol.RSS)->default_value(0.1), "Relative increase of the peak RSS growth during a phase that is reported as a regression")
+      ("min-time-ms", boost::program_options::value<double>(&Tol.MinTimeMs)->default_value(5), "Slow-downs of less milliseconds are not reported as a regression")
+      ("min-rss-kib", boost::program_options::value<double>(&Tol.MinRSSKiB)->default_value(1024), "Increases of the peak RSS growth of less KiB are not reported as a regression")
+      ("fail-on-regression", "Exit with a non-zero status if a regression is found")
+      ("log,L", "Enable logging");
+  // clang-format on
+  boost::program_options::variables_map VarMap;
+  try {
+    boost::program_options::store(
+        boost::program_options::parse_command_line(argc, argv, Options),
+        VarMap);
+    boost::program_options::notify(VarMap);
+  } catch (const boost::program_options::error &Err) {
+    std::cerr << "Could not parse command-line arguments!\n"
+              << "Error: " << Err.what() << '\n';
+    return 1;
+  }
+  if (VarMap.count("help") ||
+      (!VarMap.count("module") && !VarMap.count("module-dir"))) {
+    std::cout << Options << '\n';
+    return 0;
+  }
+  Opts.Log = VarMap.count("log");
+  Opts.Repetitions = std::max(Opts.Repetitions, 1U);
+  Opts.PTATy =
+      to_PointerAnalysisType(VarMap["pointer-analysis"].as<std::string>());
+  Opts.CGTy =
+      to_CallGraphAnalysisType(VarMap["call-graph-analysis"].as<std::string>());
+  if (Opts.PTATy == PointerAnalysisType::Invalid ||
+      std::find(Resolvers.begin(), Resolvers.end(), Opts.CGTy) ==
+          Resolvers.end()) {
+    std::cerr << "Invalid pointer or call-graph analysis!\n";
+    return 1;
+  }
+  if (VarMap.count("data-flow-analysis")) {
+    for (const auto &Analysis :
+         VarMap["data-flow-analysis"].as<std::vector<std::string>>()) {
+      auto DataFlowAnalysis = to_DataFlowAnalysisType(Analysis);
+      if (DataFlowAnalysis == DataFlowAnalysisType::None ||
+          DataFlowAnalysis == DataFlowAnalysisType::Plugin) {
+        std::cerr << "'" << Analysis
+                  << "' is not a data-flow analysis that can be "
+                     "benchmarked!\n";
+        return 1;
+      }
+      Opts.DataFlowAnalyses.push_back(DataFlowAnalysis);
+    }
+  } else {
+#define DATA_FLOW_ANALYSIS_TYPES(NAME, CMDFLAG, TYPE)                          \
+  Opts.DataFlowAnalyses.push_back(DataFlowAnalysisType::TYPE);
+#include "phasar/PhasarLLVM/Utils/DataFlowAnalysisType.def"
+    Opts.DataFlowAnalyses.erase(
+        std::remove_if(Opts.DataFlowAnalyses.begin(),
+                       Opts.DataFlowAnalyses.end(),
+                       [](DataFlowAnalysisType DataFlowAnalysis) {
+                         return DataFlowAnalysis ==
+                                    DataFlowAnalysisType::None ||
+                                DataFlowAnalysis ==
+                                    DataFlowAnalysisType::Plugin;
+                       }),
+        Opts.DataFlowAnalyses.end());
+  }
+  std::vector<std::pair<std::string, std::string>> Modules;
+  if (VarMap.count("module")) {
+    for (const auto &Module : VarMap["module"].as<std::vector<std::string>>()) {
+      Modules.emplace_back(boost::filesystem::path(Module).filename().string(),
+                           Module);
+    }
+  }
+  if (VarMap.count("module-dir")) {
+    for (const auto &Dir :
+         VarMap["module-dir"].as<std::vector<std::string>>()) {
+      if (!boost::filesystem::is_directory(Dir)) {
+        std::cerr << "'" << Dir << "' is not a directory!\n";
+        return 1;
+      }
+      auto DirModules = collectModules(Dir);
+      Modules.insert(Modules.end(), DirModules.begin(), DirModules.end());
+    }
+  }
+  if (VarMap.count("filter")) {
+    auto Filter = VarMap["filter"].as<std::string>();
+    Modules.erase(std::remove_if(Modules.begin(), Modules.end(),
+                                 [&Filter](const auto &Module) {
+                                   return Module.first.find(Filter) ==
+                                          std::string::npos;
+                                 }),
+                  Modules.end());
+  }
+  auto Phases = getPhases(Opts);
+  nlohmann::json Results = nlohmann::json::array();
+  for (const auto &[Name, Path] : Modules) {
+    std::cout << "Benchmark " << Name << '\n';
+    std::vector<std::vector<nlohmann::json>> PhaseRecords(Phases.size());
+    for (unsigned Repetition = 0; Repetition < Opts.Repetitions;
+         ++Repetition) {
+      auto Records = runIsolated(Path, Opts, Phases);
+      for (size_t Idx = 0; Idx < Phases.size(); ++Idx) {
+        PhaseRecords[Idx].push_back(Records[Idx]);
+      }
+    }
+    for (const auto &Records : PhaseRecords) {
+      auto Result = aggregate(Name, Records);
+      std::cout << "  " << Result["phase"].get<std::string>() << ": ";
+      if (Result["status"] == "ok") {
+        std::cout << Result["time_ms"].get<double>() << " ms, +"
+                  << Result["rss_growth_kib"].get<long>() << " KiB (peak "
+                  << Result["peak_rss_kib"].get<long>() << " KiB)\n";
+      } else {
+        std::cout << Result["status"].get<std::string>() << '\n';
+      }
+      Results.push_back(Result);
+    }
+  }
+  nlohmann::json Report = {{"version", 2},
+                           {"phasar", PhasarConfig::PhasarVersion()},
+                           {"repetitions", Opts.Repetitions},
+                           {"benchmarks", Results}};
+  if (VarMap.count("baseline")) {
+    std::ifstream IFS(VarMap["baseline"].as<std::string>());
+    if (!IFS) {
+      std::cerr << "Could not read baseline: "
+                << VarMap["baseline"].as<std::string>() << '\n';
+      return 1;
+    }
+    nlohmann::json Baseline;
+    IFS >> Baseline;
+    Report["regressions"] = compareWithBaseline(Results, Baseline, Tol);
+    for (const auto &Regression : Report["regressions"]) {
+      std::cout << "Regression: " << Regression["module"].get<std::string>()
+                << ' ' << Regression["phase"].get<std::string>() << ' '
+                << Regression["metric"].get<std::string>() << ": "
+                << Regression["baseline"] << " -> " << Regression["current"]
+                << '\n';
+    }
+  }
+  std::ofstream OFS(VarMap["out"].as<std::string>());
+  if (!OFS) {
+    std::cerr << "Could not write file: " << VarMap["out"].as<std::string>()
+              << '\n';
+    return 1;
+  }
+  OFS << Report.dump(2) << '\n';
+  if (VarMap.count("fail-on-regression") && Report.count("regressions") &&
+      !Report["regressions"].empty()) {
+    return 2;
+  }
+  return 0;
+}
@@ -15,6 +15,7 @@ function(add_phasar_unittest test_name)
     phasar_ifdside
     phasar_utils
     phasar_mono
+    phasar_syncpds
     phasar_db
     phasar_experimental
     # phasar_clang
@@ -64,7 +64,6 @@ int main(int argc, const char **argv) {
         WPA(DB, {"main"}, &P, &I, &H);
     WPA.solve();
     WPA.dumpResults();
-    WPA.releaseAllHelperAnalyses();
   } else {
     std::cerr << "error: file does not contain a 'main' function!\n";
   }
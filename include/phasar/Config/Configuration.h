@@ -58,6 +58,11 @@ public:
     return "compile_commands.json";
   }
 
+  /// Name of the file storing the declarative summaries of library functions.
+  static const std::string LibrarySummariesFileName() {
+    return "library_summaries_v1.json";
+  }
+
   /// Default Source- and Sink-Functions path
   static const std::string DefaultSourceSinkFunctionsPath() {
     return std::string(PhasarDirectory() +
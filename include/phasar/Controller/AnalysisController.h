@@ -10,7 +10,9 @@
 #ifndef PHASAR_CONTROLLER_ANALYSIS_CONTROLLER_H_
 #define PHASAR_CONTROLLER_ANALYSIS_CONTROLLER_H_
 
-#include <iosfwd>
+#include <fstream>
+#include <iostream>
+#include <memory>
 #include <set>
 #include <string>
 #include <vector>
@@ -18,6 +20,7 @@
 #include "boost/filesystem.hpp"
 
 #include "phasar/DB/ProjectIRDB.h"
+#include "phasar/PhasarLLVM/AnalysisStrategy/HelperAnalyses.h"
 #include "phasar/PhasarLLVM/AnalysisStrategy/Strategies.h"
 #include "phasar/PhasarLLVM/ControlFlow/LLVMBasedICFG.h"
 #include "phasar/PhasarLLVM/Pointer/LLVMPointsToInfo.h"
@@ -44,14 +47,16 @@ enum class AnalysisControllerEmitterOptions : uint32_t {
   EmitPTAAsText = (1 << 11),
   EmitPTAAsDot = (1 << 12),
   EmitPTAAsJson = (1 << 13),
+  EmitJsonReport = (1 << 14),
+  EmitSarifReport = (1 << 15),
+  EmitResultStore = (1 << 16),
 };
 
 class AnalysisController {
 private:
   ProjectIRDB &IRDB;
-  LLVMTypeHierarchy TH;
-  LLVMPointsToInfo PT;
-  LLVMBasedICFG ICF;
+  // the helper analyses are shared by all data-flow analyses
+  std::shared_ptr<HelperAnalyses<>> HA;
   std::vector<DataFlowAnalysisType> DataFlowAnalyses;
   std::vector<std::string> AnalysisConfigs;
   std::set<std::string> EntryPoints;
@@ -73,36 +78,135 @@ private:
 
   void executeWholeProgram();
 
+  void executeWholeProgramConcurrently(unsigned Jobs,
+                                       const std::string &AnalysisConfigPath);
+
+  /**
+   * @brief Runs a single data-flow analysis. RunName names the files that are
+   * written independently of ResultDir, such that they are unique per run.
+   */
+  void executeWholeProgram(DataFlowAnalysisType DataFlowAnalysis,
+                           const std::string &AnalysisConfigPath,
+                           const std::string &RunName,
+                           const boost::filesystem::path &ResultDir,
+                           std::ostream &OS);
+
   void emitRequestedHelperAnalysisResults();
 
-  template <typename T> void emitRequestedDataFlowResults(T &WPA) {
+  template <typename T>
+  void emitRequestedDataFlowResults(T &WPA,
+                                    DataFlowAnalysisType DataFlowAnalysis) {
+    emitRequestedDataFlowResults(WPA, to_string(DataFlowAnalysis),
+                                 ResultDirectory, std::cout);
+  }
+
+  /**
+   * @brief Emits the requested results of a data-flow analysis into ResultDir,
+   * or to OS if no result directory is given. The result store is named after
+   * RunName, such that the stores of several analyses do not overwrite each
+   * other.
+   */
+  template <typename T>
+  void emitRequestedDataFlowResults(T &WPA, const std::string &RunName,
+                                    const boost::filesystem::path &ResultDir,
+                                    std::ostream &OS) {
     if (EmitterOptions & AnalysisControllerEmitterOptions::EmitTextReport) {
-      if (!ResultDirectory.empty()) {
-        std::ofstream OFS(ResultDirectory.string() + "/psr-report.txt");
+      if (!ResultDir.empty()) {
+        std::ofstream OFS(ResultDir.string() + "/psr-report.txt");
         WPA.emitTextReport(OFS);
       } else {
-        WPA.emitTextReport();
+        WPA.emitTextReport(OS);
       }
     }
     if (EmitterOptions &
         AnalysisControllerEmitterOptions::EmitGraphicalReport) {
-      if (!ResultDirectory.empty()) {
-        std::ofstream OFS(ResultDirectory.string() + "/psr-report.html");
+      if (!ResultDir.empty()) {
+        std::ofstream OFS(ResultDir.string() + "/psr-report.html");
         WPA.emitGraphicalReport(OFS);
       } else {
-        WPA.emitGraphicalReport();
+        WPA.emitGraphicalReport(OS);
+      }
+    }
+    if (EmitterOptions & AnalysisControllerEmitterOptions::EmitJsonReport) {
+      if (!ResultDir.empty()) {
+        std::ofstream OFS(ResultDir.string() + "/psr-report.json");
+        WPA.emitJsonReport(OFS);
+      } else {
+        WPA.emitJsonReport(OS);
+      }
+    }
+    if (EmitterOptions & AnalysisControllerEmitterOptions::EmitSarifReport) {
+      if (!ResultDir.empty()) {
+        std::ofstream OFS(ResultDir.string() + "/psr-report.sarif");
+        WPA.emitSarifReport(OFS);
+      } else {
+        WPA.emitSarifReport(OS);
       }
     }
+    if (EmitterOptions & AnalysisControllerEmitterOptions::EmitResultStore) {
+      // a binary store is never written to the terminal
+      std::string Dir = ResultDir.empty() ? "." : ResultDir.string();
+      WPA.emitResultStore(Dir + "/" + RunName + "-psr-results.bin");
+    }
     if (EmitterOptions & AnalysisControllerEmitterOptions::EmitRawResults) {
-      if (!ResultDirectory.empty()) {
-        std::ofstream OFS(ResultDirectory.string() + "/psr-raw-results.txt");
+      if (!ResultDir.empty()) {
+        std::ofstream OFS(ResultDir.string() + "/psr-raw-results.txt");
         WPA.dumpResults(OFS);
       } else {
-        WPA.dumpResults();
+        WPA.dumpResults(OS);
       }
     }
   }
 
+  template <typename T>
+  void executeQueries(T &DDA,
+                      const std::vector<llvm::Instruction *> &QueryPoints) {
+    for (auto *QueryPoint : QueryPoints) {
+      DDA.addQueryPoint(QueryPoint);
+    }
+    DDA.solve();
+    if (!ResultDirectory.empty()) {
+      std::ofstream OFS(ResultDirectory.string() + "/psr-query-results.txt");
+      DDA.dumpQueryResults(OFS);
+    } else {
+      DDA.dumpQueryResults();
+    }
+  }
+
+  template <typename T>
+  void executeIncrementally(T &IUA, DataFlowAnalysisType DataFlowAnalysis) {
+    std::string StatePath = getIncrementalStatePath(DataFlowAnalysis);
+    IUA.loadPersistedRun(StatePath);
+    IUA.solve();
+    IUA.storePersistedRun(StatePath);
+    emitRequestedDataFlowResults(IUA, DataFlowAnalysis);
+  }
+
+  std::string getIncrementalStatePath(DataFlowAnalysisType DataFlowAnalysis);
+
+  template <typename T, typename... ArgTys>
+  void summarizeModules(DataFlowAnalysisType DataFlowAnalysis,
+                        ArgTys... Args) {
+    for (auto *M : IRDB.getAllModules()) {
+      // every module is summarized on its own, using its own helper analyses
+      ProjectIRDB ModuleIRDB({M}, IRDBOptions::NONE);
+      T MWA(ModuleIRDB, Args..., T::getModuleInterface(*M));
+      MWA.summarize();
+      MWA.storeSummaries(getModuleSummaryPath(*M, DataFlowAnalysis));
+    }
+  }
+
+  template <typename T>
+  void executeWithSummaries(T &MWA, DataFlowAnalysisType DataFlowAnalysis,
+                            const std::vector<std::string> &SummaryPaths) {
+    MWA.linkSummaries(SummaryPaths);
+    MWA.solve();
+    emitRequestedDataFlowResults(MWA, DataFlowAnalysis);
+  }
+
+  std::string getModuleSummaryPath(const llvm::Module &M,
+                                   DataFlowAnalysisType DataFlowAnalysis);
+
 public:
   AnalysisController(ProjectIRDB &IRDB,
                      std::vector<DataFlowAnalysisType> DataFlowAnalyses,
@@ -11,11 +11,12 @@
 #define PHASAR_DB_HEXASTORE_H_
 
 #include <array>
-#include <iosfwd>
+#include <ostream>
 #include <string>
 #include <vector>
 
-#include "boost/format.hpp"
+#include "llvm/ADT/STLExtras.h"
+#include "llvm/ADT/StringRef.h"
 
 #include "sqlite3.h"
 
@@ -66,12 +67,67 @@ struct hs_result {
  * @brief Efficient data structure for holding graphs in databases.
  */
 class Hexastore {
+public:
+  /**
+   * A forward-only cursor over the result rows of a query. The row data is
+   * only valid until the next call to next(), which allows to process
+   * arbitrarily large results in constant memory. A Cursor must not outlive
+   * the Hexastore that created it.
+   *
+   * @brief Streams the results of a query to the Hexastore.
+   */
+  class Cursor {
+  private:
+    Hexastore *HS;
+    sqlite3_stmt *Stmt;
+    unsigned Slot;
+    llvm::StringRef column(int Col) const;
+
+  public:
+    Cursor(Hexastore &HS, sqlite3_stmt *Stmt, unsigned Slot);
+    Cursor(Cursor &&Other) noexcept;
+    Cursor(const Cursor &) = delete;
+    Cursor &operator=(const Cursor &) = delete;
+    Cursor &operator=(Cursor &&) = delete;
+    ~Cursor();
+
+    /**
+     * Advances the cursor to the next row.
+     *
+     * @return False if there are no further rows, true otherwise.
+     */
+    bool next();
+    llvm::StringRef subject() const { return column(0); }
+    llvm::StringRef predicate() const { return column(1); }
+    llvm::StringRef object() const { return column(2); }
+    /// Copies the current row into an hs_result.
+    hs_result result() const;
+  };
+
+  /// Callback type used for streaming queries.
+  using RowCallback = llvm::function_ref<void(
+      llvm::StringRef subject, llvm::StringRef predicate,
+      llvm::StringRef object)>;
+
 private:
   sqlite3 *hs_internal_db;
+  /// Prepared counterparts of INSERT_PREPARED, compiled once per Hexastore.
+  std::array<sqlite3_stmt *, 18> InsertStmts{};
+  /// Prepared search queries that are currently not lent to a Cursor,
+  /// indexed by query pattern and an additional offset of 8 for prefix
+  /// queries.
+  std::array<sqlite3_stmt *, 16> SearchStmts{};
+  /// True while an explicit transaction opened by beginTransaction() is active.
+  bool InTransaction = false;
   static int callback(void *NotUsed, int argc, char **argv, char **azColName);
-  void doPut(std::string query, std::array<std::string, 3> edge);
+  void doPut(const std::array<std::string, 3> &edge);
+  void exec(const std::string &query);
+  void returnSearchStmt(sqlite3_stmt *Stmt, unsigned Slot);
 
 public:
+  /// Number of edges that putBatch() writes per transaction by default.
+  static constexpr size_t DefaultBatchSize = 10000;
+
   /**
    * If the given filename matches an already created Hexastore, no
    * new Hexastore will be created. Instead the already created Hexastore
@@ -79,14 +135,35 @@ public:
    *
    * @brief Constructs a Hexastore under the given filename.
    * @param filename Filename of the Hexastore.
+   * @param useWAL Switches the database to write-ahead logging, which trades
+   *        durability of the very last transactions for much cheaper commits.
    */
-  Hexastore(std::string filename);
+  Hexastore(std::string filename, bool useWAL = false);
+
+  Hexastore(const Hexastore &) = delete;
+  Hexastore &operator=(const Hexastore &) = delete;
 
   /**
-   * Destructor.
+   * Destructor. Commits a still pending transaction.
    */
   ~Hexastore();
 
+  /**
+   * Opens an explicit transaction. All subsequent puts are written to the
+   * database by a single fsync when commitTransaction() is called.
+   */
+  void beginTransaction();
+
+  /**
+   * Commits the transaction opened by beginTransaction().
+   */
+  void commitTransaction();
+
+  /**
+   * Discards all puts since the last call to beginTransaction().
+   */
+  void rollbackTransaction();
+
   /**
    * Adds the given tuple as a new entry to the Hexastore. It is not
    * possible to have duplicate entries in the Hexastore and
@@ -100,6 +177,19 @@ public:
    */
   void put(std::array<std::string, 3> edge);
 
+  /**
+   * Bulk-loads the given tuples into the Hexastore. The tuples are inserted
+   * using prepared statements and committed in transactions of batchSize
+   * tuples each. If a transaction has already been opened by
+   * beginTransaction(), the tuples become part of it instead.
+   *
+   * @brief Creates new entries in the Hexastore.
+   * @param edges New entries in the form of 3-tuples.
+   * @param batchSize Number of entries per transaction.
+   */
+  void putBatch(const std::vector<std::array<std::string, 3>> &edges,
+                size_t batchSize = DefaultBatchSize);
+
   /**
    * A query is always in the form of a 3-tuple (source, edge, destination)
    * where
@@ -117,6 +207,35 @@ public:
    */
   std::vector<hs_result> get(std::array<std::string, 3> edge_query,
                              size_t result_size_hint = 0);
+
+  /**
+   * Runs a query of the same form as get() through a prepared statement and
+   * returns a Cursor over its results instead of materializing them. If
+   * prefix is set, every fixed element of the query matches all entries that
+   * start with it, e.g. ("node_1", "?", "?") then also yields the edges of
+   * "node_19".
+   *
+   * @brief Query information from the Hexastore without materializing it.
+   * @param edge_query Query in the form of a 3-tuple.
+   * @param prefix Match fixed elements as prefixes.
+   * @return A Cursor positioned before the first result.
+   */
+  Cursor query(const std::array<std::string, 3> &edge_query,
+               bool prefix = false);
+
+  /**
+   * Streams the results of the given query to callback.
+   */
+  void forEach(const std::array<std::string, 3> &edge_query,
+               RowCallback callback, bool prefix = false);
+
+  /**
+   * Streams the results of several queries to callback, one query after the
+   * other. The prepared statements are reused across the queries.
+   */
+  void forEachBatch(
+      const std::vector<std::array<std::string, 3>> &edge_queries,
+      RowCallback callback, bool prefix = false);
 };
 
 } // namespace psr
@@ -10,6 +10,7 @@
 #ifndef PHASAR_DB_QUERIES_H_
 #define PHASAR_DB_QUERIES_H_
 
+#include <array>
 #include <string>
 
 namespace psr {
@@ -44,6 +45,29 @@ extern const std::string SEARCH_XXX;
 
 extern const std::string INIT;
 
+/// Parameterized, single-statement counterparts of the *_INSERT queries. They
+/// bind subject, predicate and object to ?1, ?2 and ?3 and are meant to be
+/// prepared once with sqlite3_prepare_v2() and re-bound for every edge.
+extern const std::array<std::string, 18> INSERT_PREPARED;
+
+extern const std::string BEGIN_TRANSACTION;
+
+extern const std::string COMMIT_TRANSACTION;
+
+extern const std::string ROLLBACK_TRANSACTION;
+
+extern const std::string ENABLE_WAL;
+
+/**
+ * Builds a parameterized search query for the given query pattern. The
+ * pattern is a bit mask of the fixed tuple elements where subject, predicate
+ * and object are represented by 4, 2 and 1, respectively. Fixed elements are
+ * bound to ?1, ?2 and ?3. If prefix is set, fixed elements are matched as
+ * prefixes against the half-open range [?1, ?4), [?2, ?5) and [?3, ?6),
+ * respectively, which keeps the lookups on the name indices.
+ */
+std::string getSearchQuery(unsigned pattern, bool prefix);
+
 } // namespace psr
 
 #endif
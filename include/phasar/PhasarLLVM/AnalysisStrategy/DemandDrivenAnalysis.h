@@ -10,9 +10,180 @@
 #ifndef PHASAR_PHASARLLVM_ANALYSISSTRATEGY_DEMANDDRIVENANALYSIS_H_
 #define PHASAR_PHASARLLVM_ANALYSISSTRATEGY_DEMANDDRIVENANALYSIS_H_
 
+#include <iostream>
+#include <memory>
+#include <set>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "phasar/DB/ProjectIRDB.h"
+#include "phasar/PhasarLLVM/AnalysisStrategy/AnalysisSetup.h"
+#include "phasar/PhasarLLVM/AnalysisStrategy/HelperAnalyses.h"
+#include "phasar/PhasarLLVM/DataFlowSolver/IfdsIde/Solver/DemandDrivenSolver.h"
+#include "phasar/PhasarLLVM/Utils/BinaryDomain.h"
+
 namespace psr {
 
-class DemandDrivenAnalysis {};
+/**
+ * Answers queries of the form "which facts hold at this statement?" by only
+ * exploring the part of the exploded super-graph that is relevant for the
+ * queried statements, see DemandDrivenSolver. Partial results are kept and
+ * reused by subsequent queries.
+ *
+ * Solver must be an IFDSSolver or IDESolver type.
+ */
+template <typename Solver, typename ProblemDescription,
+          typename Setup = psr::DefaultAnalysisSetup>
+class DemandDrivenAnalysis {
+  // Check if the solver is able to solve the given problem description
+  static_assert(
+      std::is_base_of_v<typename Solver::ProblemTy, ProblemDescription>,
+      "Problem description does not match solver type!");
+  // Check if the setup is a valid analysis setup
+  static_assert(std::is_base_of_v<psr::AnalysisSetup, Setup>,
+                "Setup is not a valid analysis setup!");
+
+public:
+  using n_t = typename Solver::n_t;
+  using d_t = typename Solver::d_t;
+  using l_t = typename Solver::l_t;
+
+private:
+  using TypeHierarchyTy = typename Setup::TypeHierarchyTy;
+  using PointerAnalysisTy = typename Setup::PointerAnalysisTy;
+  using CallGraphAnalysisTy = typename Setup::CallGraphAnalysisTy;
+  using HelperAnalysesTy = HelperAnalyses<Setup>;
+  using ConfigurationTy = typename ProblemDescription::ConfigurationTy;
+
+  ProjectIRDB &IRDB;
+  std::shared_ptr<HelperAnalysesTy> Helpers;
+  std::set<std::string> EntryPoints;
+  std::unique_ptr<ConfigurationTy> Config;
+  std::string ConfigPath;
+  ProblemDescription ProblemDesc;
+  DemandDrivenSolver<Solver> DataFlowSolver;
+  std::vector<n_t> QueryPoints;
+
+public:
+  /**
+   * @brief Runs the analysis on the helper analyses of the given context,
+   * which may be shared with other analyses.
+   */
+  explicit DemandDrivenAnalysis(std::shared_ptr<HelperAnalysesTy> Helpers)
+      : IRDB(Helpers->getProjectIRDB()), Helpers(Helpers),
+        EntryPoints(Helpers->getEntryPoints()),
+        ProblemDesc(&IRDB, &Helpers->getTypeHierarchy(), &Helpers->getICFG(),
+                    &Helpers->getPointsToInfo(), EntryPoints),
+        DataFlowSolver(ProblemDesc) {}
+
+  template <typename T = ProblemDescription,
+            typename = typename std::enable_if_t<!std::is_same_v<
+                typename T::ConfigurationTy, HasNoConfigurationType>>>
+  DemandDrivenAnalysis(std::shared_ptr<HelperAnalysesTy> Helpers,
+                       std::string ConfigPath)
+      : IRDB(Helpers->getProjectIRDB()), Helpers(Helpers),
+        EntryPoints(Helpers->getEntryPoints()),
+        Config(std::make_unique<ConfigurationTy>(ConfigPath)),
+        ConfigPath(ConfigPath),
+        ProblemDesc(&IRDB, &Helpers->getTypeHierarchy(), &Helpers->getICFG(),
+                    &Helpers->getPointsToInfo(), *Config, EntryPoints),
+        DataFlowSolver(ProblemDesc) {}
+
+  /**
+   * @brief Runs the analysis on the given helper analyses, which are not owned
+   * and must outlive the analysis. The ones that are nullptr are built for
+   * this analysis only.
+   */
+  DemandDrivenAnalysis(ProjectIRDB &IRDB,
+                       std::set<std::string> EntryPoints = {},
+                       PointerAnalysisTy *PointerInfo = nullptr,
+                       CallGraphAnalysisTy *CallGraph = nullptr,
+                       TypeHierarchyTy *TypeHierarchy = nullptr)
+      : DemandDrivenAnalysis(std::make_shared<HelperAnalysesTy>(
+              IRDB, std::move(EntryPoints), PointerInfo, CallGraph,
+              TypeHierarchy)) {}
+
+  template <typename T = ProblemDescription,
+            typename = typename std::enable_if_t<!std::is_same_v<
+                typename T::ConfigurationTy, HasNoConfigurationType>>>
+  DemandDrivenAnalysis(ProjectIRDB &IRDB, std::string ConfigPath,
+                       std::set<std::string> EntryPoints = {},
+                       PointerAnalysisTy *PointerInfo = nullptr,
+                       CallGraphAnalysisTy *CallGraph = nullptr,
+                       TypeHierarchyTy *TypeHierarchy = nullptr)
+      : DemandDrivenAnalysis(std::make_shared<HelperAnalysesTy>(
+              IRDB, std::move(EntryPoints), PointerInfo, CallGraph,
+              TypeHierarchy),
+            std::move(ConfigPath)) {}
+
+  /**
+   * @brief Adds a query point; call solve() to compute its results.
+   */
+  void addQueryPoint(n_t Stmt) {
+    QueryPoints.push_back(Stmt);
+    DataFlowSolver.addQueryPoint(Stmt);
+  }
+
+  void solve() { DataFlowSolver.solve(); }
+
+  void operator()() { solve(); }
+
+  l_t query(n_t Stmt, d_t Fact) { return DataFlowSolver.query(Stmt, Fact); }
+
+  std::unordered_map<d_t, l_t> queryResultsAt(n_t Stmt,
+                                              bool StripZero = false) {
+    return DataFlowSolver.queryResultsAt(Stmt, StripZero);
+  }
+
+  const std::vector<n_t> &getQueryPoints() const { return QueryPoints; }
+
+  DemandDrivenSolver<Solver> &getSolver() { return DataFlowSolver; }
+
+  /**
+   * @brief Prints the facts and values that hold at each query point.
+   */
+  void dumpQueryResults(std::ostream &OS = std::cout) {
+    for (n_t Stmt : QueryPoints) {
+      OS << "Query: " << ProblemDesc.NtoString(Stmt) << '\n';
+      for (const auto &[Fact, Value] : queryResultsAt(Stmt, true)) {
+        OS << "\tD: " << ProblemDesc.DtoString(Fact);
+        if constexpr (!std::is_same_v<l_t, BinaryDomain>) {
+          OS << " | V: " << ProblemDesc.LtoString(Value);
+        }
+        OS << '\n';
+      }
+    }
+  }
+
+  void dumpResults(std::ostream &OS = std::cout) {
+    DataFlowSolver.dumpResults(OS);
+  }
+
+  void emitTextReport(std::ostream &OS = std::cout) {
+    DataFlowSolver.emitTextReport(OS);
+  }
+
+  void emitGraphicalReport(std::ostream &OS = std::cout) {
+    DataFlowSolver.emitGraphicalReport(OS);
+  }
+
+  void emitJsonReport(std::ostream &OS = std::cout) {
+    DataFlowSolver.emitJsonReport(OS);
+  }
+
+  void emitSarifReport(std::ostream &OS = std::cout) {
+    DataFlowSolver.emitSarifReport(OS);
+  }
+
+  void emitResultStore(const std::string &Path) {
+    DataFlowSolver.emitResultStore(Path);
+  }
+
+  ConfigurationTy *releaseConfiguration() { return Config.release(); }
+};
 
 } // namespace psr
 
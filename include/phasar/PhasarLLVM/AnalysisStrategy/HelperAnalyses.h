@@ -0,0 +1,127 @@
+/******************************************************************************
+ * Copyright (c) 2019 Philipp Schubert.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Philipp Schubert and others
+ *****************************************************************************/
+
+#ifndef PHASAR_PHASARLLVM_ANALYSISSTRATEGY_HELPERANALYSES_H_
+#define PHASAR_PHASARLLVM_ANALYSISSTRATEGY_HELPERANALYSES_H_
+
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "phasar/DB/ProjectIRDB.h"
+#include "phasar/PhasarLLVM/AnalysisStrategy/AnalysisSetup.h"
+
+namespace psr {
+
+/**
+ * The helper analyses, i.e. the type hierarchy, the points-to information and
+ * the call graph, that the data-flow analyses on an IRDB are based on. Each
+ * helper analysis is built once, on first use, and lent to every analysis
+ * strategy the context is passed to. Strategies keep the context alive via a
+ * std::shared_ptr, hence it is destroyed together with the last analysis
+ * using it.
+ *
+ * Helper analyses that have been built elsewhere can be lent to the context
+ * as well; they are not owned and must outlive the context.
+ *
+ * Building the helper analyses is thread-safe, they are only read afterwards.
+ */
+template <typename Setup = psr::DefaultAnalysisSetup> class HelperAnalyses {
+  // Check if the setup is a valid analysis setup
+  static_assert(std::is_base_of_v<psr::AnalysisSetup, Setup>,
+                "Setup is not a valid analysis setup!");
+
+public:
+  using TypeHierarchyTy = typename Setup::TypeHierarchyTy;
+  using PointerAnalysisTy = typename Setup::PointerAnalysisTy;
+  using CallGraphAnalysisTy = typename Setup::CallGraphAnalysisTy;
+
+private:
+  ProjectIRDB &IRDB;
+  std::set<std::string> EntryPoints;
+  PointerAnalysisType PTATy;
+  CallGraphAnalysisType CGTy;
+  // the helper analyses built by this context
+  std::unique_ptr<TypeHierarchyTy> OwnedTypeHierarchy;
+  std::unique_ptr<PointerAnalysisTy> OwnedPointerInfo;
+  std::unique_ptr<CallGraphAnalysisTy> OwnedCallGraph;
+  // the helper analyses in use, either owned or lent to this context
+  TypeHierarchyTy *TypeHierarchy = nullptr;
+  PointerAnalysisTy *PointerInfo = nullptr;
+  CallGraphAnalysisTy *CallGraph = nullptr;
+  std::once_flag TypeHierarchyBuilt;
+  std::once_flag PointerInfoBuilt;
+  std::once_flag CallGraphBuilt;
+
+public:
+  HelperAnalyses(ProjectIRDB &IRDB, std::set<std::string> EntryPoints = {},
+                 PointerAnalysisType PTATy = PointerAnalysisType::CFLAnders,
+                 CallGraphAnalysisType CGTy = CallGraphAnalysisType::OTF)
+      : IRDB(IRDB), EntryPoints(std::move(EntryPoints)), PTATy(PTATy),
+        CGTy(CGTy) {}
+
+  /**
+   * @brief Lends the given helper analyses to the context, the ones that are
+   * nullptr are built on first use.
+   */
+  HelperAnalyses(ProjectIRDB &IRDB, std::set<std::string> EntryPoints,
+                 PointerAnalysisTy *PointerInfo,
+                 CallGraphAnalysisTy *CallGraph,
+                 TypeHierarchyTy *TypeHierarchy)
+      : HelperAnalyses(IRDB, std::move(EntryPoints)) {
+    this->TypeHierarchy = TypeHierarchy;
+    this->PointerInfo = PointerInfo;
+    this->CallGraph = CallGraph;
+  }
+
+  HelperAnalyses(const HelperAnalyses &) = delete;
+  HelperAnalyses &operator=(const HelperAnalyses &) = delete;
+
+  ProjectIRDB &getProjectIRDB() const { return IRDB; }
+
+  const std::set<std::string> &getEntryPoints() const { return EntryPoints; }
+
+  TypeHierarchyTy &getTypeHierarchy() {
+    std::call_once(TypeHierarchyBuilt, [this]() {
+      if (!TypeHierarchy) {
+        OwnedTypeHierarchy = std::make_unique<TypeHierarchyTy>(IRDB);
+        TypeHierarchy = OwnedTypeHierarchy.get();
+      }
+    });
+    return *TypeHierarchy;
+  }
+
+  PointerAnalysisTy &getPointsToInfo() {
+    std::call_once(PointerInfoBuilt, [this]() {
+      if (!PointerInfo) {
+        OwnedPointerInfo = std::make_unique<PointerAnalysisTy>(IRDB, PTATy);
+        PointerInfo = OwnedPointerInfo.get();
+      }
+    });
+    return *PointerInfo;
+  }
+
+  CallGraphAnalysisTy &getICFG() {
+    std::call_once(CallGraphBuilt, [this]() {
+      if (!CallGraph) {
+        OwnedCallGraph = std::make_unique<CallGraphAnalysisTy>(
+            IRDB, CGTy, EntryPoints, &getTypeHierarchy(), &getPointsToInfo());
+        CallGraph = OwnedCallGraph.get();
+      }
+    });
+    return *CallGraph;
+  }
+};
+
+} // namespace psr
+
+#endif
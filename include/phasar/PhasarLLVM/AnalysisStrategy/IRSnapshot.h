@@ -0,0 +1,152 @@
+/******************************************************************************
+ * Copyright (c) 2019 Philipp Schubert.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Philipp Schubert and others
+ *****************************************************************************/
+
+#ifndef PHASAR_PHASARLLVM_ANALYSISSTRATEGY_IRSNAPSHOT_H_
+#define PHASAR_PHASARLLVM_ANALYSISSTRATEGY_IRSNAPSHOT_H_
+
+#include <map>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace llvm {
+class Function;
+class GlobalValue;
+class Instruction;
+class Module;
+class Value;
+} // namespace llvm
+
+namespace psr {
+
+class ProjectIRDB;
+
+/**
+ * Captures the function definitions of a project in a form that can be
+ * compared against, and mapped onto, another version of the same project.
+ *
+ * Each function definition is fingerprinted by a structural hash of its body
+ * that ignores metadata (debug locations, PhASAR's value ids) and the names
+ * and numbering of local values, so that unrelated edits elsewhere in the
+ * project do not change it.
+ *
+ * Values are identified by stable ids that remain valid across versions as
+ * long as the function they belong to is unchanged:
+ *
+ *   i:<idx>:<function key>          the idx-th instruction of a function
+ *   a:<arg-no>:<function key>       a formal parameter
+ *   o:<idx>.<op-no>:<function key>  a constant operand of an instruction
+ *   g:<global key>                  a global variable or function
+ *
+ * The key of a global is its name, or <module identifier>:<name> if it has
+ * local linkage, since several modules may define local globals of the same
+ * name.
+ */
+class IRSnapshot {
+public:
+  struct Diff {
+    std::set<std::string> Added;
+    std::set<std::string> Removed;
+    std::set<std::string> Changed;
+    bool GlobalsChanged = false;
+
+    bool empty() const {
+      return Added.empty() && Removed.empty() && Changed.empty() &&
+             !GlobalsChanged;
+    }
+  };
+
+  explicit IRSnapshot(const ProjectIRDB &IRDB);
+
+  explicit IRSnapshot(const std::set<llvm::Module *> &Modules);
+
+  ~IRSnapshot() = default;
+
+  IRSnapshot(const IRSnapshot &) = delete;
+  IRSnapshot &operator=(const IRSnapshot &) = delete;
+
+  /**
+   * @brief Returns the key by which the given global variable or function is
+   * identified in a snapshot, see above.
+   */
+  static std::string getGlobalKey(const llvm::GlobalValue *G);
+
+  /**
+   * @brief Returns a structural hash of the given function definition.
+   */
+  static std::string getFunctionHash(const llvm::Function *F);
+
+  /**
+   * @brief Returns the hashes of all function definitions by key.
+   */
+  const std::map<std::string, std::string> &getFunctionHashes() const {
+    return FunctionHashes;
+  }
+
+  /**
+   * @brief Returns a hash over all global variable definitions.
+   */
+  const std::string &getGlobalsHash() const { return GlobalsHash; }
+
+  /**
+   * @brief Returns the hashes of all global variable definitions by key.
+   */
+  const std::map<std::string, std::string> &getGlobalHashes() const {
+    return GlobalHashes;
+  }
+
+  Diff diff(const std::map<std::string, std::string> &PreviousFunctionHashes,
+            const std::string &PreviousGlobalsHash) const;
+
+  /**
+   * @brief Returns the function definition of the given key or nullptr.
+   */
+  const llvm::Function *getFunction(const std::string &Key) const;
+
+  const llvm::Instruction *getInstruction(const llvm::Function *F,
+                                          unsigned Idx) const;
+
+  /**
+   * @brief Returns the position of I within its function.
+   */
+  unsigned getInstructionIndex(const llvm::Instruction *I) const;
+
+  /**
+   * @brief Returns the stable id of V or an empty string if V cannot be
+   * identified across versions.
+   */
+  std::string getStableId(const llvm::Value *V) const;
+
+  /**
+   * @brief Returns the value of the given stable id or nullptr.
+   */
+  const llvm::Value *getValue(const std::string &Id) const;
+
+  /**
+   * @brief Returns the key of the function a stable id refers into or an
+   * empty string for globals.
+   */
+  static std::string getFunctionNameOfId(const std::string &Id);
+
+private:
+  std::vector<const llvm::Module *> Modules;
+  std::map<std::string, const llvm::Function *> Functions;
+  std::unordered_map<const llvm::Function *,
+                     std::vector<const llvm::Instruction *>>
+      Instructions;
+  std::unordered_map<const llvm::Instruction *, unsigned> InstructionIndices;
+  std::map<std::string, std::string> FunctionHashes;
+  std::map<std::string, std::string> GlobalHashes;
+  std::string GlobalsHash;
+};
+
+} // namespace psr
+
+#endif
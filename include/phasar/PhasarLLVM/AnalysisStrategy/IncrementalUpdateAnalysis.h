@@ -10,9 +10,192 @@
 #ifndef PHASAR_PHASARLLVM_ANALYSISSTRATEGY_INCREMENTALUPDATEANALYSIS_H_
 #define PHASAR_PHASARLLVM_ANALYSISSTRATEGY_INCREMENTALUPDATEANALYSIS_H_
 
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <set>
+#include <string>
+#include <type_traits>
+#include <typeinfo>
+#include <utility>
+
+#include "boost/filesystem.hpp"
+
+#include "nlohmann/json.hpp"
+
+#include "phasar/DB/ProjectIRDB.h"
+#include "phasar/PhasarLLVM/AnalysisStrategy/AnalysisSetup.h"
+#include "phasar/PhasarLLVM/AnalysisStrategy/HelperAnalyses.h"
+#include "phasar/PhasarLLVM/AnalysisStrategy/IRSnapshot.h"
+#include "phasar/PhasarLLVM/DataFlowSolver/IfdsIde/Solver/IncrementalSolver.h"
+#include "phasar/Utils/Logger.h"
+
 namespace psr {
 
-class IncrementalUpdateAnalysis {};
+/**
+ * Re-analyzes a new version of a project by reusing the results of a run on a
+ * previous version that has been persisted via storePersistedRun(). Only the
+ * functions that (transitively) changed are solved again, see
+ * IncrementalSolver. The results are identical to a from-scratch run.
+ *
+ * Solver must be an IFDSSolver type.
+ */
+template <typename Solver, typename ProblemDescription,
+          typename Setup = psr::DefaultAnalysisSetup>
+class IncrementalUpdateAnalysis {
+  // Check if the solver is able to solve the given problem description
+  static_assert(
+      std::is_base_of_v<typename Solver::ProblemTy, ProblemDescription>,
+      "Problem description does not match solver type!");
+  // Check if the setup is a valid analysis setup
+  static_assert(std::is_base_of_v<psr::AnalysisSetup, Setup>,
+                "Setup is not a valid analysis setup!");
+
+private:
+  using TypeHierarchyTy = typename Setup::TypeHierarchyTy;
+  using PointerAnalysisTy = typename Setup::PointerAnalysisTy;
+  using CallGraphAnalysisTy = typename Setup::CallGraphAnalysisTy;
+  using HelperAnalysesTy = HelperAnalyses<Setup>;
+  using ConfigurationTy = typename ProblemDescription::ConfigurationTy;
+
+  ProjectIRDB &IRDB;
+  std::shared_ptr<HelperAnalysesTy> Helpers;
+  std::set<std::string> EntryPoints;
+  std::unique_ptr<ConfigurationTy> Config;
+  std::string ConfigPath;
+  ProblemDescription ProblemDesc;
+  IRSnapshot Snapshot;
+  IncrementalSolver<Solver> DataFlowSolver;
+
+  // identifies the analysis a persisted run belongs to
+  std::string getAnalysisKey() const {
+    return std::string(typeid(ProblemDescription).name()) + ":" + ConfigPath;
+  }
+
+public:
+  /**
+   * @brief Runs the analysis on the helper analyses of the given context,
+   * which may be shared with other analyses.
+   */
+  explicit IncrementalUpdateAnalysis(std::shared_ptr<HelperAnalysesTy> Helpers)
+      : IRDB(Helpers->getProjectIRDB()), Helpers(Helpers),
+        EntryPoints(Helpers->getEntryPoints()),
+        ProblemDesc(&IRDB, &Helpers->getTypeHierarchy(), &Helpers->getICFG(),
+                    &Helpers->getPointsToInfo(), EntryPoints),
+        Snapshot(IRDB), DataFlowSolver(ProblemDesc, Snapshot) {}
+
+  template <typename T = ProblemDescription,
+            typename = typename std::enable_if_t<!std::is_same_v<
+                typename T::ConfigurationTy, HasNoConfigurationType>>>
+  IncrementalUpdateAnalysis(std::shared_ptr<HelperAnalysesTy> Helpers,
+                            std::string ConfigPath)
+      : IRDB(Helpers->getProjectIRDB()), Helpers(Helpers),
+        EntryPoints(Helpers->getEntryPoints()),
+        Config(std::make_unique<ConfigurationTy>(ConfigPath)),
+        ConfigPath(ConfigPath),
+        ProblemDesc(&IRDB, &Helpers->getTypeHierarchy(), &Helpers->getICFG(),
+                    &Helpers->getPointsToInfo(), *Config, EntryPoints),
+        Snapshot(IRDB), DataFlowSolver(ProblemDesc, Snapshot) {}
+
+  /**
+   * @brief Runs the analysis on the given helper analyses, which are not owned
+   * and must outlive the analysis. The ones that are nullptr are built for
+   * this analysis only.
+   */
+  IncrementalUpdateAnalysis(ProjectIRDB &IRDB,
+                            std::set<std::string> EntryPoints = {},
+                            PointerAnalysisTy *PointerInfo = nullptr,
+                            CallGraphAnalysisTy *CallGraph = nullptr,
+                            TypeHierarchyTy *TypeHierarchy = nullptr)
+      : IncrementalUpdateAnalysis(std::make_shared<HelperAnalysesTy>(
+              IRDB, std::move(EntryPoints), PointerInfo, CallGraph,
+              TypeHierarchy)) {}
+
+  template <typename T = ProblemDescription,
+            typename = typename std::enable_if_t<!std::is_same_v<
+                typename T::ConfigurationTy, HasNoConfigurationType>>>
+  IncrementalUpdateAnalysis(ProjectIRDB &IRDB, std::string ConfigPath,
+                            std::set<std::string> EntryPoints = {},
+                            PointerAnalysisTy *PointerInfo = nullptr,
+                            CallGraphAnalysisTy *CallGraph = nullptr,
+                            TypeHierarchyTy *TypeHierarchy = nullptr)
+      : IncrementalUpdateAnalysis(std::make_shared<HelperAnalysesTy>(
+              IRDB, std::move(EntryPoints), PointerInfo, CallGraph,
+              TypeHierarchy),
+            std::move(ConfigPath)) {}
+
+  /**
+   * @brief Loads the run persisted at the given path. Returns false if there
+   * is no usable previous run, in which case solve() starts from scratch.
+   */
+  bool loadPersistedRun(const std::string &Path) {
+    auto &lg = lg::get();
+    if (!boost::filesystem::exists(Path)) {
+      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, INFO)
+                    << "No previous run found at: " << Path);
+      return false;
+    }
+    std::ifstream IFS(Path);
+    nlohmann::json J = nlohmann::json::parse(IFS, nullptr, false);
+    if (J.is_discarded() || !J.is_object() ||
+        J.value("analysis", std::string()) != getAnalysisKey()) {
+      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, WARNING)
+                    << "Ignore incompatible previous run: " << Path);
+      return false;
+    }
+    DataFlowSolver.setPreviousRun(std::move(J));
+    return true;
+  }
+
+  /**
+   * @brief Persists this run such that the next version can be analyzed
+   * incrementally. Throws std::ios_base::failure if the file could not be
+   * written.
+   */
+  void storePersistedRun(const std::string &Path) {
+    nlohmann::json J = DataFlowSolver.getAsPersistedRun();
+    J["analysis"] = getAnalysisKey();
+    std::ofstream OFS(Path);
+    if (!OFS.is_open()) {
+      throw std::ios_base::failure("could not write file: " + Path);
+    }
+    OFS << J << '\n';
+  }
+
+  void solve() { DataFlowSolver.solve(); }
+
+  void operator()() { solve(); }
+
+  IncrementalSolver<Solver> &getSolver() { return DataFlowSolver; }
+
+  const IRSnapshot &getSnapshot() const { return Snapshot; }
+
+  void dumpResults(std::ostream &OS = std::cout) {
+    DataFlowSolver.dumpResults(OS);
+  }
+
+  void emitTextReport(std::ostream &OS = std::cout) {
+    DataFlowSolver.emitTextReport(OS);
+  }
+
+  void emitGraphicalReport(std::ostream &OS = std::cout) {
+    DataFlowSolver.emitGraphicalReport(OS);
+  }
+
+  void emitJsonReport(std::ostream &OS = std::cout) {
+    DataFlowSolver.emitJsonReport(OS);
+  }
+
+  void emitSarifReport(std::ostream &OS = std::cout) {
+    DataFlowSolver.emitSarifReport(OS);
+  }
+
+  void emitResultStore(const std::string &Path) {
+    DataFlowSolver.emitResultStore(Path);
+  }
+
+  ConfigurationTy *releaseConfiguration() { return Config.release(); }
+};
 
 } // namespace psr
 
@@ -10,9 +10,314 @@
 #ifndef PHASAR_PHASARLLVM_ANALYSISSTRATEGY_MODULEWISEANALYSIS_H_
 #define PHASAR_PHASARLLVM_ANALYSISSTRATEGY_MODULEWISEANALYSIS_H_
 
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <type_traits>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+
+#include "nlohmann/json.hpp"
+
+#include "llvm/IR/Function.h"
+#include "llvm/IR/Module.h"
+
+#include "phasar/DB/ProjectIRDB.h"
+#include "phasar/PhasarLLVM/AnalysisStrategy/AnalysisSetup.h"
+#include "phasar/PhasarLLVM/AnalysisStrategy/HelperAnalyses.h"
+#include "phasar/PhasarLLVM/AnalysisStrategy/IRSnapshot.h"
+#include "phasar/PhasarLLVM/DataFlowSolver/IfdsIde/IDESummary.h"
+#include "phasar/PhasarLLVM/DataFlowSolver/IfdsIde/Solver/IncrementalSolver.h"
+#include "phasar/Utils/Logger.h"
+
 namespace psr {
 
-class ModuleWiseAnalysis {};
+/**
+ * Analyzes a project compositionally. Each module is summarized on its own,
+ * e.g. in a separate process, via summarize() and storeSummaries(): the end
+ * summaries of every function that is visible outside the module are
+ * computed for the zero fact and each formal parameter and persisted to a
+ * compact (CBOR) file.
+ *
+ * A whole-program run links these files via linkSummaries() before solve().
+ * Whenever the solver enters a summarized function with a summarized entry
+ * fact, the persisted end summaries are applied instead of re-entering the
+ * function's module, see IncrementalSolver. A summary is ignored if the
+ * function changed, if its callees differ in the whole program, or if it
+ * calls a function that has been a mere declaration in its own module, such
+ * that the results are identical to a whole-program analysis.
+ *
+ * Solver must be an IFDSSolver type.
+ */
+template <typename Solver, typename ProblemDescription,
+          typename Setup = psr::DefaultAnalysisSetup>
+class ModuleWiseAnalysis {
+  // Check if the solver is able to solve the given problem description
+  static_assert(
+      std::is_base_of_v<typename Solver::ProblemTy, ProblemDescription>,
+      "Problem description does not match solver type!");
+  // Check if the setup is a valid analysis setup
+  static_assert(std::is_base_of_v<psr::AnalysisSetup, Setup>,
+                "Setup is not a valid analysis setup!");
+
+public:
+  static constexpr unsigned FormatVersion = 1;
+
+private:
+  using TypeHierarchyTy = typename Setup::TypeHierarchyTy;
+  using PointerAnalysisTy = typename Setup::PointerAnalysisTy;
+  using CallGraphAnalysisTy = typename Setup::CallGraphAnalysisTy;
+  using HelperAnalysesTy = HelperAnalyses<Setup>;
+  using ConfigurationTy = typename ProblemDescription::ConfigurationTy;
+
+  ProjectIRDB &IRDB;
+  std::shared_ptr<HelperAnalysesTy> Helpers;
+  std::set<std::string> EntryPoints;
+  std::unique_ptr<ConfigurationTy> Config;
+  std::string ConfigPath;
+  ProblemDescription ProblemDesc;
+  IRSnapshot Snapshot;
+  std::map<std::string, IDESummary> Summaries;
+  std::unique_ptr<IncrementalSolver<Solver>> DataFlowSolver;
+
+  // identifies the analysis a summary belongs to
+  std::string getAnalysisKey() const {
+    return std::string(typeid(ProblemDescription).name()) + ":" + ConfigPath;
+  }
+
+  // the linked summaries in the form of a previous run of IncrementalSolver
+  nlohmann::json getLinkedRun() const {
+    nlohmann::json J;
+    J["version"] = IncrementalSolver<Solver>::FormatVersion;
+    // the global variables have been checked by linkSummaries()
+    J["globals"] = Snapshot.getGlobalsHash();
+    J["functions"] = nlohmann::json::object();
+    for (const auto &[Name, Summary] : Summaries) {
+      J["functions"][Name] = Summary.getAsJson();
+    }
+    return J;
+  }
+
+  void solveWith(IFDSIDESolverConfig SolverConfig) {
+    ProblemDesc.setIFDSIDESolverConfig(SolverConfig);
+    DataFlowSolver =
+        std::make_unique<IncrementalSolver<Solver>>(ProblemDesc, Snapshot);
+    DataFlowSolver->setPreviousRun(getLinkedRun());
+    DataFlowSolver->solve();
+  }
+
+public:
+  /**
+   * @brief Runs the analysis on the helper analyses of the given context,
+   * which may be shared with other analyses.
+   */
+  explicit ModuleWiseAnalysis(std::shared_ptr<HelperAnalysesTy> Helpers)
+      : IRDB(Helpers->getProjectIRDB()), Helpers(Helpers),
+        EntryPoints(Helpers->getEntryPoints()),
+        ProblemDesc(&IRDB, &Helpers->getTypeHierarchy(), &Helpers->getICFG(),
+                    &Helpers->getPointsToInfo(), EntryPoints),
+        Snapshot(IRDB) {}
+
+  template <typename T = ProblemDescription,
+            typename = typename std::enable_if_t<!std::is_same_v<
+                typename T::ConfigurationTy, HasNoConfigurationType>>>
+  ModuleWiseAnalysis(std::shared_ptr<HelperAnalysesTy> Helpers,
+                     std::string ConfigPath)
+      : IRDB(Helpers->getProjectIRDB()), Helpers(Helpers),
+        EntryPoints(Helpers->getEntryPoints()),
+        Config(std::make_unique<ConfigurationTy>(ConfigPath)),
+        ConfigPath(ConfigPath),
+        ProblemDesc(&IRDB, &Helpers->getTypeHierarchy(), &Helpers->getICFG(),
+                    &Helpers->getPointsToInfo(), *Config, EntryPoints),
+        Snapshot(IRDB) {}
+
+  /**
+   * @brief Runs the analysis on the given helper analyses, which are not owned
+   * and must outlive the analysis. The ones that are nullptr are built for
+   * this analysis only.
+   */
+  ModuleWiseAnalysis(ProjectIRDB &IRDB, std::set<std::string> EntryPoints = {},
+                     PointerAnalysisTy *PointerInfo = nullptr,
+                     CallGraphAnalysisTy *CallGraph = nullptr,
+                     TypeHierarchyTy *TypeHierarchy = nullptr)
+      : ModuleWiseAnalysis(std::make_shared<HelperAnalysesTy>(
+              IRDB, std::move(EntryPoints), PointerInfo, CallGraph,
+              TypeHierarchy)) {}
+
+  template <typename T = ProblemDescription,
+            typename = typename std::enable_if_t<!std::is_same_v<
+                typename T::ConfigurationTy, HasNoConfigurationType>>>
+  ModuleWiseAnalysis(ProjectIRDB &IRDB, std::string ConfigPath,
+                     std::set<std::string> EntryPoints = {},
+                     PointerAnalysisTy *PointerInfo = nullptr,
+                     CallGraphAnalysisTy *CallGraph = nullptr,
+                     TypeHierarchyTy *TypeHierarchy = nullptr)
+      : ModuleWiseAnalysis(std::make_shared<HelperAnalysesTy>(
+              IRDB, std::move(EntryPoints), PointerInfo, CallGraph,
+              TypeHierarchy),
+            std::move(ConfigPath)) {}
+
+  /**
+   * @brief Returns the names of the functions that a module defines and that
+   * can be called from other modules, i.e. the entry points to summarize.
+   */
+  static std::set<std::string> getModuleInterface(const llvm::Module &M) {
+    std::set<std::string> Interface;
+    for (const auto &F : M) {
+      if (!F.isDeclaration() && !F.hasLocalLinkage()) {
+        Interface.insert(F.getName().str());
+      }
+    }
+    return Interface;
+  }
+
+  /**
+   * @brief Links the summaries persisted at the given paths. Files that are
+   * missing, malformed or belong to another analysis are skipped, as are
+   * modules whose global variables are defined differently in this project.
+   * Returns the number of linked files.
+   */
+  size_t linkSummaries(const std::vector<std::string> &Paths) {
+    auto &lg = lg::get();
+    size_t NumLinked = 0;
+    for (const auto &Path : Paths) {
+      std::ifstream IFS(Path, std::ios::binary);
+      if (!IFS.is_open()) {
+        LOG_IF_ENABLE(BOOST_LOG_SEV(lg, WARNING)
+                      << "Could not read module summaries: " << Path);
+        continue;
+      }
+      std::vector<std::uint8_t> Bytes((std::istreambuf_iterator<char>(IFS)),
+                                      std::istreambuf_iterator<char>());
+      try {
+        nlohmann::json J = nlohmann::json::from_cbor(Bytes);
+        if (J.at("version").template get<unsigned>() != FormatVersion ||
+            J.at("analysis").template get<std::string>() != getAnalysisKey()) {
+          LOG_IF_ENABLE(BOOST_LOG_SEV(lg, WARNING)
+                        << "Ignore incompatible module summaries: " << Path);
+          continue;
+        }
+        bool GlobalsMatch = true;
+        for (const auto &[Name, Hash] : J.at("globals").items()) {
+          auto Search = Snapshot.getGlobalHashes().find(Name);
+          if (Search != Snapshot.getGlobalHashes().end() &&
+              Search->second != Hash.template get<std::string>()) {
+            GlobalsMatch = false;
+          }
+        }
+        if (!GlobalsMatch) {
+          LOG_IF_ENABLE(BOOST_LOG_SEV(lg, WARNING)
+                        << "Ignore module summaries of changed global "
+                           "variables: "
+                        << Path);
+          continue;
+        }
+        std::map<std::string, IDESummary> ModuleSummaries;
+        for (const auto &[Name, JF] : J.at("functions").items()) {
+          ModuleSummaries.emplace(Name, IDESummary(Name, JF));
+        }
+        // functions defined in several modules, e.g. inline functions, are
+        // summarized by whichever module is linked first
+        Summaries.insert(ModuleSummaries.begin(), ModuleSummaries.end());
+        ++NumLinked;
+      } catch (const nlohmann::json::exception &E) {
+        LOG_IF_ENABLE(BOOST_LOG_SEV(lg, WARNING)
+                      << "Ignore malformed module summaries: " << Path << ": "
+                      << E.what());
+      }
+    }
+    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, INFO)
+                  << "Linked " << Summaries.size() << " function summaries of "
+                  << NumLinked << " module(s)");
+    return NumLinked;
+  }
+
+  /**
+   * @brief Computes the summaries of the entry points, which usually are the
+   * module's interface. Summaries linked before are reused.
+   */
+  void summarize() {
+    IFDSIDESolverConfig SolverConfig = ProblemDesc.getIFDSIDESolverConfig();
+    SolverConfig.computePersistedSummaries = true;
+    SolverConfig.computeValues = false;
+    solveWith(SolverConfig);
+  }
+
+  /**
+   * @brief Persists the summaries computed by summarize(). Throws
+   * std::ios_base::failure if the file could not be written.
+   */
+  void storeSummaries(const std::string &Path) {
+    nlohmann::json Run = DataFlowSolver->getAsPersistedRun();
+    nlohmann::json J;
+    J["version"] = FormatVersion;
+    J["analysis"] = getAnalysisKey();
+    J["globals"] = Snapshot.getGlobalHashes();
+    J["functions"] = nlohmann::json::object();
+    for (auto &[Name, JF] : Run["functions"].items()) {
+      // functions that have not been reached cannot be applied anyway
+      if (!JF["contexts"].empty()) {
+        J["functions"][Name] = std::move(JF);
+      }
+    }
+    std::vector<std::uint8_t> Bytes = nlohmann::json::to_cbor(J);
+    std::ofstream OFS(Path, std::ios::binary);
+    if (!OFS.is_open()) {
+      throw std::ios_base::failure("could not write file: " + Path);
+    }
+    OFS.write(reinterpret_cast<const char *>(Bytes.data()), Bytes.size());
+  }
+
+  /**
+   * @brief Solves the problem while applying the linked summaries.
+   */
+  void solve() { solveWith(ProblemDesc.getIFDSIDESolverConfig()); }
+
+  void operator()() { solve(); }
+
+  /**
+   * @brief Returns the solver of the last call to summarize() or solve().
+   */
+  IncrementalSolver<Solver> &getSolver() { return *DataFlowSolver; }
+
+  const std::map<std::string, IDESummary> &getLinkedSummaries() const {
+    return Summaries;
+  }
+
+  const IRSnapshot &getSnapshot() const { return Snapshot; }
+
+  void dumpResults(std::ostream &OS = std::cout) {
+    DataFlowSolver->dumpResults(OS);
+  }
+
+  void emitTextReport(std::ostream &OS = std::cout) {
+    DataFlowSolver->emitTextReport(OS);
+  }
+
+  void emitGraphicalReport(std::ostream &OS = std::cout) {
+    DataFlowSolver->emitGraphicalReport(OS);
+  }
+
+  void emitJsonReport(std::ostream &OS = std::cout) {
+    DataFlowSolver->emitJsonReport(OS);
+  }
+
+  void emitSarifReport(std::ostream &OS = std::cout) {
+    DataFlowSolver->emitSarifReport(OS);
+  }
+
+  void emitResultStore(const std::string &Path) {
+    DataFlowSolver->emitResultStore(Path);
+  }
+
+  ConfigurationTy *releaseConfiguration() { return Config.release(); }
+};
 
 } // namespace psr
 
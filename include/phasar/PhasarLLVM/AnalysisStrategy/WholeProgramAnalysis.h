@@ -19,6 +19,7 @@
 
 #include "phasar/DB/ProjectIRDB.h"
 #include "phasar/PhasarLLVM/AnalysisStrategy/AnalysisSetup.h"
+#include "phasar/PhasarLLVM/AnalysisStrategy/HelperAnalyses.h"
 
 namespace psr {
 
@@ -37,12 +38,11 @@ private:
   using TypeHierarchyTy = typename Setup::TypeHierarchyTy;
   using PointerAnalysisTy = typename Setup::PointerAnalysisTy;
   using CallGraphAnalysisTy = typename Setup::CallGraphAnalysisTy;
+  using HelperAnalysesTy = HelperAnalyses<Setup>;
   using ConfigurationTy = typename ProblemDescription::ConfigurationTy;
 
   ProjectIRDB &IRDB;
-  std::unique_ptr<TypeHierarchyTy> TypeHierarchy;
-  std::unique_ptr<PointerAnalysisTy> PointerInfo;
-  std::unique_ptr<CallGraphAnalysisTy> CallGraph;
+  std::shared_ptr<HelperAnalysesTy> Helpers;
   std::set<std::string> EntryPoints;
   std::unique_ptr<ConfigurationTy> Config;
   std::string ConfigPath;
@@ -50,26 +50,55 @@ private:
   Solver DataFlowSolver;
 
 public:
+  /**
+   * @brief Runs the analysis on the helper analyses of the given context,
+   * which may be shared with other analyses.
+   */
+  explicit WholeProgramAnalysis(std::shared_ptr<HelperAnalysesTy> Helpers)
+      : IRDB(Helpers->getProjectIRDB()), Helpers(Helpers),
+        EntryPoints(Helpers->getEntryPoints()),
+        ProblemDesc(&IRDB, &Helpers->getTypeHierarchy(), &Helpers->getICFG(),
+                    &Helpers->getPointsToInfo(), EntryPoints),
+        DataFlowSolver(ProblemDesc) {}
+
+  template <typename T = ProblemDescription,
+            typename = typename std::enable_if_t<!std::is_same_v<
+                typename T::ConfigurationTy, HasNoConfigurationType>>>
+  WholeProgramAnalysis(std::shared_ptr<HelperAnalysesTy> Helpers,
+                       ConfigurationTy *Config)
+      : IRDB(Helpers->getProjectIRDB()), Helpers(Helpers),
+        EntryPoints(Helpers->getEntryPoints()),
+        Config(std::unique_ptr<ConfigurationTy>(Config)), ConfigPath(""),
+        ProblemDesc(&IRDB, &Helpers->getTypeHierarchy(), &Helpers->getICFG(),
+                    &Helpers->getPointsToInfo(), *Config, EntryPoints),
+        DataFlowSolver(ProblemDesc) {}
+
+  template <typename T = ProblemDescription,
+            typename = typename std::enable_if_t<!std::is_same_v<
+                typename T::ConfigurationTy, HasNoConfigurationType>>>
+  WholeProgramAnalysis(std::shared_ptr<HelperAnalysesTy> Helpers,
+                       std::string ConfigPath)
+      : IRDB(Helpers->getProjectIRDB()), Helpers(Helpers),
+        EntryPoints(Helpers->getEntryPoints()),
+        Config(std::make_unique<ConfigurationTy>(ConfigPath)),
+        ConfigPath(ConfigPath),
+        ProblemDesc(&IRDB, &Helpers->getTypeHierarchy(), &Helpers->getICFG(),
+                    &Helpers->getPointsToInfo(), *Config, EntryPoints),
+        DataFlowSolver(ProblemDesc) {}
+
+  /**
+   * @brief Runs the analysis on the given helper analyses, which are not owned
+   * and must outlive the analysis. The ones that are nullptr are built for
+   * this analysis only.
+   */
   WholeProgramAnalysis(ProjectIRDB &IRDB,
                        std::set<std::string> EntryPoints = {},
                        PointerAnalysisTy *PointerInfo = nullptr,
                        CallGraphAnalysisTy *CallGraph = nullptr,
                        TypeHierarchyTy *TypeHierarchy = nullptr)
-      : IRDB(IRDB),
-        TypeHierarchy(TypeHierarchy == nullptr
-                          ? std::make_unique<TypeHierarchyTy>(IRDB)
-                          : std::unique_ptr<TypeHierarchyTy>(TypeHierarchy)),
-        PointerInfo(PointerInfo == nullptr
-                        ? std::make_unique<PointerAnalysisTy>(IRDB)
-                        : std::unique_ptr<PointerAnalysisTy>(PointerInfo)),
-        CallGraph(CallGraph == nullptr
-                      ? std::make_unique<CallGraphAnalysisTy>(
-                            IRDB, CallGraphAnalysisType::OTF, EntryPoints,
-                            this->TypeHierarchy.get(), this->PointerInfo.get())
-                      : std::unique_ptr<CallGraphAnalysisTy>(CallGraph)),
-        EntryPoints(EntryPoints),
-        ProblemDesc(&IRDB, TypeHierarchy, CallGraph, PointerInfo, EntryPoints),
-        DataFlowSolver(ProblemDesc) {}
+      : WholeProgramAnalysis(std::make_shared<HelperAnalysesTy>(
+              IRDB, std::move(EntryPoints), PointerInfo, CallGraph,
+              TypeHierarchy)) {}
 
   template <typename T = ProblemDescription,
             typename = typename std::enable_if_t<!std::is_same_v<
@@ -79,23 +108,10 @@ public:
                        PointerAnalysisTy *PointerInfo = nullptr,
                        CallGraphAnalysisTy *CallGraph = nullptr,
                        TypeHierarchyTy *TypeHierarchy = nullptr)
-      : IRDB(IRDB),
-        TypeHierarchy(TypeHierarchy == nullptr
-                          ? std::make_unique<TypeHierarchyTy>(IRDB)
-                          : std::unique_ptr<TypeHierarchyTy>(TypeHierarchy)),
-        PointerInfo(PointerInfo == nullptr
-                        ? std::make_unique<PointerAnalysisTy>(IRDB)
-                        : std::unique_ptr<PointerAnalysisTy>(PointerInfo)),
-        CallGraph(CallGraph == nullptr
-                      ? std::make_unique<CallGraphAnalysisTy>(
-                            IRDB, CallGraphAnalysisType::OTF, EntryPoints,
-                            this->TypeHierarchy.get(), this->PointerInfo.get())
-                      : std::unique_ptr<CallGraphAnalysisTy>(CallGraph)),
-        EntryPoints(EntryPoints),
-        Config(std::unique_ptr<ConfigurationTy>(Config)), ConfigPath(""),
-        ProblemDesc(&IRDB, TypeHierarchy, CallGraph, PointerInfo, *Config,
-                    EntryPoints),
-        DataFlowSolver(ProblemDesc) {}
+      : WholeProgramAnalysis(std::make_shared<HelperAnalysesTy>(
+              IRDB, std::move(EntryPoints), PointerInfo, CallGraph,
+              TypeHierarchy),
+            Config) {}
 
   template <typename T = ProblemDescription,
             typename = typename std::enable_if_t<!std::is_same_v<
@@ -105,23 +121,10 @@ public:
                        PointerAnalysisTy *PointerInfo = nullptr,
                        CallGraphAnalysisTy *CallGraph = nullptr,
                        TypeHierarchyTy *TypeHierarchy = nullptr)
-      : IRDB(IRDB),
-        TypeHierarchy(TypeHierarchy == nullptr
-                          ? std::make_unique<TypeHierarchyTy>(IRDB)
-                          : std::unique_ptr<TypeHierarchyTy>(TypeHierarchy)),
-        PointerInfo(PointerInfo == nullptr
-                        ? std::make_unique<PointerAnalysisTy>(IRDB)
-                        : std::unique_ptr<PointerAnalysisTy>(PointerInfo)),
-        CallGraph(CallGraph == nullptr
-                      ? std::make_unique<CallGraphAnalysisTy>(
-                            IRDB, CallGraphAnalysisType::OTF, EntryPoints,
-                            this->TypeHierarchy.get(), this->PointerInfo.get())
-                      : std::unique_ptr<CallGraphAnalysisTy>(CallGraph)),
-        EntryPoints(EntryPoints),
-        Config(std::make_unique<ConfigurationTy>(ConfigPath)),
-        ConfigPath(ConfigPath), ProblemDesc(&IRDB, TypeHierarchy, CallGraph,
-                                            PointerInfo, *Config, EntryPoints),
-        DataFlowSolver(ProblemDesc) {}
+      : WholeProgramAnalysis(std::make_shared<HelperAnalysesTy>(
+              IRDB, std::move(EntryPoints), PointerInfo, CallGraph,
+              TypeHierarchy),
+            std::move(ConfigPath)) {}
 
   void solve() { DataFlowSolver.solve(); }
 
@@ -139,19 +142,17 @@ public:
     DataFlowSolver.emitGraphicalReport(OS);
   }
 
-  void releaseAllHelperAnalyses() {
-    releasePointerInformation();
-    releaseCallGraph();
-    releaseTypeHierarchy();
+  void emitJsonReport(std::ostream &OS = std::cout) {
+    DataFlowSolver.emitJsonReport(OS);
   }
 
-  PointerAnalysisTy *releasePointerInformation() {
-    return PointerInfo.release();
+  void emitSarifReport(std::ostream &OS = std::cout) {
+    DataFlowSolver.emitSarifReport(OS);
   }
 
-  CallGraphAnalysisTy *releaseCallGraph() { return CallGraph.release(); }
-
-  TypeHierarchyTy *releaseTypeHierarchy() { return TypeHierarchy.release(); }
+  void emitResultStore(const std::string &Path) {
+    DataFlowSolver.emitResultStore(Path);
+  }
 
   ConfigurationTy *releaseConfiguration() { return Config.release(); }
 };
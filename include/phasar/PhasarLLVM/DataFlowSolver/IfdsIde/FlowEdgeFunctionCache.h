@@ -21,6 +21,7 @@
 #include "phasar/PhasarLLVM/DataFlowSolver/IfdsIde/ZeroedFlowFunction.h"
 #include "phasar/Utils/Logger.h"
 #include "phasar/Utils/PAMMMacros.h"
+#include "phasar/Utils/TraceRecorder.h"
 
 namespace psr {
 
@@ -47,6 +48,8 @@ private:
       ReturnFlowFunctionCache;
   std::map<std::tuple<N, N, std::set<F>>, std::shared_ptr<FlowFunction<D>>>
       CallToRetFlowFunctionCache;
+  std::map<std::tuple<N, F>, std::shared_ptr<FlowFunction<D>>>
+      SummaryFlowFunctionCache;
   // Caches for the edge functions
   std::map<std::tuple<N, D, N, D>, std::shared_ptr<EdgeFunction<L>>>
       NormalEdgeFunctionCache;
@@ -58,6 +61,17 @@ private:
       CallToRetEdgeFunctionCache;
   std::map<std::tuple<N, D, N, D>, std::shared_ptr<EdgeFunction<L>>>
       SummaryEdgeFunctionCache;
+  // Optional recorder for sampled flow/edge function construction events
+  TraceRecorder *Trace = nullptr;
+
+  std::string traceDetailOfStmt(N n) const {
+    return problem.getICFG()->getFunctionName(
+        problem.getICFG()->getFunctionOf(n));
+  }
+
+  std::string traceDetailOfFunction(F f) const {
+    return problem.getICFG()->getFunctionName(f);
+  }
 
 public:
   // Ctor allows access to the IDEProblem in order to get access to flow and
@@ -79,8 +93,8 @@ public:
     REG_COUNTER("CallToRet-FF Construction", 0, PAMM_SEVERITY_LEVEL::Full);
     REG_COUNTER("CallToRet-FF Cache Hit", 0, PAMM_SEVERITY_LEVEL::Full);
     // Counters for the summary flow functions
-    // REG_COUNTER("Summary-FF Construction", 0, PAMM_SEVERITY_LEVEL::Full);
-    // REG_COUNTER("Summary-FF Cache Hit", 0, PAMM_SEVERITY_LEVEL::Full);
+    REG_COUNTER("Summary-FF Construction", 0, PAMM_SEVERITY_LEVEL::Full);
+    REG_COUNTER("Summary-FF Cache Hit", 0, PAMM_SEVERITY_LEVEL::Full);
     // Counters for the normal edge functions
     REG_COUNTER("Normal-EF Construction", 0, PAMM_SEVERITY_LEVEL::Full);
     REG_COUNTER("Normal-EF Cache Hit", 0, PAMM_SEVERITY_LEVEL::Full);
@@ -104,61 +118,77 @@ public:
 
   FlowEdgeFunctionCache(FlowEdgeFunctionCache &&FEFC) = default;
 
+  /**
+   * @brief Records the construction of flow and edge functions to the given
+   * recorder; nullptr disables tracing.
+   */
+  void setTraceRecorder(TraceRecorder *Recorder) { Trace = Recorder; }
+
   std::shared_ptr<FlowFunction<D>> getNormalFlowFunction(N curr, N succ) {
     PAMM_GET_INSTANCE;
-    auto &lg = lg::get();
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                  << "Normal flow function factory call");
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                  << "(N) Curr Inst : " << problem.NtoString(curr));
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                  << "(N) Succ Inst : " << problem.NtoString(succ));
+    PHASAR_LOG_LEVEL_CAT(DEBUG, FlowEdgeFunctionCache,
+                         "Normal flow function factory call");
+    PHASAR_LOG_LEVEL_CAT(DEBUG, FlowEdgeFunctionCache,
+                         "(N) Curr Inst : " << problem.NtoString(curr));
+    PHASAR_LOG_LEVEL_CAT(DEBUG, FlowEdgeFunctionCache,
+                         "(N) Succ Inst : " << problem.NtoString(succ));
     auto key = std::tie(curr, succ);
     if (NormalFlowFunctionCache.count(key)) {
-      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                    << "Flow function fetched from cache");
-      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << ' ');
+      PHASAR_LOG_LEVEL_CAT(DEBUG, FlowEdgeFunctionCache,
+                           "Flow function fetched from cache");
+      PHASAR_LOG_LEVEL_CAT(DEBUG, FlowEdgeFunctionCache, ' ');
       INC_COUNTER("Normal-FF Cache Hit", 1, PAMM_SEVERITY_LEVEL::Full);
       return NormalFlowFunctionCache.at(key);
     } else {
       INC_COUNTER("Normal-FF Construction", 1, PAMM_SEVERITY_LEVEL::Full);
+      TraceRecorder::Scope TS(Trace, "Normal-FF Construction",
+                              "flow function");
+      if (TS) {
+        TS.setDetail(traceDetailOfStmt(curr));
+      }
       auto ff = (autoAddZero)
                     ? std::make_shared<ZeroedFlowFunction<D>>(
                           problem.getNormalFlowFunction(curr, succ), zeroValue)
                     : problem.getNormalFlowFunction(curr, succ);
       NormalFlowFunctionCache.insert(make_pair(key, ff));
-      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << "Flow function constructed");
-      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << ' ');
+      PHASAR_LOG_LEVEL_CAT(DEBUG, FlowEdgeFunctionCache,
+                           "Flow function constructed");
+      PHASAR_LOG_LEVEL_CAT(DEBUG, FlowEdgeFunctionCache, ' ');
       return ff;
     }
   }
 
   std::shared_ptr<FlowFunction<D>> getCallFlowFunction(N callStmt, F destFun) {
     PAMM_GET_INSTANCE;
-    auto &lg = lg::get();
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                  << "Call flow function factory call");
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                  << "(N) Call Stmt : " << problem.NtoString(callStmt));
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                  << "(F) Dest Fun : " << problem.FtoString(destFun));
+    PHASAR_LOG_LEVEL_CAT(DEBUG, FlowEdgeFunctionCache,
+                         "Call flow function factory call");
+    PHASAR_LOG_LEVEL_CAT(DEBUG, FlowEdgeFunctionCache,
+                         "(N) Call Stmt : " << problem.NtoString(callStmt));
+    PHASAR_LOG_LEVEL_CAT(DEBUG, FlowEdgeFunctionCache,
+                         "(F) Dest Fun : " << problem.FtoString(destFun));
     auto key = std::tie(callStmt, destFun);
     if (CallFlowFunctionCache.count(key)) {
-      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                    << "Flow function fetched from cache");
-      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << ' ');
+      PHASAR_LOG_LEVEL_CAT(DEBUG, FlowEdgeFunctionCache,
+                           "Flow function fetched from cache");
+      PHASAR_LOG_LEVEL_CAT(DEBUG, FlowEdgeFunctionCache, ' ');
       INC_COUNTER("Call-FF Cache Hit", 1, PAMM_SEVERITY_LEVEL::Full);
       return CallFlowFunctionCache.at(key);
     } else {
       INC_COUNTER("Call-FF Construction", 1, PAMM_SEVERITY_LEVEL::Full);
+      TraceRecorder::Scope TS(Trace, "Call-FF Construction",
+                              "flow function");
+      if (TS) {
+        TS.setDetail(traceDetailOfFunction(destFun));
+      }
       auto ff =
           (autoAddZero)
               ? std::make_shared<ZeroedFlowFunction<D>>(
                     problem.getCallFlowFunction(callStmt, destFun), zeroValue)
               : problem.getCallFlowFunction(callStmt, destFun);
       CallFlowFunctionCache.insert(std::make_pair(key, ff));
-      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << "Flow function constructed");
-      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << ' ');
+      PHASAR_LOG_LEVEL_CAT(DEBUG, FlowEdgeFunctionCache,
+                           "Flow function constructed");
+      PHASAR_LOG_LEVEL_CAT(DEBUG, FlowEdgeFunctionCache, ' ');
       return ff;
     }
   }
@@ -166,26 +196,30 @@ public:
   std::shared_ptr<FlowFunction<D>> getRetFlowFunction(N callSite, F calleeFun,
                                                       N exitStmt, N retSite) {
     PAMM_GET_INSTANCE;
-    auto &lg = lg::get();
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                  << "Return flow function factory call");
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                  << "(N) Call Site : " << problem.NtoString(callSite));
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                  << "(F) Callee    : " << problem.FtoString(calleeFun));
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                  << "(N) Exit Stmt : " << problem.NtoString(exitStmt));
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                  << "(N) Ret Site  : " << problem.NtoString(retSite));
+    PHASAR_LOG_LEVEL_CAT(DEBUG, FlowEdgeFunctionCache,
+                         "Return flow function factory call");
+    PHASAR_LOG_LEVEL_CAT(DEBUG, FlowEdgeFunctionCache,
+                         "(N) Call Site : " << problem.NtoString(callSite));
+    PHASAR_LOG_LEVEL_CAT(DEBUG, FlowEdgeFunctionCache,
+                         "(F) Callee    : " << problem.FtoString(calleeFun));
+    PHASAR_LOG_LEVEL_CAT(DEBUG, FlowEdgeFunctionCache,
+                         "(N) Exit Stmt : " << problem.NtoString(exitStmt));
+    PHASAR_LOG_LEVEL_CAT(DEBUG, FlowEdgeFunctionCache,
+                         "(N) Ret Site  : " << problem.NtoString(retSite));
     auto key = std::tie(callSite, calleeFun, exitStmt, retSite);
     if (ReturnFlowFunctionCache.count(key)) {
-      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                    << "Flow function fetched from cache");
-      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << ' ');
+      PHASAR_LOG_LEVEL_CAT(DEBUG, FlowEdgeFunctionCache,
+                           "Flow function fetched from cache");
+      PHASAR_LOG_LEVEL_CAT(DEBUG, FlowEdgeFunctionCache, ' ');
       INC_COUNTER("Return-FF Cache Hit", 1, PAMM_SEVERITY_LEVEL::Full);
       return ReturnFlowFunctionCache.at(key);
     } else {
       INC_COUNTER("Return-FF Construction", 1, PAMM_SEVERITY_LEVEL::Full);
+      TraceRecorder::Scope TS(Trace, "Return-FF Construction",
+                              "flow function");
+      if (TS) {
+        TS.setDetail(traceDetailOfFunction(calleeFun));
+      }
       auto ff = (autoAddZero) ? std::make_shared<ZeroedFlowFunction<D>>(
                                     problem.getRetFlowFunction(
                                         callSite, calleeFun, exitStmt, retSite),
@@ -193,8 +227,9 @@ public:
                               : problem.getRetFlowFunction(callSite, calleeFun,
                                                            exitStmt, retSite);
       ReturnFlowFunctionCache.insert(std::make_pair(key, ff));
-      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << "Flow function constructed");
-      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << ' ');
+      PHASAR_LOG_LEVEL_CAT(DEBUG, FlowEdgeFunctionCache,
+                           "Flow function constructed");
+      PHASAR_LOG_LEVEL_CAT(DEBUG, FlowEdgeFunctionCache, ' ');
       return ff;
     }
   }
@@ -202,27 +237,31 @@ public:
   std::shared_ptr<FlowFunction<D>>
   getCallToRetFlowFunction(N callSite, N retSite, std::set<F> callees) {
     PAMM_GET_INSTANCE;
-    auto &lg = lg::get();
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                  << "Call-to-Return flow function factory call");
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                  << "(N) Call Site : " << problem.NtoString(callSite));
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                  << "(N) Ret Site  : " << problem.NtoString(retSite));
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << "(F) Callee's  : ");
+    PHASAR_LOG_LEVEL_CAT(DEBUG, FlowEdgeFunctionCache,
+                         "Call-to-Return flow function factory call");
+    PHASAR_LOG_LEVEL_CAT(DEBUG, FlowEdgeFunctionCache,
+                         "(N) Call Site : " << problem.NtoString(callSite));
+    PHASAR_LOG_LEVEL_CAT(DEBUG, FlowEdgeFunctionCache,
+                         "(N) Ret Site  : " << problem.NtoString(retSite));
+    PHASAR_LOG_LEVEL_CAT(DEBUG, FlowEdgeFunctionCache, "(F) Callee's  : ");
     for (auto callee : callees) {
-      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                    << "  " << problem.FtoString(callee));
+      PHASAR_LOG_LEVEL_CAT(DEBUG, FlowEdgeFunctionCache,
+                           "  " << problem.FtoString(callee));
     }
     auto key = std::tie(callSite, retSite, callees);
     if (CallToRetFlowFunctionCache.count(key)) {
-      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                    << "Flow function fetched from cache");
-      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << ' ');
+      PHASAR_LOG_LEVEL_CAT(DEBUG, FlowEdgeFunctionCache,
+                           "Flow function fetched from cache");
+      PHASAR_LOG_LEVEL_CAT(DEBUG, FlowEdgeFunctionCache, ' ');
       INC_COUNTER("CallToRet-FF Cache Hit", 1, PAMM_SEVERITY_LEVEL::Full);
       return CallToRetFlowFunctionCache.at(key);
     } else {
       INC_COUNTER("CallToRet-FF Construction", 1, PAMM_SEVERITY_LEVEL::Full);
+      TraceRecorder::Scope TS(Trace, "CallToRet-FF Construction",
+                              "flow function");
+      if (TS) {
+        TS.setDetail(traceDetailOfStmt(callSite));
+      }
       auto ff =
           (autoAddZero)
               ? std::make_shared<ZeroedFlowFunction<D>>(
@@ -231,55 +270,72 @@ public:
                     zeroValue)
               : problem.getCallToRetFlowFunction(callSite, retSite, callees);
       CallToRetFlowFunctionCache.insert(std::make_pair(key, ff));
-      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << "Flow function constructed");
-      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << ' ');
+      PHASAR_LOG_LEVEL_CAT(DEBUG, FlowEdgeFunctionCache,
+                           "Flow function constructed");
+      PHASAR_LOG_LEVEL_CAT(DEBUG, FlowEdgeFunctionCache, ' ');
       return ff;
     }
   }
 
   std::shared_ptr<FlowFunction<D>> getSummaryFlowFunction(N callStmt,
                                                           F destFun) {
-    // PAMM_GET_INSTANCE;
-    // INC_COUNTER("Summary-FF Construction", 1, PAMM_SEVERITY_LEVEL::Full);
-    auto &lg = lg::get();
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                  << "Summary flow function factory call");
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                  << "(N) Call Stmt : " << problem.NtoString(callStmt));
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                  << "(F) Dest Mthd : " << problem.FtoString(destFun));
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << ' ');
+    PAMM_GET_INSTANCE;
+    PHASAR_LOG_LEVEL_CAT(DEBUG, FlowEdgeFunctionCache,
+                         "Summary flow function factory call");
+    PHASAR_LOG_LEVEL_CAT(DEBUG, FlowEdgeFunctionCache,
+                         "(N) Call Stmt : " << problem.NtoString(callStmt));
+    PHASAR_LOG_LEVEL_CAT(DEBUG, FlowEdgeFunctionCache,
+                         "(F) Dest Mthd : " << problem.FtoString(destFun));
+    PHASAR_LOG_LEVEL_CAT(DEBUG, FlowEdgeFunctionCache, ' ');
+    // summaries are queried for every fact that reaches the call site and may
+    // be compiled for it, e.g. from declarative library summaries
+    auto key = std::tie(callStmt, destFun);
+    if (SummaryFlowFunctionCache.count(key)) {
+      INC_COUNTER("Summary-FF Cache Hit", 1, PAMM_SEVERITY_LEVEL::Full);
+      return SummaryFlowFunctionCache.at(key);
+    }
+    INC_COUNTER("Summary-FF Construction", 1, PAMM_SEVERITY_LEVEL::Full);
+    TraceRecorder::Scope TS(Trace, "Summary-FF Construction", "flow function");
+    if (TS) {
+      TS.setDetail(traceDetailOfFunction(destFun));
+    }
     auto ff = problem.getSummaryFlowFunction(callStmt, destFun);
+    SummaryFlowFunctionCache.insert(std::make_pair(key, ff));
     return ff;
   }
 
   std::shared_ptr<EdgeFunction<L>> getNormalEdgeFunction(N curr, D currNode,
                                                          N succ, D succNode) {
     PAMM_GET_INSTANCE;
-    auto &lg = lg::get();
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                  << "Normal edge function factory call");
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                  << "(N) Curr Inst : " << problem.NtoString(curr));
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                  << "(D) Curr Node : " << problem.DtoString(currNode));
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                  << "(N) Succ Inst : " << problem.NtoString(succ));
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                  << "(D) Succ Node : " << problem.DtoString(succNode));
+    PHASAR_LOG_LEVEL_CAT(DEBUG, FlowEdgeFunctionCache,
+                         "Normal edge function factory call");
+    PHASAR_LOG_LEVEL_CAT(DEBUG, FlowEdgeFunctionCache,
+                         "(N) Curr Inst : " << problem.NtoString(curr));
+    PHASAR_LOG_LEVEL_CAT(DEBUG, FlowEdgeFunctionCache,
+                         "(D) Curr Node : " << problem.DtoString(currNode));
+    PHASAR_LOG_LEVEL_CAT(DEBUG, FlowEdgeFunctionCache,
+                         "(N) Succ Inst : " << problem.NtoString(succ));
+    PHASAR_LOG_LEVEL_CAT(DEBUG, FlowEdgeFunctionCache,
+                         "(D) Succ Node : " << problem.DtoString(succNode));
     auto key = std::tie(curr, currNode, succ, succNode);
     if (NormalEdgeFunctionCache.count(key)) {
       INC_COUNTER("Normal-EF Cache Hit", 1, PAMM_SEVERITY_LEVEL::Full);
-      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                    << "Edge function fetched from cache");
-      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << ' ');
+      PHASAR_LOG_LEVEL_CAT(DEBUG, FlowEdgeFunctionCache,
+                           "Edge function fetched from cache");
+      PHASAR_LOG_LEVEL_CAT(DEBUG, FlowEdgeFunctionCache, ' ');
       return NormalEdgeFunctionCache.at(key);
     } else {
       INC_COUNTER("Normal-EF Construction", 1, PAMM_SEVERITY_LEVEL::Full);
+      TraceRecorder::Scope TS(Trace, "Normal-EF Construction",
+                              "edge function");
+      if (TS) {
+        TS.setDetail(traceDetailOfStmt(curr));
+      }
       auto ef = problem.getNormalEdgeFunction(curr, currNode, succ, succNode);
       NormalEdgeFunctionCache.insert(std::make_pair(key, ef));
-      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << "Edge function constructed");
-      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << ' ');
+      PHASAR_LOG_LEVEL_CAT(DEBUG, FlowEdgeFunctionCache,
+                           "Edge function constructed");
+      PHASAR_LOG_LEVEL_CAT(DEBUG, FlowEdgeFunctionCache, ' ');
       return ef;
     }
   }
@@ -288,32 +344,37 @@ public:
                                                        F destinationFunction,
                                                        D destNode) {
     PAMM_GET_INSTANCE;
-    auto &lg = lg::get();
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                  << "Call edge function factory call");
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                  << "(N) Call Stmt : " << problem.NtoString(callStmt));
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                  << "(D) Src Node  : " << problem.DtoString(srcNode));
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                  << "(F) Dest Fun : "
-                  << problem.FtoString(destinationFunction));
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                  << "(D) Dest Node : " << problem.DtoString(destNode));
+    PHASAR_LOG_LEVEL_CAT(DEBUG, FlowEdgeFunctionCache,
+                         "Call edge function factory call");
+    PHASAR_LOG_LEVEL_CAT(DEBUG, FlowEdgeFunctionCache,
+                         "(N) Call Stmt : " << problem.NtoString(callStmt));
+    PHASAR_LOG_LEVEL_CAT(DEBUG, FlowEdgeFunctionCache,
+                         "(D) Src Node  : " << problem.DtoString(srcNode));
+    PHASAR_LOG_LEVEL_CAT(DEBUG, FlowEdgeFunctionCache,
+                         "(F) Dest Fun : "
+                         << problem.FtoString(destinationFunction));
+    PHASAR_LOG_LEVEL_CAT(DEBUG, FlowEdgeFunctionCache,
+                         "(D) Dest Node : " << problem.DtoString(destNode));
     auto key = std::tie(callStmt, srcNode, destinationFunction, destNode);
     if (CallEdgeFunctionCache.count(key)) {
       INC_COUNTER("Call-EF Cache Hit", 1, PAMM_SEVERITY_LEVEL::Full);
-      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                    << "Edge function fetched from cache");
-      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << ' ');
+      PHASAR_LOG_LEVEL_CAT(DEBUG, FlowEdgeFunctionCache,
+                           "Edge function fetched from cache");
+      PHASAR_LOG_LEVEL_CAT(DEBUG, FlowEdgeFunctionCache, ' ');
       return CallEdgeFunctionCache.at(key);
     } else {
       INC_COUNTER("Call-EF Construction", 1, PAMM_SEVERITY_LEVEL::Full);
+      TraceRecorder::Scope TS(Trace, "Call-EF Construction",
+                              "edge function");
+      if (TS) {
+        TS.setDetail(traceDetailOfFunction(destinationFunction));
+      }
       auto ef = problem.getCallEdgeFunction(callStmt, srcNode,
                                             destinationFunction, destNode);
       CallEdgeFunctionCache.insert(std::make_pair(key, ef));
-      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << "Edge function constructed");
-      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << ' ');
+      PHASAR_LOG_LEVEL_CAT(DEBUG, FlowEdgeFunctionCache,
+                           "Edge function constructed");
+      PHASAR_LOG_LEVEL_CAT(DEBUG, FlowEdgeFunctionCache, ' ');
       return ef;
     }
   }
@@ -323,36 +384,42 @@ public:
                                                          N exitStmt, D exitNode,
                                                          N reSite, D retNode) {
     PAMM_GET_INSTANCE;
-    auto &lg = lg::get();
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                  << "Return edge function factory call");
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                  << "(N) Call Site : " << problem.NtoString(callSite));
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                  << "(F) Callee    : " << problem.FtoString(calleeFunction));
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                  << "(N) Exit Stmt : " << problem.NtoString(exitStmt));
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                  << "(D) Exit Node : " << problem.DtoString(exitNode));
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                  << "(N) Ret Site  : " << problem.NtoString(reSite));
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                  << "(D) Ret Node  : " << problem.DtoString(retNode));
+    PHASAR_LOG_LEVEL_CAT(DEBUG, FlowEdgeFunctionCache,
+                         "Return edge function factory call");
+    PHASAR_LOG_LEVEL_CAT(DEBUG, FlowEdgeFunctionCache,
+                         "(N) Call Site : " << problem.NtoString(callSite));
+    PHASAR_LOG_LEVEL_CAT(DEBUG, FlowEdgeFunctionCache,
+                         "(F) Callee    : "
+                         << problem.FtoString(calleeFunction));
+    PHASAR_LOG_LEVEL_CAT(DEBUG, FlowEdgeFunctionCache,
+                         "(N) Exit Stmt : " << problem.NtoString(exitStmt));
+    PHASAR_LOG_LEVEL_CAT(DEBUG, FlowEdgeFunctionCache,
+                         "(D) Exit Node : " << problem.DtoString(exitNode));
+    PHASAR_LOG_LEVEL_CAT(DEBUG, FlowEdgeFunctionCache,
+                         "(N) Ret Site  : " << problem.NtoString(reSite));
+    PHASAR_LOG_LEVEL_CAT(DEBUG, FlowEdgeFunctionCache,
+                         "(D) Ret Node  : " << problem.DtoString(retNode));
     auto key =
         std::tie(callSite, calleeFunction, exitStmt, exitNode, reSite, retNode);
     if (ReturnEdgeFunctionCache.count(key)) {
       INC_COUNTER("Return-EF Cache Hit", 1, PAMM_SEVERITY_LEVEL::Full);
-      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                    << "Edge function fetched from cache");
-      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << ' ');
+      PHASAR_LOG_LEVEL_CAT(DEBUG, FlowEdgeFunctionCache,
+                           "Edge function fetched from cache");
+      PHASAR_LOG_LEVEL_CAT(DEBUG, FlowEdgeFunctionCache, ' ');
       return ReturnEdgeFunctionCache.at(key);
     } else {
       INC_COUNTER("Return-EF Construction", 1, PAMM_SEVERITY_LEVEL::Full);
+      TraceRecorder::Scope TS(Trace, "Return-EF Construction",
+                              "edge function");
+      if (TS) {
+        TS.setDetail(traceDetailOfFunction(calleeFunction));
+      }
       auto ef = problem.getReturnEdgeFunction(
           callSite, calleeFunction, exitStmt, exitNode, reSite, retNode);
       ReturnEdgeFunctionCache.insert(std::make_pair(key, ef));
-      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << "Edge function constructed");
-      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << ' ');
+      PHASAR_LOG_LEVEL_CAT(DEBUG, FlowEdgeFunctionCache,
+                           "Edge function constructed");
+      PHASAR_LOG_LEVEL_CAT(DEBUG, FlowEdgeFunctionCache, ' ');
       return ef;
     }
   }
@@ -361,36 +428,41 @@ public:
   getCallToRetEdgeFunction(N callSite, D callNode, N retSite, D retSiteNode,
                            std::set<F> callees) {
     PAMM_GET_INSTANCE;
-    auto &lg = lg::get();
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                  << "Call-to-Return edge function factory call");
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                  << "(N) Call Site : " << problem.NtoString(callSite));
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                  << "(D) Call Node : " << problem.DtoString(callNode));
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                  << "(N) Ret Site  : " << problem.NtoString(retSite));
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                  << "(D) Ret Node  : " << problem.DtoString(retSiteNode));
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << "(F) Callee's  : ");
+    PHASAR_LOG_LEVEL_CAT(DEBUG, FlowEdgeFunctionCache,
+                         "Call-to-Return edge function factory call");
+    PHASAR_LOG_LEVEL_CAT(DEBUG, FlowEdgeFunctionCache,
+                         "(N) Call Site : " << problem.NtoString(callSite));
+    PHASAR_LOG_LEVEL_CAT(DEBUG, FlowEdgeFunctionCache,
+                         "(D) Call Node : " << problem.DtoString(callNode));
+    PHASAR_LOG_LEVEL_CAT(DEBUG, FlowEdgeFunctionCache,
+                         "(N) Ret Site  : " << problem.NtoString(retSite));
+    PHASAR_LOG_LEVEL_CAT(DEBUG, FlowEdgeFunctionCache,
+                         "(D) Ret Node  : " << problem.DtoString(retSiteNode));
+    PHASAR_LOG_LEVEL_CAT(DEBUG, FlowEdgeFunctionCache, "(F) Callee's  : ");
     for (auto callee : callees) {
-      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                    << "  " << problem.FtoString(callee));
+      PHASAR_LOG_LEVEL_CAT(DEBUG, FlowEdgeFunctionCache,
+                           "  " << problem.FtoString(callee));
     }
     auto key = std::tie(callSite, callNode, retSite, retSiteNode);
     if (CallToRetEdgeFunctionCache.count(key)) {
       INC_COUNTER("CallToRet-EF Cache Hit", 1, PAMM_SEVERITY_LEVEL::Full);
-      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                    << "Edge function fetched from cache");
-      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << ' ');
+      PHASAR_LOG_LEVEL_CAT(DEBUG, FlowEdgeFunctionCache,
+                           "Edge function fetched from cache");
+      PHASAR_LOG_LEVEL_CAT(DEBUG, FlowEdgeFunctionCache, ' ');
       return CallToRetEdgeFunctionCache.at(key);
     } else {
       INC_COUNTER("CallToRet-EF Construction", 1, PAMM_SEVERITY_LEVEL::Full);
+      TraceRecorder::Scope TS(Trace, "CallToRet-EF Construction",
+                              "edge function");
+      if (TS) {
+        TS.setDetail(traceDetailOfStmt(callSite));
+      }
       auto ef = problem.getCallToRetEdgeFunction(callSite, callNode, retSite,
                                                  retSiteNode, callees);
       CallToRetEdgeFunctionCache.insert(std::make_pair(key, ef));
-      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << "Edge function constructed");
-      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << ' ');
+      PHASAR_LOG_LEVEL_CAT(DEBUG, FlowEdgeFunctionCache,
+                           "Edge function constructed");
+      PHASAR_LOG_LEVEL_CAT(DEBUG, FlowEdgeFunctionCache, ' ');
       return ef;
     }
   }
@@ -398,135 +470,141 @@ public:
   std::shared_ptr<EdgeFunction<L>>
   getSummaryEdgeFunction(N callSite, D callNode, N retSite, D retSiteNode) {
     PAMM_GET_INSTANCE;
-    auto &lg = lg::get();
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                  << "Summary edge function factory call");
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                  << "(N) Call Site : " << problem.NtoString(callSite));
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                  << "(D) Call Node : " << problem.DtoString(callNode));
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                  << "(N) Ret Site  : " << problem.NtoString(retSite));
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                  << "(D) Ret Node  : " << problem.DtoString(retSiteNode));
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << ' ');
+    PHASAR_LOG_LEVEL_CAT(DEBUG, FlowEdgeFunctionCache,
+                         "Summary edge function factory call");
+    PHASAR_LOG_LEVEL_CAT(DEBUG, FlowEdgeFunctionCache,
+                         "(N) Call Site : " << problem.NtoString(callSite));
+    PHASAR_LOG_LEVEL_CAT(DEBUG, FlowEdgeFunctionCache,
+                         "(D) Call Node : " << problem.DtoString(callNode));
+    PHASAR_LOG_LEVEL_CAT(DEBUG, FlowEdgeFunctionCache,
+                         "(N) Ret Site  : " << problem.NtoString(retSite));
+    PHASAR_LOG_LEVEL_CAT(DEBUG, FlowEdgeFunctionCache,
+                         "(D) Ret Node  : " << problem.DtoString(retSiteNode));
+    PHASAR_LOG_LEVEL_CAT(DEBUG, FlowEdgeFunctionCache, ' ');
     auto key = std::tie(callSite, callNode, retSite, retSiteNode);
     if (SummaryEdgeFunctionCache.count(key)) {
       INC_COUNTER("Summary-EF Cache Hit", 1, PAMM_SEVERITY_LEVEL::Full);
-      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                    << "Edge function fetched from cache");
-      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << ' ');
+      PHASAR_LOG_LEVEL_CAT(DEBUG, FlowEdgeFunctionCache,
+                           "Edge function fetched from cache");
+      PHASAR_LOG_LEVEL_CAT(DEBUG, FlowEdgeFunctionCache, ' ');
       return SummaryEdgeFunctionCache.at(key);
     } else {
       INC_COUNTER("Summary-EF Construction", 1, PAMM_SEVERITY_LEVEL::Full);
+      TraceRecorder::Scope TS(Trace, "Summary-EF Construction",
+                              "edge function");
+      if (TS) {
+        TS.setDetail(traceDetailOfStmt(callSite));
+      }
       auto ef = problem.getSummaryEdgeFunction(callSite, callNode, retSite,
                                                retSiteNode);
       SummaryEdgeFunctionCache.insert(std::make_pair(key, ef));
-      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << "Edge function constructed");
-      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << ' ');
+      PHASAR_LOG_LEVEL_CAT(DEBUG, FlowEdgeFunctionCache,
+                           "Edge function constructed");
+      PHASAR_LOG_LEVEL_CAT(DEBUG, FlowEdgeFunctionCache, ' ');
       return ef;
     }
   }
 
   void print() {
-    auto &lg = lg::get();
     if constexpr (PAMM_CURR_SEV_LEVEL >= PAMM_SEVERITY_LEVEL::Full) {
       PAMM_GET_INSTANCE;
-      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, INFO)
-                    << "=== Flow-Edge-Function Cache Statistics ===");
-      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, INFO)
-                    << "Normal-flow function cache hits: "
-                    << GET_COUNTER("Normal-FF Cache Hit"));
-      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, INFO)
-                    << "Normal-flow function constructions: "
-                    << GET_COUNTER("Normal-FF Construction"));
-      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, INFO)
-                    << "Call-flow function cache hits: "
-                    << GET_COUNTER("Call-FF Cache Hit"));
-      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, INFO)
-                    << "Call-flow function constructions: "
-                    << GET_COUNTER("Call-FF Construction"));
-      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, INFO)
-                    << "Return-flow function cache hits: "
-                    << GET_COUNTER("Return-FF Cache Hit"));
-      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, INFO)
-                    << "Return-flow function constructions: "
-                    << GET_COUNTER("Return-FF Construction"));
-      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, INFO)
-                    << "Call-to-Return-flow function cache hits: "
-                    << GET_COUNTER("CallToRet-FF Cache Hit"));
-      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, INFO)
-                    << "Call-to-Return-flow function constructions: "
-                    << GET_COUNTER("CallToRet-FF Construction"));
-      // LOG_IF_ENABLE(BOOST_LOG_SEV(lg, INFO) << "Summary-flow function cache
-      // hits: "
-      //                        << GET_COUNTER("Summary-FF Cache Hit"));
-      // LOG_IF_ENABLE(BOOST_LOG_SEV(lg, INFO) << "Summary-flow function
-      // constructions: "
-      //                         << GET_COUNTER("Summary-FF Construction"));
-      LOG_IF_ENABLE(
-          BOOST_LOG_SEV(lg, INFO)
-          << "Total flow function cache hits: "
-          << GET_SUM_COUNT({"Normal-FF Cache Hit", "Call-FF Cache Hit",
-                            "Return-FF Cache Hit", "CallToRet-FF Cache Hit"}));
-      //"Summary-FF Cache Hit"});
-      LOG_IF_ENABLE(
-          BOOST_LOG_SEV(lg, INFO)
-          << "Total flow function constructions: "
-          << GET_SUM_COUNT({"Normal-FF Construction", "Call-FF Construction",
-                            "Return-FF Construction",
-                            "CallToRet-FF Construction" /*,
-                "Summary-FF Construction"*/}));
-      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, INFO) << ' ');
-      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, INFO)
-                    << "Normal edge function cache hits: "
-                    << GET_COUNTER("Normal-EF Cache Hit"));
-      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, INFO)
-                    << "Normal edge function constructions: "
-                    << GET_COUNTER("Normal-EF Construction"));
-      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, INFO)
-                    << "Call edge function cache hits: "
-                    << GET_COUNTER("Call-EF Cache Hit"));
-      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, INFO)
-                    << "Call edge function constructions: "
-                    << GET_COUNTER("Call-EF Construction"));
-      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, INFO)
-                    << "Return edge function cache hits: "
-                    << GET_COUNTER("Return-EF Cache Hit"));
-      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, INFO)
-                    << "Return edge function constructions: "
-                    << GET_COUNTER("Return-EF Construction"));
-      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, INFO)
-                    << "Call-to-Return edge function cache hits: "
-                    << GET_COUNTER("CallToRet-EF Cache Hit"));
-      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, INFO)
-                    << "Call-to-Return edge function constructions: "
-                    << GET_COUNTER("CallToRet-EF Construction"));
-      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, INFO)
-                    << "Summary edge function cache hits: "
-                    << GET_COUNTER("Summary-EF Cache Hit"));
-      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, INFO)
-                    << "Summary edge function constructions: "
-                    << GET_COUNTER("Summary-EF Construction"));
-      LOG_IF_ENABLE(
-          BOOST_LOG_SEV(lg, INFO)
-          << "Total edge function cache hits: "
-          << GET_SUM_COUNT({"Normal-EF Cache Hit", "Call-EF Cache Hit",
-                            "Return-EF Cache Hit", "CallToRet-EF Cache Hit",
-                            "Summary-EF Cache Hit"}));
-      LOG_IF_ENABLE(
-          BOOST_LOG_SEV(lg, INFO)
-          << "Total edge function constructions: "
-          << GET_SUM_COUNT({"Normal-EF Construction", "Call-EF Construction",
-                            "Return-EF Construction",
-                            "CallToRet-EF Construction",
-                            "Summary-EF Construction"}));
-      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, INFO)
-                    << "----------------------------------------------");
+      PHASAR_LOG_LEVEL_CAT(INFO, FlowEdgeFunctionCache,
+                           "=== Flow-Edge-Function Cache Statistics ===");
+      PHASAR_LOG_LEVEL_CAT(INFO, FlowEdgeFunctionCache,
+                           "Normal-flow function cache hits: "
+                           << GET_COUNTER("Normal-FF Cache Hit"));
+      PHASAR_LOG_LEVEL_CAT(INFO, FlowEdgeFunctionCache,
+                           "Normal-flow function constructions: "
+                           << GET_COUNTER("Normal-FF Construction"));
+      PHASAR_LOG_LEVEL_CAT(INFO, FlowEdgeFunctionCache,
+                           "Call-flow function cache hits: "
+                           << GET_COUNTER("Call-FF Cache Hit"));
+      PHASAR_LOG_LEVEL_CAT(INFO, FlowEdgeFunctionCache,
+                           "Call-flow function constructions: "
+                           << GET_COUNTER("Call-FF Construction"));
+      PHASAR_LOG_LEVEL_CAT(INFO, FlowEdgeFunctionCache,
+                           "Return-flow function cache hits: "
+                           << GET_COUNTER("Return-FF Cache Hit"));
+      PHASAR_LOG_LEVEL_CAT(INFO, FlowEdgeFunctionCache,
+                           "Return-flow function constructions: "
+                           << GET_COUNTER("Return-FF Construction"));
+      PHASAR_LOG_LEVEL_CAT(INFO, FlowEdgeFunctionCache,
+                           "Call-to-Return-flow function cache hits: "
+                           << GET_COUNTER("CallToRet-FF Cache Hit"));
+      PHASAR_LOG_LEVEL_CAT(INFO, FlowEdgeFunctionCache,
+                           "Call-to-Return-flow function constructions: "
+                           << GET_COUNTER("CallToRet-FF Construction"));
+      PHASAR_LOG_LEVEL_CAT(INFO, FlowEdgeFunctionCache,
+                           "Summary-flow function cache hits: "
+                           << GET_COUNTER("Summary-FF Cache Hit"));
+      PHASAR_LOG_LEVEL_CAT(INFO, FlowEdgeFunctionCache,
+                           "Summary-flow function constructions: "
+                           << GET_COUNTER("Summary-FF Construction"));
+      PHASAR_LOG_LEVEL_CAT(INFO, FlowEdgeFunctionCache,
+                           "Total flow function cache hits: "
+                           << GET_SUM_COUNT({"Normal-FF Cache Hit",
+                                             "Call-FF Cache Hit",
+                                             "Return-FF Cache Hit",
+                                             "CallToRet-FF Cache Hit",
+                                             "Summary-FF Cache Hit"}));
+      PHASAR_LOG_LEVEL_CAT(INFO, FlowEdgeFunctionCache,
+                           "Total flow function constructions: "
+                           << GET_SUM_COUNT({"Normal-FF Construction",
+                                             "Call-FF Construction",
+                                             "Return-FF Construction",
+                                             "CallToRet-FF Construction",
+                                             "Summary-FF Construction"}));
+      PHASAR_LOG_LEVEL_CAT(INFO, FlowEdgeFunctionCache, ' ');
+      PHASAR_LOG_LEVEL_CAT(INFO, FlowEdgeFunctionCache,
+                           "Normal edge function cache hits: "
+                           << GET_COUNTER("Normal-EF Cache Hit"));
+      PHASAR_LOG_LEVEL_CAT(INFO, FlowEdgeFunctionCache,
+                           "Normal edge function constructions: "
+                           << GET_COUNTER("Normal-EF Construction"));
+      PHASAR_LOG_LEVEL_CAT(INFO, FlowEdgeFunctionCache,
+                           "Call edge function cache hits: "
+                           << GET_COUNTER("Call-EF Cache Hit"));
+      PHASAR_LOG_LEVEL_CAT(INFO, FlowEdgeFunctionCache,
+                           "Call edge function constructions: "
+                           << GET_COUNTER("Call-EF Construction"));
+      PHASAR_LOG_LEVEL_CAT(INFO, FlowEdgeFunctionCache,
+                           "Return edge function cache hits: "
+                           << GET_COUNTER("Return-EF Cache Hit"));
+      PHASAR_LOG_LEVEL_CAT(INFO, FlowEdgeFunctionCache,
+                           "Return edge function constructions: "
+                           << GET_COUNTER("Return-EF Construction"));
+      PHASAR_LOG_LEVEL_CAT(INFO, FlowEdgeFunctionCache,
+                           "Call-to-Return edge function cache hits: "
+                           << GET_COUNTER("CallToRet-EF Cache Hit"));
+      PHASAR_LOG_LEVEL_CAT(INFO, FlowEdgeFunctionCache,
+                           "Call-to-Return edge function constructions: "
+                           << GET_COUNTER("CallToRet-EF Construction"));
+      PHASAR_LOG_LEVEL_CAT(INFO, FlowEdgeFunctionCache,
+                           "Summary edge function cache hits: "
+                           << GET_COUNTER("Summary-EF Cache Hit"));
+      PHASAR_LOG_LEVEL_CAT(INFO, FlowEdgeFunctionCache,
+                           "Summary edge function constructions: "
+                           << GET_COUNTER("Summary-EF Construction"));
+      PHASAR_LOG_LEVEL_CAT(INFO, FlowEdgeFunctionCache,
+                           "Total edge function cache hits: "
+                           << GET_SUM_COUNT({"Normal-EF Cache Hit",
+                                             "Call-EF Cache Hit",
+                                             "Return-EF Cache Hit",
+                                             "CallToRet-EF Cache Hit",
+                                             "Summary-EF Cache Hit"}));
+      PHASAR_LOG_LEVEL_CAT(INFO, FlowEdgeFunctionCache,
+                           "Total edge function constructions: "
+                           << GET_SUM_COUNT({"Normal-EF Construction",
+                                             "Call-EF Construction",
+                                             "Return-EF Construction",
+                                             "CallToRet-EF Construction",
+                                             "Summary-EF Construction"}));
+      PHASAR_LOG_LEVEL_CAT(INFO, FlowEdgeFunctionCache,
+                           "----------------------------------------------");
     } else {
-      LOG_IF_ENABLE(
-          BOOST_LOG_SEV(lg, INFO)
-          << "Cache statistics only recorded on PAMM severity level: Full.");
+      PHASAR_LOG_LEVEL_CAT(
+          INFO, FlowEdgeFunctionCache,
+          "Cache statistics only recorded on PAMM severity level: Full.");
     }
   }
 };
@@ -10,13 +10,59 @@
 #ifndef PHASAR_PHASARLLVM_IFDSIDE_IDESUMMARY_H_
 #define PHASAR_PHASARLLVM_IFDSIDE_IDESUMMARY_H_
 
+#include <set>
+#include <string>
+
+#include "nlohmann/json.hpp"
+
 namespace psr {
 
-// template <typename N, typename D, typename F, typename V, typename I>
+/**
+ * The persisted summary of a single function definition, see
+ * IncrementalSolver::getAsPersistedRun() for its contents.
+ *
+ * The structural hash of the function, its callees and the callees that had
+ * no definition when the summary was computed determine whether the summary
+ * can still be used. The calling contexts are kept in their persisted form,
+ * i.e. keyed by the stable id of their entry fact (see IRSnapshot), since they
+ * can only be resolved against the IR they are applied to.
+ */
 class IDESummary {
+private:
+  std::string FunctionName;
+  std::string Hash;
+  std::set<std::string> Callees;
+  std::set<std::string> Declarations;
+  nlohmann::json Contexts = nlohmann::json::object();
+
 public:
-  IDESummary() {}
+  IDESummary() = default;
+
+  /**
+   * @brief Reads the summary of the given function from its persisted form.
+   * Throws nlohmann::json::exception if the summary is malformed.
+   */
+  IDESummary(std::string FunctionName, const nlohmann::json &J);
+
+  const std::string &getFunctionName() const { return FunctionName; }
+
+  const std::string &getHash() const { return Hash; }
+
+  const std::set<std::string> &getCallees() const { return Callees; }
+
+  /**
+   * @brief Returns the callees that were mere declarations, their effects are
+   * not part of the summary.
+   */
+  const std::set<std::string> &getDeclarations() const {
+    return Declarations;
+  }
+
+  size_t getNumContexts() const { return Contexts.size(); }
+
+  nlohmann::json getAsJson() const;
 };
+
 } // namespace psr
 
 #endif
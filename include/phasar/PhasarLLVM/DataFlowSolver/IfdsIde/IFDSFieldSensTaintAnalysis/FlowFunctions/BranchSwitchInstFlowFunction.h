@@ -13,8 +13,9 @@ class BranchSwitchInstFlowFunction : public FlowFunctionBase {
 public:
   BranchSwitchInstFlowFunction(const llvm::Instruction *_currentInst,
                                TraceStats &_traceStats,
-                               ExtendedValue _zeroValue)
-      : FlowFunctionBase(_currentInst, _traceStats, _zeroValue) {}
+                               ExtendedValue _zeroValue,
+                               DataFlowUtils::TypeCache &_typeCache)
+      : FlowFunctionBase(_currentInst, _traceStats, _zeroValue, _typeCache) {}
   ~BranchSwitchInstFlowFunction() override = default;
 
   std::set<ExtendedValue> computeTargetsExt(ExtendedValue &fact) override;
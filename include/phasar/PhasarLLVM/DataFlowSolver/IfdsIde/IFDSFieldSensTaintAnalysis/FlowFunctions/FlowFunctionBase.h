@@ -21,9 +21,10 @@ namespace psr {
 class FlowFunctionBase : public FlowFunction<ExtendedValue> {
 public:
   FlowFunctionBase(const llvm::Instruction *_currentInst,
-                   TraceStats &_traceStats, ExtendedValue _zeroValue)
+                   TraceStats &_traceStats, ExtendedValue _zeroValue,
+                   DataFlowUtils::TypeCache &_typeCache)
       : currentInst(_currentInst), traceStats(_traceStats),
-        zeroValue(_zeroValue) {}
+        zeroValue(_zeroValue), typeCache(_typeCache) {}
   ~FlowFunctionBase() override = default;
 
   std::set<ExtendedValue> computeTargets(ExtendedValue fact) override;
@@ -33,6 +34,7 @@ protected:
   const llvm::Instruction *currentInst;
   TraceStats &traceStats;
   ExtendedValue zeroValue;
+  DataFlowUtils::TypeCache &typeCache;
 };
 
 } // namespace psr
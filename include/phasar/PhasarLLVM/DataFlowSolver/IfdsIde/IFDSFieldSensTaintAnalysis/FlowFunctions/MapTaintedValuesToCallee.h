@@ -6,6 +6,7 @@
 #define MAPTAINTEDVALUESTOCALLEE_H
 
 #include "../Stats/TraceStats.h"
+#include "../Utils/DataFlowUtils.h"
 
 #include "llvm/IR/CallSite.h"
 #include "llvm/IR/Instruction.h"
@@ -20,9 +21,10 @@ class MapTaintedValuesToCallee : public FlowFunction<ExtendedValue> {
 public:
   MapTaintedValuesToCallee(const llvm::CallInst *_callInst,
                            const llvm::Function *_destFun,
-                           TraceStats &_traceStats, ExtendedValue _zeroValue)
+                           TraceStats &_traceStats, ExtendedValue _zeroValue,
+                           DataFlowUtils::TypeCache &_typeCache)
       : callInst(_callInst), destFun(_destFun), traceStats(_traceStats),
-        zeroValue(_zeroValue) {}
+        zeroValue(_zeroValue), typeCache(_typeCache) {}
   ~MapTaintedValuesToCallee() override = default;
 
   std::set<ExtendedValue> computeTargets(ExtendedValue fact) override;
@@ -32,6 +34,7 @@ private:
   const llvm::Function *destFun;
   TraceStats &traceStats;
   ExtendedValue zeroValue;
+  DataFlowUtils::TypeCache &typeCache;
 };
 
 } // namespace psr
@@ -6,6 +6,7 @@
 #define MAPTAINTEDVALUESTOCALLER_H
 
 #include "../Stats/TraceStats.h"
+#include "../Utils/DataFlowUtils.h"
 
 #include "llvm/IR/Instructions.h"
 
@@ -19,9 +20,10 @@ class MapTaintedValuesToCaller : public FlowFunction<ExtendedValue> {
 public:
   MapTaintedValuesToCaller(const llvm::CallInst *_callInst,
                            const llvm::ReturnInst *_retInst,
-                           TraceStats &_traceStats, ExtendedValue _zeroValue)
+                           TraceStats &_traceStats, ExtendedValue _zeroValue,
+                           DataFlowUtils::TypeCache &_typeCache)
       : callInst(_callInst), retInst(_retInst), traceStats(_traceStats),
-        zeroValue(_zeroValue) {}
+        zeroValue(_zeroValue), typeCache(_typeCache) {}
   ~MapTaintedValuesToCaller() override = default;
 
   std::set<ExtendedValue> computeTargets(ExtendedValue fact) override;
@@ -31,6 +33,7 @@ private:
   const llvm::ReturnInst *retInst;
   TraceStats &traceStats;
   ExtendedValue zeroValue;
+  DataFlowUtils::TypeCache &typeCache;
 };
 
 } // namespace psr
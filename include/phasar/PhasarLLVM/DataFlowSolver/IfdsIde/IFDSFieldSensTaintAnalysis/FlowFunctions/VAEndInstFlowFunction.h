@@ -12,8 +12,9 @@ namespace psr {
 class VAEndInstFlowFunction : public FlowFunctionBase {
 public:
   VAEndInstFlowFunction(const llvm::Instruction *_currentInst,
-                        TraceStats &_traceStats, ExtendedValue _zeroValue)
-      : FlowFunctionBase(_currentInst, _traceStats, _zeroValue) {}
+                        TraceStats &_traceStats, ExtendedValue _zeroValue,
+                        DataFlowUtils::TypeCache &_typeCache)
+      : FlowFunctionBase(_currentInst, _traceStats, _zeroValue, _typeCache) {}
   ~VAEndInstFlowFunction() override = default;
 
   std::set<ExtendedValue> computeTargetsExt(ExtendedValue &fact) override;
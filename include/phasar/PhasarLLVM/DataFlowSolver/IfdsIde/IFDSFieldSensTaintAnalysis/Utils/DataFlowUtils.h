@@ -8,6 +8,7 @@
 #include <set>
 #include <string>
 #include <tuple>
+#include <unordered_map>
 #include <vector>
 
 #include "llvm/IR/Instructions.h"
@@ -20,14 +21,35 @@ class DataFlowUtils {
 public:
   DataFlowUtils() = delete;
 
+  /*
+   * Predicates of types that are derived from the names showing up in the
+   * textual representation of a type.
+   */
+  enum TypeFlags : unsigned {
+    VA_LIST_TYPE = 1U << 0,
+    UNION_TYPE = 1U << 1,
+    MAGIC_RETURN_TYPE = 1U << 2
+  };
+
+  /*
+   * Caches the flags of the types of a module. The cache is owned by the
+   * analysis and is not synchronized.
+   */
+  using TypeCache = std::unordered_map<const llvm::Type *, unsigned>;
+
+  static unsigned classifyType(const llvm::Type *type);
+  static unsigned getTypeFlags(const llvm::Type *type, TypeCache &typeCache);
+
   static bool isValueTainted(const llvm::Value *currentInst,
                              const ExtendedValue &fact);
 
   static bool isMemoryLocationTainted(const llvm::Value *memLocationMatr,
-                                      const ExtendedValue &fact);
+                                      const ExtendedValue &fact,
+                                      TypeCache &typeCache);
 
   static const std::vector<const llvm::Value *>
-  getMemoryLocationSeqFromMatr(const llvm::Value *memLocationMatr);
+  getMemoryLocationSeqFromMatr(const llvm::Value *memLocationMatr,
+                               TypeCache &typeCache);
   static const std::vector<const llvm::Value *>
   getMemoryLocationSeqFromFact(const ExtendedValue &memLocationFact);
   static const std::vector<const llvm::Value *>
@@ -48,11 +70,12 @@ public:
       const std::vector<const llvm::Value *> memLocationSeq2);
 
   static bool isPatchableArgumentStore(const llvm::Value *srcValue,
-                                       const ExtendedValue &fact);
+                                       const ExtendedValue &fact,
+                                       TypeCache &typeCache);
   static bool isPatchableArgumentMemcpy(
       const llvm::Value *srcValue,
       const std::vector<const llvm::Value *> srcMemLocationSeq,
-      const ExtendedValue &fact);
+      const ExtendedValue &fact, TypeCache &typeCache);
   static bool isPatchableVaListArgument(const llvm::Value *srcValue,
                                         const ExtendedValue &fact);
   static bool isPatchableReturnValue(const llvm::Value *srcValue,
@@ -66,7 +89,7 @@ public:
                  const llvm::Value *>>
   getSanitizedArgList(const llvm::CallInst *callInst,
                       const llvm::Function *destFun,
-                      const llvm::Value *zeroValue);
+                      const llvm::Value *zeroValue, TypeCache &typeCache);
 
   static const llvm::BasicBlock *
   getEndOfTaintedBlock(const llvm::BasicBlock *startBasicBlock);
@@ -78,12 +101,13 @@ public:
   static bool isKillAfterStoreFact(const ExtendedValue &ev);
   static bool isCheckOperandsInst(const llvm::Instruction *currentInst);
   static bool isAutoIdentity(const llvm::Instruction *currentInst,
-                             const ExtendedValue &fact);
+                             const ExtendedValue &fact, TypeCache &typeCache);
   static bool isVarArgParam(const llvm::Value *param,
                             const llvm::Value *zeroValue);
-  static bool isVaListType(const llvm::Type *type);
+  static bool isVaListType(const llvm::Type *type, TypeCache &typeCache);
   static bool isReturnValue(const llvm::Instruction *currentInst,
-                            const llvm::Instruction *successorInst);
+                            const llvm::Instruction *successorInst,
+                            TypeCache &typeCache);
   static bool isArrayDecay(const llvm::Value *memLocationMatr);
   static bool isGlobalMemoryLocationSeq(
       const std::vector<const llvm::Value *> memLocationSeq);
@@ -18,6 +18,7 @@
 #define PHASAR_PHASARLLVM_IFDSIDE_SOLVERCONFIGURATION_H_
 
 #include <iosfwd>
+#include <string>
 
 #include "phasar/Config/Configuration.h"
 
@@ -42,6 +43,18 @@ struct IFDSIDESolverConfig {
           ? PhasarConfig::VariablesMap()["emit-esg-as-dot"].as<bool>()
           : false;
   bool computePersistedSummaries = false;
+  // if non-empty, a sampled trace of the solver run is written to this file
+  // in the Chrome trace-event format
+  std::string traceFile =
+      (PhasarConfig::VariablesMap().count("solver-trace"))
+          ? PhasarConfig::VariablesMap()["solver-trace"].as<std::string>()
+          : "";
+  // only every traceSampleRate-th event is recorded
+  unsigned traceSampleRate =
+      (PhasarConfig::VariablesMap().count("solver-trace-sample-rate"))
+          ? PhasarConfig::VariablesMap()["solver-trace-sample-rate"]
+                .as<unsigned>()
+          : 1;
   friend std::ostream &operator<<(std::ostream &os,
                                   const IFDSIDESolverConfig &sc);
 };
@@ -0,0 +1,51 @@
+/******************************************************************************
+ * Copyright (c) 2020 Philipp Schubert.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Philipp Schubert and others
+ *****************************************************************************/
+
+#ifndef PHASAR_PHASARLLVM_IFDSIDE_LLVMFLOWFUNCTIONS_LIBRARYSUMMARYFLOW_H_
+#define PHASAR_PHASARLLVM_IFDSIDE_LLVMFLOWFUNCTIONS_LIBRARYSUMMARYFLOW_H_
+
+#include <map>
+#include <set>
+
+#include "phasar/PhasarLLVM/DataFlowSolver/IfdsIde/FlowFunction.h"
+#include "phasar/PhasarLLVM/DataFlowSolver/IfdsIde/LibrarySummaries.h"
+
+namespace llvm {
+class Value;
+class Instruction;
+} // namespace llvm
+
+namespace psr {
+
+/**
+ * @brief Applies the declarative summary of a library function at a call
+ * site.
+ *
+ * The summary's locations are resolved to the call site's operands, its
+ * return value and the module's globals once, such that applying the flow
+ * function is a lookup. Every fact is passed along the call and additionally
+ * generates the targets of the flows it is the source of.
+ */
+class LibrarySummaryFlow : public FlowFunction<const llvm::Value *> {
+protected:
+  std::map<const llvm::Value *, std::set<const llvm::Value *>> Flows;
+  std::set<const llvm::Value *> ZeroFlows;
+
+public:
+  LibrarySummaryFlow(const llvm::Instruction *CallSite,
+                     const LibrarySummaries::Summary &Summary);
+  ~LibrarySummaryFlow() override = default;
+
+  std::set<const llvm::Value *>
+  computeTargets(const llvm::Value *Source) override;
+};
+
+} // namespace psr
+
+#endif
@@ -0,0 +1,107 @@
+/******************************************************************************
+ * Copyright (c) 2019 Philipp Schubert.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Philipp Schubert and others
+ *****************************************************************************/
+
+#ifndef PHASAR_PHASARLLVM_IFDSIDE_LIBRARYSUMMARIES_H_
+#define PHASAR_PHASARLLVM_IFDSIDE_LIBRARYSUMMARIES_H_
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "nlohmann/json.hpp"
+
+namespace llvm {
+class Function;
+} // namespace llvm
+
+namespace psr {
+
+/**
+ * Declarative data-flow summaries of library functions, e.g. of glibc or the
+ * C++ standard library, that allow an analysis to skip their bodies.
+ *
+ * A summary lists the flows a call to the function induces between its
+ * parameters, its return value and global variables:
+ *
+ *   {
+ *     "Version": 1,
+ *     "Functions": {
+ *       "strcpy": {
+ *         "Flows": [ { "From": "Arg1", "To": ["Arg0", "Return"] } ]
+ *       }
+ *     }
+ *   }
+ *
+ * A location is "Arg<n>", "Return", "Global:<name>" or, as the source of a
+ * flow only, "Zero", which generates the targets unconditionally. Functions
+ * are identified by their mangled or demangled name. Facts that are not
+ * mentioned by a summary are passed along the call as by the identity
+ * summaries PhASAR uses for special functions by default, see
+ * SpecialSummaries.
+ */
+class LibrarySummaries {
+public:
+  struct Location {
+    enum class Kind { Zero, Arg, Return, Global };
+    Kind K;
+    unsigned ArgNo = 0;
+    std::string Global;
+  };
+
+  struct Flow {
+    Location From;
+    std::vector<Location> To;
+  };
+
+  using Summary = std::vector<Flow>;
+
+  static constexpr unsigned FormatVersion = 1;
+
+  LibrarySummaries() = default;
+
+  /**
+   * @brief Parses summaries of the format above. Throws std::runtime_error
+   * if J is malformed.
+   */
+  explicit LibrarySummaries(const nlohmann::json &J);
+
+  /**
+   * @brief Reads summaries from a file. Throws std::ios_base::failure if the
+   * file cannot be read and std::runtime_error if it is malformed.
+   */
+  static LibrarySummaries loadFromFile(const std::string &Path);
+
+  /**
+   * @brief Returns the summary of F or nullptr if F is not summarized.
+   */
+  const Summary *getSummary(const llvm::Function *F) const;
+
+  const Summary *getSummary(const std::string &FunctionName) const;
+
+  /**
+   * @brief Adds the summaries of Other, which replace existing summaries of
+   * the same functions.
+   */
+  void merge(const LibrarySummaries &Other);
+
+  const std::map<std::string, Summary> &getSummaries() const {
+    return Summaries;
+  }
+
+  size_t size() const { return Summaries.size(); }
+
+private:
+  std::map<std::string, Summary> Summaries;
+
+  static Location parseLocation(const std::string &Str);
+};
+
+} // namespace psr
+
+#endif
@@ -19,6 +19,7 @@
 
 #include "phasar/PhasarLLVM/DataFlowSolver/IfdsIde/EdgeFunctionComposer.h"
 #include "phasar/PhasarLLVM/DataFlowSolver/IfdsIde/IDETabulationProblem.h"
+#include "phasar/PhasarLLVM/DataFlowSolver/IfdsIde/Problems/TypeStateDescriptions/CompiledTypeStateDescription.h"
 #include "phasar/PhasarLLVM/DataFlowSolver/IfdsIde/Problems/TypeStateDescriptions/TypeStateDescription.h"
 
 namespace llvm {
@@ -50,6 +51,8 @@ public:
 
 private:
   const TypeStateDescription &TSD;
+  // TSD compiled against the functions of the IRDB
+  const CompiledTypeStateDescription CTSD;
   std::map<const llvm::Value *, std::set<const llvm::Value *>> PointsToCache;
   std::map<const llvm::Value *, std::set<const llvm::Value *>>
       RelevantAllocaCache;
@@ -193,17 +196,18 @@ public:
   class TSEdgeFunction : public EdgeFunction<l_t>,
                          public std::enable_shared_from_this<TSEdgeFunction> {
   protected:
+    const CompiledTypeStateDescription &CTSD;
     const TypeStateDescription &TSD;
-    // Do not use a reference here, since LLVM's StringRef's (obtained by str())
-    // might turn to nullptr for whatever reason...
-    const std::string Token;
+    // the id of the API function in CTSD
+    const unsigned FunctionId;
     l_t CurrentState;
     llvm::ImmutableCallSite CS;
 
   public:
-    TSEdgeFunction(const TypeStateDescription &tsd, const std::string tok,
+    TSEdgeFunction(const CompiledTypeStateDescription &ctsd, unsigned funId,
                    llvm::ImmutableCallSite cs)
-        : TSD(tsd), Token(tok), CurrentState(TSD.top()), CS(cs){};
+        : CTSD(ctsd), TSD(ctsd.getDescription()), FunctionId(funId),
+          CurrentState(TSD.top()), CS(cs){};
 
     l_t computeTarget(l_t source) override;
 
@@ -17,6 +17,7 @@
 
 #include "phasar/PhasarLLVM/ControlFlow/LLVMBasedICFG.h"
 #include "phasar/PhasarLLVM/DataFlowSolver/IfdsIde/IFDSFieldSensTaintAnalysis/Stats/TraceStats.h"
+#include "phasar/PhasarLLVM/DataFlowSolver/IfdsIde/IFDSFieldSensTaintAnalysis/Utils/DataFlowUtils.h"
 #include "phasar/PhasarLLVM/DataFlowSolver/IfdsIde/IFDSTabulationProblem.h"
 #include "phasar/PhasarLLVM/DataFlowSolver/IfdsIde/LLVMZeroValue.h"
 #include "phasar/PhasarLLVM/Domain/ExtendedValue.h"
@@ -88,7 +89,7 @@ public:
 
   ExtendedValue createZeroValue() const override {
     // create a special value to represent the zero value!
-    return ExtendedValue(LLVMZeroValue::getInstance());
+    return ExtendedValue(internTable, LLVMZeroValue::getInstance());
   }
 
   bool isZeroValue(ExtendedValue ev) const override {
@@ -125,6 +126,12 @@ private:
   TaintConfiguration<ExtendedValue> taintConfig;
 
   TraceStats traceStats;
+
+  // classifies the types of the analyzed module once
+  DataFlowUtils::TypeCache typeCache;
+
+  // holds the facts of this analysis, interning does not change the analysis
+  mutable ExtendedValue::InternTable internTable;
 };
 
 } // namespace psr
@@ -18,6 +18,10 @@
 #include <set>
 #include <string>
 
+#include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/DenseSet.h"
+#include "llvm/ADT/SmallBitVector.h"
+
 // Forward declaration of types for which we only use its pointer or ref type
 namespace llvm {
 class Instruction;
@@ -49,6 +53,21 @@ class IFDSTaintAnalysis
                                    const llvm::Value *, LLVMBasedICFG> {
 private:
   const TaintConfiguration<const llvm::Value *> &SourceSinkFunctions;
+  /// Holds the source and sink functions that are called in the ICFG
+  llvm::DenseSet<const llvm::Function *> SourceSinkCallees;
+  /// Holds the leaked arguments of each call site of a sink function
+  llvm::DenseMap<const llvm::Instruction *, llvm::SmallBitVector>
+      SinkCallSites;
+  /// Holds the values tainted by each call site of a source function
+  llvm::DenseMap<const llvm::Instruction *, std::set<const llvm::Value *>>
+      SourceCallSites;
+
+  /**
+   * @brief Resolves the source and sink functions to their call sites in the
+   * ICFG, such that the flow functions do not look up functions by name and
+   * the taints generated by source functions are computed only once.
+   */
+  void indexSourceSinkCallSites();
 
 public:
   typedef const llvm::Value *d_t;
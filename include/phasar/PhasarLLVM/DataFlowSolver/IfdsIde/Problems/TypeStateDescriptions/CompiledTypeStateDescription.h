@@ -0,0 +1,131 @@
+/******************************************************************************
+ * Copyright (c) 2019 Philipp Schubert.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Philipp Schubert and others
+ *****************************************************************************/
+
+#ifndef PHASAR_PHASARLLVM_IFDSIDE_PROBLEMS_TYPESTATEDESCRIPTIONS_COMPILEDTYPESTATEDESCRIPTION_H_
+#define PHASAR_PHASARLLVM_IFDSIDE_PROBLEMS_TYPESTATEDESCRIPTIONS_COMPILEDTYPESTATEDESCRIPTION_H_
+
+#include <limits>
+#include <optional>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "llvm/ADT/DenseMap.h"
+
+#include "phasar/PhasarLLVM/DataFlowSolver/IfdsIde/Problems/TypeStateDescriptions/TypeStateDescription.h"
+
+namespace llvm {
+class Function;
+} // namespace llvm
+
+namespace psr {
+
+class ProjectIRDB;
+
+/**
+ * A type state description compiled against the functions of an IRDB. The
+ * API functions of the description are resolved to llvm::Function's once and
+ * numbered densely. The finite state machine is tabulated by (function id,
+ * state), such that a transition is a single array load instead of string
+ * lookups in the description.
+ *
+ * Only states that are reachable from bottom(), uninit(), start() and error()
+ * by transitions are tabulated. Transitions from other states, e.g. top(), are
+ * forwarded to the description as well as transitions depending on the call
+ * site.
+ */
+class CompiledTypeStateDescription {
+public:
+  using State = TypeStateDescription::State;
+
+  CompiledTypeStateDescription(const TypeStateDescription &TSD,
+                               const ProjectIRDB &IRDB);
+
+  /**
+   * @brief Returns the id of F if it is a function of the API.
+   */
+  std::optional<unsigned> getFunctionId(const llvm::Function *F) const {
+    auto Search = FunctionIds.find(F);
+    if (Search == FunctionIds.end()) {
+      return std::nullopt;
+    }
+    return Search->second;
+  }
+
+  bool isAPIFunction(const llvm::Function *F) const {
+    return FunctionIds.count(F);
+  }
+
+  bool isFactoryFunction(const llvm::Function *F) const {
+    auto Id = getFunctionId(F);
+    return Id && Functions[*Id].IsFactory;
+  }
+
+  bool isConsumingFunction(const llvm::Function *F) const {
+    auto Id = getFunctionId(F);
+    return Id && Functions[*Id].IsConsuming;
+  }
+
+  /**
+   * @brief Returns the demangled name of the API function with the given id,
+   * i.e. its token in the description.
+   */
+  const std::string &getFunctionName(unsigned Id) const {
+    return Functions[Id].Name;
+  }
+
+  const std::set<int> &getConsumerParamIdx(unsigned Id) const {
+    return Functions[Id].ConsumerParamIdx;
+  }
+
+  State getNextState(unsigned Id, State S) const {
+    if (S >= MinState && S - MinState < NumStates) {
+      State Next = Delta[Id * NumStates + (S - MinState)];
+      if (Next != Unknown) {
+        return Next;
+      }
+    }
+    return TSD.getNextState(Functions[Id].Name, S);
+  }
+
+  State getNextState(unsigned Id, State S, llvm::ImmutableCallSite CS) const {
+    return TSD.getNextState(Functions[Id].Name, S, CS);
+  }
+
+  size_t getNumFunctions() const { return Functions.size(); }
+
+  size_t getNumStates() const { return NumStates; }
+
+  const TypeStateDescription &getDescription() const { return TSD; }
+
+private:
+  struct APIFunction {
+    std::string Name;
+    bool IsFactory;
+    bool IsConsuming;
+    std::set<int> ConsumerParamIdx;
+  };
+
+  // marks entries of the table for values between the tabulated states that
+  // are no states themselves
+  static constexpr State Unknown = std::numeric_limits<State>::min();
+
+  const TypeStateDescription &TSD;
+  llvm::DenseMap<const llvm::Function *, unsigned> FunctionIds;
+  std::vector<APIFunction> Functions;
+  // the tabulated states are MinState, ..., MinState + NumStates - 1
+  State MinState = 0;
+  State NumStates = 0;
+  // Delta[Id * NumStates + (S - MinState)] = next state
+  std::vector<State> Delta;
+};
+
+} // namespace psr
+
+#endif
@@ -0,0 +1,164 @@
+/******************************************************************************
+ * Copyright (c) 2019 Philipp Schubert.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Philipp Schubert and others
+ *****************************************************************************/
+
+#ifndef PHASAR_PHASARLLVM_IFDSIDE_RESULTSTORE_H_
+#define PHASAR_PHASARLLVM_IFDSIDE_RESULTSTORE_H_
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "llvm/ADT/StringRef.h"
+
+namespace llvm {
+class MemoryBuffer;
+} // namespace llvm
+
+namespace psr {
+
+/**
+ * A read-only, memory-mapped dump of the results of a data-flow solver, i.e.
+ * the facts that hold at each node together with their values, as written by
+ * ResultStoreWriter. Nodes are identified by a key, e.g. their ID annotation,
+ * and carry a human-readable label. The facts at a node are found by a binary
+ * search on the keys, without reading the rest of the store.
+ *
+ * File layout, all integers are stored little endian:
+ *
+ *   "PSRRESST"                                    magic
+ *   uint32 version, uint32 number of nodes, uint32 number of facts,
+ *   uint32 number of values, uint64 number of cells
+ *   { uint64 offset, uint32 size }                per node key, sorted
+ *   { uint64 offset, uint32 size }                per node label
+ *   { uint64 offset, uint32 size }                per fact, sorted
+ *   { uint64 offset, uint32 size }                per value, sorted
+ *   uint64                                        per node and one more: the
+ *                                                 index of its first cell
+ *   uint32                                        per cell: its fact
+ *   uint32                                        per cell: its value
+ *   string data
+ *
+ * The cells are grouped by node and sorted by fact within a node, values are
+ * stored as their string representation.
+ */
+class ResultStore {
+public:
+  static constexpr uint32_t FormatVersion = 1;
+
+  /**
+   * @brief Maps the store at the given path. Throws std::runtime_error if the
+   * file cannot be read or is not a result store.
+   */
+  explicit ResultStore(const std::string &Path);
+
+  ~ResultStore();
+
+  ResultStore(const ResultStore &) = delete;
+  ResultStore &operator=(const ResultStore &) = delete;
+
+  /**
+   * @brief Returns the index of the node with the given key, if any.
+   */
+  std::optional<uint32_t> findNode(llvm::StringRef Key) const;
+
+  llvm::StringRef getNodeKey(uint32_t Node) const;
+
+  llvm::StringRef getNodeLabel(uint32_t Node) const;
+
+  /**
+   * @brief Returns the facts that hold at the given node with their values.
+   */
+  std::vector<std::pair<llvm::StringRef, llvm::StringRef>>
+  getFactsAt(uint32_t Node) const;
+
+  /**
+   * @brief Returns the facts that hold at the node with the given key, which
+   * are none if there is no such node.
+   */
+  std::vector<std::pair<llvm::StringRef, llvm::StringRef>>
+  getFactsAt(llvm::StringRef Key) const;
+
+  size_t getNumNodes() const { return NumNodes; }
+
+  size_t getNumFacts() const { return NumFacts; }
+
+  size_t getNumCells() const { return NumCells; }
+
+private:
+  std::unique_ptr<llvm::MemoryBuffer> Buffer;
+  uint32_t NumNodes = 0;
+  uint32_t NumFacts = 0;
+  uint32_t NumValues = 0;
+  uint64_t NumCells = 0;
+  // the offsets of the tables within the buffer
+  uint64_t NodeKeys = 0;
+  uint64_t NodeLabels = 0;
+  uint64_t Facts = 0;
+  uint64_t Values = 0;
+  uint64_t Rows = 0;
+  uint64_t FactColumn = 0;
+  uint64_t ValueColumn = 0;
+
+  llvm::StringRef getString(uint64_t Table, uint32_t Idx) const;
+
+  uint32_t read32(uint64_t Offset) const;
+
+  uint64_t read64(uint64_t Offset) const;
+};
+
+/**
+ * Collects the results of a solver and writes them in the format of
+ * ResultStore. Nodes, facts and values are interned, such that the caller
+ * only has to compute the string representation of each node and fact once.
+ */
+class ResultStoreWriter {
+public:
+  /**
+   * @brief Returns the id of the node with the given key, the label is only
+   * used if the node has not been added before.
+   */
+  uint32_t addNode(const std::string &Key, const std::string &Label);
+
+  uint32_t addFact(const std::string &Fact);
+
+  uint32_t addValue(const std::string &Value);
+
+  void addCell(uint32_t Node, uint32_t Fact, uint32_t Value);
+
+  size_t size() const { return Cells.size(); }
+
+  /**
+   * @brief Writes the store. Throws std::ios_base::failure if the file could
+   * not be written.
+   */
+  void write(const std::string &Path) const;
+
+private:
+  struct StringTable {
+    std::unordered_map<std::string, uint32_t> Ids;
+    std::vector<std::string> Strings;
+
+    uint32_t intern(const std::string &S);
+  };
+
+  StringTable NodeKeys;
+  std::vector<std::string> NodeLabels;
+  StringTable Facts;
+  StringTable Values;
+  std::vector<std::tuple<uint32_t, uint32_t, uint32_t>> Cells;
+};
+
+} // namespace psr
+
+#endif
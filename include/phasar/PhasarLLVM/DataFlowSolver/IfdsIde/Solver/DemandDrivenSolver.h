@@ -0,0 +1,246 @@
+/******************************************************************************
+ * Copyright (c) 2019 Philipp Schubert.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Philipp Schubert and others
+ *****************************************************************************/
+
+#ifndef PHASAR_PHASARLLVM_IFDSIDE_SOLVER_DEMANDDRIVENSOLVER_H_
+#define PHASAR_PHASARLLVM_IFDSIDE_SOLVER_DEMANDDRIVENSOLVER_H_
+
+#include <map>
+#include <set>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "phasar/PhasarLLVM/DataFlowSolver/IfdsIde/Solver/IDESolver.h"
+#include "phasar/PhasarLLVM/DataFlowSolver/IfdsIde/Solver/PathEdge.h"
+#include "phasar/Utils/Logger.h"
+
+namespace psr {
+
+/**
+ * Turns an IDESolver (or IFDSSolver) into a demand-driven solver that only
+ * explores the part of the exploded super-graph that is relevant for a set of
+ * query points.
+ *
+ * The relevant part is the backward slice of the query points on the
+ * inter-procedural control-flow graph: ascending into all callers of a
+ * function whose start point is reached and descending into the callees of
+ * each call whose return site is reached. Path edges whose targets are not
+ * relevant are deferred rather than processed. When further query points are
+ * added the slice is extended and only the deferred edges that became
+ * relevant are resumed, so that jump functions and end summaries computed for
+ * earlier queries are reused.
+ *
+ * Results are precise for every query point (and every node on the ascending
+ * part of the slice) and identical to the results of a whole-program run.
+ * Results at other nodes may be incomplete.
+ */
+template <typename SolverTy> class DemandDrivenSolver : public SolverTy {
+public:
+  using n_t = typename SolverTy::n_t;
+  using d_t = typename SolverTy::d_t;
+  using l_t = typename SolverTy::l_t;
+
+  using SolverTy::SolverTy;
+
+  ~DemandDrivenSolver() override = default;
+
+  /**
+   * @brief Registers a query point and extends the relevant part of the
+   * exploded super-graph accordingly. Call solve() afterwards.
+   */
+  void addQueryPoint(n_t Stmt) {
+    // maps a node to the mode in which its predecessors have to be visited,
+    // i.e. whether we may ascend into callers or only descend into callees
+    std::vector<std::pair<n_t, bool>> WorkList;
+    auto Visit = [&](n_t N, bool Ascending) {
+      auto Search = Relevant.find(N);
+      if (Search == Relevant.end()) {
+        Relevant.emplace(N, Ascending);
+        NewlyRelevant.push_back(N);
+        WorkList.emplace_back(N, Ascending);
+      } else if (Ascending && !Search->second) {
+        Search->second = true;
+        WorkList.emplace_back(N, Ascending);
+      }
+    };
+    Visit(Stmt, true);
+    while (!WorkList.empty()) {
+      auto [N, Ascending] = WorkList.back();
+      WorkList.pop_back();
+      for (n_t Pred : this->ICF->getPredsOf(N)) {
+        Visit(Pred, Ascending);
+        if (this->ICF->isCallStmt(Pred) &&
+            this->ICF->getReturnSitesOfCallAt(Pred).count(N)) {
+          for (auto Callee : this->ICF->getCalleesOfCallAt(Pred)) {
+            for (n_t ExitPoint : this->ICF->getExitPointsOf(Callee)) {
+              Visit(ExitPoint, false);
+            }
+          }
+        }
+      }
+      if (Ascending && this->ICF->isStartPoint(N)) {
+        for (n_t CallSite :
+             this->ICF->getCallersOf(this->ICF->getFunctionOf(N))) {
+          Visit(CallSite, true);
+        }
+      }
+    }
+  }
+
+  /**
+   * @brief Solves the problem for all query points registered so far.
+   */
+  void solve() override {
+    if (!SeedsSubmitted) {
+      PHASAR_LOG_LEVEL_CAT(INFO, Solver,
+                           "Demand-driven solver: submit initial seeds");
+      SeedsSubmitted = true;
+      NewlyRelevant.clear();
+      this->submitInitialSeeds();
+    } else {
+      resumeDeferredEdges();
+    }
+    if (this->SolverConfig.computeValues) {
+      computeValuesOnSlice();
+    }
+    PHASAR_LOG_LEVEL_CAT(INFO, Solver,
+                         "Demand-driven solver: " << Relevant.size()
+                         << " relevant nodes, " << getNumDeferredEdges()
+                         << " deferred path edges");
+  }
+
+  /**
+   * @brief Returns true if results for the given statement are available
+   * without further solving.
+   */
+  bool isAnswered(n_t Stmt) const {
+    auto Search = Relevant.find(Stmt);
+    return SeedsSubmitted && Search != Relevant.end() && Search->second;
+  }
+
+  /**
+   * @brief Returns the value of the given fact at the given statement and
+   * only solves the parts that have not been explored by previous queries.
+   */
+  l_t query(n_t Stmt, d_t Fact) {
+    if (!isAnswered(Stmt)) {
+      addQueryPoint(Stmt);
+      solve();
+    }
+    return this->resultAt(Stmt, Fact);
+  }
+
+  /**
+   * @brief Returns all facts and their values at the given statement and
+   * only solves the parts that have not been explored by previous queries.
+   */
+  std::unordered_map<d_t, l_t> queryResultsAt(n_t Stmt,
+                                              bool StripZero = false) {
+    if (!isAnswered(Stmt)) {
+      addQueryPoint(Stmt);
+      solve();
+    }
+    return this->resultsAt(Stmt, StripZero);
+  }
+
+  size_t getNumRelevantNodes() const { return Relevant.size(); }
+
+  size_t getNumDeferredEdges() const {
+    size_t Num = 0;
+    for (const auto &Entry : Deferred) {
+      Num += Entry.second.size();
+    }
+    return Num;
+  }
+
+protected:
+  // relevant nodes, mapped to true if they were reached while ascending
+  std::unordered_map<n_t, bool> Relevant;
+  // nodes that became relevant since the last call to solve()
+  std::vector<n_t> NewlyRelevant;
+  // path edges (source fact, target fact) reaching a not yet relevant target
+  std::unordered_map<n_t, std::set<std::pair<d_t, d_t>>> Deferred;
+  bool SeedsSubmitted = false;
+
+  bool isRelevant(n_t Stmt) const { return Relevant.count(Stmt); }
+
+  bool deferIfIrrelevant(PathEdge<n_t, d_t> &Edge) {
+    if (isRelevant(Edge.getTarget())) {
+      return false;
+    }
+    Deferred[Edge.getTarget()].emplace(Edge.factAtSource(),
+                                       Edge.factAtTarget());
+    return true;
+  }
+
+  void processCall(PathEdge<n_t, d_t> Edge) override {
+    if (!deferIfIrrelevant(Edge)) {
+      SolverTy::processCall(Edge);
+    }
+  }
+
+  void processNormalFlow(PathEdge<n_t, d_t> Edge) override {
+    if (!deferIfIrrelevant(Edge)) {
+      SolverTy::processNormalFlow(Edge);
+    }
+  }
+
+  void processExit(PathEdge<n_t, d_t> Edge) override {
+    if (!deferIfIrrelevant(Edge)) {
+      SolverTy::processExit(Edge);
+    }
+  }
+
+  void resumeDeferredEdges() {
+    std::vector<n_t> Resume;
+    Resume.swap(NewlyRelevant);
+    for (n_t Stmt : Resume) {
+      auto Search = Deferred.find(Stmt);
+      if (Search == Deferred.end()) {
+        continue;
+      }
+      auto Edges = std::move(Search->second);
+      Deferred.erase(Search);
+      for (const auto &[Source, Target] : Edges) {
+        this->pathEdgeProcessingTask(PathEdge<n_t, d_t>(Source, Stmt, Target));
+      }
+    }
+  }
+
+  /**
+   * Phase II of the IDE algorithm restricted to the relevant nodes.
+   */
+  void computeValuesOnSlice() {
+    this->valtab.clear();
+    std::map<n_t, std::set<d_t>> AllSeeds(this->initialSeeds);
+    for (n_t UnbalancedRetSite : this->unbalancedRetSites) {
+      if (AllSeeds[UnbalancedRetSite].empty()) {
+        AllSeeds[UnbalancedRetSite] = {this->ZeroValue};
+      }
+    }
+    for (const auto &[StartPoint, Facts] : AllSeeds) {
+      for (d_t Fact : Facts) {
+        this->setVal(StartPoint, Fact, this->IDEProblem.topElement());
+        this->valuePropagationTask(std::make_pair(StartPoint, Fact));
+      }
+    }
+    std::vector<n_t> Nodes;
+    for (const auto &Entry : Relevant) {
+      if (!this->ICF->isCallStmt(Entry.first) &&
+          !this->ICF->isStartPoint(Entry.first)) {
+        Nodes.push_back(Entry.first);
+      }
+    }
+    this->valueComputationTask(Nodes);
+  }
+};
+
+} // namespace psr
+
+#endif
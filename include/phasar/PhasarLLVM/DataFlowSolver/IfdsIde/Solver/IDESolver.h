@@ -17,6 +17,7 @@
 #ifndef PHASAR_PHASARLLVM_IFDSIDE_SOLVER_IDESOLVER_H_
 #define PHASAR_PHASARLLVM_IFDSIDE_SOLVER_IDESOLVER_H_
 
+#include <algorithm>
 #include <fstream>
 #include <iostream>
 #include <map>
@@ -25,8 +26,10 @@
 #include <string>
 #include <tuple>
 #include <type_traits>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
+#include <vector>
 
 #include "nlohmann/json.hpp"
 
@@ -41,17 +44,22 @@
 #include "phasar/PhasarLLVM/DataFlowSolver/IfdsIde/FlowFunctions.h"
 #include "phasar/PhasarLLVM/DataFlowSolver/IfdsIde/IDETabulationProblem.h"
 #include "phasar/PhasarLLVM/DataFlowSolver/IfdsIde/JoinLattice.h"
+#include "phasar/PhasarLLVM/DataFlowSolver/IfdsIde/ResultStore.h"
 #include "phasar/PhasarLLVM/DataFlowSolver/IfdsIde/Solver/IFDSToIDETabulationProblem.h"
 #include "phasar/PhasarLLVM/DataFlowSolver/IfdsIde/Solver/JoinHandlingNode.h"
 #include "phasar/PhasarLLVM/DataFlowSolver/IfdsIde/Solver/JumpFunctions.h"
 #include "phasar/PhasarLLVM/DataFlowSolver/IfdsIde/Solver/LinkedNode.h"
 #include "phasar/PhasarLLVM/DataFlowSolver/IfdsIde/Solver/PathEdge.h"
 #include "phasar/PhasarLLVM/DataFlowSolver/IfdsIde/ZeroedFlowFunction.h"
+#include "phasar/PhasarLLVM/Utils/BinaryDomain.h"
 #include "phasar/PhasarLLVM/Utils/DOTGraph.h"
+#include "phasar/Utils/JsonWriter.h"
 #include "phasar/Utils/LLVMShorthands.h"
 #include "phasar/Utils/Logger.h"
 #include "phasar/Utils/PAMMMacros.h"
+#include "phasar/Utils/SarifWriter.h"
 #include "phasar/Utils/Table.h"
+#include "phasar/Utils/TraceRecorder.h"
 
 namespace psr {
 
@@ -79,6 +87,13 @@ template <typename N, typename D, typename F, typename T, typename V,
 class IDESolver {
 public:
   using ProblemTy = IDETabulationProblem<N, D, F, T, V, L, I>;
+  using n_t = N;
+  using d_t = D;
+  using f_t = F;
+  using t_t = T;
+  using v_t = V;
+  using l_t = L;
+  using i_t = I;
 
   IDESolver(IDETabulationProblem<N, D, F, T, V, L, I> &Problem)
       : IDEProblem(Problem), ZeroValue(Problem.getZeroValue()),
@@ -86,7 +101,9 @@ public:
         cachedFlowEdgeFunctions(Problem), allTop(Problem.allTopFunction()),
         jumpFn(std::make_shared<JumpFunctions<N, D, F, T, V, L, I>>(
             allTop, IDEProblem)),
-        initialSeeds(Problem.initialSeeds()) {}
+        initialSeeds(Problem.initialSeeds()) {
+    initializeTraceRecorder();
+  }
 
   IDESolver &operator=(IDESolver &&) = delete;
 
@@ -103,9 +120,10 @@ public:
       for (auto cell : results) {
         cells.push_back(cell);
       }
-      sort(cells.begin(), cells.end(),
-           [](typename Table<N, D, L>::Cell a,
-              typename Table<N, D, L>::Cell b) { return a.r < b.r; });
+      // the cells are ordered by node and fact, which is kept within a node
+      stable_sort(cells.begin(), cells.end(),
+                  [](typename Table<N, D, L>::Cell a,
+                     typename Table<N, D, L>::Cell b) { return a.r < b.r; });
       N curr;
       for (unsigned i = 0; i < cells.size(); ++i) {
         curr = cells[i].r;
@@ -124,6 +142,102 @@ public:
     return J;
   }
 
+  /**
+   * @brief Writes the same document as getAsJson() to OS, but streams it node
+   * by node instead of building it in memory first. Nodes are ordered by their
+   * names and each fact is written as a [fact, value] pair.
+   */
+  virtual void emitJsonReport(std::ostream &OS = std::cout) {
+    JsonWriter W(OS);
+    W.beginObject();
+    W.key("DataFlow");
+    auto Nodes = this->valtab.rowKeySet();
+    if (Nodes.empty()) {
+      W.value("EMPTY");
+    } else {
+      // only the names are kept in memory, nodes that share a name are merged
+      // into one entry like in getAsJson()
+      std::map<std::string, std::vector<N>> NamedNodes;
+      for (auto Node : Nodes) {
+        NamedNodes[getNodeName(Node)].push_back(Node);
+      }
+      W.beginObject();
+      for (const auto &[Name, SameNamedNodes] : NamedNodes) {
+        W.key(Name);
+        W.beginObject();
+        W.key("Facts");
+        W.beginArray();
+        for (auto Node : SameNamedNodes) {
+          std::vector<std::pair<D, L>> Row(this->valtab.row(Node).begin(),
+                                           this->valtab.row(Node).end());
+          std::sort(Row.begin(), Row.end(),
+                    [](const auto &Lhs, const auto &Rhs) {
+                      return Lhs.first < Rhs.first;
+                    });
+          for (const auto &[Fact, Value] : Row) {
+            W.beginArray();
+            W.value(getTrimmed(IDEProblem.DtoString(Fact)));
+            W.value(getTrimmed(IDEProblem.LtoString(Value)));
+            W.endArray();
+          }
+        }
+        W.endArray();
+        W.endObject();
+      }
+      W.endObject();
+    }
+    W.endObject();
+    OS << '\n';
+  }
+
+  /**
+   * @brief Writes the results to a memory-mappable ResultStore at the given
+   * path. Nodes are keyed by their ID annotations, if they have one. Throws
+   * std::ios_base::failure if the store could not be written.
+   */
+  virtual void emitResultStore(const std::string &Path) {
+    ResultStoreWriter Writer;
+    // intern the facts, such that each one is printed only once
+    std::unordered_map<D, uint32_t> FactIds;
+    for (auto Node : this->valtab.rowKeySet()) {
+      uint32_t NodeId = Writer.addNode(getNodeKey(Node), getNodeName(Node));
+      for (auto &[Fact, Value] : this->valtab.row(Node)) {
+        auto [It, Inserted] = FactIds.try_emplace(Fact, 0);
+        if (Inserted) {
+          It->second = Writer.addFact(getTrimmed(IDEProblem.DtoString(Fact)));
+        }
+        uint32_t ValueId =
+            Writer.addValue(getTrimmed(IDEProblem.LtoString(Value)));
+        Writer.addCell(NodeId, It->second, ValueId);
+      }
+    }
+    Writer.write(Path);
+  }
+
+  /**
+   * @brief Writes the results as a SARIF log to OS, every non-zero fact that
+   * holds at an instruction is reported as a note at that instruction.
+   */
+  virtual void emitSarifReport(std::ostream &OS = std::cout) {
+    SarifWriter SW(OS);
+    for (auto Node : this->valtab.rowKeySet()) {
+      SarifWriter::Location Loc;
+      if constexpr (std::is_convertible_v<N, const llvm::Value *>) {
+        Loc = SarifWriter::getLocationOf(Node);
+      }
+      for (auto &[Fact, Value] : this->valtab.row(Node)) {
+        if (IDEProblem.isZeroValue(Fact)) {
+          continue;
+        }
+        std::string Message = getTrimmed(IDEProblem.DtoString(Fact));
+        if constexpr (!std::is_same_v<L, BinaryDomain>) {
+          Message += " = " + getTrimmed(IDEProblem.LtoString(Value));
+        }
+        SW.addResult("DataFlow", SarifWriter::Level::Note, Message, Loc);
+      }
+    }
+  }
+
   /**
    * @brief Runs the solver on the configured problem. This can take some time.
    */
@@ -148,32 +262,51 @@ public:
     REG_HISTOGRAM("Data-flow facts", PAMM_SEVERITY_LEVEL::Full);
     REG_HISTOGRAM("Points-to", PAMM_SEVERITY_LEVEL::Full);
 
-    auto &lg = lg::get();
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, INFO)
-                  << "IDE solver is solving the specified problem");
+    PHASAR_LOG_LEVEL_CAT(INFO, Solver,
+                         "IDE solver is solving the specified problem");
     // computations starting here
     START_TIMER("DFA Phase I", PAMM_SEVERITY_LEVEL::Full);
+    auto PhaseStart = TraceRecorder::Clock_t::now();
     // We start our analysis and construct exploded supergraph
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, INFO)
-                  << "Submit initial seeds, construct exploded super graph");
+    PHASAR_LOG_LEVEL_CAT(
+        INFO, Solver, "Submit initial seeds, construct exploded super graph");
     submitInitialSeeds();
     STOP_TIMER("DFA Phase I", PAMM_SEVERITY_LEVEL::Full);
+    if (Trace) {
+      Trace->record("DFA Phase I", "phase", "", PhaseStart,
+                    TraceRecorder::Clock_t::now());
+    }
     if (SolverConfig.computeValues) {
       START_TIMER("DFA Phase II", PAMM_SEVERITY_LEVEL::Full);
+      PhaseStart = TraceRecorder::Clock_t::now();
       // Computing the final values for the edge functions
-      LOG_IF_ENABLE(
-          BOOST_LOG_SEV(lg, INFO)
-          << "Compute the final values according to the edge functions");
+      PHASAR_LOG_LEVEL_CAT(
+          INFO, Solver,
+          "Compute the final values according to the edge functions");
       computeValues();
       STOP_TIMER("DFA Phase II", PAMM_SEVERITY_LEVEL::Full);
+      if (Trace) {
+        Trace->record("DFA Phase II", "phase", "", PhaseStart,
+                      TraceRecorder::Clock_t::now());
+      }
     }
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, INFO) << "Problem solved");
+    if (SolverConfig.computePersistedSummaries) {
+      // after value computation, such that the contexts do not receive values
+      submitSummaryContexts();
+    }
+    PHASAR_LOG_LEVEL_CAT(INFO, Solver, "Problem solved");
     if constexpr (PAMM_CURR_SEV_LEVEL >= PAMM_SEVERITY_LEVEL::Core) {
       computeAndPrintStatistics();
     }
     if (SolverConfig.emitESG) {
       emitESGasDot();
     }
+    if (Trace) {
+      PHASAR_LOG_LEVEL_CAT(INFO, Solver,
+                           "Export solver trace to: "
+                           << SolverConfig.traceFile);
+      Trace->exportChromeTrace(SolverConfig.traceFile);
+    }
   }
 
   /**
@@ -215,48 +348,32 @@ public:
     OS << "\n***************************************************************\n"
        << "*                  Raw IDESolver results                      *\n"
        << "***************************************************************\n";
-    auto cells = this->valtab.cellVec();
-    if (cells.empty()) {
+    auto Nodes = this->valtab.rowKeySet();
+    if (Nodes.empty()) {
       OS << "No results computed!" << std::endl;
     } else {
-      llvmValueIDLess llvmIDLess;
-      std::sort(cells.begin(), cells.end(),
-                [&llvmIDLess](
-                    auto a,
-                    auto b)
-                    {
-                  if (!llvmIDLess(a.r, b.r) && !llvmIDLess(b.r, a.r)) {
-                    if constexpr (std::is_same<D, const llvm::Value
-                    *>::value) {
-                      return llvmIDLess(a.c, b.c);
-                    } else {
-                      // If D is user defined we should use the user defined
-                      // less-than comparison
-                      return a.c < b.c;
-                    }
-                  }
-                  return llvmIDLess(a.r, b.r);
-                });
-      N prev = N{};
-      N curr = N{};
       F prevFn = F{};
       F currFn = F{};
-      for (unsigned i = 0; i < cells.size(); ++i) {
-        curr = cells[i].r;
+      for (auto curr :
+           getDumpOrder(std::vector<N>(Nodes.begin(), Nodes.end()))) {
         currFn = ICF->getFunctionOf(curr);
         if (prevFn != currFn) {
           prevFn = currFn;
           OS << "\n\n============ Results for function '" +
                     ICF->getFunctionName(currFn) + "' ============\n";
         }
-        if (prev != curr) {
-          prev = curr;
-          std::string NString = IDEProblem.NtoString(curr);
-          std::string line(NString.size(), '-');
-          OS << "\n\nN: " << NString << "\n---" << line << '\n';
+        std::string NString = IDEProblem.NtoString(curr);
+        std::string line(NString.size(), '-');
+        OS << "\n\nN: " << NString << "\n---" << line << '\n';
+        auto &Row = this->valtab.row(curr);
+        std::vector<D> RowFacts;
+        for (auto &[Fact, Value] : Row) {
+          RowFacts.push_back(Fact);
+        }
+        for (auto Fact : getDumpOrder(std::move(RowFacts))) {
+          OS << "\tD: " << IDEProblem.DtoString(Fact)
+             << " | V: " << IDEProblem.LtoString(Row[Fact]) << '\n';
         }
-        OS << "\tD: " << IDEProblem.DtoString(cells[i].c)
-           << " | V: " << IDEProblem.LtoString(cells[i].v) << '\n';
       }
     }
     OS << '\n';
@@ -307,6 +424,12 @@ public:
     return SolverResults<N, D, L>(this->valtab, IDEProblem.getZeroValue());
   }
 
+  /**
+   * Returns the recorder holding the sampled solver events or nullptr if
+   * tracing is disabled, see IFDSIDESolverConfig::traceFile.
+   */
+  const TraceRecorder *getTraceRecorder() const { return Trace.get(); }
+
 protected:
   // have a shared point to allow for a copy constructor of IDESolver
   std::unique_ptr<IFDSToIDETabulationProblem<N, D, F, T, V, I>>
@@ -349,6 +472,66 @@ protected:
 
   std::map<std::pair<N, D>, size_t> fSummaryReuse;
 
+  // records sampled solver events if a trace file is configured
+  std::unique_ptr<TraceRecorder> Trace;
+
+  void initializeTraceRecorder() {
+    if (!SolverConfig.traceFile.empty()) {
+      Trace = std::make_unique<TraceRecorder>(SolverConfig.traceSampleRate);
+      cachedFlowEdgeFunctions.setTraceRecorder(Trace.get());
+    }
+  }
+
+  std::string getTraceDetail(N n) const {
+    return ICF->getFunctionName(ICF->getFunctionOf(n));
+  }
+
+  static std::string getTrimmed(std::string S) {
+    boost::algorithm::trim(S);
+    return S;
+  }
+
+  // the name of a node in the JSON reports, qualified by its function
+  std::string getNodeName(N n) const {
+    return ICF->getFunctionName(ICF->getFunctionOf(n)) +
+           "::" + getTrimmed(IDEProblem.NtoString(n));
+  }
+
+  // the key of a node in a result store, its ID annotation if it has one
+  std::string getNodeKey(N n) const {
+    if constexpr (std::is_convertible_v<N, const llvm::Value *>) {
+      std::string ID = getMetaDataID(n);
+      if (ID != "-1") {
+        return ID;
+      }
+    }
+    return getNodeName(n);
+  }
+
+  // sorts nodes or facts in the order of their ID annotations, see
+  // llvmValueIDLess, other values are sorted by their less-than comparison
+  template <typename ElemT>
+  static std::vector<ElemT> getDumpOrder(std::vector<ElemT> Vs) {
+    if constexpr (std::is_convertible_v<ElemT, const llvm::Value *>) {
+      // compute the keys once instead of in every comparison
+      std::vector<std::pair<std::tuple<bool, long, std::string>, ElemT>> Keyed;
+      Keyed.reserve(Vs.size());
+      for (auto Elem : Vs) {
+        Keyed.emplace_back(getMetaDataIDKey(Elem), Elem);
+      }
+      std::stable_sort(Keyed.begin(), Keyed.end(),
+                       [](const auto &Lhs, const auto &Rhs) {
+                         return Lhs.first < Rhs.first;
+                       });
+      for (size_t Idx = 0; Idx < Keyed.size(); ++Idx) {
+        Vs[Idx] = Keyed[Idx].second;
+      }
+    } else {
+      std::sort(Vs.begin(), Vs.end());
+    }
+    return Vs;
+  }
+
   // When transforming an IFDSTabulationProblem into an IDETabulationProblem,
   // we need to allocate dynamically, otherwise the objects lifetime runs out
   // - as a modifiable r-value reference created here that should be stored in
@@ -366,7 +549,9 @@ protected:
         allTop(IDEProblem.allTopFunction()),
         jumpFn(std::make_shared<JumpFunctions<N, D, F, T, V, L, I>>(
             allTop, IDEProblem)),
-        initialSeeds(IDEProblem.initialSeeds()) {}
+        initialSeeds(IDEProblem.initialSeeds()) {
+    initializeTraceRecorder();
+  }
 
   /**
    * Lines 13-20 of the algorithm; processing a call site in the caller's
@@ -389,27 +574,28 @@ protected:
   virtual void processCall(PathEdge<N, D> edge) {
     PAMM_GET_INSTANCE;
     INC_COUNTER("Process Call", 1, PAMM_SEVERITY_LEVEL::Full);
-    auto &lg = lg::get();
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                  << "Process call at target: "
-                  << IDEProblem.NtoString(edge.getTarget()));
+    TraceRecorder::Scope TS(Trace.get(), "Process Call", "solver");
+    if (TS) {
+      TS.setDetail(getTraceDetail(edge.getTarget()));
+    }
+    PHASAR_LOG_LEVEL_CAT(DEBUG, Solver,
+                         "Process call at target: "
+                         << IDEProblem.NtoString(edge.getTarget()));
     D d1 = edge.factAtSource();
     N n = edge.getTarget(); // a call node; line 14...
     D d2 = edge.factAtTarget();
     std::shared_ptr<EdgeFunction<L>> f = jumpFunction(edge);
     std::set<N> returnSiteNs = ICF->getReturnSitesOfCallAt(n);
     std::set<F> callees = ICF->getCalleesOfCallAt(n);
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << "Possible callees:");
+    PHASAR_LOG_LEVEL_CAT(DEBUG, Solver, "Possible callees:");
     for (auto callee : callees) {
-      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                    << "  " << callee->getName().str());
+      PHASAR_LOG_LEVEL_CAT(DEBUG, Solver, "  " << callee->getName().str());
     }
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << "Possible return sites:");
+    PHASAR_LOG_LEVEL_CAT(DEBUG, Solver, "Possible return sites:");
     for (auto ret : returnSiteNs) {
-      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                    << "  " << IDEProblem.NtoString(ret));
+      PHASAR_LOG_LEVEL_CAT(DEBUG, Solver, "  " << IDEProblem.NtoString(ret));
     }
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << ' ');
+    PHASAR_LOG_LEVEL_CAT(DEBUG, Solver, ' ');
     // for each possible callee
     for (F sCalledProcN : callees) { // still line 14
       // check if a special summary for the called procedure exists
@@ -418,8 +604,8 @@ protected:
       // if a special summary is available, treat this as a normal flow
       // and use the summary flow and edge functions
       if (specialSum) {
-        LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                      << "Found and process special summary");
+        PHASAR_LOG_LEVEL_CAT(DEBUG, Solver,
+                             "Found and process special summary");
         for (N returnSiteN : returnSiteNs) {
           std::set<D> res = computeSummaryFlowFunction(specialSum, d1, d2);
           INC_COUNTER("SpecialSummary-FF Application", 1,
@@ -431,15 +617,14 @@ protected:
             std::shared_ptr<EdgeFunction<L>> sumEdgFnE =
                 cachedFlowEdgeFunctions.getSummaryEdgeFunction(n, d2,
                                                                returnSiteN, d3);
-            LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                          << "Queried Summary Edge Function: "
-                          << sumEdgFnE->str());
+            PHASAR_LOG_LEVEL_CAT(DEBUG, Solver,
+                                 "Queried Summary Edge Function: "
+                                 << sumEdgFnE->str());
             INC_COUNTER("SpecialSummary-EF Queries", 1,
                         PAMM_SEVERITY_LEVEL::Full);
-            LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                          << "Compose: " << sumEdgFnE->str() << " * "
-                          << f->str());
-            LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << ' ');
+            PHASAR_LOG_LEVEL_CAT(DEBUG, Solver, "Compose: " << sumEdgFnE->str()
+                                 << " * " << f->str());
+            PHASAR_LOG_LEVEL_CAT(DEBUG, Solver, ' ');
             propagate(d1, returnSiteN, d3, f->composeWith(sumEdgFnE), n, false);
           }
         }
@@ -454,11 +639,11 @@ protected:
         // for each callee's start point(s)
         std::set<N> startPointsOf = ICF->getStartPointsOf(sCalledProcN);
         if (startPointsOf.empty()) {
-          LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                        << "Start points of '" +
-                               ICF->getFunctionName(sCalledProcN) +
-                               "' currently not available!");
-          LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << ' ');
+          PHASAR_LOG_LEVEL_CAT(DEBUG, Solver,
+                               "Start points of '" +
+                                   ICF->getFunctionName(sCalledProcN) +
+                                   "' currently not available!");
+          PHASAR_LOG_LEVEL_CAT(DEBUG, Solver, ' ');
         }
         // if startPointsOf is empty, the called function is a declaration
         for (N sP : startPointsOf) {
@@ -466,11 +651,15 @@ protected:
           // for each result node of the call-flow function
           for (D d3 : res) {
             // create initial self-loop
-            LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                          << "Create initial self-loop with D: "
-                          << IDEProblem.DtoString(d3));
-            propagate(d3, sP, d3, EdgeIdentity<L>::getInstance(), n,
-                      false); // line 15
+            PHASAR_LOG_LEVEL_CAT(DEBUG, Solver,
+                                 "Create initial self-loop with D: "
+                                 << IDEProblem.DtoString(d3));
+            // a stored summary of <sP,d3> makes descending into the callee
+            // unnecessary
+            if (!applyStoredSummary(sP, d3)) {
+              propagate(d3, sP, d3, EdgeIdentity<L>::getInstance(), n,
+                        false); // line 15
+            }
             // register the fact that <sp,d3> has an incoming edge from <n,d2>
             // line 15.1 of Naeem/Lhotak/Rodriguez
             addIncoming(sP, d3, n, d2);
@@ -517,15 +706,16 @@ protected:
                   std::shared_ptr<EdgeFunction<L>> f4 =
                       cachedFlowEdgeFunctions.getCallEdgeFunction(
                           n, d2, sCalledProcN, d3);
-                  LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                                << "Queried Call Edge Function: " << f4->str());
+                  PHASAR_LOG_LEVEL_CAT(DEBUG, Solver,
+                                       "Queried Call Edge Function: "
+                                       << f4->str());
                   // get return edge function
                   std::shared_ptr<EdgeFunction<L>> f5 =
                       cachedFlowEdgeFunctions.getReturnEdgeFunction(
                           n, sCalledProcN, eP, d4, retSiteN, d5);
-                  LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                                << "Queried Return Edge Function: "
-                                << f5->str());
+                  PHASAR_LOG_LEVEL_CAT(DEBUG, Solver,
+                                       "Queried Return Edge Function: "
+                                       << f5->str());
                   if (SolverConfig.emitESG) {
                     for (auto sP : ICF->getStartPointsOf(sCalledProcN)) {
                       intermediateEdgeFunctions[std::make_tuple(n, d2, sP, d3)]
@@ -537,22 +727,23 @@ protected:
                   }
                   INC_COUNTER("EF Queries", 2, PAMM_SEVERITY_LEVEL::Full);
                   // compose call * calleeSummary * return edge functions
-                  LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                                << "Compose: " << f5->str() << " * "
-                                << fCalleeSummary->str() << " * " << f4->str());
-                  LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                                << "         (return * calleeSummary * call)");
+                  PHASAR_LOG_LEVEL_CAT(DEBUG, Solver, "Compose: " << f5->str()
+                                       << " * " << fCalleeSummary->str()
+                                       << " * " << f4->str());
+                  PHASAR_LOG_LEVEL_CAT(
+                      DEBUG, Solver,
+                      "         (return * calleeSummary * call)");
                   std::shared_ptr<EdgeFunction<L>> fPrime =
                       f4->composeWith(fCalleeSummary)->composeWith(f5);
-                  LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                                << "       = " << fPrime->str());
-                  LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << ' ');
+                  PHASAR_LOG_LEVEL_CAT(DEBUG, Solver,
+                                       "       = " << fPrime->str());
+                  PHASAR_LOG_LEVEL_CAT(DEBUG, Solver, ' ');
                   D d5_restoredCtx = restoreContextOnReturnedFact(n, d2, d5);
                   // propagte the effects of the entire call
-                  LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                                << "Compose: " << fPrime->str() << " * "
-                                << f->str());
-                  LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << ' ');
+                  PHASAR_LOG_LEVEL_CAT(DEBUG, Solver,
+                                       "Compose: " << fPrime->str() << " * "
+                                       << f->str());
+                  PHASAR_LOG_LEVEL_CAT(DEBUG, Solver, ' ');
                   propagate(d1, retSiteN, d5_restoredCtx,
                             f->composeWith(fPrime), n, false);
                 }
@@ -577,19 +768,18 @@ protected:
           std::shared_ptr<EdgeFunction<L>> edgeFnE =
               cachedFlowEdgeFunctions.getCallToRetEdgeFunction(
                   n, d2, returnSiteN, d3, callees);
-          LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                        << "Queried Call-to-Return Edge Function: "
-                        << edgeFnE->str());
+          PHASAR_LOG_LEVEL_CAT(DEBUG, Solver,
+                               "Queried Call-to-Return Edge Function: "
+                               << edgeFnE->str());
           if (SolverConfig.emitESG) {
             intermediateEdgeFunctions[std::make_tuple(n, d2, returnSiteN, d3)]
                 .push_back(edgeFnE);
           }
           INC_COUNTER("EF Queries", 1, PAMM_SEVERITY_LEVEL::Full);
           auto fPrime = f->composeWith(edgeFnE);
-          LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                        << "Compose: " << edgeFnE->str() << " * " << f->str()
-                        << " = " << fPrime->str());
-          LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << ' ');
+          PHASAR_LOG_LEVEL_CAT(DEBUG, Solver, "Compose: " << edgeFnE->str()
+                               << " * " << f->str() << " = " << fPrime->str());
+          PHASAR_LOG_LEVEL_CAT(DEBUG, Solver, ' ');
           propagate(d1, returnSiteN, d3, fPrime, n, false);
         }
       }
@@ -604,10 +794,13 @@ protected:
   virtual void processNormalFlow(PathEdge<N, D> edge) {
     PAMM_GET_INSTANCE;
     INC_COUNTER("Process Normal", 1, PAMM_SEVERITY_LEVEL::Full);
-    auto &lg = lg::get();
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                  << "Process normal at target: "
-                  << IDEProblem.NtoString(edge.getTarget()));
+    TraceRecorder::Scope TS(Trace.get(), "Process Normal", "solver");
+    if (TS) {
+      TS.setDetail(getTraceDetail(edge.getTarget()));
+    }
+    PHASAR_LOG_LEVEL_CAT(DEBUG, Solver,
+                         "Process normal at target: "
+                         << IDEProblem.NtoString(edge.getTarget()));
     D d1 = edge.factAtSource();
     N n = edge.getTarget();
     D d2 = edge.factAtTarget();
@@ -624,17 +817,16 @@ protected:
       for (D d3 : res) {
         std::shared_ptr<EdgeFunction<L>> g =
             cachedFlowEdgeFunctions.getNormalEdgeFunction(n, d2, fn, d3);
-        LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                      << "Queried Normal Edge Function: " << g->str());
+        PHASAR_LOG_LEVEL_CAT(DEBUG, Solver,
+                             "Queried Normal Edge Function: " << g->str());
         std::shared_ptr<EdgeFunction<L>> fprime = f->composeWith(g);
         if (SolverConfig.emitESG) {
           intermediateEdgeFunctions[std::make_tuple(n, d2, fn, d3)].push_back(
               fprime);
         }
-        LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                      << "Compose: " << g->str() << " * " << f->str() << " = "
-                      << fprime->str());
-        LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << ' ');
+        PHASAR_LOG_LEVEL_CAT(DEBUG, Solver, "Compose: " << g->str() << " * "
+                             << f->str() << " = " << fprime->str());
+        PHASAR_LOG_LEVEL_CAT(DEBUG, Solver, ' ');
         INC_COUNTER("EF Queries", 1, PAMM_SEVERITY_LEVEL::Full);
         propagate(d1, fn, d3, fprime, nullptr, false);
       }
@@ -659,7 +851,6 @@ protected:
 
   void propagateValueAtCall(std::pair<N, D> nAndD, N n) {
     PAMM_GET_INSTANCE;
-    auto &lg = lg::get();
     D d = nAndD.second;
     for (F q : ICF->getCalleesOfCallAt(n)) {
       std::shared_ptr<FlowFunction<D>> callFlowFunction =
@@ -668,8 +859,8 @@ protected:
       for (D dPrime : callFlowFunction->computeTargets(d)) {
         std::shared_ptr<EdgeFunction<L>> edgeFn =
             cachedFlowEdgeFunctions.getCallEdgeFunction(n, d, q, dPrime);
-        LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                      << "Queried Call Edge Function: " << edgeFn->str());
+        PHASAR_LOG_LEVEL_CAT(DEBUG, Solver,
+                             "Queried Call Edge Function: " << edgeFn->str());
         if (SolverConfig.emitESG) {
           for (auto sP : ICF->getStartPointsOf(q)) {
             intermediateEdgeFunctions[std::make_tuple(n, d, sP, dPrime)]
@@ -704,7 +895,6 @@ protected:
   }
 
   void setVal(N nHashN, D nHashD, L l) {
-    auto &lg = lg::get();
     // TOP is the implicit default value which we do not need to store.
     if (l == IDEProblem.topElement()) {
       // do not store top values
@@ -712,42 +902,41 @@ protected:
     } else {
       valtab.insert(nHashN, nHashD, l);
     }
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                  << "Function : "
-                  << ICF->getFunctionOf(nHashN)->getName().str());
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                  << "Inst.    : " << IDEProblem.NtoString(nHashN));
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                  << "Fact     : " << IDEProblem.DtoString(nHashD));
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                  << "Value    : " << IDEProblem.LtoString(l));
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << ' ');
+    PHASAR_LOG_LEVEL_CAT(DEBUG, Solver,
+                         "Function : "
+                         << ICF->getFunctionOf(nHashN)->getName().str());
+    PHASAR_LOG_LEVEL_CAT(DEBUG, Solver,
+                         "Inst.    : " << IDEProblem.NtoString(nHashN));
+    PHASAR_LOG_LEVEL_CAT(DEBUG, Solver,
+                         "Fact     : " << IDEProblem.DtoString(nHashD));
+    PHASAR_LOG_LEVEL_CAT(DEBUG, Solver, "Value    : "
+                         << IDEProblem.LtoString(l));
+    PHASAR_LOG_LEVEL_CAT(DEBUG, Solver, ' ');
   }
 
   std::shared_ptr<EdgeFunction<L>> jumpFunction(PathEdge<N, D> edge) {
-    auto &lg = lg::get();
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << " ");
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << "JumpFunctions Forward-Lookup:");
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                  << "   Source D: "
-                  << IDEProblem.DtoString(edge.factAtSource()));
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                  << "   Target N: " << IDEProblem.NtoString(edge.getTarget()));
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                  << "   Target D: "
-                  << IDEProblem.DtoString(edge.factAtTarget()));
+    PHASAR_LOG_LEVEL_CAT(DEBUG, Solver, " ");
+    PHASAR_LOG_LEVEL_CAT(DEBUG, Solver, "JumpFunctions Forward-Lookup:");
+    PHASAR_LOG_LEVEL_CAT(DEBUG, Solver,
+                         "   Source D: "
+                         << IDEProblem.DtoString(edge.factAtSource()));
+    PHASAR_LOG_LEVEL_CAT(DEBUG, Solver,
+                         "   Target N: "
+                         << IDEProblem.NtoString(edge.getTarget()));
+    PHASAR_LOG_LEVEL_CAT(DEBUG, Solver,
+                         "   Target D: "
+                         << IDEProblem.DtoString(edge.factAtTarget()));
     if (!jumpFn->forwardLookup(edge.factAtSource(), edge.getTarget())
              .count(edge.factAtTarget())) {
-      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                    << "  => EdgeFn: " << allTop->str());
-      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << " ");
+      PHASAR_LOG_LEVEL_CAT(DEBUG, Solver, "  => EdgeFn: " << allTop->str());
+      PHASAR_LOG_LEVEL_CAT(DEBUG, Solver, " ");
       // JumpFn initialized to all-top, see line [2] in SRH96 paper
       return allTop;
     }
     auto res = jumpFn->forwardLookup(edge.factAtSource(),
                                      edge.getTarget())[edge.factAtTarget()];
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << "  => EdgeFn: " << res->str());
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << " ");
+    PHASAR_LOG_LEVEL_CAT(DEBUG, Solver, "  => EdgeFn: " << res->str());
+    PHASAR_LOG_LEVEL_CAT(DEBUG, Solver, " ");
     return res;
   }
 
@@ -762,25 +951,25 @@ protected:
   // should be made a callable at some point
   void pathEdgeProcessingTask(PathEdge<N, D> edge) {
     PAMM_GET_INSTANCE;
-    auto &lg = lg::get();
     INC_COUNTER("JumpFn Construction", 1, PAMM_SEVERITY_LEVEL::Full);
-    LOG_IF_ENABLE(
-        BOOST_LOG_SEV(lg, DEBUG)
-        << "-------------------------------------------- " << PathEdgeCount
-        << ". Path Edge --------------------------------------------");
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << ' ');
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                  << "Process " << PathEdgeCount << ". path edge:");
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                  << "< D source: " << IDEProblem.DtoString(edge.factAtSource())
-                  << " ;");
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                  << "  N target: " << IDEProblem.NtoString(edge.getTarget())
-                  << " ;");
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                  << "  D target: " << IDEProblem.DtoString(edge.factAtTarget())
-                  << " >");
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << ' ');
+    PHASAR_LOG_LEVEL_CAT(
+        DEBUG, Solver,
+        "-------------------------------------------- "
+            << PathEdgeCount
+            << ". Path Edge --------------------------------------------");
+    PHASAR_LOG_LEVEL_CAT(DEBUG, Solver, ' ');
+    PHASAR_LOG_LEVEL_CAT(DEBUG, Solver, "Process " << PathEdgeCount
+                         << ". path edge:");
+    PHASAR_LOG_LEVEL_CAT(DEBUG, Solver,
+                         "< D source: "
+                         << IDEProblem.DtoString(edge.factAtSource()) << " ;");
+    PHASAR_LOG_LEVEL_CAT(DEBUG, Solver,
+                         "  N target: "
+                         << IDEProblem.NtoString(edge.getTarget()) << " ;");
+    PHASAR_LOG_LEVEL_CAT(DEBUG, Solver,
+                         "  D target: "
+                         << IDEProblem.DtoString(edge.factAtTarget()) << " >");
+    PHASAR_LOG_LEVEL_CAT(DEBUG, Solver, ' ');
     bool isCall = ICF->isCallStmt(edge.getTarget());
 
     if (!isCall) {
@@ -846,8 +1035,7 @@ protected:
    * Computes the final values for edge functions.
    */
   void computeValues() {
-    auto &lg = lg::get();
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << "Start computing values");
+    PHASAR_LOG_LEVEL_CAT(DEBUG, Solver, "Start computing values");
     // Phase II(i)
     std::map<N, std::set<D>> allSeeds(initialSeeds);
     for (N unbalancedRetSite : unbalancedRetSites) {
@@ -883,15 +1071,14 @@ protected:
    * their own. Normally, solve() should be called instead.
    */
   void submitInitialSeeds() {
-    auto &lg = lg::get();
     PAMM_GET_INSTANCE;
     for (const auto &[StartPoint, Facts] : initialSeeds) {
-      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                    << "Start point: " << IDEProblem.NtoString(StartPoint));
+      PHASAR_LOG_LEVEL_CAT(DEBUG, Solver,
+                           "Start point: " << IDEProblem.NtoString(StartPoint));
       for (const auto &Fact : Facts) {
-        LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                      << "\tFact: " << IDEProblem.DtoString(Fact));
-        LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << ' ');
+        PHASAR_LOG_LEVEL_CAT(DEBUG, Solver,
+                             "\tFact: " << IDEProblem.DtoString(Fact));
+        PHASAR_LOG_LEVEL_CAT(DEBUG, Solver, ' ');
         if (!IDEProblem.isZeroValue(Fact)) {
           INC_COUNTER("Gen facts", 1, PAMM_SEVERITY_LEVEL::Core);
         }
@@ -903,6 +1090,39 @@ protected:
     }
   }
 
+  /**
+   * Submits a calling context for the zero value and each formal parameter of
+   * every entry point, i.e. for all facts a caller that is not known yet may
+   * pass in, such that their end summaries can be persisted.
+   */
+  void submitSummaryContexts() {
+    if constexpr (std::is_same_v<F, const llvm::Function *> &&
+                  std::is_same_v<D, const llvm::Value *>) {
+      for (const auto &EntryPoint : IDEProblem.getEntryPoints()) {
+        F Function = ICF->getFunction(EntryPoint);
+        if (!Function || Function->isDeclaration()) {
+          continue;
+        }
+        for (N StartPoint : ICF->getStartPointsOf(Function)) {
+          propagate(ZeroValue, StartPoint, ZeroValue,
+                    EdgeIdentity<L>::getInstance(), nullptr, false);
+          for (const auto &Arg : Function->args()) {
+            propagate(&Arg, StartPoint, &Arg, EdgeIdentity<L>::getInstance(),
+                      nullptr, false);
+          }
+        }
+      }
+    }
+  }
+
+  /**
+   * Installs the end summaries of <sP,d3> from a summary store instead of
+   * solving the callee's body. Returns false if no stored summary applies,
+   * which is always the case unless a subclass provides a store, see
+   * SummaryStoreSolver.
+   */
+  virtual bool applyStoredSummary(N sP, D d3) { return false; }
+
   /**
    * Lines 21-32 of the algorithm.
    *
@@ -915,10 +1135,13 @@ protected:
   virtual void processExit(PathEdge<N, D> edge) {
     PAMM_GET_INSTANCE;
     INC_COUNTER("Process Exit", 1, PAMM_SEVERITY_LEVEL::Full);
-    auto &lg = lg::get();
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                  << "Process exit at target: "
-                  << IDEProblem.NtoString(edge.getTarget()));
+    TraceRecorder::Scope TS(Trace.get(), "Process Exit", "solver");
+    if (TS) {
+      TS.setDetail(getTraceDetail(edge.getTarget()));
+    }
+    PHASAR_LOG_LEVEL_CAT(DEBUG, Solver,
+                         "Process exit at target: "
+                         << IDEProblem.NtoString(edge.getTarget()));
     N n = edge.getTarget(); // an exit node; line 21...
     std::shared_ptr<EdgeFunction<L>> f = jumpFunction(edge);
     F functionThatNeedsSummary = ICF->getFunctionOf(n);
@@ -964,14 +1187,14 @@ protected:
             std::shared_ptr<EdgeFunction<L>> f4 =
                 cachedFlowEdgeFunctions.getCallEdgeFunction(
                     c, d4, ICF->getFunctionOf(n), d1);
-            LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                          << "Queried Call Edge Function: " << f4->str());
+            PHASAR_LOG_LEVEL_CAT(DEBUG, Solver,
+                                 "Queried Call Edge Function: " << f4->str());
             // get return edge function
             std::shared_ptr<EdgeFunction<L>> f5 =
                 cachedFlowEdgeFunctions.getReturnEdgeFunction(
                     c, ICF->getFunctionOf(n), n, d2, retSiteC, d5);
-            LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                          << "Queried Return Edge Function: " << f5->str());
+            PHASAR_LOG_LEVEL_CAT(DEBUG, Solver,
+                                 "Queried Return Edge Function: " << f5->str());
             if (SolverConfig.emitESG) {
               for (auto sP : ICF->getStartPointsOf(ICF->getFunctionOf(n))) {
                 intermediateEdgeFunctions[std::make_tuple(c, d4, sP, d1)]
@@ -982,16 +1205,14 @@ protected:
             }
             INC_COUNTER("EF Queries", 2, PAMM_SEVERITY_LEVEL::Full);
             // compose call function * function * return function
-            LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                          << "Compose: " << f5->str() << " * " << f->str()
-                          << " * " << f4->str());
-            LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                          << "         (return * function * call)");
+            PHASAR_LOG_LEVEL_CAT(DEBUG, Solver, "Compose: " << f5->str()
+                                 << " * " << f->str() << " * " << f4->str());
+            PHASAR_LOG_LEVEL_CAT(DEBUG, Solver,
+                                 "         (return * function * call)");
             std::shared_ptr<EdgeFunction<L>> fPrime =
                 f4->composeWith(f)->composeWith(f5);
-            LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                          << "       = " << fPrime->str());
-            LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << ' ');
+            PHASAR_LOG_LEVEL_CAT(DEBUG, Solver, "       = " << fPrime->str());
+            PHASAR_LOG_LEVEL_CAT(DEBUG, Solver, ' ');
             // for each jump function coming into the call, propagate to
             // return site using the composed function
             for (auto valAndFunc : jumpFn->reverseLookup(c, d4)) {
@@ -999,10 +1220,9 @@ protected:
               if (!f3->equal_to(allTop)) {
                 D d3 = valAndFunc.first;
                 D d5_restoredCtx = restoreContextOnReturnedFact(c, d4, d5);
-                LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                              << "Compose: " << fPrime->str() << " * "
-                              << f3->str());
-                LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << ' ');
+                PHASAR_LOG_LEVEL_CAT(DEBUG, Solver, "Compose: " << fPrime->str()
+                                     << " * " << f3->str());
+                PHASAR_LOG_LEVEL_CAT(DEBUG, Solver, ' ');
                 propagate(d3, retSiteC, d5_restoredCtx, f3->composeWith(fPrime),
                           c, false);
               }
@@ -1035,16 +1255,16 @@ protected:
             std::shared_ptr<EdgeFunction<L>> f5 =
                 cachedFlowEdgeFunctions.getReturnEdgeFunction(
                     c, ICF->getFunctionOf(n), n, d2, retSiteC, d5);
-            LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                          << "Queried Return Edge Function: " << f5->str());
+            PHASAR_LOG_LEVEL_CAT(DEBUG, Solver,
+                                 "Queried Return Edge Function: " << f5->str());
             if (SolverConfig.emitESG) {
               intermediateEdgeFunctions[std::make_tuple(n, d2, retSiteC, d5)]
                   .push_back(f5);
             }
             INC_COUNTER("EF Queries", 1, PAMM_SEVERITY_LEVEL::Full);
-            LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                          << "Compose: " << f5->str() << " * " << f->str());
-            LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << ' ');
+            PHASAR_LOG_LEVEL_CAT(DEBUG, Solver, "Compose: " << f5->str()
+                                 << " * " << f->str());
+            PHASAR_LOG_LEVEL_CAT(DEBUG, Solver, ' ');
             propagteUnbalancedReturnFlow(retSiteC, d5, f->composeWith(f5), c);
             // register for value processing (2nd IDE phase)
             unbalancedRetSites.insert(retSiteC);
@@ -1185,18 +1405,16 @@ protected:
             std::shared_ptr<EdgeFunction<L>> f,
             /* deliberately exposed to clients */ N relatedCallSite,
             /* deliberately exposed to clients */ bool isUnbalancedReturn) {
-    auto &lg = lg::get();
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << "Propagate flow");
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                  << "Source value  : " << IDEProblem.DtoString(sourceVal));
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                  << "Target        : " << IDEProblem.NtoString(target));
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                  << "Target value  : " << IDEProblem.DtoString(targetVal));
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                  << "Edge function : " << f.get()->str()
-                  << " (result of previous compose)");
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << ' ');
+    PHASAR_LOG_LEVEL_CAT(DEBUG, Solver, "Propagate flow");
+    PHASAR_LOG_LEVEL_CAT(DEBUG, Solver,
+                         "Source value  : " << IDEProblem.DtoString(sourceVal));
+    PHASAR_LOG_LEVEL_CAT(DEBUG, Solver,
+                         "Target        : " << IDEProblem.NtoString(target));
+    PHASAR_LOG_LEVEL_CAT(DEBUG, Solver,
+                         "Target value  : " << IDEProblem.DtoString(targetVal));
+    PHASAR_LOG_LEVEL_CAT(DEBUG, Solver, "Edge function : " << f.get()->str()
+                         << " (result of previous compose)");
+    PHASAR_LOG_LEVEL_CAT(DEBUG, Solver, ' ');
     std::shared_ptr<EdgeFunction<L>> jumpFnE = nullptr;
     std::shared_ptr<EdgeFunction<L>> fPrime;
     if (!jumpFn->reverseLookup(target, targetVal).empty()) {
@@ -1207,33 +1425,35 @@ protected:
     }
     fPrime = jumpFnE->joinWith(f);
     bool newFunction = !(fPrime->equal_to(jumpFnE));
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                  << "Join: " << jumpFnE->str() << " & " << f.get()->str()
-                  << (jumpFnE->equal_to(f) ? " (EF's are equal)" : " "));
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                  << "    = " << fPrime->str()
-                  << (newFunction ? " (new jump func)" : " "));
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << ' ');
+    PHASAR_LOG_LEVEL_CAT(DEBUG, Solver, "Join: " << jumpFnE->str() << " & "
+                         << f.get()->str()
+                         << (jumpFnE->equal_to(f) ? " (EF's are equal)" : " "));
+    PHASAR_LOG_LEVEL_CAT(DEBUG, Solver, "    = " << fPrime->str()
+                         << (newFunction ? " (new jump func)" : " "));
+    PHASAR_LOG_LEVEL_CAT(DEBUG, Solver, ' ');
     if (newFunction) {
       jumpFn->addFunction(sourceVal, target, targetVal, fPrime);
       PathEdge<N, D> edge(sourceVal, target, targetVal);
       PathEdgeCount++;
       pathEdgeProcessingTask(edge);
       if (!IDEProblem.isZeroValue(targetVal)) {
-        LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                      << "EDGE: <F: " << target->getFunction()->getName().str()
-                      << ", D: " << IDEProblem.DtoString(sourceVal) << '>');
-        LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                      << " ---> <N: " << IDEProblem.NtoString(target) << ',');
-        LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                      << "       D: " << IDEProblem.DtoString(targetVal)
-                      << ',');
-        LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                      << "      EF: " << fPrime->str() << '>');
-        LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << ' ');
+        PHASAR_LOG_LEVEL_CAT(DEBUG, Solver,
+                             "EDGE: <F: "
+                             << target->getFunction()->getName().str()
+                             << ", D: " << IDEProblem.DtoString(sourceVal)
+                             << '>');
+        PHASAR_LOG_LEVEL_CAT(DEBUG, Solver,
+                             " ---> <N: " << IDEProblem.NtoString(target)
+                             << ',');
+        PHASAR_LOG_LEVEL_CAT(DEBUG, Solver,
+                             "       D: " << IDEProblem.DtoString(targetVal)
+                             << ',');
+        PHASAR_LOG_LEVEL_CAT(DEBUG, Solver, "      EF: " << fPrime->str()
+                             << '>');
+        PHASAR_LOG_LEVEL_CAT(DEBUG, Solver, ' ');
       }
     } else {
-      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << "PROPAGATE: No new function!");
+      PHASAR_LOG_LEVEL_CAT(DEBUG, Solver, "PROPAGATE: No new function!");
     }
   }
 
@@ -1264,49 +1484,46 @@ protected:
   }
 
   void printIncomingTab() {
-    auto &lg = lg::get();
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << "Start of incomingtab entry");
+    PHASAR_LOG_LEVEL_CAT(DEBUG, Solver, "Start of incomingtab entry");
     for (auto cell : incomingtab.cellSet()) {
-      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                    << "sP: " << IDEProblem.NtoString(cell.r));
-      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                    << "d3: " << IDEProblem.DtoString(cell.c));
+      PHASAR_LOG_LEVEL_CAT(DEBUG, Solver, "sP: "
+                           << IDEProblem.NtoString(cell.r));
+      PHASAR_LOG_LEVEL_CAT(DEBUG, Solver, "d3: "
+                           << IDEProblem.DtoString(cell.c));
       for (auto entry : cell.v) {
-        LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                      << "  n: " << IDEProblem.NtoString(entry.first));
+        PHASAR_LOG_LEVEL_CAT(DEBUG, Solver,
+                             "  n: " << IDEProblem.NtoString(entry.first));
         for (auto fact : entry.second) {
-          LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                        << "  d2: " << IDEProblem.DtoString(fact));
+          PHASAR_LOG_LEVEL_CAT(DEBUG, Solver,
+                               "  d2: " << IDEProblem.DtoString(fact));
         }
       }
-      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << "---------------");
+      PHASAR_LOG_LEVEL_CAT(DEBUG, Solver, "---------------");
     }
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << "End of incomingtab entry");
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << ' ');
+    PHASAR_LOG_LEVEL_CAT(DEBUG, Solver, "End of incomingtab entry");
+    PHASAR_LOG_LEVEL_CAT(DEBUG, Solver, ' ');
   }
 
   void printEndSummaryTab() {
-    auto &lg = lg::get();
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << "Start of endsummarytab entry");
+    PHASAR_LOG_LEVEL_CAT(DEBUG, Solver, "Start of endsummarytab entry");
     for (auto cell : endsummarytab.cellVec()) {
-      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                    << "sP: " << IDEProblem.NtoString(cell.r));
-      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                    << "d1: " << IDEProblem.DtoString(cell.c));
+      PHASAR_LOG_LEVEL_CAT(DEBUG, Solver, "sP: "
+                           << IDEProblem.NtoString(cell.r));
+      PHASAR_LOG_LEVEL_CAT(DEBUG, Solver, "d1: "
+                           << IDEProblem.DtoString(cell.c));
       for (auto inner_cell : cell.v.cellVec()) {
-        LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                      << "  eP: " << IDEProblem.NtoString(inner_cell.r));
-        LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                      << "  d2: " << IDEProblem.DtoString(inner_cell.c));
-        LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                      << "  EF: " << inner_cell.v->str());
-        LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << ' ');
+        PHASAR_LOG_LEVEL_CAT(DEBUG, Solver,
+                             "  eP: " << IDEProblem.NtoString(inner_cell.r));
+        PHASAR_LOG_LEVEL_CAT(DEBUG, Solver,
+                             "  d2: " << IDEProblem.DtoString(inner_cell.c));
+        PHASAR_LOG_LEVEL_CAT(DEBUG, Solver, "  EF: " << inner_cell.v->str());
+        PHASAR_LOG_LEVEL_CAT(DEBUG, Solver, ' ');
       }
-      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << "---------------");
-      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << ' ');
+      PHASAR_LOG_LEVEL_CAT(DEBUG, Solver, "---------------");
+      PHASAR_LOG_LEVEL_CAT(DEBUG, Solver, ' ');
     }
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << "End of endsummarytab entry");
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << ' ');
+    PHASAR_LOG_LEVEL_CAT(DEBUG, Solver, "End of endsummarytab entry");
+    PHASAR_LOG_LEVEL_CAT(DEBUG, Solver, ' ');
   }
 
   void printComputedPathEdges() {
@@ -1378,7 +1595,6 @@ protected:
    * generated/killed facts, number of summary-reuses etc.
    */
   void computeAndPrintStatistics() {
-    auto &lg = lg::get();
     PAMM_GET_INSTANCE;
     // Stores all valid facts at return site in caller context; return-site is
     // key
@@ -1392,14 +1608,13 @@ protected:
      */
     for (auto cell : computedIntraPathEdges.cellSet()) {
       auto Edge = std::make_pair(cell.r, cell.c);
-      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                    << "N1: " << IDEProblem.NtoString(Edge.first));
-      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                    << "N2: " << IDEProblem.NtoString(Edge.second));
+      PHASAR_LOG_LEVEL_CAT(DEBUG, Solver,
+                           "N1: " << IDEProblem.NtoString(Edge.first));
+      PHASAR_LOG_LEVEL_CAT(DEBUG, Solver,
+                           "N2: " << IDEProblem.NtoString(Edge.second));
       for (auto D1ToD2Set : cell.v) {
         auto D1 = D1ToD2Set.first;
-        LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                      << "d1: " << IDEProblem.DtoString(D1));
+        PHASAR_LOG_LEVEL_CAT(DEBUG, Solver, "d1: " << IDEProblem.DtoString(D1));
         auto D2Set = D1ToD2Set.second;
         intraPathEdges += D2Set.size();
         // Case 1
@@ -1419,25 +1634,25 @@ protected:
           ValidInCallerContext[Edge.second].insert(D2Set.begin(), D2Set.end());
         }
         for (auto D2 : D2Set) {
-          LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                        << "d2: " << IDEProblem.DtoString(D2));
+          PHASAR_LOG_LEVEL_CAT(DEBUG, Solver, "d2: "
+                               << IDEProblem.DtoString(D2));
         }
-        LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << "----");
+        PHASAR_LOG_LEVEL_CAT(DEBUG, Solver, "----");
       }
-      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << " ");
+      PHASAR_LOG_LEVEL_CAT(DEBUG, Solver, " ");
     }
 
     // Stores all pairs of (Startpoint, Fact) for which a summary was applied
     std::set<std::pair<N, D>> ProcessSummaryFacts;
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                  << "==============================================");
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << "INTER PATH EDGES");
+    PHASAR_LOG_LEVEL_CAT(DEBUG, Solver,
+                         "==============================================");
+    PHASAR_LOG_LEVEL_CAT(DEBUG, Solver, "INTER PATH EDGES");
     for (auto cell : computedInterPathEdges.cellSet()) {
       auto Edge = std::make_pair(cell.r, cell.c);
-      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                    << "N1: " << IDEProblem.NtoString(Edge.first));
-      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                    << "N2: " << IDEProblem.NtoString(Edge.second));
+      PHASAR_LOG_LEVEL_CAT(DEBUG, Solver,
+                           "N1: " << IDEProblem.NtoString(Edge.first));
+      PHASAR_LOG_LEVEL_CAT(DEBUG, Solver,
+                           "N2: " << IDEProblem.NtoString(Edge.second));
       /* --- Call-flow Path Edges ---
        * Case 1: d1 --> empty set
        *   Can be ignored, since killing a fact in the caller context will
@@ -1456,8 +1671,8 @@ protected:
       if (ICF->isCallStmt(Edge.first)) {
         for (auto D1ToD2Set : cell.v) {
           auto D1 = D1ToD2Set.first;
-          LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                        << "d1: " << IDEProblem.DtoString(D1));
+          PHASAR_LOG_LEVEL_CAT(DEBUG, Solver, "d1: "
+                               << IDEProblem.DtoString(D1));
           auto DSet = D1ToD2Set.second;
           interPathEdges += DSet.size();
           for (auto D2 : DSet) {
@@ -1485,10 +1700,10 @@ protected:
             } else {
               ProcessSummaryFacts.insert(std::make_pair(Edge.second, D2));
             }
-            LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                          << "d2: " << IDEProblem.DtoString(D2));
+            PHASAR_LOG_LEVEL_CAT(DEBUG, Solver,
+                                 "d2: " << IDEProblem.DtoString(D2));
           }
-          LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << "----");
+          PHASAR_LOG_LEVEL_CAT(DEBUG, Solver, "----");
         }
       }
       /* --- Return-flow Path Edges ---
@@ -1502,8 +1717,8 @@ protected:
       if (ICF->isExitStmt(cell.r)) {
         for (auto D1ToD2Set : cell.v) {
           auto D1 = D1ToD2Set.first;
-          LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                        << "d1: " << IDEProblem.DtoString(D1));
+          PHASAR_LOG_LEVEL_CAT(DEBUG, Solver, "d1: "
+                               << IDEProblem.DtoString(D1));
           auto DSet = D1ToD2Set.second;
           interPathEdges += DSet.size();
           auto CallerFacts = ValidInCallerContext[Edge.second];
@@ -1512,25 +1727,25 @@ protected:
             if (CallerFacts.find(D2) == CallerFacts.end()) {
               genFacts++;
             }
-            LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                          << "d2: " << IDEProblem.DtoString(D2));
+            PHASAR_LOG_LEVEL_CAT(DEBUG, Solver,
+                                 "d2: " << IDEProblem.DtoString(D2));
           }
           if (!IDEProblem.isZeroValue(D1)) {
             killFacts++;
           }
-          LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << "----");
+          PHASAR_LOG_LEVEL_CAT(DEBUG, Solver, "----");
         }
       }
-      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << " ");
+      PHASAR_LOG_LEVEL_CAT(DEBUG, Solver, " ");
     }
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << "SUMMARY REUSE");
+    PHASAR_LOG_LEVEL_CAT(DEBUG, Solver, "SUMMARY REUSE");
     std::size_t TotalSummaryReuse = 0;
     for (auto entry : fSummaryReuse) {
-      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                    << "N1: " << IDEProblem.NtoString(entry.first.first));
-      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                    << "D1: " << IDEProblem.DtoString(entry.first.second));
-      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << "#Reuse: " << entry.second);
+      PHASAR_LOG_LEVEL_CAT(DEBUG, Solver,
+                           "N1: " << IDEProblem.NtoString(entry.first.first));
+      PHASAR_LOG_LEVEL_CAT(DEBUG, Solver,
+                           "D1: " << IDEProblem.DtoString(entry.first.second));
+      PHASAR_LOG_LEVEL_CAT(DEBUG, Solver, "#Reuse: " << entry.second);
       TotalSummaryReuse += entry.second;
     }
 
@@ -1540,55 +1755,58 @@ protected:
     INC_COUNTER("Intra Path Edges", intraPathEdges, PAMM_SEVERITY_LEVEL::Core);
     INC_COUNTER("Inter Path Edges", interPathEdges, PAMM_SEVERITY_LEVEL::Core);
 
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, INFO)
-                  << "----------------------------------------------");
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, INFO) << "=== Solver Statistics ===");
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, INFO)
-                  << "#Facts generated : " << GET_COUNTER("Gen facts"));
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, INFO)
-                  << "#Facts killed    : " << GET_COUNTER("Kill facts"));
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, INFO)
-                  << "#Summary-reuse   : " << GET_COUNTER("Summary-reuse"));
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, INFO)
-                  << "#Intra Path Edges: " << GET_COUNTER("Intra Path Edges"));
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, INFO)
-                  << "#Inter Path Edges: " << GET_COUNTER("Inter Path Edges"));
+    PHASAR_LOG_LEVEL_CAT(INFO, Solver,
+                         "----------------------------------------------");
+    PHASAR_LOG_LEVEL_CAT(INFO, Solver, "=== Solver Statistics ===");
+    PHASAR_LOG_LEVEL_CAT(INFO, Solver,
+                         "#Facts generated : " << GET_COUNTER("Gen facts"));
+    PHASAR_LOG_LEVEL_CAT(INFO, Solver,
+                         "#Facts killed    : " << GET_COUNTER("Kill facts"));
+    PHASAR_LOG_LEVEL_CAT(INFO, Solver,
+                         "#Summary-reuse   : " << GET_COUNTER("Summary-reuse"));
+    PHASAR_LOG_LEVEL_CAT(INFO, Solver,
+                         "#Intra Path Edges: "
+                         << GET_COUNTER("Intra Path Edges"));
+    PHASAR_LOG_LEVEL_CAT(INFO, Solver,
+                         "#Inter Path Edges: "
+                         << GET_COUNTER("Inter Path Edges"));
     if constexpr (PAMM_CURR_SEV_LEVEL >= PAMM_SEVERITY_LEVEL::Full) {
-      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, INFO) << "Flow function query count: "
-                                            << GET_COUNTER("FF Queries"));
-      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, INFO) << "Edge function query count: "
-                                            << GET_COUNTER("EF Queries"));
-      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, INFO)
-                    << "Data-flow value propagation count: "
-                    << GET_COUNTER("Value Propagation"));
-      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, INFO)
-                    << "Data-flow value computation count: "
-                    << GET_COUNTER("Value Computation"));
-      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, INFO)
-                    << "Special flow function usage count: "
-                    << GET_COUNTER("SpecialSummary-FF Application"));
-      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, INFO)
-                    << "Jump function construciton count: "
-                    << GET_COUNTER("JumpFn Construction"));
-      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, INFO)
-                    << "Phase I duration: " << PRINT_TIMER("DFA Phase I"));
-      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, INFO)
-                    << "Phase II duration: " << PRINT_TIMER("DFA Phase II"));
-      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, INFO)
-                    << "----------------------------------------------");
+      PHASAR_LOG_LEVEL_CAT(INFO, Solver,
+                           "Flow function query count: "
+                           << GET_COUNTER("FF Queries"));
+      PHASAR_LOG_LEVEL_CAT(INFO, Solver,
+                           "Edge function query count: "
+                           << GET_COUNTER("EF Queries"));
+      PHASAR_LOG_LEVEL_CAT(INFO, Solver,
+                           "Data-flow value propagation count: "
+                           << GET_COUNTER("Value Propagation"));
+      PHASAR_LOG_LEVEL_CAT(INFO, Solver,
+                           "Data-flow value computation count: "
+                           << GET_COUNTER("Value Computation"));
+      PHASAR_LOG_LEVEL_CAT(INFO, Solver,
+                           "Special flow function usage count: "
+                           << GET_COUNTER("SpecialSummary-FF Application"));
+      PHASAR_LOG_LEVEL_CAT(INFO, Solver,
+                           "Jump function construciton count: "
+                           << GET_COUNTER("JumpFn Construction"));
+      PHASAR_LOG_LEVEL_CAT(INFO, Solver,
+                           "Phase I duration: " << PRINT_TIMER("DFA Phase I"));
+      PHASAR_LOG_LEVEL_CAT(INFO, Solver,
+                           "Phase II duration: "
+                           << PRINT_TIMER("DFA Phase II"));
+      PHASAR_LOG_LEVEL_CAT(INFO, Solver,
+                           "----------------------------------------------");
       cachedFlowEdgeFunctions.print();
     }
   }
 
 public:
   void emitESGasDot() {
-    auto &lg = lg::get();
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                  << "Emit Exploded super-graph (ESG) as DOT graph");
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                  << "Process intra-procedural path egdes");
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                  << "=============================================");
+    PHASAR_LOG_LEVEL_CAT(DEBUG, Solver,
+                         "Emit Exploded super-graph (ESG) as DOT graph");
+    PHASAR_LOG_LEVEL_CAT(DEBUG, Solver, "Process intra-procedural path egdes");
+    PHASAR_LOG_LEVEL_CAT(DEBUG, Solver,
+                         "=============================================");
     DOTGraph<D> G;
     DOTConfig::importDOTConfig();
     DOTFunctionSubGraph *FG = nullptr;
@@ -1602,8 +1820,8 @@ public:
       auto Edge = std::make_pair(cell.r, cell.c);
       std::string n1_label = IDEProblem.NtoString(Edge.first);
       std::string n2_label = IDEProblem.NtoString(Edge.second);
-      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << "N1: " << n1_label);
-      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << "N2: " << n2_label);
+      PHASAR_LOG_LEVEL_CAT(DEBUG, Solver, "N1: " << n1_label);
+      PHASAR_LOG_LEVEL_CAT(DEBUG, Solver, "N2: " << n2_label);
       std::string n1_stmtId = ICF->getStatementId(Edge.first);
       std::string n2_stmtId = ICF->getStatementId(Edge.second);
       std::string fnName = ICF->getFunctionOf(Edge.first)->getName().str();
@@ -1630,8 +1848,8 @@ public:
       unsigned D2FactId = 0;
       for (auto D1ToD2Set : cell.v) {
         auto D1Fact = D1ToD2Set.first;
-        LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                      << "d1: " << IDEProblem.DtoString(D1Fact));
+        PHASAR_LOG_LEVEL_CAT(DEBUG, Solver,
+                             "d1: " << IDEProblem.DtoString(D1Fact));
 
         DOTNode D1;
         if (IDEProblem.isZeroValue(D1Fact)) {
@@ -1652,8 +1870,8 @@ public:
 
         DOTFactSubGraph *D2_FSG = nullptr;
         for (auto D2Fact : D1ToD2Set.second) {
-          LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                        << "d2: " << IDEProblem.DtoString(D2Fact));
+          PHASAR_LOG_LEVEL_CAT(DEBUG, Solver,
+                               "d2: " << IDEProblem.DtoString(D2Fact));
           // We do not need to generate any intra-procedural nodes and edges
           // for the zero value since they will be auto-generated
           if (!IDEProblem.isZeroValue(D2Fact)) {
@@ -1667,7 +1885,7 @@ public:
             for (auto EF : EFVec) {
               EFLabel += EF->str() + ", ";
             }
-            LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << "EF LABEL: " << EFLabel);
+            PHASAR_LOG_LEVEL_CAT(DEBUG, Solver, "EF LABEL: " << EFLabel);
             if (D1FactId == D2FactId && !IDEProblem.isZeroValue(D1Fact)) {
               D1_FSG->nodes.insert(std::make_pair(n2_stmtId, D2));
               D1_FSG->edges.emplace(D1, D2, true, EFLabel);
@@ -1680,17 +1898,16 @@ public:
             }
           }
         }
-        LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << "----------");
+        PHASAR_LOG_LEVEL_CAT(DEBUG, Solver, "----------");
       }
-      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << " ");
+      PHASAR_LOG_LEVEL_CAT(DEBUG, Solver, " ");
     }
 
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                  << "=============================================");
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                  << "Process inter-procedural path edges");
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                  << "=============================================");
+    PHASAR_LOG_LEVEL_CAT(DEBUG, Solver,
+                         "=============================================");
+    PHASAR_LOG_LEVEL_CAT(DEBUG, Solver, "Process inter-procedural path edges");
+    PHASAR_LOG_LEVEL_CAT(DEBUG, Solver,
+                         "=============================================");
     cells = computedInterPathEdges.cellVec();
     sort(cells.begin(), cells.end(),
          [&stmtless](auto a, auto b) { return stmtless(a.r, b.r); });
@@ -1702,8 +1919,8 @@ public:
       std::string fNameOfN2 = ICF->getFunctionOf(Edge.second)->getName().str();
       std::string n1_stmtId = ICF->getStatementId(Edge.first);
       std::string n2_stmtId = ICF->getStatementId(Edge.second);
-      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << "N1: " << n1_label);
-      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << "N2: " << n2_label);
+      PHASAR_LOG_LEVEL_CAT(DEBUG, Solver, "N1: " << n1_label);
+      PHASAR_LOG_LEVEL_CAT(DEBUG, Solver, "N2: " << n2_label);
 
       // Add inter-procedural control flow edge
       DOTNode N1(fNameOfN1, n1_label, n1_stmtId);
@@ -1738,8 +1955,8 @@ public:
       unsigned D2FactId = 0;
       for (auto D1ToD2Set : cell.v) {
         auto D1Fact = D1ToD2Set.first;
-        LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                      << "d1: " << IDEProblem.DtoString(D1Fact));
+        PHASAR_LOG_LEVEL_CAT(DEBUG, Solver,
+                             "d1: " << IDEProblem.DtoString(D1Fact));
         DOTNode D1;
         if (IDEProblem.isZeroValue(D1Fact)) {
           D1 = {fNameOfN1, "Λ", n1_stmtId, 0, false, true};
@@ -1758,8 +1975,8 @@ public:
 
         auto D2Set = D1ToD2Set.second;
         for (auto D2Fact : D2Set) {
-          LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                        << "d2: " << IDEProblem.DtoString(D2Fact));
+          PHASAR_LOG_LEVEL_CAT(DEBUG, Solver,
+                               "d2: " << IDEProblem.DtoString(D2Fact));
           DOTNode D2;
           if (IDEProblem.isZeroValue(D2Fact)) {
             D2 = {fNameOfN2, "Λ", n2_stmtId, 0, false, true};
@@ -1790,13 +2007,13 @@ public:
             for (auto EF : EFVec) {
               EFLabel += EF->str() + ", ";
             }
-            LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << "EF LABEL: " << EFLabel);
+            PHASAR_LOG_LEVEL_CAT(DEBUG, Solver, "EF LABEL: " << EFLabel);
             G.interFactEdges.emplace(D1, D2, true, EFLabel);
           }
         }
-        LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << "----------");
+        PHASAR_LOG_LEVEL_CAT(DEBUG, Solver, "----------");
       }
-      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << " ");
+      PHASAR_LOG_LEVEL_CAT(DEBUG, Solver, " ");
     }
 
     std::ofstream dotFile("ESG.dot", std::ios::binary);
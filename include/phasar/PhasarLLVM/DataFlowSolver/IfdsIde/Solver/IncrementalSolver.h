@@ -0,0 +1,556 @@
+/******************************************************************************
+ * Copyright (c) 2019 Philipp Schubert.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Philipp Schubert and others
+ *****************************************************************************/
+
+#ifndef PHASAR_PHASARLLVM_IFDSIDE_SOLVER_INCREMENTALSOLVER_H_
+#define PHASAR_PHASARLLVM_IFDSIDE_SOLVER_INCREMENTALSOLVER_H_
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "nlohmann/json.hpp"
+
+#include "llvm/IR/Function.h"
+#include "llvm/IR/InstIterator.h"
+#include "llvm/IR/Instruction.h"
+#include "llvm/IR/Value.h"
+
+#include "phasar/PhasarLLVM/AnalysisStrategy/IRSnapshot.h"
+#include "phasar/PhasarLLVM/DataFlowSolver/IfdsIde/EdgeFunctions/EdgeIdentity.h"
+#include "phasar/PhasarLLVM/DataFlowSolver/IfdsIde/Solver/IFDSToIDETabulationProblem.h"
+#include "phasar/PhasarLLVM/DataFlowSolver/IfdsIde/Solver/PathEdge.h"
+#include "phasar/PhasarLLVM/Utils/BinaryDomain.h"
+#include "phasar/Utils/Logger.h"
+
+namespace psr {
+
+/**
+ * Turns an IFDSSolver into a solver that reuses the results of a previous run
+ * on an earlier version of the same project.
+ *
+ * The previous run is persisted as the exploded super-graph restricted to each
+ * calling context <function, entry fact>: the path edges, end summaries and
+ * outgoing calls of the context, together with a structural hash and the
+ * call-graph edges of every function (see getAsPersistedRun()).
+ *
+ * A function is clean if its hash and its callees are unchanged, none of the
+ * callees that were mere declarations has been defined since, and all of its
+ * transitive callees are clean. All other persisted contexts are
+ * invalidated. When the solver reaches the start point of a clean function
+ * with a persisted entry fact, the persisted end summaries are installed
+ * instead of exploring the function's body, such that only the changed
+ * frontier and contexts that did not exist before are solved. The path edges
+ * of the reused contexts are turned into results afterwards, which makes the
+ * results identical to a from-scratch run.
+ *
+ * If IFDSIDESolverConfig::computePersistedSummaries is set, the persisted run
+ * additionally contains the summaries of each of the problem's entry points
+ * for the facts any caller may pass in, see ModuleWiseAnalysis.
+ *
+ * Since arbitrary edge functions cannot be persisted, only IFDS problems over
+ * LLVM IR are supported.
+ */
+template <typename SolverTy> class IncrementalSolver : public SolverTy {
+public:
+  using n_t = typename SolverTy::n_t;
+  using d_t = typename SolverTy::d_t;
+  using f_t = typename SolverTy::f_t;
+  using l_t = typename SolverTy::l_t;
+
+  static_assert(std::is_same_v<l_t, BinaryDomain>,
+                "Incremental solving is only supported for IFDS problems!");
+  static_assert(std::is_same_v<n_t, const llvm::Instruction *> &&
+                    std::is_same_v<d_t, const llvm::Value *> &&
+                    std::is_same_v<f_t, const llvm::Function *>,
+                "Incremental solving requires LLVM-based problems!");
+
+  static constexpr unsigned FormatVersion = 1;
+
+  template <typename ProblemTy>
+  IncrementalSolver(ProblemTy &Problem, const IRSnapshot &Snapshot)
+      : SolverTy(Problem), Snapshot(Snapshot) {}
+
+  ~IncrementalSolver() override = default;
+
+  /**
+   * @brief Sets the state persisted by a previous run, must be called before
+   * solve(). States of an incompatible format are ignored.
+   */
+  void setPreviousRun(nlohmann::json PreviousRun) {
+    Previous = std::move(PreviousRun);
+  }
+
+  void solve() override {
+    loadPreviousRun();
+    PHASAR_LOG_LEVEL_CAT(INFO, Solver,
+                         "Incremental solver: " << DirtyFunctions.size()
+                         << " dirty function(s), " << Reusable.size()
+                         << " reusable context(s)");
+    SolverTy::solve();
+    if (this->SolverConfig.computeValues) {
+      computeReusedValues();
+    }
+    PHASAR_LOG_LEVEL_CAT(INFO, Solver,
+                         "Incremental solver: reused " << Reused.size()
+                         << " context(s)");
+  }
+
+  /**
+   * @brief Returns the state of this run that allows to solve the next
+   * version incrementally.
+   */
+  nlohmann::json getAsPersistedRun() {
+    // contexts of all functions that have been solved during this run
+    std::map<f_t, std::map<d_t, nlohmann::json>> Contexts;
+    std::map<std::pair<n_t, d_t>, std::vector<d_t>> CallSiteContexts;
+    std::set<std::pair<f_t, d_t>> Unpersistable;
+    auto ToId = [&](f_t F, d_t D1, d_t D) {
+      std::string Id = getFactId(D);
+      if (Id.empty()) {
+        Unpersistable.emplace(F, D1);
+      }
+      return Id;
+    };
+    for (const auto &[Name, F] : getFunctions()) {
+      for (n_t N : this->ICF->getStartPointsOf(F)) {
+        if (!this->endsummarytab.containsRow(N)) {
+          continue;
+        }
+        for (auto [D1, Summaries] : this->endsummarytab.row(N)) {
+          auto &Ctx = getContext(Contexts, F, D1);
+          for (auto Exit : Summaries.cellSet()) {
+            Ctx["exits"].push_back(
+                {Snapshot.getInstructionIndex(Exit.getRowKey()),
+                 ToId(F, D1, Exit.getColumnKey()), isIdentity(Exit.getValue())});
+          }
+        }
+      }
+      for (const auto &I : llvm::instructions(F)) {
+        n_t N = &I;
+        for (auto Cell : this->jumpFn->lookupByTarget(N).cellSet()) {
+          d_t D1 = Cell.getRowKey();
+          d_t D2 = Cell.getColumnKey();
+          getContext(Contexts, F, D1)["facts"].push_back(
+              {Snapshot.getInstructionIndex(N), ToId(F, D1, D2),
+               isIdentity(Cell.getValue())});
+          if (this->ICF->isCallStmt(N)) {
+            CallSiteContexts[{N, D2}].push_back(D1);
+          }
+        }
+      }
+    }
+    for (auto Cell : this->incomingtab.cellSet()) {
+      f_t Callee = this->ICF->getFunctionOf(Cell.getRowKey());
+      d_t D3 = Cell.getColumnKey();
+      for (const auto &[CallSite, CallSiteFacts] : Cell.getValue()) {
+        f_t Caller = this->ICF->getFunctionOf(CallSite);
+        for (d_t D2 : CallSiteFacts) {
+          for (d_t D1 : CallSiteContexts[{CallSite, D2}]) {
+            getContext(Contexts, Caller, D1)["calls"].push_back(
+                {Snapshot.getInstructionIndex(CallSite), ToId(Caller, D1, D2),
+                 IRSnapshot::getGlobalKey(Callee), ToId(Caller, D1, D3)});
+          }
+        }
+      }
+    }
+    nlohmann::json J;
+    J["version"] = FormatVersion;
+    J["globals"] = Snapshot.getGlobalsHash();
+    J["functions"] = nlohmann::json::object();
+    for (const auto &[Name, F] : getFunctions()) {
+      auto &JF = J["functions"][Name];
+      JF["hash"] = Snapshot.getFunctionHashes().at(Name);
+      JF["callees"] = getCalleeNames(F);
+      JF["declarations"] = getCalleeNames(F, true);
+      JF["contexts"] = nlohmann::json::object();
+      for (auto &[D1, Ctx] : Contexts[F]) {
+        std::string Id = getFactId(D1);
+        if (Id.empty() || Unpersistable.count({F, D1})) {
+          continue;
+        }
+        // keep the persisted form independent of pointer orderings
+        for (auto &Entries : Ctx) {
+          std::sort(Entries.begin(), Entries.end());
+        }
+        JF["contexts"][Id] = std::move(Ctx);
+      }
+      // reused contexts have not been solved, their persisted form is still
+      // valid as the function did not change
+      for (const auto &Key : Reused) {
+        if (Key.first == F) {
+          JF["contexts"][getFactId(Key.second)] = Reusable[Key].Persisted;
+        }
+      }
+    }
+    return J;
+  }
+
+  const std::set<std::string> &getDirtyFunctions() const {
+    return DirtyFunctions;
+  }
+
+  size_t getNumReusableContexts() const { return Reusable.size(); }
+
+  size_t getNumReusedContexts() const { return Reused.size(); }
+
+protected:
+  // a persisted calling context <function, entry fact>
+  struct Context {
+    // path edges <node, fact, edge function is the identity>
+    std::vector<std::tuple<n_t, d_t, bool>> Facts;
+    // end summaries <exit, fact, edge function is the identity>
+    std::vector<std::tuple<n_t, d_t, bool>> Exits;
+    // outgoing calls <call-site, fact at call-site, callee, entry fact>
+    std::vector<std::tuple<n_t, d_t, f_t, d_t>> Calls;
+    nlohmann::json Persisted;
+  };
+
+  const IRSnapshot &Snapshot;
+  nlohmann::json Previous;
+  std::set<std::string> DirtyFunctions;
+  std::map<std::pair<f_t, d_t>, Context> Reusable;
+  std::set<std::pair<f_t, d_t>> Reused;
+
+  static bool isIdentity(const std::shared_ptr<EdgeFunction<l_t>> &EF) {
+    return EF->equal_to(EdgeIdentity<l_t>::getInstance());
+  }
+
+  std::map<std::string, f_t> getFunctions() const {
+    std::map<std::string, f_t> Functions;
+    for (const auto &Entry : Snapshot.getFunctionHashes()) {
+      Functions[Entry.first] = Snapshot.getFunction(Entry.first);
+    }
+    return Functions;
+  }
+
+  std::set<std::string> getCalleeNames(f_t F,
+                                       bool OnlyDeclarations = false) const {
+    std::set<std::string> Callees;
+    for (n_t CallSite : this->ICF->getCallsFromWithin(F)) {
+      for (f_t Callee : this->ICF->getCalleesOfCallAt(CallSite)) {
+        if (!OnlyDeclarations || Callee->isDeclaration()) {
+          Callees.insert(IRSnapshot::getGlobalKey(Callee));
+        }
+      }
+    }
+    return Callees;
+  }
+
+  static nlohmann::json &
+  getContext(std::map<f_t, std::map<d_t, nlohmann::json>> &Contexts, f_t F,
+             d_t D1) {
+    auto &Ctx = Contexts[F][D1];
+    if (Ctx.is_null()) {
+      Ctx = {{"facts", nlohmann::json::array()},
+             {"exits", nlohmann::json::array()},
+             {"calls", nlohmann::json::array()}};
+    }
+    return Ctx;
+  }
+
+  std::string getFactId(d_t D) const {
+    if (this->IDEProblem.isZeroValue(D)) {
+      return "zero";
+    }
+    return Snapshot.getStableId(D);
+  }
+
+  /**
+   * Resolves a persisted fact; facts that belong to changed functions cannot
+   * be resolved.
+   */
+  d_t resolveFact(const std::string &Id,
+                  const std::set<std::string> &Unchanged) const {
+    if (Id == "zero") {
+      return this->ZeroValue;
+    }
+    std::string FunctionName = IRSnapshot::getFunctionNameOfId(Id);
+    if (!FunctionName.empty() && !Unchanged.count(FunctionName)) {
+      return nullptr;
+    }
+    return Snapshot.getValue(Id);
+  }
+
+  void loadPreviousRun() {
+    DirtyFunctions.clear();
+    Reusable.clear();
+    Reused.clear();
+    auto Functions = getFunctions();
+    for (const auto &Entry : Functions) {
+      DirtyFunctions.insert(Entry.first);
+    }
+    if (!Previous.is_object() ||
+        Previous.value("version", 0U) != FormatVersion ||
+        !Previous.contains("functions") || !Previous["functions"].is_object()) {
+      PHASAR_LOG_LEVEL_CAT(INFO, Solver,
+                           "No compatible previous run, solve from scratch");
+      return;
+    }
+    try {
+      loadPreviousFunctions(Functions);
+    } catch (const nlohmann::json::exception &E) {
+      PHASAR_LOG_LEVEL_CAT(WARNING, Solver,
+                           "Malformed previous run, solve from scratch: "
+                           << E.what());
+      for (const auto &Entry : Functions) {
+        DirtyFunctions.insert(Entry.first);
+      }
+      Reusable.clear();
+    }
+  }
+
+  void loadPreviousFunctions(const std::map<std::string, f_t> &Functions) {
+    const auto &JFunctions = Previous["functions"];
+    std::map<std::string, std::string> PreviousHashes;
+    for (const auto &[Name, JF] : JFunctions.items()) {
+      PreviousHashes[Name] = JF.at("hash").template get<std::string>();
+    }
+    auto Diff = Snapshot.diff(PreviousHashes,
+                              Previous.value("globals", std::string()));
+    if (Diff.GlobalsChanged) {
+      PHASAR_LOG_LEVEL_CAT(INFO, Solver,
+                           "Global variables changed, solve from scratch");
+      return;
+    }
+    std::set<std::string> Unchanged;
+    for (const auto &Entry : Functions) {
+      if (!Diff.Added.count(Entry.first) && !Diff.Changed.count(Entry.first)) {
+        Unchanged.insert(Entry.first);
+      }
+    }
+    // a function is clean if it is unchanged, has the same call-graph edges,
+    // did not call declarations that are defined by now and only calls clean
+    // functions
+    std::vector<f_t> WorkList;
+    for (const auto &[Name, F] : Functions) {
+      if (Unchanged.count(Name) &&
+          hasUnchangedCallees(JFunctions.at(Name), F)) {
+        DirtyFunctions.erase(Name);
+      } else {
+        WorkList.push_back(F);
+      }
+    }
+    while (!WorkList.empty()) {
+      f_t F = WorkList.back();
+      WorkList.pop_back();
+      for (n_t CallSite : this->ICF->getCallersOf(F)) {
+        f_t Caller = this->ICF->getFunctionOf(CallSite);
+        if (DirtyFunctions.insert(IRSnapshot::getGlobalKey(Caller)).second) {
+          WorkList.push_back(Caller);
+        }
+      }
+    }
+    PHASAR_LOG_LEVEL_CAT(INFO, Solver,
+                         "Changed functions: " << Diff.Changed.size()
+                         << ", added: " << Diff.Added.size() << ", removed: "
+                         << Diff.Removed.size());
+    for (const auto &[Name, F] : Functions) {
+      if (!DirtyFunctions.count(Name)) {
+        loadContexts(F, JFunctions.at(Name).at("contexts"), Unchanged);
+      }
+    }
+    // drop contexts whose callee contexts cannot be reused, until stable
+    bool Changed = true;
+    while (Changed) {
+      Changed = false;
+      for (auto It = Reusable.begin(); It != Reusable.end();) {
+        bool Complete = std::all_of(
+            It->second.Calls.begin(), It->second.Calls.end(),
+            [this](const auto &Call) {
+              return Reusable.count({std::get<2>(Call), std::get<3>(Call)});
+            });
+        if (Complete) {
+          ++It;
+        } else {
+          It = Reusable.erase(It);
+          Changed = true;
+        }
+      }
+    }
+  }
+
+  bool hasUnchangedCallees(const nlohmann::json &JF, f_t F) const {
+    if (JF.at("callees").template get<std::set<std::string>>() !=
+        getCalleeNames(F)) {
+      return false;
+    }
+    if (!JF.contains("declarations")) {
+      return true;
+    }
+    auto Declarations =
+        JF["declarations"].template get<std::set<std::string>>();
+    return std::none_of(Declarations.begin(), Declarations.end(),
+                        [this](const std::string &Name) {
+                          return Snapshot.getFunction(Name) != nullptr;
+                        });
+  }
+
+  void loadContexts(f_t F, const nlohmann::json &JContexts,
+                    const std::set<std::string> &Unchanged) {
+    auto ToNode = [&](const nlohmann::json &Idx) {
+      return Snapshot.getInstruction(F, Idx.template get<unsigned>());
+    };
+    for (const auto &[Id, JCtx] : JContexts.items()) {
+      d_t D1 = resolveFact(Id, Unchanged);
+      if (!D1) {
+        continue;
+      }
+      Context Ctx;
+      bool Valid = true;
+      for (const auto &JFact : JCtx.at("facts")) {
+        n_t N = ToNode(JFact[0]);
+        d_t D = resolveFact(JFact[1].template get<std::string>(), Unchanged);
+        Valid &= N && D;
+        Ctx.Facts.emplace_back(N, D, JFact[2].template get<bool>());
+      }
+      for (const auto &JExit : JCtx.at("exits")) {
+        n_t N = ToNode(JExit[0]);
+        d_t D = resolveFact(JExit[1].template get<std::string>(), Unchanged);
+        Valid &= N && D;
+        Ctx.Exits.emplace_back(N, D, JExit[2].template get<bool>());
+      }
+      for (const auto &JCall : JCtx.at("calls")) {
+        n_t N = ToNode(JCall[0]);
+        d_t D2 = resolveFact(JCall[1].template get<std::string>(), Unchanged);
+        f_t Callee = Snapshot.getFunction(JCall[2].template get<std::string>());
+        d_t D3 = resolveFact(JCall[3].template get<std::string>(), Unchanged);
+        Valid &= N && D2 && Callee && D3;
+        Ctx.Calls.emplace_back(N, D2, Callee, D3);
+      }
+      if (Valid) {
+        Ctx.Persisted = JCtx;
+        Reusable.emplace(std::make_pair(F, D1), std::move(Ctx));
+      }
+    }
+  }
+
+  /**
+   * Installs the end summaries of a reusable context and of all contexts it
+   * transitively calls instead of exploring their bodies.
+   */
+  void reuse(const std::pair<f_t, d_t> &Key) {
+    std::vector<std::pair<f_t, d_t>> WorkList = {Key};
+    while (!WorkList.empty()) {
+      auto Current = WorkList.back();
+      WorkList.pop_back();
+      if (!Reused.insert(Current).second) {
+        continue;
+      }
+      const auto &Ctx = Reusable.at(Current);
+      for (n_t SP : this->ICF->getStartPointsOf(Current.first)) {
+        for (const auto &[EP, D2, Identity] : Ctx.Exits) {
+          std::shared_ptr<EdgeFunction<l_t>> Summary = ALL_BOTTOM;
+          if (Identity) {
+            Summary = EdgeIdentity<l_t>::getInstance();
+          }
+          this->addEndSummary(SP, Current.second, EP, D2, Summary);
+        }
+      }
+      for (const auto &Call : Ctx.Calls) {
+        WorkList.emplace_back(std::get<2>(Call), std::get<3>(Call));
+      }
+    }
+  }
+
+  bool reuseIfPossible(PathEdge<n_t, d_t> Edge) {
+    n_t Target = Edge.getTarget();
+    if (Edge.factAtSource() != Edge.factAtTarget() ||
+        !this->ICF->isStartPoint(Target)) {
+      return false;
+    }
+    auto Key = std::make_pair(this->ICF->getFunctionOf(Target),
+                              Edge.factAtTarget());
+    if (!Reusable.count(Key)) {
+      return false;
+    }
+    reuse(Key);
+    return true;
+  }
+
+  void processCall(PathEdge<n_t, d_t> Edge) override {
+    if (!reuseIfPossible(Edge)) {
+      SolverTy::processCall(Edge);
+    }
+  }
+
+  void processNormalFlow(PathEdge<n_t, d_t> Edge) override {
+    if (!reuseIfPossible(Edge)) {
+      SolverTy::processNormalFlow(Edge);
+    }
+  }
+
+  void processExit(PathEdge<n_t, d_t> Edge) override {
+    if (!reuseIfPossible(Edge)) {
+      SolverTy::processExit(Edge);
+    }
+  }
+
+  /**
+   * Computes the values within the reused contexts. In IFDS every edge
+   * function is either the identity or all-bottom, hence the value of a
+   * fact is bottom unless its jump function is the identity and the value at
+   * the context's entry is top.
+   */
+  void computeReusedValues() {
+    const l_t Bottom = this->IDEProblem.bottomElement();
+    std::map<std::pair<f_t, d_t>, l_t> EntryValues;
+    std::vector<std::pair<std::pair<f_t, d_t>, l_t>> WorkList;
+    for (const auto &Key : Reused) {
+      for (n_t SP : this->ICF->getStartPointsOf(Key.first)) {
+        if (this->valtab.contains(SP, Key.second)) {
+          WorkList.emplace_back(Key, this->valtab.get(SP, Key.second));
+        } else if (!this->jumpFn->reverseLookup(SP, Key.second).empty()) {
+          // entered from a freshly solved caller, but with value top
+          WorkList.emplace_back(Key, this->IDEProblem.topElement());
+        }
+      }
+    }
+    while (!WorkList.empty()) {
+      auto [Key, Value] = WorkList.back();
+      WorkList.pop_back();
+      auto Search = EntryValues.find(Key);
+      if (Search != EntryValues.end()) {
+        l_t Joined = this->IDEProblem.join(Search->second, Value);
+        if (Joined == Search->second) {
+          continue;
+        }
+        Value = Joined;
+      }
+      EntryValues[Key] = Value;
+      const auto &Ctx = Reusable.at(Key);
+      std::map<std::pair<n_t, d_t>, l_t> CallSiteValues;
+      for (const auto &[N, D2, Identity] : Ctx.Facts) {
+        CallSiteValues[{N, D2}] = Identity ? Value : Bottom;
+      }
+      for (const auto &[CallSite, D2, Callee, D3] : Ctx.Calls) {
+        l_t CallValue = CallSiteValues[{CallSite, D2}];
+        WorkList.emplace_back(std::make_pair(Callee, D3),
+                              this->IDEProblem.isZeroValue(D2) ? Bottom
+                                                               : CallValue);
+      }
+    }
+    for (const auto &[Key, Value] : EntryValues) {
+      for (const auto &[N, D2, Identity] : Reusable.at(Key).Facts) {
+        this->setVal(N, D2,
+                     this->IDEProblem.join(this->val(N, D2),
+                                           Identity ? Value : Bottom));
+      }
+    }
+  }
+};
+
+} // namespace psr
+
+#endif
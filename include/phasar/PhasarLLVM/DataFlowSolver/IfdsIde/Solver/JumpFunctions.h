@@ -75,16 +75,14 @@ public:
    */
   void addFunction(D sourceVal, N target, D targetVal,
                    std::shared_ptr<EdgeFunction<L>> function) {
-    auto &lg = lg::get();
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << "Start adding new jump function");
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                  << "Fact at source : " << problem.DtoString(sourceVal));
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                  << "Fact at target : " << problem.DtoString(targetVal));
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                  << "Destination    : " << problem.NtoString(target));
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                  << "Edge Function  : " << function->str());
+    PHASAR_LOG_LEVEL_CAT(DEBUG, Solver, "Start adding new jump function");
+    PHASAR_LOG_LEVEL_CAT(DEBUG, Solver,
+                         "Fact at source : " << problem.DtoString(sourceVal));
+    PHASAR_LOG_LEVEL_CAT(DEBUG, Solver,
+                         "Fact at target : " << problem.DtoString(targetVal));
+    PHASAR_LOG_LEVEL_CAT(DEBUG, Solver,
+                         "Destination    : " << problem.NtoString(target));
+    PHASAR_LOG_LEVEL_CAT(DEBUG, Solver, "Edge Function  : " << function->str());
     // we do not store the default function (all-top)
     if (function->equal_to(allTop)) {
       return;
@@ -99,8 +97,8 @@ public:
     targetValToFunc[targetVal] = function;
     // V Table::insert(R r, C c, V v) always overrides (see comments above)
     nonEmptyLookupByTargetNode[target].insert(sourceVal, targetVal, function);
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << "End adding new jump function");
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << ' ');
+    PHASAR_LOG_LEVEL_CAT(DEBUG, Solver, "End adding new jump function");
+    PHASAR_LOG_LEVEL_CAT(DEBUG, Solver, ' ');
   }
 
   /**
@@ -0,0 +1,249 @@
+/******************************************************************************
+ * Copyright (c) 2019 Philipp Schubert.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Philipp Schubert and others
+ *****************************************************************************/
+
+#ifndef PHASAR_PHASARLLVM_IFDSIDE_SOLVER_SUMMARYSTORESOLVER_H_
+#define PHASAR_PHASARLLVM_IFDSIDE_SOLVER_SUMMARYSTORESOLVER_H_
+
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "llvm/IR/Function.h"
+#include "llvm/IR/Instruction.h"
+#include "llvm/IR/Value.h"
+#include "llvm/Support/MD5.h"
+#include "llvm/Support/TypeName.h"
+
+#include "phasar/PhasarLLVM/AnalysisStrategy/IRSnapshot.h"
+#include "phasar/PhasarLLVM/DataFlowSolver/IfdsIde/EdgeFunctions/EdgeIdentity.h"
+#include "phasar/PhasarLLVM/DataFlowSolver/IfdsIde/Solver/IFDSToIDETabulationProblem.h"
+#include "phasar/PhasarLLVM/DataFlowSolver/IfdsIde/SummaryStore.h"
+#include "phasar/PhasarLLVM/Utils/BinaryDomain.h"
+#include "phasar/Utils/Logger.h"
+
+namespace psr {
+
+/**
+ * Turns an IFDSSolver into a solver that consults a SummaryStore whenever it
+ * descends into a callee, such that functions that have been summarized
+ * before, e.g. library code, are not solved again.
+ *
+ * Summaries are keyed by the analysis, the entry fact and a hash of the callee
+ * that covers the structural hashes of all functions it transitively calls,
+ * so a stored summary is only applied if none of them has changed. Callees
+ * that are mere declarations are hashed by name, i.e. a summary is not
+ * applied if a declaration it relied on is defined in the analyzed program.
+ * Facts are encoded relative to the summarized function, only contexts whose
+ * facts are the zero value, values of the function itself or globals can be
+ * stored.
+ *
+ * A store is filled by solving a problem whose entry points are the functions
+ * to summarize with IFDSIDESolverConfig::computePersistedSummaries set and
+ * passing its end summaries to addSummariesTo().
+ *
+ * Since arbitrary edge functions cannot be persisted, only IFDS problems over
+ * LLVM IR are supported.
+ */
+template <typename SolverTy> class SummaryStoreSolver : public SolverTy {
+public:
+  using n_t = typename SolverTy::n_t;
+  using d_t = typename SolverTy::d_t;
+  using f_t = typename SolverTy::f_t;
+  using l_t = typename SolverTy::l_t;
+
+  static_assert(std::is_same_v<l_t, BinaryDomain>,
+                "Summary stores are only supported for IFDS problems!");
+  static_assert(std::is_same_v<n_t, const llvm::Instruction *> &&
+                    std::is_same_v<d_t, const llvm::Value *> &&
+                    std::is_same_v<f_t, const llvm::Function *>,
+                "Summary stores require LLVM-based problems!");
+
+  /**
+   * @brief Creates a solver that applies the summaries of Store, if any. The
+   * analysis name is part of the key and defaults to the problem's type.
+   */
+  template <typename ProblemTy>
+  SummaryStoreSolver(
+      ProblemTy &Problem, const IRSnapshot &Snapshot,
+      const SummaryStore *Store = nullptr,
+      std::string Analysis = llvm::getTypeName<ProblemTy>().str())
+      : SolverTy(Problem), Snapshot(Snapshot), Store(Store),
+        Analysis(std::move(Analysis)) {}
+
+  ~SummaryStoreSolver() override = default;
+
+  /**
+   * @brief Adds the end summaries of all storable contexts of this run to
+   * Writer and returns their number.
+   */
+  size_t addSummariesTo(SummaryStoreWriter &Writer) {
+    size_t NumAdded = 0;
+    for (const auto &Entry : Snapshot.getFunctionHashes()) {
+      f_t F = Snapshot.getFunction(Entry.first);
+      for (n_t SP : this->ICF->getStartPointsOf(F)) {
+        if (!this->endsummarytab.containsRow(SP)) {
+          continue;
+        }
+        for (auto [D1, Summaries] : this->endsummarytab.row(SP)) {
+          std::string EntryFact = getFactId(F, D1);
+          if (EntryFact.empty()) {
+            continue;
+          }
+          std::vector<SummaryStore::Exit> Exits;
+          bool Storable = true;
+          for (auto Exit : Summaries.cellSet()) {
+            std::string Fact = getFactId(F, Exit.getColumnKey());
+            Storable &= !Fact.empty();
+            Exits.push_back({Snapshot.getInstructionIndex(Exit.getRowKey()),
+                             Fact, isIdentity(Exit.getValue())});
+          }
+          if (Storable) {
+            Writer.add(Analysis, getDeepHash(F), EntryFact, std::move(Exits));
+            ++NumAdded;
+          }
+        }
+      }
+    }
+    return NumAdded;
+  }
+
+  const std::string &getAnalysis() const { return Analysis; }
+
+  size_t getNumAppliedSummaries() const { return Applied.size(); }
+
+protected:
+  const IRSnapshot &Snapshot;
+  const SummaryStore *Store;
+  std::string Analysis;
+  std::map<f_t, std::string> DeepHashes;
+  std::set<std::pair<f_t, d_t>> Applied;
+  std::set<std::pair<f_t, d_t>> Rejected;
+
+  static bool isIdentity(const std::shared_ptr<EdgeFunction<l_t>> &EF) {
+    return EF->equal_to(EdgeIdentity<l_t>::getInstance());
+  }
+
+  /**
+   * Returns the id of D relative to F, or an empty string if D neither is the
+   * zero value, a global nor belongs to F.
+   */
+  std::string getFactId(f_t F, d_t D) const {
+    if (this->IDEProblem.isZeroValue(D)) {
+      return "zero";
+    }
+    std::string Id = Snapshot.getStableId(D);
+    std::string Key = IRSnapshot::getGlobalKey(F);
+    if (Id.empty() || Id[0] == 'g') {
+      return Id;
+    }
+    if (IRSnapshot::getFunctionNameOfId(Id) != Key) {
+      return "";
+    }
+    return Id.substr(0, Id.size() - Key.size() - 1);
+  }
+
+  d_t resolveFact(f_t F, const std::string &Id) const {
+    if (Id == "zero") {
+      return this->ZeroValue;
+    }
+    if (!Id.empty() && Id[0] == 'g') {
+      return Snapshot.getValue(Id);
+    }
+    return Snapshot.getValue(Id + ':' + IRSnapshot::getGlobalKey(F));
+  }
+
+  /**
+   * Hashes F together with all functions it transitively calls, sorted by
+   * name, which is independent of the order in which they are visited and
+   * thus robust against recursion.
+   */
+  const std::string &getDeepHash(f_t F) {
+    auto Search = DeepHashes.find(F);
+    if (Search != DeepHashes.end()) {
+      return Search->second;
+    }
+    std::map<std::string, std::string> Reachable;
+    std::vector<f_t> WorkList = {F};
+    while (!WorkList.empty()) {
+      f_t Current = WorkList.back();
+      WorkList.pop_back();
+      std::string Name = IRSnapshot::getGlobalKey(Current);
+      if (Reachable.count(Name)) {
+        continue;
+      }
+      if (Current->isDeclaration()) {
+        Reachable[Name] = "decl";
+        continue;
+      }
+      Reachable[Name] = IRSnapshot::getFunctionHash(Current);
+      for (n_t CallSite : this->ICF->getCallsFromWithin(Current)) {
+        for (f_t Callee : this->ICF->getCalleesOfCallAt(CallSite)) {
+          WorkList.push_back(Callee);
+        }
+      }
+    }
+    llvm::MD5 Hash;
+    for (const auto &[Name, FunctionHash] : Reachable) {
+      Hash.update(Name);
+      Hash.update(FunctionHash);
+    }
+    llvm::MD5::MD5Result Result;
+    Hash.final(Result);
+    return DeepHashes[F] = std::string(Result.digest());
+  }
+
+  bool applyStoredSummary(n_t SP, d_t D3) override {
+    if (!Store) {
+      return false;
+    }
+    f_t F = this->ICF->getFunctionOf(SP);
+    auto Key = std::make_pair(F, D3);
+    if (Applied.count(Key)) {
+      return true;
+    }
+    if (Rejected.count(Key)) {
+      return false;
+    }
+    std::vector<std::tuple<n_t, d_t, bool>> Exits;
+    std::string EntryFact = getFactId(F, D3);
+    std::vector<SummaryStore::Exit> Stored;
+    bool Valid = !EntryFact.empty() &&
+                 Store->lookup(Analysis, getDeepHash(F), EntryFact, Stored);
+    for (const auto &Exit : Stored) {
+      n_t EP = Snapshot.getInstruction(F, Exit.Idx);
+      d_t D2 = resolveFact(F, Exit.Fact);
+      Valid &= EP && D2;
+      Exits.emplace_back(EP, D2, Exit.Identity);
+    }
+    if (!Valid) {
+      Rejected.insert(Key);
+      return false;
+    }
+    PHASAR_LOG_LEVEL_CAT(DEBUG, Solver,
+                         "Apply stored summary of " << F->getName().str()
+                         << " for " << this->IDEProblem.DtoString(D3));
+    for (const auto &[EP, D2, Identity] : Exits) {
+      std::shared_ptr<EdgeFunction<l_t>> Summary = ALL_BOTTOM;
+      if (Identity) {
+        Summary = EdgeIdentity<l_t>::getInstance();
+      }
+      this->addEndSummary(SP, D3, EP, D2, Summary);
+    }
+    Applied.insert(Key);
+    return true;
+  }
+};
+
+} // namespace psr
+
+#endif
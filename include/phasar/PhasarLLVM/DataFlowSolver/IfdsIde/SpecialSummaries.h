@@ -21,15 +21,26 @@
 #include <memory>
 #include <ostream>
 #include <string>
+#include <type_traits>
 #include <vector>
 
+#include "boost/filesystem.hpp"
+
+#include "llvm/IR/Function.h"
+#include "llvm/IR/Instruction.h"
+#include "llvm/IR/Value.h"
+
 #include "phasar/Config/Configuration.h"
 #include "phasar/PhasarLLVM/DataFlowSolver/IfdsIde/EdgeFunction.h"
 #include "phasar/PhasarLLVM/DataFlowSolver/IfdsIde/EdgeFunctions/EdgeIdentity.h"
 #include "phasar/PhasarLLVM/DataFlowSolver/IfdsIde/FlowFunction.h"
 #include "phasar/PhasarLLVM/DataFlowSolver/IfdsIde/FlowFunctions/Identity.h"
+#include "phasar/PhasarLLVM/DataFlowSolver/IfdsIde/LLVMFlowFunctions/LibrarySummaryFlow.h"
+#include "phasar/PhasarLLVM/DataFlowSolver/IfdsIde/LibrarySummaries.h"
 #include "phasar/PhasarLLVM/Utils/BinaryDomain.h"
 #include "phasar/Utils/IO.h" // readFile
+#include "phasar/Utils/Logger.h"
+#include "phasar/Utils/Utilities.h"
 
 namespace psr {
 
@@ -38,6 +49,8 @@ private:
   std::map<std::string, std::shared_ptr<FlowFunction<D>>> SpecialFlowFunctions;
   std::map<std::string, std::shared_ptr<EdgeFunction<V>>> SpecialEdgeFunctions;
   std::vector<std::string> SpecialFunctionNames;
+  // declarative summaries, which take precedence over the identity defaults
+  LibrarySummaries Library;
 
   // Constructs the SpecialSummaryMap such that it contains all glibc,
   // llvm.intrinsics and C++'s new, new[], delete, delete[] with identity
@@ -51,6 +64,19 @@ private:
       SpecialEdgeFunctions.insert(
           std::make_pair(function_name, EdgeIdentity<V>::getInstance()));
     }
+    // load the library summaries shipped with the configuration, if any
+    const std::string LibrarySummariesPath =
+        PhasarConfig::ConfigurationDirectory() +
+        PhasarConfig::LibrarySummariesFileName();
+    if (boost::filesystem::exists(LibrarySummariesPath)) {
+      try {
+        Library = LibrarySummaries::loadFromFile(LibrarySummariesPath);
+      } catch (const std::exception &E) {
+        auto &lg = lg::get();
+        LOG_IF_ENABLE(BOOST_LOG_SEV(lg, WARNING)
+                      << "Could not load library summaries: " << E.what());
+      }
+    }
   }
 
 public:
@@ -83,12 +109,22 @@ public:
     return Override;
   }
 
+  // Adds declarative summaries that replace the ones of the same functions.
+  // They are only compiled into flow functions for LLVM-based analyses.
+  void provideLibrarySummaries(const LibrarySummaries &Summaries) {
+    Library.merge(Summaries);
+  }
+
+  const LibrarySummaries &getLibrarySummaries() const { return Library; }
+
   bool containsSpecialSummary(const llvm::Function *function) {
-    return containsSpecialSummary(function->getName().str());
+    return containsSpecialSummary(function->getName().str()) ||
+           containsSpecialSummary(cxx_demangle(function->getName().str())) ||
+           Library.getSummary(function);
   }
 
   bool containsSpecialSummary(const std::string &name) {
-    return SpecialFlowFunctions.count(name);
+    return SpecialFlowFunctions.count(name) || Library.getSummary(name);
   }
 
   std::shared_ptr<FlowFunction<D>>
@@ -101,6 +137,25 @@ public:
     return SpecialFlowFunctions[name];
   }
 
+  // Returns the summary of a call to the given function. A declarative
+  // summary is compiled for the call site, otherwise this falls back to the
+  // summary provided for the function's name, if any.
+  std::shared_ptr<FlowFunction<D>>
+  getSpecialFlowFunctionSummary(const llvm::Instruction *callSite,
+                                const llvm::Function *function) {
+    if constexpr (std::is_same_v<D, const llvm::Value *>) {
+      if (const auto *Summary = Library.getSummary(function)) {
+        return std::make_shared<LibrarySummaryFlow>(callSite, *Summary);
+      }
+    }
+    auto Search = SpecialFlowFunctions.find(function->getName().str());
+    if (Search == SpecialFlowFunctions.end()) {
+      Search = SpecialFlowFunctions.find(
+          cxx_demangle(function->getName().str()));
+    }
+    return Search != SpecialFlowFunctions.end() ? Search->second : nullptr;
+  }
+
   std::shared_ptr<EdgeFunction<V>>
   getSpecialEdgeFunctionSummary(const llvm::Function *function) {
     return getSpecialEdgeFunctionSummary(function->getName().str());
@@ -108,6 +163,9 @@ public:
 
   std::shared_ptr<EdgeFunction<V>>
   getSpecialEdgeFunctionSummary(const std::string &name) {
+    if (!SpecialEdgeFunctions.count(name) && Library.getSummary(name)) {
+      return EdgeIdentity<V>::getInstance();
+    }
     return SpecialEdgeFunctions[name];
   }
 
@@ -0,0 +1,119 @@
+/******************************************************************************
+ * Copyright (c) 2019 Philipp Schubert.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Philipp Schubert and others
+ *****************************************************************************/
+
+#ifndef PHASAR_PHASARLLVM_IFDSIDE_SUMMARYSTORE_H_
+#define PHASAR_PHASARLLVM_IFDSIDE_SUMMARYSTORE_H_
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace llvm {
+class MemoryBuffer;
+class StringRef;
+} // namespace llvm
+
+namespace psr {
+
+/**
+ * A read-only store of function summaries, e.g. of libraries that have been
+ * summarized offline, that is memory-mapped from a file written by
+ * SummaryStoreWriter. Lookups are binary searches on the mapped file, such
+ * that opening even a large store is cheap.
+ *
+ * A summary is keyed by the analysis, a hash of the function and everything
+ * it calls, and the entry fact. It consists of the end summaries of that
+ * calling context, see SummaryStoreSolver.
+ *
+ * File layout, all integers are stored little endian:
+ *
+ *   "PSRSUMST"                                  magic
+ *   uint32 version, uint32 number of entries
+ *   { uint32 key offset, uint32 key size,
+ *     uint32 value offset, uint32 value size }  per entry, sorted by key
+ *   keys and values
+ *
+ * A key is "<analysis>\0<function hash>\0<entry fact>", a value is a sequence
+ * of exits { uint32 exit index, uint8 identity, uint32 fact size, fact }.
+ */
+class SummaryStore {
+public:
+  struct Exit {
+    // position of the exit statement within its function
+    unsigned Idx;
+    std::string Fact;
+    // whether the edge function is the identity or all-bottom
+    bool Identity;
+
+    friend bool operator<(const Exit &Lhs, const Exit &Rhs) {
+      return std::tie(Lhs.Idx, Lhs.Fact, Lhs.Identity) <
+             std::tie(Rhs.Idx, Rhs.Fact, Rhs.Identity);
+    }
+
+    friend bool operator==(const Exit &Lhs, const Exit &Rhs) {
+      return std::tie(Lhs.Idx, Lhs.Fact, Lhs.Identity) ==
+             std::tie(Rhs.Idx, Rhs.Fact, Rhs.Identity);
+    }
+  };
+
+  static constexpr uint32_t FormatVersion = 1;
+
+  /**
+   * @brief Maps the store at the given path. Throws std::runtime_error if the
+   * file cannot be read or is not a summary store.
+   */
+  explicit SummaryStore(const std::string &Path);
+
+  ~SummaryStore();
+
+  SummaryStore(const SummaryStore &) = delete;
+  SummaryStore &operator=(const SummaryStore &) = delete;
+
+  /**
+   * @brief Looks up a summary. Returns false if there is none or if the
+   * stored summary is malformed.
+   */
+  bool lookup(const std::string &Analysis, const std::string &FunctionHash,
+              const std::string &EntryFact, std::vector<Exit> &Exits) const;
+
+  size_t size() const { return NumEntries; }
+
+private:
+  std::unique_ptr<llvm::MemoryBuffer> Buffer;
+  uint32_t NumEntries = 0;
+
+  llvm::StringRef getField(size_t Entry, size_t Field) const;
+};
+
+/**
+ * Collects summaries and writes them in the format of SummaryStore.
+ */
+class SummaryStoreWriter {
+private:
+  std::map<std::string, std::vector<SummaryStore::Exit>> Entries;
+
+public:
+  void add(const std::string &Analysis, const std::string &FunctionHash,
+           const std::string &EntryFact, std::vector<SummaryStore::Exit> Exits);
+
+  size_t size() const { return Entries.size(); }
+
+  /**
+   * @brief Writes the store. Throws std::ios_base::failure if the file could
+   * not be written.
+   */
+  void write(const std::string &Path) const;
+};
+
+} // namespace psr
+
+#endif
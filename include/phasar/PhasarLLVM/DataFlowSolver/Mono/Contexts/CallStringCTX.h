@@ -1,48 +1,63 @@
 #ifndef _PHASAR_PHASARLLVM_MONO_CALLSTRINGCTX_H_
 #define _PHASAR_PHASARLLVM_MONO_CALLSTRINGCTX_H_
 
-#include <deque>
+#include <algorithm>
+#include <array>
 #include <functional>
 #include <initializer_list>
+#include <stdexcept>
 
 #include "boost/functional/hash.hpp"
 #include "phasar/Utils/LLVMShorthands.h"
 
 namespace psr {
 
+/**
+ * A call string of at most K call sites, the most recent one is last. Pushing
+ * onto a full call string drops its oldest call site. The call sites are
+ * stored inline, such that call strings can be copied and compared cheaply.
+ */
 template <typename N, unsigned K> class CallStringCTX {
+  static_assert(K > 0, "call strings must hold at least one call site");
+
 protected:
-  std::deque<N> cs;
+  std::array<N, K> cs{};
+  unsigned Size = 0;
   static const unsigned k = K;
   friend struct std::hash<psr::CallStringCTX<N, K>>;
 
 public:
   CallStringCTX() {}
 
-  CallStringCTX(std::initializer_list<N> ilist) : cs(ilist) {
+  CallStringCTX(std::initializer_list<N> ilist) {
     if (ilist.size() > k) {
       throw std::runtime_error(
           "initial call std::string length exceeds maximal length K");
     }
+    std::copy(ilist.begin(), ilist.end(), cs.begin());
+    Size = ilist.size();
   }
 
   void push_back(N n) {
-    if (cs.size() > k - 1) {
-      cs.pop_front();
+    if (Size == k) {
+      std::move(cs.begin() + 1, cs.end(), cs.begin());
+      --Size;
     }
-    cs.push_back(n);
+    cs[Size++] = n;
   }
 
   N pop_back() {
-    if (cs.size() > 0) {
-      N n = cs.back();
-      cs.pop_back();
+    if (Size > 0) {
+      N n = cs[--Size];
+      cs[Size] = N{};
       return n;
     }
     return N{};
   }
 
-  bool isEqual(const CallStringCTX &rhs) const { return cs == rhs.cs; }
+  bool isEqual(const CallStringCTX &rhs) const {
+    return Size == rhs.Size && std::equal(begin(), end(), rhs.begin());
+  }
 
   bool isDifferent(const CallStringCTX &rhs) const { return !isEqual(rhs); }
 
@@ -58,16 +73,17 @@ public:
 
   friend bool operator<(const CallStringCTX<N, K> &Lhs,
                         const CallStringCTX<N, K> &Rhs) {
-    return Lhs.cs < Rhs.cs;
+    return std::lexicographical_compare(Lhs.begin(), Lhs.end(), Rhs.begin(),
+                                        Rhs.end());
   }
 
   void print(std::ostream &os) const {
     os << "Call string: [ ";
-    for (auto C : cs) {
-      os << llvmIRToString(C);
-      if (C != cs.back()) {
+    for (auto It = begin(); It != end(); ++It) {
+      if (It != begin()) {
         os << " * ";
       }
+      os << llvmIRToString(*It);
     }
     os << " ]";
   }
@@ -78,9 +94,19 @@ public:
     return os;
   }
 
-  bool empty() const { return cs.empty(); }
+  typename std::array<N, K>::const_iterator begin() const {
+    return cs.begin();
+  }
+
+  typename std::array<N, K>::const_iterator end() const {
+    return cs.begin() + Size;
+  }
+
+  N back() const { return Size > 0 ? cs[Size - 1] : N{}; }
+
+  bool empty() const { return Size == 0; }
 
-  std::size_t size() const { return cs.size(); }
+  std::size_t size() const { return Size; }
 };
 
 } // namespace psr
@@ -89,14 +115,12 @@ namespace std {
 
 template <typename N, unsigned K> struct hash<psr::CallStringCTX<N, K>> {
   size_t operator()(const psr::CallStringCTX<N, K> &CS) const noexcept {
-    boost::hash<std::deque<N>> hash_deque;
-    std::hash<unsigned> hash_unsigned;
-    size_t u = hash_unsigned(K);
-    size_t h = hash_deque(CS.cs);
-    return u ^ (h << 1);
+    size_t h = std::hash<unsigned>()(K);
+    boost::hash_range(h, CS.begin(), CS.end());
+    return h;
   }
 };
 
 } // namespace std
 
-#endif
\ No newline at end of file
+#endif
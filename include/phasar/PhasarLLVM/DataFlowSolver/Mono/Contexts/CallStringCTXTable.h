@@ -0,0 +1,95 @@
+/******************************************************************************
+ * Copyright (c) 2019 Philipp Schubert.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Philipp Schubert and others
+ *****************************************************************************/
+
+#ifndef PHASAR_PHASARLLVM_MONO_CONTEXTS_CALLSTRINGCTXTABLE_H_
+#define PHASAR_PHASARLLVM_MONO_CONTEXTS_CALLSTRINGCTXTABLE_H_
+
+#include <cstddef>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "phasar/PhasarLLVM/DataFlowSolver/Mono/Contexts/CallStringCTX.h"
+
+namespace psr {
+
+/**
+ * Interns K-limited call strings: every distinct call string is stored once
+ * and referred to by a dense integer id. The empty call string always has id
+ * 0. Pushing and popping call sites is memoized on the ids, such that a
+ * solver only has to construct a call string the first time a transition is
+ * taken.
+ */
+template <typename N, unsigned K> class CallStringCTXTable {
+public:
+  using ContextTy = CallStringCTX<N, K>;
+
+  static constexpr unsigned EmptyContext = 0;
+
+  CallStringCTXTable() { getId(ContextTy()); }
+
+  /**
+   * @brief Returns the id of CTX, interning it if necessary.
+   */
+  unsigned getId(const ContextTy &CTX) {
+    auto [It, Inserted] = Ids.try_emplace(CTX, Contexts.size());
+    if (Inserted) {
+      Contexts.push_back(CTX);
+      Pushes.emplace_back();
+    }
+    return It->second;
+  }
+
+  const ContextTy &getContext(unsigned Id) const { return Contexts[Id]; }
+
+  /**
+   * @brief Returns the id of the call string that results from entering
+   * CallSite in context Id.
+   */
+  unsigned push(unsigned Id, N CallSite) {
+    auto It = Pushes[Id].find(CallSite);
+    if (It != Pushes[Id].end()) {
+      return It->second;
+    }
+    ContextTy CTX(Contexts[Id]);
+    CTX.push_back(CallSite);
+    unsigned Result = getId(CTX);
+    Pushes[Id].emplace(CallSite, Result);
+    return Result;
+  }
+
+  /**
+   * @brief Returns the most recent call site of context Id together with the
+   * id of the call string it returns to.
+   */
+  std::pair<N, unsigned> pop(unsigned Id) {
+    auto It = Pops.find(Id);
+    if (It != Pops.end()) {
+      return It->second;
+    }
+    ContextTy CTX(Contexts[Id]);
+    N CallSite = CTX.pop_back();
+    auto Result = std::make_pair(CallSite, getId(CTX));
+    Pops.emplace(Id, Result);
+    return Result;
+  }
+
+  size_t size() const { return Contexts.size(); }
+
+private:
+  std::vector<ContextTy> Contexts;
+  std::unordered_map<ContextTy, unsigned> Ids;
+  // the memoized pushes, indexed by the id of the context pushed onto
+  std::vector<std::unordered_map<N, unsigned>> Pushes;
+  std::unordered_map<unsigned, std::pair<N, unsigned>> Pops;
+};
+
+} // namespace psr
+
+#endif
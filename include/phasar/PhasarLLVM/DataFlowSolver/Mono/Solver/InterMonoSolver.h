@@ -17,17 +17,29 @@
 #ifndef PHASAR_PHASARLLVM_MONO_SOLVER_INTERMONOSOLVER_H_
 #define PHASAR_PHASARLLVM_MONO_SOLVER_INTERMONOSOLVER_H_
 
+#include <cstdint>
 #include <deque>
 #include <iostream>
+#include <sstream>
+#include <string>
+#include <type_traits>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
 
+#include "boost/algorithm/string/trim.hpp"
+
+#include "phasar/PhasarLLVM/DataFlowSolver/IfdsIde/ResultStore.h"
 #include "phasar/PhasarLLVM/DataFlowSolver/Mono/Contexts/CallStringCTX.h"
+#include "phasar/PhasarLLVM/DataFlowSolver/Mono/Contexts/CallStringCTXTable.h"
 #include "phasar/PhasarLLVM/DataFlowSolver/Mono/InterMonoProblem.h"
+#include "phasar/PhasarLLVM/DataFlowSolver/Mono/Solver/MonoWorklist.h"
 #include "phasar/Utils/BitVectorSet.h"
+#include "phasar/Utils/JsonWriter.h"
 #include "phasar/Utils/LLVMShorthands.h"
+#include "phasar/Utils/PAMMMacros.h"
+#include "phasar/Utils/SarifWriter.h"
 
 namespace psr {
 
@@ -39,29 +51,68 @@ public:
 
 protected:
   InterMonoProblem<N, D, F, T, V, I> &IMProblem;
-  std::deque<std::pair<N, N>> Worklist;
-  std::unordered_map<N,
-                     std::unordered_map<CallStringCTX<N, K>, BitVectorSet<D>>>
-      Analysis;
+  MonoWorklist<N> Worklist;
+  CallStringCTXTable<N, K> Contexts;
+  std::unordered_map<N, unsigned> NodeIds;
+  std::vector<N> Nodes;
+  // the ids of the contexts that hold facts at a node, indexed by node id
+  std::vector<std::vector<unsigned>> NodeContexts;
+  // maps (node id, context id) to the facts that hold there
+  std::unordered_map<uint64_t, unsigned> FactIds;
+  std::deque<BitVectorSet<D>> Facts;
   std::unordered_set<F> AddedFunctions;
   const I *ICF;
 
+  unsigned getNodeId(N Node) {
+    auto [It, Inserted] = NodeIds.try_emplace(Node, Nodes.size());
+    if (Inserted) {
+      Nodes.push_back(Node);
+      NodeContexts.emplace_back();
+    }
+    return It->second;
+  }
+
+  /**
+   * @brief Returns the facts that hold at Node in context CTX, which are
+   * created empty if necessary.
+   */
+  BitVectorSet<D> &getFacts(N Node, unsigned CTX) {
+    unsigned NodeId = getNodeId(Node);
+    uint64_t Key = (static_cast<uint64_t>(NodeId) << 32) | CTX;
+    auto [It, Inserted] = FactIds.try_emplace(Key, Facts.size());
+    if (Inserted) {
+      Facts.emplace_back();
+      NodeContexts[NodeId].push_back(CTX);
+    }
+    return Facts[It->second];
+  }
+
+  /**
+   * @brief Returns the ids of the contexts that hold facts at Node. The
+   * result is a copy, since the contexts of Node may grow while they are
+   * processed.
+   */
+  std::vector<unsigned> getContextsAt(N Node) {
+    return NodeContexts[getNodeId(Node)];
+  }
+
   void initialize() {
     for (auto &seed : IMProblem.initialSeeds()) {
       std::vector<std::pair<N, N>> edges =
           ICF->getAllControlFlowEdges(ICF->getFunctionOf(seed.first));
-      Worklist.insert(Worklist.begin(), edges.begin(), edges.end());
+      Worklist.addFunction(*ICF, ICF->getFunctionOf(seed.first));
+      Worklist.push(edges.begin(), edges.end());
       // Initialize with empty context and empty data-flow set such that the
       // flow functions are at least called once per instruction
       for (auto &edge : edges) {
-        Analysis[edge.first][CallStringCTX<N, K>()];
+        getFacts(edge.first, Contexts.EmptyContext);
       }
       // Initialize last
       if (!edges.empty()) {
-        Analysis[edges.back().second][CallStringCTX<N, K>()];
+        getFacts(edges.back().second, Contexts.EmptyContext);
       }
       // Additionally, insert the initial seeds
-      Analysis[seed.first][CallStringCTX<N, K>()].insert(seed.second);
+      getFacts(seed.first, Contexts.EmptyContext).insert(seed.second);
     }
   }
 
@@ -79,7 +130,7 @@ protected:
 
   void printWorkList() {
     std::cout << "CURRENT WORKLIST:" << std::endl;
-    for (auto Entry : Worklist) {
+    for (auto Entry : Worklist.getQueuedEdges()) {
       std::cout << llvmIRToString(Entry.first) << " ---> "
                 << llvmIRToString(Entry.second) << std::endl;
     }
@@ -103,26 +154,27 @@ protected:
         break;
       }
       AddedFunctions.insert(callee);
+      Worklist.addFunction(*ICF, callee);
       // Add call edge(s)
       for (auto startPoint : ICF->getStartPointsOf(callee)) {
-        Worklist.push_back({src, startPoint});
+        Worklist.push({src, startPoint});
       }
       // Add intra edges of callee
       std::vector<std::pair<N, N>> edges = ICF->getAllControlFlowEdges(callee);
-      Worklist.insert(Worklist.begin(), edges.begin(), edges.end());
+      Worklist.push(edges.begin(), edges.end());
       // Initialize with empty context and empty data-flow set such that the
       // flow functions are at least called once per instruction
       for (auto &edge : edges) {
-        Analysis[edge.first][CallStringCTX<N, K>()];
+        getFacts(edge.first, Contexts.EmptyContext);
       }
       // Initialize last
       if (!edges.empty()) {
-        Analysis[edges.back().second][CallStringCTX<N, K>()];
+        getFacts(edges.back().second, Contexts.EmptyContext);
       }
       // Add return edge(s)
       for (auto ret : ICF->getExitPointsOf(callee)) {
         for (auto retSite : ICF->getReturnSitesOfCallAt(src)) {
-          Worklist.push_back({ret, retSite});
+          Worklist.push({ret, retSite});
         }
       }
     }
@@ -131,18 +183,18 @@ protected:
   }
 
   void addToWorklist(std::pair<N, N> edge) {
-    auto src = edge.first;
+    // the facts of edge.first have not changed, such that edge itself does
+    // not need to be processed again
     auto dst = edge.second;
-    Worklist.push_back({src, dst});
     // add intra-procedural edges again
     for (auto nprimeprime : ICF->getSuccsOf(dst)) {
-      Worklist.push_back({dst, nprimeprime});
+      Worklist.push({dst, nprimeprime});
     }
     // add inter-procedural call edges again
     if (ICF->isCallStmt(dst)) {
       for (auto callee : ICF->getCalleesOfCallAt(dst)) {
         for (auto startPoint : ICF->getStartPointsOf(callee)) {
-          Worklist.push_back({dst, startPoint});
+          Worklist.push({dst, startPoint});
         }
       }
     }
@@ -150,7 +202,7 @@ protected:
     if (ICF->isExitStmt(dst)) {
       for (auto caller : ICF->getCallersOf(ICF->getFunctionOf(dst))) {
         for (auto nprimeprime : ICF->getSuccsOf(caller)) {
-          Worklist.push_back({dst, nprimeprime});
+          Worklist.push({dst, nprimeprime});
         }
       }
     }
@@ -168,124 +220,141 @@ public:
   std::unordered_map<N,
                      std::unordered_map<CallStringCTX<N, K>, BitVectorSet<D>>>
   getAnalysis() {
-    return Analysis;
+    std::unordered_map<N,
+                       std::unordered_map<CallStringCTX<N, K>, BitVectorSet<D>>>
+        Result;
+    for (auto Node : Nodes) {
+      auto &ContextMap = Result[Node];
+      for (unsigned CTX : getContextsAt(Node)) {
+        ContextMap[Contexts.getContext(CTX)] = getFacts(Node, CTX);
+      }
+    }
+    return Result;
   }
 
   virtual void solve() {
+    PAMM_GET_INSTANCE;
+    REG_COUNTER("InterMono Iterations", 0, PAMM_SEVERITY_LEVEL::Full);
+    REG_COUNTER("InterMono Re-visits", 0, PAMM_SEVERITY_LEVEL::Full);
+    REG_COUNTER("InterMono Duplicate Edges", 0, PAMM_SEVERITY_LEVEL::Full);
+    REG_COUNTER("InterMono Contexts", 0, PAMM_SEVERITY_LEVEL::Full);
     initialize();
     while (!Worklist.empty()) {
-      std::pair<N, N> edge = Worklist.front();
-      Worklist.pop_front();
+      std::pair<N, N> edge = Worklist.pop();
       auto src = edge.first;
       auto dst = edge.second;
       if (ICF->isCallStmt(src)) {
         addCalleesToWorklist(edge);
       }
       // Compute the data-flow facts using the respective flow function
-      std::unordered_map<CallStringCTX<N, K>, BitVectorSet<D>> Out;
       if (ICF->isCallStmt(src)) {
         // Handle call and call-to-ret flow
         if (!isIntraEdge(edge)) {
           // Handle call flow
-          for (auto &[CTX, Facts] : Analysis[src]) {
-            auto CTXAdd(CTX);
-            CTXAdd.push_back(src);
-            Out[CTXAdd] = IMProblem.callFlow(src, ICF->getFunctionOf(dst),
-                                             Analysis[src][CTX]);
-            bool flowfactsstabilized =
-                IMProblem.sqSubSetEqual(Out[CTXAdd], Analysis[dst][CTXAdd]);
-            if (!flowfactsstabilized) {
-              Analysis[dst][CTXAdd] =
-                  IMProblem.join(Analysis[dst][CTXAdd], Out[CTXAdd]);
+          for (unsigned CTX : getContextsAt(src)) {
+            unsigned CTXAdd = Contexts.push(CTX, src);
+            auto Out = IMProblem.callFlow(src, ICF->getFunctionOf(dst),
+                                          getFacts(src, CTX));
+            auto &DstFacts = getFacts(dst, CTXAdd);
+            if (!IMProblem.sqSubSetEqual(Out, DstFacts)) {
+              DstFacts = IMProblem.join(DstFacts, Out);
               addToWorklist({src, dst});
             }
           }
         } else {
           // Handle call-to-ret flow
-          for (auto &[CTX, Facts] : Analysis[src]) {
+          for (unsigned CTX : getContextsAt(src)) {
             // call-to-ret flow does not modify contexts
-            Out[CTX] = IMProblem.callToRetFlow(
-                src, dst, ICF->getCalleesOfCallAt(src), Analysis[src][CTX]);
-            bool flowfactsstabilized =
-                IMProblem.sqSubSetEqual(Out[CTX], Analysis[dst][CTX]);
-            if (!flowfactsstabilized) {
-              Analysis[dst][CTX] = IMProblem.join(Analysis[dst][CTX], Out[CTX]);
+            auto Out = IMProblem.callToRetFlow(
+                src, dst, ICF->getCalleesOfCallAt(src), getFacts(src, CTX));
+            auto &DstFacts = getFacts(dst, CTX);
+            if (!IMProblem.sqSubSetEqual(Out, DstFacts)) {
+              DstFacts = IMProblem.join(DstFacts, Out);
               addToWorklist({src, dst});
             }
           }
         }
       } else if (ICF->isExitStmt(src)) {
         // Handle return flow
-        for (auto &[CTX, Facts] : Analysis[src]) {
-          auto CTXRm(CTX);
+        std::unordered_map<unsigned, BitVectorSet<D>> Out;
+        for (unsigned CTX : getContextsAt(src)) {
+          unsigned CTXRm = CTX;
           // we need to use several call- and retsites if the context is empty
           std::set<N> callsites;
           std::set<N> retsites;
-          std::cout << "CTX: " << CTX << '\n';
           // handle empty context
-          if (CTX.empty()) {
+          if (CTX == Contexts.EmptyContext) {
             callsites = ICF->getCallersOf(ICF->getFunctionOf(src));
           } else {
             // handle context containing at least one element
-            callsites.insert(CTXRm.pop_back());
+            auto [CallSite, Caller] = Contexts.pop(CTX);
+            callsites.insert(CallSite);
+            CTXRm = Caller;
           }
-          std::cout << "CTXRm: " << CTXRm << std::endl;
           // retrieve the possible return sites for each call
           for (auto callsite : callsites) {
             auto retsitesPerCall = ICF->getReturnSitesOfCallAt(callsite);
             retsites.insert(retsitesPerCall.begin(), retsitesPerCall.end());
           }
+          auto &OutFacts = Out[CTXRm];
           for (auto callsite : callsites) {
             auto retFactsPerCall =
                 IMProblem.returnFlow(callsite, ICF->getFunctionOf(src), src,
-                                     dst, Analysis[src][CTX]);
-            Out[CTXRm].insert(retFactsPerCall);
+                                     dst, getFacts(src, CTX));
+            OutFacts.insert(retFactsPerCall);
           }
           for (auto retsite : retsites) {
-            bool flowfactsstabilized =
-                IMProblem.sqSubSetEqual(Out[CTXRm], Analysis[retsite][CTXRm]);
-            if (!flowfactsstabilized) {
-              Analysis[dst][CTXRm] =
-                  IMProblem.join(Analysis[retsite][CTXRm], Out[CTXRm]);
+            auto &RetSiteFacts = getFacts(retsite, CTXRm);
+            if (!IMProblem.sqSubSetEqual(OutFacts, RetSiteFacts)) {
+              getFacts(dst, CTXRm) = IMProblem.join(RetSiteFacts, OutFacts);
               addToWorklist({src, retsite});
             }
           }
         }
       } else {
         // Handle normal flow
-        for (auto &[CTX, Facts] : Analysis[src]) {
-          Out[CTX] = IMProblem.normalFlow(src, Analysis[src][CTX]);
+        for (unsigned CTX : getContextsAt(src)) {
+          auto Out = IMProblem.normalFlow(src, getFacts(src, CTX));
           // Check if data-flow facts have changed and if so, add edge(s) to
           // worklist again.
-          bool flowfactsstabilized =
-              IMProblem.sqSubSetEqual(Out[CTX], Analysis[dst][CTX]);
-          if (!flowfactsstabilized) {
-            Analysis[dst][CTX] = IMProblem.join(Analysis[dst][CTX], Out[CTX]);
+          auto &DstFacts = getFacts(dst, CTX);
+          if (!IMProblem.sqSubSetEqual(Out, DstFacts)) {
+            DstFacts = IMProblem.join(DstFacts, Out);
             addToWorklist({src, dst});
           }
         }
       }
     }
+    INC_COUNTER("InterMono Iterations", Worklist.getNumIterations(),
+                PAMM_SEVERITY_LEVEL::Full);
+    INC_COUNTER("InterMono Re-visits", Worklist.getNumRevisits(),
+                PAMM_SEVERITY_LEVEL::Full);
+    INC_COUNTER("InterMono Duplicate Edges", Worklist.getNumDuplicates(),
+                PAMM_SEVERITY_LEVEL::Full);
+    INC_COUNTER("InterMono Contexts", Contexts.size(),
+                PAMM_SEVERITY_LEVEL::Full);
   }
 
   BitVectorSet<D> getResultsAt(N n) {
     BitVectorSet<D> Result;
-    for (auto &[CTX, Facts] : Analysis[n]) {
-      Result.insert(Facts);
+    for (unsigned CTX : getContextsAt(n)) {
+      Result.insert(getFacts(n, CTX));
     }
     return Result;
   }
 
   virtual void dumpResults(std::ostream &OS = std::cout) {
     OS << "======= DUMP LLVM-INTER-MONOTONE-SOLVER RESULTS =======\n";
-    for (auto &[Node, ContextMap] : this->Analysis) {
+    for (auto Node : Nodes) {
       OS << "Instruction:\n" << this->IMProblem.NtoString(Node);
       OS << "\nFacts:\n";
-      if (ContextMap.empty()) {
+      auto NodeCTXs = getContextsAt(Node);
+      if (NodeCTXs.empty()) {
         OS << "\tEMPTY\n";
       } else {
-        for (auto &[Context, FlowFacts] : ContextMap) {
-          OS << Context << '\n';
+        for (unsigned CTX : NodeCTXs) {
+          OS << Contexts.getContext(CTX) << '\n';
+          const auto &FlowFacts = getFacts(Node, CTX);
           if (FlowFacts.empty()) {
             OS << "\tEMPTY\n";
           } else {
@@ -299,9 +368,111 @@ public:
     }
   }
 
+  /**
+   * @brief Streams the facts that hold at each instruction, grouped by their
+   * calling contexts, as JSON to OS.
+   */
+  virtual void emitJsonReport(std::ostream &OS = std::cout) {
+    JsonWriter W(OS);
+    W.beginObject();
+    W.key("DataFlow");
+    W.beginObject();
+    for (auto Node : Nodes) {
+      W.key(ICF->getFunctionName(ICF->getFunctionOf(Node)) +
+            "::" + getTrimmed(IMProblem.NtoString(Node)));
+      W.beginObject();
+      W.key("Contexts");
+      W.beginArray();
+      for (unsigned CTX : getContextsAt(Node)) {
+        W.beginObject();
+        W.key("Context");
+        std::stringstream CTXStr;
+        CTXStr << Contexts.getContext(CTX);
+        W.value(CTXStr.str());
+        W.key("Facts");
+        W.beginArray();
+        for (auto FlowFact : getFacts(Node, CTX)) {
+          W.value(getTrimmed(IMProblem.DtoString(FlowFact)));
+        }
+        W.endArray();
+        W.endObject();
+      }
+      W.endArray();
+      W.endObject();
+    }
+    W.endObject();
+    W.endObject();
+    OS << '\n';
+  }
+
+  /**
+   * @brief Writes the facts that hold at each instruction to a memory-mappable
+   * ResultStore at the given path, the value of a fact is the calling context
+   * it holds in. Instructions are keyed by their ID annotations, if they have
+   * one.
+   */
+  virtual void emitResultStore(const std::string &Path) {
+    ResultStoreWriter Writer;
+    // intern the facts and contexts, such that each one is printed only once
+    std::unordered_map<D, uint32_t> FactIds;
+    std::unordered_map<unsigned, uint32_t> ContextIds;
+    for (auto Node : Nodes) {
+      std::string Name = ICF->getFunctionName(ICF->getFunctionOf(Node)) +
+                         "::" + getTrimmed(IMProblem.NtoString(Node));
+      std::string Key = Name;
+      if constexpr (std::is_convertible_v<N, const llvm::Value *>) {
+        if (std::string ID = getMetaDataID(Node); ID != "-1") {
+          Key = ID;
+        }
+      }
+      uint32_t NodeId = Writer.addNode(Key, Name);
+      for (unsigned CTX : getContextsAt(Node)) {
+        auto [CTXIt, CTXInserted] = ContextIds.try_emplace(CTX, 0);
+        if (CTXInserted) {
+          std::stringstream CTXStr;
+          CTXStr << Contexts.getContext(CTX);
+          CTXIt->second = Writer.addValue(CTXStr.str());
+        }
+        for (auto FlowFact : getFacts(Node, CTX)) {
+          auto [It, Inserted] = FactIds.try_emplace(FlowFact, 0);
+          if (Inserted) {
+            It->second =
+                Writer.addFact(getTrimmed(IMProblem.DtoString(FlowFact)));
+          }
+          Writer.addCell(NodeId, It->second, CTXIt->second);
+        }
+      }
+    }
+    Writer.write(Path);
+  }
+
+  /**
+   * @brief Writes the facts that hold at each instruction in any context as
+   * notes of a SARIF log to OS.
+   */
+  virtual void emitSarifReport(std::ostream &OS = std::cout) {
+    SarifWriter SW(OS);
+    for (auto Node : Nodes) {
+      SarifWriter::Location Loc;
+      if constexpr (std::is_convertible_v<N, const llvm::Value *>) {
+        Loc = SarifWriter::getLocationOf(Node);
+      }
+      for (auto FlowFact : getResultsAt(Node)) {
+        SW.addResult("DataFlow", SarifWriter::Level::Note,
+                     getTrimmed(IMProblem.DtoString(FlowFact)), Loc);
+      }
+    }
+  }
+
   virtual void emitTextReport(std::ostream &OS = std::cout) {}
 
   virtual void emitGraphicalReport(std::ostream &OS = std::cout) {}
+
+private:
+  static std::string getTrimmed(std::string S) {
+    boost::algorithm::trim(S);
+    return S;
+  }
 };
 
 template <typename Problem, unsigned K>
@@ -17,14 +17,23 @@
 #ifndef PHASAR_PHASARLLVM_MONO_SOLVER_INTRAMONOSOLVER_H_
 #define PHASAR_PHASARLLVM_MONO_SOLVER_INTRAMONOSOLVER_H_
 
-#include <deque>
 #include <iostream>
+#include <string>
+#include <type_traits>
 #include <unordered_map>
 #include <utility>
 #include <vector>
 
+#include "boost/algorithm/string/trim.hpp"
+
+#include "phasar/PhasarLLVM/DataFlowSolver/IfdsIde/ResultStore.h"
 #include "phasar/PhasarLLVM/DataFlowSolver/Mono/IntraMonoProblem.h"
+#include "phasar/PhasarLLVM/DataFlowSolver/Mono/Solver/MonoWorklist.h"
 #include "phasar/Utils/BitVectorSet.h"
+#include "phasar/Utils/JsonWriter.h"
+#include "phasar/Utils/LLVMShorthands.h"
+#include "phasar/Utils/PAMMMacros.h"
+#include "phasar/Utils/SarifWriter.h"
 
 namespace psr {
 
@@ -36,7 +45,7 @@ public:
 
 protected:
   ProblemTy &IMProblem;
-  std::deque<std::pair<N, N>> Worklist;
+  MonoWorklist<N> Worklist;
   std::unordered_map<N, BitVectorSet<D>> Analysis;
   const C *CFG;
 
@@ -47,8 +56,8 @@ protected:
           IMProblem.getProjectIRDB()->getFunctionDefinition(EntryPoint);
       auto ControlFlowEdges = CFG->getAllControlFlowEdges(Function);
       // add all intra-procedural edges to the worklist
-      Worklist.insert(Worklist.begin(), ControlFlowEdges.begin(),
-                      ControlFlowEdges.end());
+      Worklist.addFunction(*CFG, Function);
+      Worklist.push(ControlFlowEdges.begin(), ControlFlowEdges.end());
       // set all analysis information to the empty set
       for (auto s : CFG->getAllInstructionsOf(Function)) {
         Analysis.insert(std::make_pair(s, BitVectorSet<D>()));
@@ -65,23 +74,31 @@ public:
       : IMProblem(IMP), CFG(IMP.getCFG()) {}
   virtual ~IntraMonoSolver() = default;
   virtual void solve() {
+    PAMM_GET_INSTANCE;
+    REG_COUNTER("IntraMono Iterations", 0, PAMM_SEVERITY_LEVEL::Full);
+    REG_COUNTER("IntraMono Re-visits", 0, PAMM_SEVERITY_LEVEL::Full);
+    REG_COUNTER("IntraMono Duplicate Edges", 0, PAMM_SEVERITY_LEVEL::Full);
     // step 1: Initalization (of Worklist and Analysis)
     initialize();
     // step 2: Iteration (updating Worklist and Analysis)
     while (!Worklist.empty()) {
-      // std::cout << "worklist size: " << Worklist.size() << "\n";
-      std::pair<N, N> path = Worklist.front();
-      Worklist.pop_front();
+      std::pair<N, N> path = Worklist.pop();
       N src = path.first;
       N dst = path.second;
       BitVectorSet<D> Out = IMProblem.normalFlow(src, Analysis[src]);
       if (!IMProblem.sqSubSetEqual(Out, Analysis[dst])) {
         Analysis[dst] = IMProblem.join(Analysis[dst], Out);
         for (auto nprimeprime : CFG->getSuccsOf(dst)) {
-          Worklist.push_back({dst, nprimeprime});
+          Worklist.push({dst, nprimeprime});
         }
       }
     }
+    INC_COUNTER("IntraMono Iterations", Worklist.getNumIterations(),
+                PAMM_SEVERITY_LEVEL::Full);
+    INC_COUNTER("IntraMono Re-visits", Worklist.getNumRevisits(),
+                PAMM_SEVERITY_LEVEL::Full);
+    INC_COUNTER("IntraMono Duplicate Edges", Worklist.getNumDuplicates(),
+                PAMM_SEVERITY_LEVEL::Full);
     // step 3: Presenting the result (MFP_in and MFP_out)
     // MFP_in[s] = Analysis[s];
     // MFP out[s] = IMProblem.flow(Analysis[s]);
@@ -109,9 +126,86 @@ public:
     }
   }
 
+  /**
+   * @brief Streams the facts that hold at each instruction as JSON to OS.
+   */
+  virtual void emitJsonReport(std::ostream &OS = std::cout) {
+    JsonWriter W(OS);
+    W.beginObject();
+    W.key("DataFlow");
+    W.beginObject();
+    for (auto &[Node, FlowFacts] : this->Analysis) {
+      W.key(CFG->getFunctionName(CFG->getFunctionOf(Node)) +
+            "::" + getTrimmed(this->IMProblem.NtoString(Node)));
+      W.beginObject();
+      W.key("Facts");
+      W.beginArray();
+      for (auto FlowFact : FlowFacts) {
+        W.value(getTrimmed(this->IMProblem.DtoString(FlowFact)));
+      }
+      W.endArray();
+      W.endObject();
+    }
+    W.endObject();
+    W.endObject();
+    OS << '\n';
+  }
+
+  /**
+   * @brief Writes the facts that hold at each instruction to a memory-mappable
+   * ResultStore at the given path, the facts carry no values. Instructions are
+   * keyed by their ID annotations, if they have one.
+   */
+  virtual void emitResultStore(const std::string &Path) {
+    ResultStoreWriter Writer;
+    uint32_t NoValue = Writer.addValue("");
+    for (auto &[Node, FlowFacts] : this->Analysis) {
+      std::string Name = CFG->getFunctionName(CFG->getFunctionOf(Node)) +
+                         "::" + getTrimmed(this->IMProblem.NtoString(Node));
+      std::string Key = Name;
+      if constexpr (std::is_convertible_v<N, const llvm::Value *>) {
+        if (std::string ID = getMetaDataID(Node); ID != "-1") {
+          Key = ID;
+        }
+      }
+      uint32_t NodeId = Writer.addNode(Key, Name);
+      for (auto FlowFact : FlowFacts) {
+        Writer.addCell(
+            NodeId,
+            Writer.addFact(getTrimmed(this->IMProblem.DtoString(FlowFact))),
+            NoValue);
+      }
+    }
+    Writer.write(Path);
+  }
+
+  /**
+   * @brief Writes the facts that hold at each instruction as notes of a SARIF
+   * log to OS.
+   */
+  virtual void emitSarifReport(std::ostream &OS = std::cout) {
+    SarifWriter SW(OS);
+    for (auto &[Node, FlowFacts] : this->Analysis) {
+      SarifWriter::Location Loc;
+      if constexpr (std::is_convertible_v<N, const llvm::Value *>) {
+        Loc = SarifWriter::getLocationOf(Node);
+      }
+      for (auto FlowFact : FlowFacts) {
+        SW.addResult("DataFlow", SarifWriter::Level::Note,
+                     getTrimmed(this->IMProblem.DtoString(FlowFact)), Loc);
+      }
+    }
+  }
+
   virtual void emitTextReport(std::ostream &OS = std::cout) {}
 
   virtual void emitGraphicalReport(std::ostream &OS = std::cout) {}
+
+private:
+  static std::string getTrimmed(std::string S) {
+    boost::algorithm::trim(S);
+    return S;
+  }
 };
 
 template <typename Problem>
@@ -0,0 +1,195 @@
+/******************************************************************************
+ * Copyright (c) 2019 Philipp Schubert.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Philipp Schubert and others
+ *****************************************************************************/
+
+#ifndef PHASAR_PHASARLLVM_MONO_SOLVER_MONOWORKLIST_H_
+#define PHASAR_PHASARLLVM_MONO_SOLVER_MONOWORKLIST_H_
+
+#include <functional>
+#include <map>
+#include <queue>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "llvm/ADT/BitVector.h"
+
+namespace psr {
+
+/**
+ * The worklist of control flow edges that is shared by the monotone solvers.
+ *
+ * An edge is queued at most once at a time, which is tracked by a bitset over
+ * all edges that have been seen so far. Edges are popped in reverse postorder
+ * of their source and target, such that the facts of a node are usually
+ * complete before they are propagated further and loops are iterated from
+ * their header. Functions are ordered by the time they have been added, nodes
+ * of functions that have not been added are ordered by the time they are first
+ * seen.
+ */
+template <typename N> class MonoWorklist {
+public:
+  using Edge = std::pair<N, N>;
+
+  /**
+   * @brief Assigns priorities to the nodes of Fun in reverse postorder of the
+   * given (I)CFG. Nodes that have been prioritized before keep their priority.
+   */
+  template <typename CFGTy, typename F>
+  void addFunction(const CFGTy &CFG, F Fun) {
+    auto ControlFlowEdges = CFG.getAllControlFlowEdges(Fun);
+    std::unordered_map<N, std::vector<N>> Succs;
+    for (const auto &[Src, Dst] : ControlFlowEdges) {
+      Succs[Src].push_back(Dst);
+    }
+    std::vector<N> Roots;
+    for (auto Node : CFG.getAllInstructionsOf(Fun)) {
+      if (CFG.isStartPoint(Node)) {
+        Roots.push_back(Node);
+      }
+    }
+    // nodes that are unreachable from the start points are ordered last
+    for (const auto &CFEdge : ControlFlowEdges) {
+      Roots.push_back(CFEdge.first);
+    }
+    std::vector<N> PostOrder;
+    std::unordered_map<N, bool> Visited;
+    for (auto Root : Roots) {
+      if (Visited[Root]) {
+        continue;
+      }
+      // iterative depth-first search, the flag marks finished nodes
+      std::vector<std::pair<N, bool>> Stack = {{Root, false}};
+      while (!Stack.empty()) {
+        auto [Node, Finished] = Stack.back();
+        Stack.pop_back();
+        if (Finished) {
+          PostOrder.push_back(Node);
+          continue;
+        }
+        if (Visited[Node]) {
+          continue;
+        }
+        Visited[Node] = true;
+        Stack.emplace_back(Node, true);
+        auto &NodeSuccs = Succs[Node];
+        for (auto It = NodeSuccs.rbegin(); It != NodeSuccs.rend(); ++It) {
+          if (!Visited[*It]) {
+            Stack.emplace_back(*It, false);
+          }
+        }
+      }
+    }
+    for (auto It = PostOrder.rbegin(); It != PostOrder.rend(); ++It) {
+      getPriority(*It);
+    }
+  }
+
+  /**
+   * @brief Queues E unless it is queued already, returns true if E has been
+   * queued.
+   */
+  bool push(Edge E) {
+    unsigned Id = getEdgeId(E);
+    if (Queued.test(Id)) {
+      ++NumDuplicates;
+      return false;
+    }
+    Queued.set(Id);
+    unsigned SrcPriority = getPriority(E.first);
+    Queue.emplace(SrcPriority, getPriority(E.second), Id);
+    return true;
+  }
+
+  template <typename Iterator> void push(Iterator First, Iterator Last) {
+    for (; First != Last; ++First) {
+      push(*First);
+    }
+  }
+
+  /**
+   * @brief Removes and returns the queued edge of highest priority.
+   */
+  Edge pop() {
+    unsigned Id = std::get<2>(Queue.top());
+    Queue.pop();
+    Queued.reset(Id);
+    ++NumIterations;
+    if (Processed.test(Id)) {
+      ++NumRevisits;
+    }
+    Processed.set(Id);
+    return Edges[Id];
+  }
+
+  bool empty() const { return Queue.empty(); }
+
+  size_t size() const { return Queue.size(); }
+
+  std::vector<Edge> getQueuedEdges() const {
+    std::vector<Edge> Result;
+    for (unsigned Id : Queued.set_bits()) {
+      Result.push_back(Edges[Id]);
+    }
+    return Result;
+  }
+
+  /**
+   * @brief Returns the number of edges that have been popped.
+   */
+  size_t getNumIterations() const { return NumIterations; }
+
+  /**
+   * @brief Returns the number of edges that have been popped although they
+   * have been popped before.
+   */
+  size_t getNumRevisits() const { return NumRevisits; }
+
+  /**
+   * @brief Returns the number of pushes of edges that were queued already.
+   */
+  size_t getNumDuplicates() const { return NumDuplicates; }
+
+private:
+  std::unordered_map<N, unsigned> Priorities;
+  unsigned NextPriority = 0;
+  std::map<Edge, unsigned> EdgeIds;
+  std::vector<Edge> Edges;
+  llvm::BitVector Queued;
+  llvm::BitVector Processed;
+  std::priority_queue<std::tuple<unsigned, unsigned, unsigned>,
+                      std::vector<std::tuple<unsigned, unsigned, unsigned>>,
+                      std::greater<std::tuple<unsigned, unsigned, unsigned>>>
+      Queue;
+  size_t NumIterations = 0;
+  size_t NumRevisits = 0;
+  size_t NumDuplicates = 0;
+
+  unsigned getPriority(N Node) {
+    auto [It, Inserted] = Priorities.try_emplace(Node, NextPriority);
+    if (Inserted) {
+      ++NextPriority;
+    }
+    return It->second;
+  }
+
+  unsigned getEdgeId(const Edge &E) {
+    auto [It, Inserted] = EdgeIds.try_emplace(E, Edges.size());
+    if (Inserted) {
+      Edges.push_back(E);
+      Queued.push_back(false);
+      Processed.push_back(false);
+    }
+    return It->second;
+  }
+};
+
+} // namespace psr
+
+#endif
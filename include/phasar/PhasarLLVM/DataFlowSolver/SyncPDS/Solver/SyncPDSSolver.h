@@ -10,12 +10,158 @@
 #ifndef PHASAR_PHASARLLVM_SYNCSPDS_SOLVER_SYNCSPDSSOLVER_H_
 #define PHASAR_PHASARLLVM_SYNCSPDS_SOLVER_SYNCSPDSSOLVER_H_
 
+#include <cstddef>
+#include <map>
+#include <set>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace llvm {
+class Instruction;
+class Value;
+} // namespace llvm
+
 namespace psr {
 
+class LLVMBasedICFG;
+
+/**
+ * Answers alias queries on demand in the style of synchronized pushdown
+ * systems (SPDS) as used by Boomerang: a pointer is tracked together with a
+ * field stack, which records the field accesses and dereferences that still
+ * have to be matched, and a call stack, which records the calls that have been
+ * entered. A flow is only valid if it matches both stacks at the same time,
+ * which makes the queries field- and context-sensitive.
+ *
+ * Queries start at the pointer in question and only explore the part of the
+ * program that is relevant for it: a backward search finds the allocation
+ * sites the pointer may point to, a forward search from these allocation sites
+ * finds the pointers that point to the same objects. Both searches trigger
+ * each other whenever a pointer is stored to or loaded from memory, all
+ * intermediate results are cached for subsequent queries.
+ *
+ * The solver does not distinguish program points, i.e. it is
+ * flow-insensitive for memory, and treats arrays as single elements. Both
+ * stacks are bounded: call stacks that grow beyond their bound lose their
+ * oldest call sites, which merely costs precision, whereas flows that would
+ * require a field stack beyond its bound are not followed.
+ */
 class SyncPDSSolver {
-private:
 public:
+  // struct field indices, or Deref for dereferencing a pointer
+  using FieldStack = std::vector<int>;
+  // the call sites that have been entered, the innermost one is last
+  using CallStack = std::vector<const llvm::Instruction *>;
+
+  static constexpr int Deref = -1;
+
+  /**
+   * @brief An abstract object: an allocation site, i.e. an alloca, a global,
+   * a function, the result of a call to an external function or a parameter
+   * of an entry point, and the fields that lead to a subobject.
+   */
+  struct AllocationSite {
+    const llvm::Value *V;
+    FieldStack Fields;
+    CallStack Context;
+
+    friend bool operator<(const AllocationSite &Lhs,
+                          const AllocationSite &Rhs) {
+      return std::tie(Lhs.V, Lhs.Fields, Lhs.Context) <
+             std::tie(Rhs.V, Rhs.Fields, Rhs.Context);
+    }
+  };
+
+  SyncPDSSolver(const LLVMBasedICFG &ICF, unsigned FieldStackBound = 8,
+                unsigned CallStackBound = 4);
+
   ~SyncPDSSolver() = default;
+
+  /**
+   * @brief Returns the allocation sites of the objects V may point to.
+   */
+  std::set<const llvm::Value *> getAllocationSitesOf(const llvm::Value *V);
+
+  /**
+   * @brief Returns the pointers that may point to the same object as V,
+   * including V itself.
+   */
+  std::set<const llvm::Value *> getAliasesOf(const llvm::Value *V);
+
+  /**
+   * @brief Returns true if V and W may point to the same (sub)object.
+   */
+  bool alias(const llvm::Value *V, const llvm::Value *W);
+
+  /**
+   * @brief Returns the number of distinct backward and forward searches that
+   * have been performed.
+   */
+  size_t getNumSearches() const { return Results.size(); }
+
+  /**
+   * @brief Returns the number of flows that have been dropped because they
+   * exceeded the field stack bound.
+   */
+  size_t getNumTruncatedFlows() const { return NumTruncated; }
+
+private:
+  enum class Direction { Backward, Forward };
+
+  // a search starts at a pointer with the fields that lead from it to the
+  // objects to find (backward) or to the object it has been reached from
+  // (forward)
+  using Search = std::tuple<Direction, const llvm::Value *, FieldStack,
+                            CallStack>;
+  using Node = std::tuple<const llvm::Value *, FieldStack, CallStack>;
+
+  // backward searches yield allocation sites, forward searches yield pointers
+  // to the object in question, both within their calling context
+  struct SearchResults {
+    std::set<AllocationSite> Objects;
+    std::set<std::pair<const llvm::Value *, CallStack>> Pointers;
+  };
+
+  const LLVMBasedICFG &ICF;
+  unsigned FieldStackBound;
+  unsigned CallStackBound;
+  std::map<Search, SearchResults> Results;
+  // searches whose results have reached their fixpoint
+  std::set<Search> Solved;
+  // the round in which a search has last been evaluated
+  std::map<Search, unsigned> EvaluatedIn;
+  // the searches of the current query that have not reached their fixpoint
+  std::vector<Search> Pending;
+  unsigned Round = 0;
+  bool Changed = false;
+  bool Solving = false;
+  size_t NumTruncated = 0;
+
+  std::set<AllocationSite> getObjectsOf(const llvm::Value *V);
+
+  /**
+   * Solves S and every search it depends on, which may depend on S in turn,
+   * by evaluating them in rounds until none of their results changes.
+   */
+  const SearchResults &solve(const Search &S);
+
+  /**
+   * Evaluates S once per round and adds what has been found to its results.
+   */
+  const SearchResults &evaluate(const Search &S);
+
+  SearchResults searchBackward(const Node &Start);
+
+  SearchResults searchForward(const Node &Start);
+
+  bool isAllocationSite(const llvm::Value *V, const CallStack &CS) const;
+
+  bool push(std::vector<Node> &WorkList, std::set<Node> &Visited, Node N);
+
+  CallStack enter(CallStack CS, const llvm::Instruction *CallSite) const;
+
+  static FieldStack getFields(const llvm::Value *GEP);
 };
 
 } // namespace psr
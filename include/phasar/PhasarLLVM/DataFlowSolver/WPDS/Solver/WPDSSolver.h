@@ -11,12 +11,17 @@
 #define PHASAR_PHASARLLVM_WPDS_SOLVER_WPDSSOLVER_H_
 
 #include <fstream>
+#include <future>
 #include <iostream>
 #include <map>
 #include <memory>
+#include <optional>
 #include <set>
+#include <sstream>
+#include <stdexcept>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "llvm/Support/Casting.h"
 #include "llvm/Support/raw_ostream.h"
@@ -24,6 +29,7 @@
 #include "wali/Common.hpp"
 #include "wali/KeySource.hpp"
 #include "wali/wfa/State.hpp"
+#include "wali/wfa/TransFunctor.hpp"
 #include "wali/wfa/WFA.hpp"
 #include "wali/witness/WitnessWrapper.hpp"
 #include "wali/wpds/Rule.hpp"
@@ -64,6 +70,74 @@ private:
   wali::wfa::WFA Answer;
   wali::sem_elem_t SRElem;
   Table<N, D, std::map<N, std::set<D>>> incomingtab;
+  // nodes whose results are queried in BACKWARD mode
+  std::set<N> BackwardTargets;
+  // pending asynchronous dump of the PDS
+  std::future<void> PDSDump;
+
+  // The weights of the saturated Answer automaton by <fact, node>: the weight
+  // of the transition to the accepting state, if any, and the combined weight
+  // of all transitions, which is used otherwise.
+  struct AnswerWeights {
+    wali::sem_elem_t Accepting;
+    wali::sem_elem_t Combined;
+  };
+  std::map<std::pair<wali::Key, wali::Key>, AnswerWeights> AnswerIndex;
+  bool AnswerIndexed = false;
+
+  class AnswerIndexer : public wali::wfa::ConstTransFunctor {
+  private:
+    const wali::wfa::WFA &Answer;
+    wali::Key AcceptingState;
+    std::map<std::pair<wali::Key, wali::Key>, AnswerWeights> &Index;
+
+  public:
+    AnswerIndexer(
+        const wali::wfa::WFA &Answer, wali::Key AcceptingState,
+        std::map<std::pair<wali::Key, wali::Key>, AnswerWeights> &Index)
+        : Answer(Answer), AcceptingState(AcceptingState), Index(Index) {}
+
+    void operator()(const wali::wfa::ITrans *T) override {
+      auto &Weights = Index[{T->from(), T->stack()}];
+      if (T->to() == AcceptingState) {
+        Weights.Accepting = T->weight();
+      }
+      wali::sem_elem_t W = Answer.getState(T->to())->weight();
+      W = W->extend(T->weight());
+      Weights.Combined =
+          Weights.Combined.is_valid() ? Weights.Combined->combine(W) : W;
+    }
+  };
+
+  /**
+   * Indexes the saturated Answer automaton once, such that queries are
+   * lookups rather than scans of the automaton.
+   */
+  void indexAnswer() {
+    if (AnswerIndexed) {
+      return;
+    }
+    AnswerIndexer Indexer(Answer, AcceptingState, AnswerIndex);
+    Answer.for_each(Indexer);
+    AnswerIndexed = true;
+  }
+
+  std::optional<L> lookupAnswer(N stmt, D fact) {
+    indexAnswer();
+    auto Search = AnswerIndex.find({wali::getKey(fact), wali::getKey(stmt)});
+    if (Search == AnswerIndex.end()) {
+      return std::nullopt;
+    }
+    wali::sem_elem_t W = Search->second.Accepting;
+    if (!W.is_valid()) {
+      W = Search->second.Combined;
+      if (W->equal(SRElem->zero())) {
+        return std::nullopt;
+      }
+    }
+    return static_cast<JoinLatticeToSemiRingElem<L> &>(*W).F->computeTarget(
+        L{});
+  }
 
   wali::wpds::WPDS *makePDS(WPDSType Ty, bool Witnesses) {
     wali::wpds::Wrapper *Wrapper =
@@ -83,8 +157,8 @@ private:
       return new wali::wpds::fwpds::SWPDS(Wrapper);
       break;
     case WPDSType::SYNCPDS:
-      assert(false);
-      break;
+      throw std::invalid_argument("synchronized pushdown systems are not "
+                                  "weighted, use SyncPDSSolver instead");
     }
   }
 
@@ -98,85 +172,75 @@ public:
     ZeroPDSState = wali::getKey(ZeroValue);
     DKey[ZeroValue] = ZeroPDSState;
   }
-  ~WPDSSolver() override = default;
+
+  ~WPDSSolver() override {
+    if (PDSDump.valid()) {
+      PDSDump.wait();
+    }
+  }
+
+  /**
+   * @brief Sets the nodes whose results are queried in BACKWARD mode, the last
+   * instruction of main by default. Must be called before solve().
+   */
+  void setBackwardQueryTargets(std::set<N> Targets) {
+    BackwardTargets = std::move(Targets);
+  }
 
   void solve() override {
     auto &lg = lg::get();
     // Construct the PDS
     IDESolver<N, D, F, T, V, L, I>::submitInitalSeeds();
-    std::ofstream pdsfile("pds.dot");
-    PDS->print_dot(pdsfile, true);
-    pdsfile.flush();
-    pdsfile.close();
-    // test the SRElem
-    wali::test_semelem_impl(SRElem);
+    if (SolverConf.emitPDS) {
+      // render the PDS before it is solved, but do not block on writing it
+      std::ostringstream PDSDot;
+      PDS->print_dot(PDSDot, true);
+      PDSDump = std::async(std::launch::async,
+                           [Path = SolverConf.pdsFile, Dot = PDSDot.str()]() {
+                             std::ofstream PDSFile(Path);
+                             PDSFile << Dot;
+                           });
+    }
+    if (SolverConf.testSemiRing) {
+      wali::test_semelem_impl(SRElem);
+    }
     // Solve the PDS
-    wali::sem_elem_t ret = nullptr;
+    AnswerIndex.clear();
+    AnswerIndexed = false;
     if (WPDSSearchDirection::FORWARD == SolverConf.searchDirection) {
       LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << "FORWARD");
       doForwardSearch(Answer);
-      Answer.path_summary();
-      // another way not using path summary
-      // wali::Key node = wali::getKey(n);
-      // auto ret = SRElem->zero();
-      // wali::wfa::TransSet tset;
-      // wali::wfa::TransSet::iterator titer;
-      // tset = Answer.match(ZeroPDSState, node);
-      // for (titer = tset.begin(); titer != tset.end(); titer++) {
-      //   wali::wfa::ITrans *t = *titer;
-      //   wali::sem_elem_t tmp(Answer.getState(t->to())->weight());
-      //   tmp = tmp->extend(t->weight());
-      //   ret = ret->combine(tmp);
-      // }
     } else {
-      auto retnode =
-          wali::getKey(&IDESolver<N, D, F, T, V, L, I>::ICF->getFunction("main")
-                            ->back()
-                            .back());
       LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << "BACKWARD");
-      doBackwardSearch(retnode, Answer);
-      Answer.path_summary();
-
-      // access the results
-      // wali::wfa::Trans goal;
-      // // check all data-flow facts
-      // std::cout << "All D(s)" << std::endl;
-      // for (auto Entry : DKey) {
-      //   if (Answer.find(Entry.second, retnode, AcceptingState, goal)) {
-      //     std::cout << "FOUND ANSWER!" << std::endl;
-      //     std::cout << llvmIRToString(Entry.first);
-      //     goal.weight()->print(std::cout << " :--- weight ---: ");
-      //     std::cout << " : --- "
-      //               << static_cast<JoinLatticeToSemiRingElem<L>
-      //               &>(*goal.weight())
-      //                      .F->computeTarget(L{});
-      //     std::cout << std::endl;
-      //   }
-      // }
+      if (BackwardTargets.empty()) {
+        BackwardTargets.insert(
+            &IDESolver<N, D, F, T, V, L, I>::ICF->getFunction("main")
+                 ->back()
+                 .back());
+      }
+      std::set<wali::Key> Nodes;
+      for (N Target : BackwardTargets) {
+        Nodes.insert(wali::getKey(Target));
+      }
+      doBackwardSearch(Nodes, Answer);
+    }
+    // computed once, all queries are answered against the saturated automaton
+    Answer.path_summary();
+  }
 
-      // wali::sem_elem_t ret = SRElem->zero();
-      // wali::wfa::TransSet tset;
-      // wali::wfa::TransSet::iterator titer;
-      // tset = Answer.match(a1key, retnode);
-      // std::cout << "TRANSSET" << std::endl;
-      // for (auto trans : tset) {
-      //   trans->print(std::cout);
-      //   std::cout << std::endl;
-      // }
-      // for (titer = tset.begin(); titer != tset.end(); titer++) {
-      //   wali::wfa::ITrans *t = *titer;
-      //   if (!Answer.isFinalState(t->to())) continue;
-      //   wali::sem_elem_t tmp(Answer.getState(t->to())->weight());
-      //   ret = ret->combine(tmp);
-      // }
-      // std::cout << "FOUND ANSWER!" << std::endl;
-      // // std::cout << llvmIRToString(alloca1);
-      // ret->print(std::cout << " :--- weight ---: ");
-      // std::cout << " : --- "
-      //           << static_cast<JoinLatticeToSemiRingElem<L>
-      //           &>(*ret).F->computeTarget(L{});
-      // std::cout << std::endl;
+  /**
+   * @brief Answers a batch of <node, fact> queries against the saturated
+   * Answer automaton. The automaton is indexed on the first query, such that
+   * each query is a lookup. Facts that do not hold yield std::nullopt.
+   */
+  std::vector<std::optional<L>>
+  resultsAt(const std::vector<std::pair<N, D>> &Queries) {
+    std::vector<std::optional<L>> Results;
+    Results.reserve(Queries.size());
+    for (const auto &[Stmt, Fact] : Queries) {
+      Results.push_back(lookupAnswer(Stmt, Fact));
     }
+    return Results;
   }
 
   void processNormalFlow(PathEdge<N, D> edge) override {
@@ -695,17 +759,27 @@ public:
     }
     Query.set_initial_state(ZeroPDSState);
     Query.add_final_state(AcceptingState);
-    Query.print(std::cout << "BEFORE POSTSTAR\n");
-    std::ofstream before("before_poststar.dot");
-    Query.print_dot(before, true);
+    if (SolverConf.emitAutomata) {
+      Query.print(std::cout << "BEFORE POSTSTAR\n");
+      std::ofstream before("before_poststar.dot");
+      Query.print_dot(before, true);
+    }
     PDS->poststar(Query, Answer);
-    Answer.print(std::cout << "AFTER POSTSTAR\n");
-    std::ofstream after("after_poststar.dot");
-    Answer.print_dot(after, true);
+    if (SolverConf.emitAutomata) {
+      Answer.print(std::cout << "AFTER POSTSTAR\n");
+      std::ofstream after("after_poststar.dot");
+      Answer.print_dot(after, true);
+    }
   }
 
   void doBackwardSearch(wali::Key node, wali::wfa::WFA &Answer) {
+    doBackwardSearch(std::set<wali::Key>{node}, Answer);
+  }
+
+  void doBackwardSearch(const std::set<wali::Key> &nodes,
+                        wali::wfa::WFA &Answer) {
     // Create an automaton to AcceptingState the configurations {n \Gamma^*}
+    // for all queried nodes n
     // Find the set of all return points
     wali::wpds::WpdsStackSymbols syms;
     PDS->for_each(syms);
@@ -714,22 +788,30 @@ public:
                         .front();
     auto a1key = wali::getKey(alloca1);
     // the weight is essential here!
-    Query.addTrans(a1key, node, AcceptingState, SRElem->one());
+    for (auto node : nodes) {
+      Query.addTrans(a1key, node, AcceptingState, SRElem->one());
+    }
     std::set<wali::Key>::iterator it;
     for (it = syms.returnPoints.begin(); it != syms.returnPoints.end(); it++) {
-      wali::getKeySource(*it)->print(std::cout);
-      std::cout << std::endl;
+      if (SolverConf.emitAutomata) {
+        wali::getKeySource(*it)->print(std::cout);
+        std::cout << std::endl;
+      }
       Query.addTrans(AcceptingState, *it, AcceptingState, SRElem->one());
     }
     Query.set_initial_state(a1key);
     Query.add_final_state(AcceptingState);
-    Query.print(std::cout << "BEFORE PRESTAR\n");
-    std::ofstream before("before_prestar.dot");
-    Query.print_dot(before, true);
+    if (SolverConf.emitAutomata) {
+      Query.print(std::cout << "BEFORE PRESTAR\n");
+      std::ofstream before("before_prestar.dot");
+      Query.print_dot(before, true);
+    }
     PDS->prestar(Query, Answer);
-    Answer.print(std::cout << "AFTER PRESTAR\n");
-    std::ofstream after("after_prestar.dot");
-    Answer.print_dot(after, true);
+    if (SolverConf.emitAutomata) {
+      Answer.print(std::cout << "AFTER PRESTAR\n");
+      std::ofstream after("after_prestar.dot");
+      Answer.print_dot(after, true);
+    }
   }
 
   void doBackwardSearch(std::vector<wali::Key> node_stack,
@@ -753,32 +835,9 @@ public:
 
   std::unordered_map<D, L> resultsAt(N stmt, bool stripZero = false) override {
     std::unordered_map<D, L> Results;
-    wali::wfa::Trans goal;
-    for (auto Entry : DKey) {
-      // Method 1: If query 'stmt' is located within the same function as the
-      // starting point
-      if (Answer.find(Entry.second, wali::getKey(stmt), AcceptingState, goal)) {
-        Results.insert(std::make_pair(
-            Entry.first,
-            static_cast<JoinLatticeToSemiRingElem<L> &>(*goal.weight())
-                .F->computeTarget(L{})));
-      } else {
-        // Method 2: If query 'stmt' is located in a different function
-        wali::sem_elem_t ret = SRElem->zero();
-        wali::wfa::TransSet tset;
-        wali::wfa::TransSet::iterator titer;
-        tset = Answer.match(Entry.second, wali::getKey(stmt));
-        for (titer = tset.begin(); titer != tset.end(); titer++) {
-          wali::wfa::ITrans *t = *titer;
-          wali::sem_elem_t tmp(Answer.getState(t->to())->weight());
-          tmp = tmp->extend(t->weight());
-          ret = ret->combine(tmp);
-        }
-        if (!ret->equal(SRElem->zero())) {
-          Results.insert(std::make_pair(
-              Entry.first, static_cast<JoinLatticeToSemiRingElem<L> &>(*ret)
-                               .F->computeTarget(L{})));
-        }
+    for (const auto &Entry : DKey) {
+      if (auto Result = lookupAnswer(stmt, Entry.first)) {
+        Results.insert(std::make_pair(Entry.first, *Result));
       }
     }
     if (stripZero) {
@@ -788,25 +847,8 @@ public:
   }
 
   L resultAt(N stmt, D fact) override {
-    wali::wfa::Trans goal;
-    if (Answer.find(wali::getKey(fact), wali::getKey(stmt), AcceptingState,
-                    goal)) {
-      return static_cast<JoinLatticeToSemiRingElem<L> &>(*goal.weight())
-          .F->computeTarget(L{});
-    }
-    wali::sem_elem_t ret = SRElem->zero();
-    wali::wfa::TransSet tset;
-    wali::wfa::TransSet::iterator titer;
-    tset = Answer.match(wali::getKey(fact), wali::getKey(stmt));
-    for (titer = tset.begin(); titer != tset.end(); titer++) {
-      wali::wfa::ITrans *t = *titer;
-      wali::sem_elem_t tmp(Answer.getState(t->to())->weight());
-      tmp = tmp->extend(t->weight());
-      ret = ret->combine(tmp);
-    }
-    if (!ret->equal(SRElem->zero())) {
-      return static_cast<JoinLatticeToSemiRingElem<L> &>(*ret).F->computeTarget(
-          L{});
+    if (auto Result = lookupAnswer(stmt, fact)) {
+      return *Result;
     }
     throw std::runtime_error("Requested invalid fact!");
   }
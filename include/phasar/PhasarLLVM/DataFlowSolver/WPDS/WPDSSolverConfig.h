@@ -11,6 +11,7 @@
 #define PHASAR_PHASARLLVM_DATAFLOWSOLVER_WPDS_SOLVERCONFIGURATION_H_
 
 #include <iosfwd>
+#include <string>
 
 #include "phasar/PhasarLLVM/DataFlowSolver/WPDS/WPDSOptions.h"
 
@@ -28,6 +29,15 @@ struct WPDSSolverConfig {
   bool recordWitnesses = false;
   WPDSSearchDirection searchDirection = WPDSSearchDirection::FORWARD;
   WPDSType wpdsty = WPDSType::FWPDS;
+  // Diagnostics, all of them are expensive on real programs
+  /// Dumps the pushdown system to pdsFile before solving; the file is written
+  /// asynchronously.
+  bool emitPDS = false;
+  std::string pdsFile = "pds.dot";
+  /// Prints the query and answer automata and dumps them as dot files.
+  bool emitAutomata = false;
+  /// Runs WALi's sanity checks on the semiring elements before solving.
+  bool testSemiRing = false;
   friend std::ostream &operator<<(std::ostream &os, const WPDSSolverConfig &sc);
 };
 
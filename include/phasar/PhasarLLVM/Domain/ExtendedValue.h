@@ -6,7 +6,9 @@
 #define EXTENDEDVALUE_H
 
 #include <cassert>
+#include <cstddef>
 #include <functional>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -17,127 +19,146 @@ class Value;
 
 namespace psr {
 
+/**
+ * A data-flow fact of the field-sensitive taint analysis. ExtendedValue is a
+ * pointer-sized handle to an interned, immutable record: every distinct fact
+ * is stored only once and comparing or hashing facts does not look at their
+ * contents. The memory location sequences are shared through a trie, such
+ * that facts with a common prefix share its storage. Setters re-intern the
+ * modified fact and re-point the handle into the same intern table.
+ *
+ * Facts are interned in an InternTable, which is owned by the analysis that
+ * uses them; they stay valid as long as their table lives. A default
+ * constructed fact does not belong to any table and must not be modified.
+ */
 class ExtendedValue {
 public:
-  ExtendedValue() {}
-  explicit ExtendedValue(const llvm::Value *_value) : value(_value) {
-    assert(value && "ExtendedValue requires an llvm::Value* object");
-  }
-  ~ExtendedValue() = default;
-
-  bool operator==(const ExtendedValue &rhs) const {
-    bool isValueEqual = value == rhs.value;
-    if (!isValueEqual)
-      return false;
+  class InternTable;
 
-    bool isMemLocationSeqEqual = memLocationSeq == rhs.memLocationSeq;
-    if (!isMemLocationSeqEqual)
-      return false;
-
-    bool isEndOfTaintedBlockLabelEqual =
-        endOfTaintedBlockLabel == rhs.endOfTaintedBlockLabel;
-    if (!isEndOfTaintedBlockLabelEqual)
-      return false;
-
-    bool isVaListMemLocationSeqEqual =
-        vaListMemLocationSeq == rhs.vaListMemLocationSeq;
-    if (!isVaListMemLocationSeqEqual)
-      return false;
-
-    bool isVarArgIndexEqual = varArgIndex == rhs.varArgIndex;
-    if (!isVarArgIndexEqual)
-      return false;
+  ExtendedValue();
+  ExtendedValue(InternTable &table, const llvm::Value *_value);
+  ~ExtendedValue() = default;
 
-    bool isCurrentVarArgIndexEqual =
-        currentVarArgIndex == rhs.currentVarArgIndex;
-    if (!isCurrentVarArgIndexEqual)
-      return false;
+  bool operator==(const ExtendedValue &rhs) const { return data == rhs.data; }
 
-    return true;
-  }
+  bool operator!=(const ExtendedValue &rhs) const { return data != rhs.data; }
 
+  /**
+   * @brief Orders facts of the same intern table by the time they were
+   * interned first.
+   */
   bool operator<(const ExtendedValue &rhs) const {
-    if (std::less<const llvm::Value *>{}(value, rhs.value))
-      return true;
-    if (std::less<const llvm::Value *>{}(rhs.value, value))
-      return false;
-
-    if (memLocationSeq < rhs.memLocationSeq)
-      return true;
-    if (rhs.memLocationSeq < memLocationSeq)
-      return false;
-
-    if (std::less<std::string>{}(endOfTaintedBlockLabel,
-                                 rhs.endOfTaintedBlockLabel))
-      return true;
-    if (std::less<std::string>{}(rhs.endOfTaintedBlockLabel,
-                                 endOfTaintedBlockLabel))
-      return false;
-
-    if (vaListMemLocationSeq < rhs.vaListMemLocationSeq)
-      return true;
-    if (rhs.vaListMemLocationSeq < vaListMemLocationSeq)
-      return false;
-
-    if (std::less<long>{}(varArgIndex, rhs.varArgIndex))
-      return true;
-    if (std::less<long>{}(rhs.varArgIndex, varArgIndex))
-      return false;
-
-    return std::less<long>{}(currentVarArgIndex, rhs.currentVarArgIndex);
+    return data->id < rhs.data->id;
   }
 
-  const llvm::Value *getValue() const { return value; }
+  const llvm::Value *getValue() const { return data->value; }
 
-  const std::vector<const llvm::Value *> getMemLocationSeq() const {
-    return memLocationSeq;
-  }
-  void setMemLocationSeq(std::vector<const llvm::Value *> _memLocationSeq) {
-    memLocationSeq = _memLocationSeq;
-  }
+  const std::vector<const llvm::Value *> getMemLocationSeq() const;
+  void setMemLocationSeq(std::vector<const llvm::Value *> _memLocationSeq);
 
   const std::string getEndOfTaintedBlockLabel() const {
-    return endOfTaintedBlockLabel;
-  }
-  void setEndOfTaintedBlockLabel(std::string _endOfTaintedBlockLabel) {
-    endOfTaintedBlockLabel = _endOfTaintedBlockLabel;
+    return data->endOfTaintedBlockLabel ? *data->endOfTaintedBlockLabel
+                                        : std::string();
   }
+  void setEndOfTaintedBlockLabel(std::string _endOfTaintedBlockLabel);
 
-  const std::vector<const llvm::Value *> getVaListMemLocationSeq() const {
-    return vaListMemLocationSeq;
-  }
+  const std::vector<const llvm::Value *> getVaListMemLocationSeq() const;
   void setVaListMemLocationSeq(
-      std::vector<const llvm::Value *> _vaListMemLocationSeq) {
-    vaListMemLocationSeq = _vaListMemLocationSeq;
-  }
+      std::vector<const llvm::Value *> _vaListMemLocationSeq);
 
-  long getVarArgIndex() const { return varArgIndex; }
-  void setVarArgIndex(long _varArgIndex) { varArgIndex = _varArgIndex; }
+  long getVarArgIndex() const { return data->varArgIndex; }
+  void setVarArgIndex(long _varArgIndex);
 
   void resetVarArgIndex() {
     if (!isVarArgTemplate())
-      varArgIndex = -1L;
+      setVarArgIndex(-1L);
   }
 
-  long getCurrentVarArgIndex() const { return currentVarArgIndex; }
-  void incrementCurrentVarArgIndex() {
-    if (!isVarArgTemplate())
-      ++currentVarArgIndex;
-  }
+  long getCurrentVarArgIndex() const { return data->currentVarArgIndex; }
+  void incrementCurrentVarArgIndex();
 
-  bool isVarArg() const { return varArgIndex > -1L; }
+  bool isVarArg() const { return data->varArgIndex > -1L; }
   bool isVarArgTemplate() const {
-    return vaListMemLocationSeq.empty() && isVarArg();
+    return !data->vaListMemLocationSeq && isVarArg();
+  }
+
+  /**
+   * @brief Returns the id of this fact, which is unique within its intern
+   * table.
+   */
+  std::size_t getId() const { return data->id; }
+
+  /**
+   * @brief Returns the intern table this fact belongs to.
+   */
+  InternTable &getInternTable() const {
+    assert(data->table && "ExtendedValue does not belong to an intern table");
+    return *data->table;
   }
 
+  /**
+   * @brief A node of the trie of memory location sequences, representing the
+   * sequence from the root up to and including location.
+   */
+  struct MemLocationNode;
+
 private:
-  const llvm::Value *value = nullptr;
-  std::vector<const llvm::Value *> memLocationSeq;
-  std::string endOfTaintedBlockLabel;
+  struct Data {
+    const llvm::Value *value = nullptr;
+    // nullptr represents an empty sequence
+    const MemLocationNode *memLocationSeq = nullptr;
+    // nullptr represents an empty label
+    const std::string *endOfTaintedBlockLabel = nullptr;
+    const MemLocationNode *vaListMemLocationSeq = nullptr;
+    long varArgIndex = -1L;
+    long currentVarArgIndex = -1L;
+    std::size_t id = 0;
+    // neither hashed nor compared, records are only compared within a table
+    InternTable *table = nullptr;
+
+    bool operator==(const Data &rhs) const {
+      return value == rhs.value && memLocationSeq == rhs.memLocationSeq &&
+             endOfTaintedBlockLabel == rhs.endOfTaintedBlockLabel &&
+             vaListMemLocationSeq == rhs.vaListMemLocationSeq &&
+             varArgIndex == rhs.varArgIndex &&
+             currentVarArgIndex == rhs.currentVarArgIndex;
+    }
+  };
+
+  const Data *data;
+
+  // the record of default constructed facts
+  static const Data emptyRecord;
+};
 
-  std::vector<const llvm::Value *> vaListMemLocationSeq;
-  long varArgIndex = -1L;
-  long currentVarArgIndex = -1L;
+/**
+ * Owns the facts, memory location sequences and labels interned by an
+ * analysis. Since ids are handed out per table, neither the memory nor the
+ * order of the facts of an analysis depends on other analyses. Interning is
+ * thread-safe.
+ */
+class ExtendedValue::InternTable {
+public:
+  InternTable();
+  ~InternTable();
+  InternTable(const InternTable &) = delete;
+  InternTable &operator=(const InternTable &) = delete;
+
+  /**
+   * @brief Returns the fact of this table that has the same contents as fact,
+   * which may belong to another table.
+   */
+  ExtendedValue import(const ExtendedValue &fact);
+
+  /**
+   * @brief Returns the number of distinct facts interned so far.
+   */
+  std::size_t getNumFacts() const;
+
+private:
+  friend class ExtendedValue;
+  struct Impl;
+  std::unique_ptr<Impl> impl;
 };
 
 } // namespace psr
@@ -146,31 +167,7 @@ namespace std {
 
 template <> struct hash<psr::ExtendedValue> {
   std::size_t operator()(const psr::ExtendedValue &ev) const {
-    std::size_t seed = 0x4711;
-
-    seed ^= hash<const llvm::Value *>{}(ev.getValue()) + 0x9e3779b9 +
-            (seed << 6) + (seed >> 2);
-
-    for (const auto &memLocationPart : ev.getMemLocationSeq()) {
-      seed ^= hash<const llvm::Value *>{}(memLocationPart) + 0x9e3779b9 +
-              (seed << 6) + (seed >> 2);
-    }
-
-    seed ^= hash<string>{}(ev.getEndOfTaintedBlockLabel()) + 0x9e3779b9 +
-            (seed << 6) + (seed >> 2);
-
-    for (const auto &vaListMemLocationPart : ev.getVaListMemLocationSeq()) {
-      seed ^= hash<const llvm::Value *>{}(vaListMemLocationPart) + 0x9e3779b9 +
-              (seed << 6) + (seed >> 2);
-    }
-
-    seed ^= hash<long>{}(ev.getVarArgIndex()) + 0x9e3779b9 + (seed << 6) +
-            (seed >> 2);
-
-    seed ^= hash<long>{}(ev.getCurrentVarArgIndex()) + 0x9e3779b9 +
-            (seed << 6) + (seed >> 2);
-
-    return seed;
+    return hash<std::size_t>{}(ev.getId());
   }
 };
 
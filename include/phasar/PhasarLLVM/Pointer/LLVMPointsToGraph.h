@@ -41,6 +41,8 @@ class Type;
 
 namespace psr {
 
+class JsonWriter;
+
 /**
  * @brief Returns true if the given pointer is an interesting pointer,
  *        i.e. not a constant null pointer.
@@ -78,8 +80,8 @@ public:
     VertexProperties(const llvm::Value *v);
     std::string getValueAsString() const;
 
-    // Fetching the users for V is expensive, so we cache the result.
-    mutable std::vector<const llvm::User *> users;
+    // The users are not cached, as the graph may be queried by analyses
+    // running concurrently. The result is a copy of V's use list either way.
     std::vector<const llvm::User *> getUsers() const;
   };
 
@@ -277,6 +279,12 @@ public:
    * @param outputstream.
    */
   void printAsJson(std::ostream &OS = std::cout) const;
+
+  /**
+   * @brief Writes the points-to graph as a JSON object that maps each vertex
+   * to its successors.
+   */
+  void printAsJson(JsonWriter &W) const;
 };
 
 } // namespace psr
@@ -20,7 +20,6 @@
 #include <cassert>
 #include <fstream>
 #include <initializer_list>
-#include <iomanip>
 #include <iostream>
 #include <map>
 #include <set>
@@ -35,6 +34,7 @@
 #include "nlohmann/json.hpp"
 
 #include "phasar/Config/Configuration.h"
+#include "phasar/Utils/Logger.h"
 
 namespace llvm {
 class Instruction;
@@ -98,7 +98,9 @@ private:
   std::map<const llvm::Instruction *, std::set<D>> seedMap;
 
   void importSourceSinkFunctions(const std::string &FilePath) {
-    std::cout << "Parsing JSON with source and sink functions\n";
+    auto &lg = lg::get();
+    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, INFO)
+                  << "Parsing JSON with source and sink functions");
     if (boost::filesystem::exists(FilePath) &&
         !boost::filesystem::is_directory(FilePath)) {
       std::ifstream ifs(FilePath);
@@ -108,7 +110,6 @@ private:
         ifs.close();
         nlohmann::json SSFunctions;
         iss >> SSFunctions;
-        std::cout << std::setw(2) << SSFunctions << '\n';
         if (SSFunctions.find(SourceJSONId) != SSFunctions.end()) {
           // Discarding default source functions
           Sources.clear();
@@ -128,8 +129,9 @@ private:
             }
           }
         } else {
-          std::cout
-              << "No Source Functions found. Using default sink functions!\n";
+          LOG_IF_ENABLE(
+              BOOST_LOG_SEV(lg, INFO)
+              << "No source functions found. Using default source functions!");
         }
         if (SSFunctions.find(SinkJSONId) != SSFunctions.end()) {
           // Discarding default sink functions
@@ -147,8 +149,9 @@ private:
             }
           }
         } else {
-          std::cout
-              << "No sink functions found. Using default sink functions!\n";
+          LOG_IF_ENABLE(
+              BOOST_LOG_SEV(lg, INFO)
+              << "No sink functions found. Using default sink functions!");
         }
       } else {
         throw std::ios_base::failure("Could not open file");
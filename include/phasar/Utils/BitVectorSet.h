@@ -11,226 +11,379 @@
 #define PHASAR_UTILS_BITVECTORSET_H_
 
 #include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <deque>
 #include <initializer_list>
+#include <iterator>
+#include <mutex>
+#include <optional>
+#include <ostream>
+#include <shared_mutex>
+#include <unordered_map>
+#include <vector>
 
-#include "boost/bimap.hpp"
-#include "boost/bimap/unordered_set_of.hpp"
-
-#include "llvm/ADT/BitVector.h"
+#include "llvm/ADT/SmallVector.h"
+#include "llvm/Support/MathExtras.h"
 
 namespace psr {
 
 /**
- * BitVectorSet implements a set that requires minimal space. Elements are
- * kept in a static map and the set itself only stores a vector of bits which
- * indicate whether elements are contained in the set.
+ * Assigns consecutive indices to the elements of a BitVectorSet. Sets can
+ * only be combined if they share their index, e.g. an analysis may use an
+ * index of its own that only contains its data-flow facts, which keeps its
+ * sets small. Sets that are not given an index use a process-wide default
+ * index per element type.
  *
- * @brief Implements a set that requires minimal space.
+ * An index only grows and may be shared by sets that are used concurrently.
+ *
+ * @brief Maps elements to bit positions.
  */
-template <typename T> class BitVectorSet {
+template <typename T> class BitVectorIndex {
 private:
-  // Using boost::hash<T> causes ambiguity for hash_value():
-  //  -<llvm/ADT/Hashing.h>
-  //  -<boost/functional/hash/extensions.hpp>
-  //  -<boost/graph/adjacency_list.hpp>
-  typedef boost::bimap<boost::bimaps::unordered_set_of<T, std::hash<T>>,
-                       boost::bimaps::unordered_set_of<size_t>>
-      bimap_t;
-  inline static bimap_t Position;
-  llvm::BitVector Bits;
-
-  template <typename D> class BitVectorSetIterator {
-    llvm::BitVector Bits;
+  mutable std::shared_mutex Mtx;
+  std::unordered_map<T, unsigned, std::hash<T>> Indices;
+  // a deque does not move its elements when it grows
+  std::deque<T> Elements;
 
-  public:
-    using iterator_category = std::forward_iterator_tag;
-    using value_type = D;
-    using difference_type = std::ptrdiff_t;
-    using pointer = D *;
-    using reference = D &;
-    BitVectorSetIterator(D ptr = nullptr) : pos_ptr(ptr) {}
-    BitVectorSetIterator(const BitVectorSetIterator<D> &rawIterator) = default;
-    ~BitVectorSetIterator() {}
+public:
+  BitVectorIndex() = default;
+  BitVectorIndex(const BitVectorIndex &) = delete;
+  BitVectorIndex &operator=(const BitVectorIndex &) = delete;
 
-    BitVectorSetIterator<D> &
-    operator=(const BitVectorSetIterator<D> &rawIterator) = default;
+  static BitVectorIndex &getDefault() {
+    static BitVectorIndex Default;
+    return Default;
+  }
 
-    BitVectorSetIterator<D> &operator=(D *ptr) {
-      pos_ptr = ptr;
-      return (*this);
+  /**
+   * @brief Returns the index of Data, which is added if necessary.
+   */
+  unsigned getIndex(const T &Data) {
+    if (auto Idx = findIndex(Data)) {
+      return *Idx;
+    }
+    std::unique_lock<std::shared_mutex> Lock(Mtx);
+    auto [It, Inserted] = Indices.try_emplace(Data, Elements.size());
+    if (Inserted) {
+      Elements.push_back(Data);
     }
+    return It->second;
+  }
 
-    operator bool() const {
-      if (pos_ptr)
-        return true;
-      return false;
+  std::optional<unsigned> findIndex(const T &Data) const {
+    std::shared_lock<std::shared_mutex> Lock(Mtx);
+    auto Search = Indices.find(Data);
+    if (Search == Indices.end()) {
+      return std::nullopt;
     }
+    return Search->second;
+  }
 
-    void setBits(llvm::BitVector B) { Bits = B; }
+  const T &getElement(unsigned Idx) const {
+    std::shared_lock<std::shared_mutex> Lock(Mtx);
+    return Elements[Idx];
+  }
 
-    bool operator==(const BitVectorSetIterator<D> &rawIterator) const {
-      return (pos_ptr == rawIterator.getPtr());
-    }
+  size_t size() const {
+    std::shared_lock<std::shared_mutex> Lock(Mtx);
+    return Elements.size();
+  }
+};
 
-    bool operator!=(const BitVectorSetIterator<D> &rawIterator) const {
-      return (pos_ptr != rawIterator.getPtr());
+/**
+ * BitVectorSet implements a set that requires minimal space. Elements are
+ * kept in a BitVectorIndex and the set itself only stores the indices of its
+ * elements: small sets as a sorted vector of indices, larger ones as a vector
+ * of bits which indicate whether elements are contained in the set. Set
+ * operations on the latter work on whole words.
+ *
+ * A set that is created without an index adopts the index of the first set
+ * it is combined with, or the default index once an element is inserted.
+ *
+ * @brief Implements a set that requires minimal space.
+ */
+template <typename T> class BitVectorSet {
+private:
+  using Word = uint64_t;
+  static constexpr unsigned WordBits = 64;
+  // sparse sets that grow beyond this size are turned into bit vectors
+  static constexpr size_t SparseLimit = 16;
+
+  BitVectorIndex<T> *Index = nullptr;
+  bool Dense = false;
+  llvm::SmallVector<unsigned, 4> Sparse;
+  std::vector<Word> Words;
+
+  BitVectorIndex<T> &getIndex() {
+    if (!Index) {
+      Index = &BitVectorIndex<T>::getDefault();
     }
+    return *Index;
+  }
 
-    BitVectorSetIterator<D> &operator+=(const difference_type &movement) {
-      for (difference_type i = 0; i < movement; i++)
-        pos_ptr++;
-      return (*this);
+  void adoptIndex(const BitVectorSet &Other) {
+    if (Other.Index && Index != Other.Index) {
+      assert((!Index || empty() || Other.empty()) &&
+             "BitVectorSets with different indices cannot be combined");
+      if (!Index || empty()) {
+        Index = Other.Index;
+      }
     }
+  }
 
-    BitVectorSetIterator<D> &operator++() {
-      do {
-        if (((pos_ptr->first) >= Bits.size() - 1)) {
-          ++pos_ptr;
-          break;
-        }
-        ++pos_ptr;
-      } while (!(Bits[pos_ptr->first]));
+  bool test(unsigned Idx) const {
+    if (Dense) {
+      return Idx / WordBits < Words.size() &&
+             (Words[Idx / WordBits] >> (Idx % WordBits)) & 1;
+    }
+    return std::binary_search(Sparse.begin(), Sparse.end(), Idx);
+  }
 
-      return (*this);
+  void set(unsigned Idx) {
+    if (Dense) {
+      if (Idx / WordBits >= Words.size()) {
+        Words.resize(Idx / WordBits + 1);
+      }
+      Words[Idx / WordBits] |= Word(1) << (Idx % WordBits);
+      return;
     }
+    auto It = std::lower_bound(Sparse.begin(), Sparse.end(), Idx);
+    if (It == Sparse.end() || *It != Idx) {
+      Sparse.insert(It, Idx);
+      if (Sparse.size() > SparseLimit) {
+        makeDense();
+      }
+    }
+  }
 
-    BitVectorSetIterator<D> operator++(int) {
-      auto temp(*this);
-      ++*this;
-      return temp;
+  void reset(unsigned Idx) {
+    if (Dense) {
+      if (Idx / WordBits < Words.size()) {
+        Words[Idx / WordBits] &= ~(Word(1) << (Idx % WordBits));
+      }
+      return;
     }
+    auto It = std::lower_bound(Sparse.begin(), Sparse.end(), Idx);
+    if (It != Sparse.end() && *It == Idx) {
+      Sparse.erase(It);
+    }
+  }
 
-    BitVectorSetIterator<D> operator+(const difference_type &movement) {
-      auto oldPtr = pos_ptr;
-      for (difference_type i = 0; i < movement; i++)
-        pos_ptr++;
-      auto temp(*this);
-      pos_ptr = oldPtr;
-      return temp;
+  void makeDense() {
+    if (Dense) {
+      return;
     }
+    Dense = true;
+    if (!Sparse.empty()) {
+      Words.assign(Sparse.back() / WordBits + 1, 0);
+    }
+    for (unsigned Idx : Sparse) {
+      Words[Idx / WordBits] |= Word(1) << (Idx % WordBits);
+    }
+    Sparse.clear();
+  }
 
-    difference_type operator-(const BitVectorSetIterator<D> &rawIterator) {
-      return std::distance(rawIterator.getPtr(), this->getPtr());
+  // returns the first position at or after Pos that holds an element, the
+  // positions of a sparse set are indices into Sparse, those of a dense set
+  // are bit positions
+  size_t findFrom(size_t Pos) const {
+    if (!Dense) {
+      return std::min(Pos, Sparse.size());
     }
+    size_t WordIdx = Pos / WordBits;
+    if (WordIdx >= Words.size()) {
+      return endPos();
+    }
+    Word W = Words[WordIdx] & (~Word(0) << (Pos % WordBits));
+    while (W == 0) {
+      if (++WordIdx == Words.size()) {
+        return endPos();
+      }
+      W = Words[WordIdx];
+    }
+    return WordIdx * WordBits + llvm::countTrailingZeros(W);
+  }
 
-    // T& operator*(){return pos_ptr->second;}
+  size_t endPos() const {
+    return Dense ? Words.size() * WordBits : Sparse.size();
+  }
 
-    const T &operator*() const { return pos_ptr->second; }
+  unsigned indexAt(size_t Pos) const {
+    return Dense ? static_cast<unsigned>(Pos) : Sparse[Pos];
+  }
 
-    D *operator->() { return pos_ptr; }
+public:
+  /**
+   * Iterates over the elements of a set in the order of their indices without
+   * copying the set, i.e. the set must not be modified during the iteration.
+   */
+  class const_iterator {
+    const BitVectorSet *Set = nullptr;
+    size_t Pos = 0;
 
-    D getPtr() const { return pos_ptr; }
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const T *;
+    using reference = const T &;
 
-    // const D* getConstPtr()const{return pos_ptr;}
+    const_iterator() = default;
+    const_iterator(const BitVectorSet *Set, size_t Pos)
+        : Set(Set), Pos(Set->findFrom(Pos)) {}
 
-    // T getPos() {return pos_ptr->first;}
+    reference operator*() const {
+      return Set->Index->getElement(Set->indexAt(Pos));
+    }
 
-    // T getVal() {return pos_ptr->second;}
+    pointer operator->() const { return &**this; }
 
-    llvm::BitVector getBits() { return Bits; }
+    const_iterator &operator++() {
+      Pos = Set->findFrom(Pos + 1);
+      return *this;
+    }
 
-  protected:
-    D pos_ptr;
+    const_iterator operator++(int) {
+      auto Tmp(*this);
+      ++*this;
+      return Tmp;
+    }
+
+    const_iterator &operator+=(difference_type Movement) {
+      for (difference_type Idx = 0; Idx < Movement; ++Idx) {
+        ++*this;
+      }
+      return *this;
+    }
+
+    const_iterator operator+(difference_type Movement) const {
+      auto Tmp(*this);
+      return Tmp += Movement;
+    }
+
+    bool operator==(const const_iterator &Other) const {
+      return Set == Other.Set && Pos == Other.Pos;
+    }
+
+    bool operator!=(const const_iterator &Other) const {
+      return !(*this == Other);
+    }
   };
 
-  typedef typename bimap_t::right_iterator r_iterator;
-  typedef typename bimap_t::right_const_iterator rc_iterator;
-  typedef BitVectorSetIterator<r_iterator> iterator;
-  typedef BitVectorSetIterator<rc_iterator> const_iterator;
+  using iterator = const_iterator;
 
-public:
   BitVectorSet() = default;
 
-  explicit BitVectorSet(size_t Count) : Bits(Count, false) {}
+  explicit BitVectorSet(BitVectorIndex<T> &Index) : Index(&Index) {}
+
+  /**
+   * @brief Creates an empty set with room for elements with indices up to
+   * Count.
+   */
+  explicit BitVectorSet(size_t Count) { reserve(Count); }
 
   BitVectorSet(std::initializer_list<T> Ilist) {
-    for (auto &Item : Ilist) {
-      insert(Item);
-    }
+    insert(Ilist.begin(), Ilist.end());
+  }
+
+  BitVectorSet(BitVectorIndex<T> &Index, std::initializer_list<T> Ilist)
+      : Index(&Index) {
+    insert(Ilist.begin(), Ilist.end());
   }
 
   template <typename InputIt> BitVectorSet(InputIt First, InputIt Last) {
-    while (First != Last) {
-      insert(*First);
-      ++First;
-    }
+    insert(First, Last);
   }
 
   ~BitVectorSet() = default;
 
   BitVectorSet<T> setUnion(const BitVectorSet<T> &Other) const {
-    size_t size = std::max(Bits.size(), Other.Bits.size());
-    BitVectorSet<T> Res(size);
-    // temp variable necessary because return type of |= is not const
-    llvm::BitVector temp = Bits;
-    Res.Bits = temp |= Other.Bits;
+    BitVectorSet<T> Res(*this);
+    Res.insert(Other);
     return Res;
   }
 
   BitVectorSet<T> setIntersect(const BitVectorSet<T> &Other) const {
-    size_t size = std::max(Bits.size(), Other.Bits.size());
-    BitVectorSet<T> Res(size);
-    // temp variable necessary because return type of &= is not const
-    llvm::BitVector temp = Bits;
-    Res.Bits = temp &= Other.Bits;
+    BitVectorSet<T> Res;
+    Res.Index = Index;
+    Res.adoptIndex(Other);
+    if (Dense && Other.Dense) {
+      Res.Dense = true;
+      Res.Words.resize(std::min(Words.size(), Other.Words.size()));
+      for (size_t Idx = 0; Idx < Res.Words.size(); ++Idx) {
+        Res.Words[Idx] = Words[Idx] & Other.Words[Idx];
+      }
+      return Res;
+    }
+    // the result is not larger than the smaller, sparse operand
+    const BitVectorSet &Small = Dense ? Other : *this;
+    const BitVectorSet &Large = Dense ? *this : Other;
+    for (unsigned Idx : Small.Sparse) {
+      if (Large.test(Idx)) {
+        Res.Sparse.push_back(Idx);
+      }
+    }
     return Res;
   }
 
+  /**
+   * @brief Returns true if all elements of Other are contained in this set.
+   */
   bool includes(const BitVectorSet<T> &Other) const {
-    // check if Other contains 1's at positions where this does not
-    // Other is longer
-    if (Bits.size() < Other.Bits.size()) {
-      size_t idx = 0;
-      for (; idx < Bits.size(); ++idx) {
-        if (Other.Bits[idx] && !Bits[idx]) {
+    if (Other.Dense && Dense) {
+      size_t Common = std::min(Words.size(), Other.Words.size());
+      for (size_t Idx = 0; Idx < Common; ++Idx) {
+        if (Other.Words[Idx] & ~Words[Idx]) {
           return false;
         }
       }
-      // Check if Other's additional bits are non-zero
-      for (; idx < Other.Bits.size(); ++idx) {
-        if (Other.Bits[idx]) {
-          return false;
-        }
+      return std::all_of(Other.Words.begin() + Common, Other.Words.end(),
+                         [](Word W) { return W == 0; });
+    }
+    if (Other.Dense) {
+      // a sparse set cannot include more than SparseLimit elements
+      if (Other.size() > Sparse.size()) {
+        return false;
       }
-      // additional zeros are fine
-      return true;
-    } else {
-      // this is longer or they have the same length
-      // check if Other contains 1's at positions where this does not
-      for (size_t idx = 0; idx < Other.Bits.size(); ++idx) {
-        if (Other.Bits[idx] && !Bits[idx]) {
+      for (size_t Pos = Other.findFrom(0); Pos != Other.endPos();
+           Pos = Other.findFrom(Pos + 1)) {
+        if (!test(Pos)) {
           return false;
         }
       }
       return true;
     }
+    return std::all_of(Other.Sparse.begin(), Other.Sparse.end(),
+                       [this](unsigned Idx) { return test(Idx); });
   }
 
-  void insert(const T &Data) {
-    auto Search = Position.left.find(Data);
-    // Data already known
-    if (Search != Position.left.end()) {
-      if (Bits.size() <= Search->second) {
-        Bits.resize(Search->second + 1);
-      }
-      Bits[Search->second] = true;
-    } else {
-      // Data unknown
-      size_t Idx = Position.left.size();
-      Position.left.insert(std::make_pair(Data, Position.left.size()));
-      if (Bits.size() <= Position.left.size()) {
-        Bits.resize(Position.left.size());
-      }
-      Bits[Idx] = true;
-    }
-  }
+  void insert(const T &Data) { set(getIndex().getIndex(Data)); }
 
   void insert(const BitVectorSet<T> &Other) {
-    if (Other.Bits.size() > Bits.size()) {
-      Bits.resize(Other.Bits.size());
+    adoptIndex(Other);
+    if (!Dense && !Other.Dense) {
+      llvm::SmallVector<unsigned, 4> Merged;
+      std::set_union(Sparse.begin(), Sparse.end(), Other.Sparse.begin(),
+                     Other.Sparse.end(), std::back_inserter(Merged));
+      Sparse = std::move(Merged);
+      if (Sparse.size() > SparseLimit) {
+        makeDense();
+      }
+      return;
     }
-    for (size_t idx = 0; idx < Other.Bits.size(); ++idx) {
-      Bits[idx] = (Bits[idx] || Other.Bits[idx]);
+    makeDense();
+    if (Other.Dense) {
+      if (Other.Words.size() > Words.size()) {
+        Words.resize(Other.Words.size());
+      }
+      for (size_t Idx = 0; Idx < Other.Words.size(); ++Idx) {
+        Words[Idx] |= Other.Words[Idx];
+      }
+    } else {
+      for (unsigned Idx : Other.Sparse) {
+        set(Idx);
+      }
     }
   }
 
@@ -242,36 +395,61 @@ public:
   }
 
   void erase(const T &Data) noexcept {
-    auto Search = Position.left.find(Data);
-    if (Search != Position.left.end()) {
-      if (!(Bits.size() < Search->second - 1)) {
-        Bits[Search->second] = false;
+    if (Index) {
+      if (auto Idx = Index->findIndex(Data)) {
+        reset(*Idx);
       }
     }
   }
 
-  void clear() noexcept { Bits.reset(); }
+  void clear() noexcept {
+    Dense = false;
+    Sparse.clear();
+    Words.clear();
+  }
 
-  bool empty() const noexcept { return Bits.none(); }
+  bool empty() const noexcept {
+    return Dense ? std::all_of(Words.begin(), Words.end(),
+                               [](Word W) { return W == 0; })
+                 : Sparse.empty();
+  }
 
-  void reserve(size_t NewCap) { Bits.reserve(NewCap); }
+  void reserve(size_t NewCap) {
+    if (NewCap > SparseLimit) {
+      makeDense();
+      Words.reserve((NewCap + WordBits - 1) / WordBits);
+    } else {
+      Sparse.reserve(NewCap);
+    }
+  }
 
   bool find(const T &Data) const noexcept { return count(Data); }
 
   size_t count(const T &Data) const noexcept {
-    auto Search = Position.left.find(Data);
-    if (Search != Position.left.end()) {
-      if (Bits.size() > Search->second) {
-        return Bits[Search->second];
+    if (Index) {
+      if (auto Idx = Index->findIndex(Data)) {
+        return test(*Idx);
       }
     }
     return 0;
   }
 
-  size_t size() const noexcept { return Bits.count(); }
+  size_t size() const noexcept {
+    if (!Dense) {
+      return Sparse.size();
+    }
+    size_t Size = 0;
+    for (Word W : Words) {
+      Size += llvm::countPopulation(W);
+    }
+    return Size;
+  }
 
   friend bool operator==(const BitVectorSet &Lhs, const BitVectorSet &Rhs) {
-    return Lhs.Bits == Rhs.Bits;
+    if (!Lhs.Dense && !Rhs.Dense) {
+      return Lhs.Sparse == Rhs.Sparse;
+    }
+    return Lhs.size() == Rhs.size() && Lhs.includes(Rhs);
   }
 
   friend bool operator!=(const BitVectorSet &Lhs, const BitVectorSet &Rhs) {
@@ -279,54 +457,24 @@ public:
   }
 
   friend bool operator<(const BitVectorSet &Lhs, const BitVectorSet &Rhs) {
-    return Lhs.Bits.count() < Rhs.Bits.count();
+    return Lhs.size() < Rhs.size();
   }
 
   friend std::ostream &operator<<(std::ostream &OS, const BitVectorSet &B) {
     OS << '<';
-    size_t Idx = 0;
-    for (auto &Position : B.Position.left) {
-      if (Position.second < B.Bits.size() && B.Bits[Position.second]) {
-        ++Idx;
-        OS << Position.first;
-        if (Idx < B.size()) {
-          OS << ", ";
-        }
+    for (auto It = B.begin(), End = B.end(); It != End; ++It) {
+      if (It != B.begin()) {
+        OS << ", ";
       }
+      OS << *It;
     }
     OS << '>';
     return OS;
   }
 
-  iterator begin() {
-    int index = Bits.find_first();
-    if (index == -1)
-      index = Bits.size();
-    iterator ret = Position.right.find(index);
-    ret.setBits(Bits);
-    return ret;
-  }
-
-  iterator end() {
-    iterator ret = Position.right.find(Bits.size());
-    ret.setBits(Bits);
-    return ret;
-  }
+  const_iterator begin() const { return const_iterator(this, 0); }
 
-  const_iterator begin() const {
-    int index = Bits.find_first();
-    if (index == -1)
-      index = Bits.size();
-    const_iterator ret = (rc_iterator)Position.right.find(index);
-    ret.setBits(Bits);
-    return ret;
-  }
-
-  const_iterator end() const {
-    const_iterator ret = (rc_iterator)Position.right.find(Bits.size());
-    ret.setBits(Bits);
-    return ret;
-  }
+  const_iterator end() const { return const_iterator(this, endPos()); }
 };
 
 } // namespace psr
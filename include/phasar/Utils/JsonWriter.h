@@ -0,0 +1,108 @@
+/******************************************************************************
+ * Copyright (c) 2019 Philipp Schubert.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Philipp Schubert and others
+ *****************************************************************************/
+
+#ifndef PHASAR_UTILS_JSONWRITER_H_
+#define PHASAR_UTILS_JSONWRITER_H_
+
+#include <cstddef>     // size_t
+#include <iosfwd>      // ostream
+#include <string>      // to_string
+#include <string_view> // string_view
+#include <type_traits> // is_integral_v
+#include <vector>      // vector
+
+namespace psr {
+
+/**
+ * Writes a JSON document incrementally to an output stream. In contrast to
+ * building an nlohmann::json object first, the writer only keeps track of the
+ * currently open objects and arrays, such that arbitrarily large results can
+ * be exported in bounded memory:
+ *
+ *   JsonWriter W(OS);
+ *   W.beginObject();
+ *   W.key("CallGraph");
+ *   W.beginArray();
+ *   W.value("main");
+ *   W.endArray();
+ *   W.endObject();
+ *
+ * Misuse, such as writing a value where a key is expected or closing a scope
+ * that has not been opened, is caught by assertions.
+ */
+class JsonWriter {
+public:
+  explicit JsonWriter(std::ostream &OS);
+  ~JsonWriter() = default;
+  JsonWriter(const JsonWriter &) = delete;
+  JsonWriter &operator=(const JsonWriter &) = delete;
+
+  void beginObject();
+
+  void endObject();
+
+  void beginArray();
+
+  void endArray();
+
+  /**
+   * @brief Writes the key of the next member of the current object.
+   */
+  void key(std::string_view Key);
+
+  void value(std::string_view Str);
+
+  void value(const char *Str) { value(std::string_view(Str)); }
+
+  void value(const std::string &Str) { value(std::string_view(Str)); }
+
+  template <typename T>
+  std::enable_if_t<std::is_integral_v<T>> value(T Number) {
+    if constexpr (std::is_same_v<T, bool>) {
+      writeRaw(Number ? "true" : "false");
+    } else {
+      writeRaw(std::to_string(Number));
+    }
+  }
+
+  void value(double Number);
+
+  void null();
+
+  /**
+   * @brief Returns the number of objects and arrays that are currently open.
+   */
+  size_t depth() const { return Scopes.size(); }
+
+  /**
+   * @brief Writes S as a quoted and escaped JSON string.
+   */
+  static void writeString(std::ostream &OS, std::string_view S);
+
+private:
+  struct Scope {
+    bool IsObject;
+    bool IsEmpty;
+  };
+
+  std::ostream &OS;
+  std::vector<Scope> Scopes;
+  bool AfterKey = false;
+
+  /**
+   * Writes the separator that precedes a new value in the current scope.
+   */
+  void beginValue();
+
+  void writeRaw(std::string_view Raw);
+};
+
+} // namespace psr
+
+#endif
@@ -19,6 +19,8 @@
 
 #include <string>
 
+#include "llvm/ADT/StringRef.h"
+
 // Forward declaration of types for which we only use its pointer or ref type
 namespace llvm {
 class Argument;
@@ -45,6 +47,21 @@ unsigned int getColumnFromIR(const llvm::Value *V);
 
 std::string getSrcCodeFromIR(const llvm::Value *V);
 
+/**
+ * Returns the given line (starting at 1) of the given source file without
+ * leading and trailing whitespace. Every file is mapped into memory and
+ * indexed by line only once, the returned reference remains valid until
+ * clearSrcCodeCache() is called.
+ */
+llvm::StringRef getSrcCodeLineFromFile(const std::string &Path,
+                                       unsigned int LineNr);
+
+/**
+ * Releases all cached source files as well as the memoized debug information
+ * lookups.
+ */
+void clearSrcCodeCache();
+
 std::string getModuleIDFromIR(const llvm::Value *V);
 
 } // namespace psr
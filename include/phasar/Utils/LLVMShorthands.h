@@ -18,6 +18,7 @@
 #define PHASAR_UTILS_LLVMSHORTHANDS_H_
 
 #include <string>
+#include <tuple>
 #include <vector>
 
 #include "phasar/Utils/Utilities.h"
@@ -129,6 +130,13 @@ struct llvmValueIDLess {
   bool operator()(const llvm::Value *lhs, const llvm::Value *rhs) const;
 };
 
+/**
+ * @brief Returns a key of the annotated ID that orders values like
+ * llvmValueIDLess. Sorting many values by precomputed keys avoids looking up
+ * and parsing their IDs in every comparison.
+ */
+std::tuple<bool, long, std::string> getMetaDataIDKey(const llvm::Value *V);
+
 /**
  * @brief Returns position of a formal function argument.
  * @param Arg LLVM Argument.
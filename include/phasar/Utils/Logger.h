@@ -17,7 +17,9 @@
 #ifndef PHASAR_UTILS_LOGGER_H_
 #define PHASAR_UTILS_LOGGER_H_
 
+#include <atomic>
 #include <iosfwd>
+#include <map>
 #include <string>
 
 #include "boost/log/sinks.hpp"
@@ -52,10 +54,60 @@ std::ostream &operator<<(std::ostream &os, enum severity_level l);
     computation;                                                               \
   }
 
+// The lowest severity level whose log messages are compiled in, messages of
+// lower severity are discarded at compile time and do not cost anything at
+// runtime. It is set by the PHASAR_LOG_LEVEL option of the build system.
+#ifndef PHASAR_LOG_LEVEL_FLOOR
+#define PHASAR_LOG_LEVEL_FLOOR DEBUG
+#endif
+
+/**
+ * The components whose log messages can be enabled or disabled separately at
+ * runtime.
+ */
+enum class LogCategory : unsigned {
+  General = 0,
+  Solver,
+  FlowEdgeFunctionCache
+};
+
+extern const std::map<std::string, LogCategory> StringToLogCategory;
+
+// one bit per log category, all categories are enabled by default
+extern std::atomic<unsigned> enabledLogCategories;
+
+/**
+ * Enables or disables the log messages of the given category.
+ */
+void setLogCategoryEnabled(LogCategory category, bool enabled);
+
+inline bool isLogCategoryEnabled(LogCategory category) {
+  return enabledLogCategories.load(std::memory_order_relaxed) &
+         (1U << static_cast<unsigned>(category));
+}
+
+// Logs a message of the given severity level and category. The message is
+// neither compiled in if the level is below PHASAR_LOG_LEVEL_FLOOR nor
+// formatted if logging or the category is disabled, e.g.
+//   PHASAR_LOG_LEVEL_CAT(DEBUG, Solver, "Process " << N << ". path edge");
+#define PHASAR_LOG_LEVEL_CAT(level, category, message)                         \
+  do {                                                                         \
+    if constexpr (psr::level >= psr::PHASAR_LOG_LEVEL_FLOOR) {                 \
+      if (psr::isLogCategoryEnabled(psr::LogCategory::category) &&             \
+          boost::log::core::get()->get_logging_enabled()) {                    \
+        BOOST_LOG_SEV(psr::lg::get(), psr::level) << message;                  \
+      }                                                                        \
+    }                                                                          \
+  } while (false)
+
+#define PHASAR_LOG_LEVEL(level, message)                                       \
+  PHASAR_LOG_LEVEL_CAT(level, General, message)
+
 // Register the logger and use it a singleton then, get the logger with:
-// boost::log::sources::severity_logger<severity_level>& lg = lg::get();
+// boost::log::sources::severity_logger_mt<severity_level>& lg = lg::get();
+// The logger is thread-safe, as data-flow analyses may be run concurrently.
 BOOST_LOG_INLINE_GLOBAL_LOGGER_DEFAULT(
-    lg, boost::log::sources::severity_logger<severity_level>)
+    lg, boost::log::sources::severity_logger_mt<severity_level>)
 // The logger can also be used as a global variable, which is not recommended.
 // In such a case a global variable would be created like in the following
 // boost::log::sources::severity_logger<int> lg;
@@ -89,10 +141,17 @@ struct LoggerExceptionHandler {
 };
 
 /**
- * Initializes the logger.
+ * Initializes the logger. Log records are formatted and written by a
+ * background thread into a buffered stream, which is flushed at program exit
+ * or by flushLogger().
  */
 void initializeLogger(bool use_logger, std::string log_file = "");
 
+/**
+ * Blocks until all pending log records are written and flushes the stream.
+ */
+void flushLogger();
+
 } // namespace psr
 
 #endif
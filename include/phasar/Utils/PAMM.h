@@ -17,8 +17,11 @@
 #ifndef PHASAR_UTILS_PAMM_H_
 #define PHASAR_UTILS_PAMM_H_
 
-#include <chrono>        // high_resolution_clock::time_point, milliseconds
+#include <array>         // array
+#include <chrono>        // steady_clock::time_point, nanoseconds
+#include <cstdint>       // uint64_t
 #include <iosfwd>        // ostream
+#include <mutex>         // mutex
 #include <set>           // set
 #include <string>        // string
 #include <unordered_map> // unordered_map
@@ -49,21 +52,61 @@ namespace psr {
  * this class.
  */
 class PAMM {
+public:
+  /// Interned representation of a timer, counter or histogram id.
+  using Id_t = unsigned;
+
+  /**
+   * Repeating timers are not recorded duration by duration but aggregated
+   * into a fixed-size summary. Durations are sorted into power-of-two buckets
+   * which allows to estimate percentiles.
+   *
+   * @brief Aggregated durations of a repeating timer in nanoseconds.
+   */
+  struct RepeatingTimerStats {
+    uint64_t Count = 0;
+    uint64_t Sum = 0;
+    uint64_t Min = 0;
+    uint64_t Max = 0;
+    std::array<uint64_t, 64> Buckets{};
+    void add(uint64_t Duration);
+    void merge(const RepeatingTimerStats &Other);
+    /// Estimates the given percentile (0 - 100) of all recorded durations.
+    uint64_t percentile(double P) const;
+  };
+
+  struct ThreadShard;
+
 private:
   PAMM() = default;
   ~PAMM() = default;
-  using TimePoint_t = std::chrono::high_resolution_clock::time_point;
+  using Clock_t = std::chrono::steady_clock;
+  using TimePoint_t = Clock_t::time_point;
   using Duration_t = std::chrono::milliseconds;
-  std::unordered_map<std::string, TimePoint_t> RunningTimer;
-  std::unordered_map<std::string, std::pair<TimePoint_t, TimePoint_t>>
-      StoppedTimer;
-  std::unordered_map<std::string,
-                     std::vector<std::pair<TimePoint_t, TimePoint_t>>>
-      RepeatingTimer;
-  std::unordered_map<std::string, unsigned> Counter;
-  std::unordered_map<std::string,
-                     std::unordered_map<std::string, unsigned long>>
+  /// Guards all members below, shards have their own lock which must only be
+  /// acquired after this one.
+  mutable std::mutex Mtx;
+  std::unordered_map<std::string, Id_t> Ids;
+  std::vector<std::string> Names;
+  /// Durations of stopped single timers in nanoseconds.
+  std::unordered_map<Id_t, uint64_t> StoppedTimer;
+  /// Repeating timers of threads that have already terminated.
+  std::unordered_map<Id_t, RepeatingTimerStats> RetiredRepeatingTimer;
+  /// Registered counters and their initial value plus the counts of threads
+  /// that have already terminated.
+  std::unordered_map<Id_t, long> Counter;
+  std::unordered_map<Id_t, std::unordered_map<std::string, unsigned long>>
       Histogram;
+  std::set<ThreadShard *> Shards;
+
+  ThreadShard &getThreadShard();
+  void retireThreadShard(ThreadShard &Shard);
+  Id_t getIdUnlocked(const std::string &Name);
+  long getCounterUnlocked(Id_t CounterId) const;
+  std::unordered_map<Id_t, RepeatingTimerStats> getRepeatingTimerUnlocked();
+  void stopAllTimers();
+
+  friend struct ThreadShard;
 
 public:
   /// PAMM is used as singleton.
@@ -85,28 +128,42 @@ public:
    */
   void reset();
 
+  /**
+   * The id of a given name never changes during the lifetime of the process,
+   * not even when PAMM is reset. The macros in @see PAMMMacros.h resolve their
+   * ids only once per call site, so that the hot paths do not need to hash
+   * any strings.
+   *
+   * @brief Returns the interned id for the given timer, counter or histogram
+   * name.
+   */
+  Id_t getId(const std::string &Name);
+
   /**
    * @brief Starts a timer under the given timer id - associated macro:
    * START_TIMER(TIMER_ID, SEV_LVL).
    * @param TimerId Unique timer id.
+   * @note Running timers are tracked per thread.
    */
-  void startTimer(const std::string &TimerId);
+  void startTimer(Id_t TimerId);
+  void startTimer(const std::string &TimerId) { startTimer(getId(TimerId)); }
 
   /**
    * @brief Resets timer under the given timer id - associated macro:
    * RESET_TIMER(TIMER_ID, SEV_LVL).
    * @param TimerId Unique timer id.
    */
-  void resetTimer(const std::string &TimerId);
+  void resetTimer(Id_t TimerId);
+  void resetTimer(const std::string &TimerId) { resetTimer(getId(TimerId)); }
 
   /**
-   * If pauseTimer is true, a running timer gets paused, its start time point
-   * will paired with a current time point, and stored as an accumulated timer.
-   * This enables us to repeatedly compute execution time for a certain portion
+   * If pauseTimer is true, a running timer gets paused and the time since it
+   * was started is added to the accumulated timer under the same id. This
+   * enables us to repeatedly compute execution time for a certain portion
    * of code which is executed multiple times, e.g. a loop or a function
    * call, without using a different timer id for every time computation.
-   * Times of all executions of one timer are saved as distinct time point
-   * pairs. Associated macro:
+   * Accumulated timers only keep count, sum, minimum, maximum and a coarse
+   * histogram of all durations. Associated macro:
    *    PAUSE_TIMER(TIMER_ID, SEV_LVL)
    *
    * Otherwise, the timer will be simply stopped. Associated macro:
@@ -115,23 +172,30 @@ public:
    * @param TimerId Unique timer id.
    * @param PauseTimer If true, timer will be paused instead of stopped.
    */
-  void stopTimer(const std::string &TimerId, bool PauseTimer = false);
+  void stopTimer(Id_t TimerId, bool PauseTimer = false);
+  void stopTimer(const std::string &TimerId, bool PauseTimer = false) {
+    stopTimer(getId(TimerId), PauseTimer);
+  }
 
   /**
    * @brief Computes the elapsed time of the given timer up until now or up to
    * the moment the timer was stopped - associated macro: GET_TIMER(TIMERID)
    * @param TimerId Unique timer id.
-   * @return Timer duration.
+   * @return Timer duration in milliseconds.
    */
   unsigned long elapsedTime(const std::string &TimerId);
 
   /**
-   * For each accumulated timer a vector holds all recorded durations.
-   * @brief Computes the elapsed time for all accumulated timer being used.
-   * @return Map containing measured durations of all accumulated timer.
+   * @brief Same as elapsedTime(), but in nanoseconds.
    */
-  std::unordered_map<std::string, std::vector<unsigned long>>
-  elapsedTimeOfRepeatingTimer();
+  uint64_t elapsedTimeNs(const std::string &TimerId);
+
+  /**
+   * Aggregates the repeating timers of all threads.
+   * @brief Returns the statistics of all accumulated timers being used.
+   * @return Map containing the statistics of all accumulated timers.
+   */
+  std::unordered_map<std::string, RepeatingTimerStats> getRepeatingTimer();
 
   /**
    * A running timer will not be stopped. The precision for time computation
@@ -150,15 +214,23 @@ public:
    * macro: REG_COUNTER(COUNTER_ID, INIT_VALUE, SEV_LVL).
    * @param CounterId Unique counter id.
    */
-  void regCounter(const std::string &CounterId, unsigned IntialValue = 0);
+  void regCounter(Id_t CounterId, unsigned IntialValue = 0);
+  void regCounter(const std::string &CounterId, unsigned IntialValue = 0) {
+    regCounter(getId(CounterId), IntialValue);
+  }
 
   /**
+   * Counts are recorded in a per-thread shard without any locking and are
+   * merged when they are read.
    * @brief Increases the count for the given counter - associated macro:
    * INC_COUNTER(COUNTER_ID, VALUE, SEV_LVL).
    * @param CounterId Unique counter id.
    * @param CValue to be added to the current counter.
    */
-  void incCounter(const std::string &CounterId, unsigned CValue = 1);
+  void incCounter(Id_t CounterId, unsigned CValue = 1);
+  void incCounter(const std::string &CounterId, unsigned CValue = 1) {
+    incCounter(getId(CounterId), CValue);
+  }
 
   /**
    * @brief Decreases the count for the given counter - associated macro:
@@ -166,7 +238,10 @@ public:
    * @param CounterId Unique counter id.
    * @param CValue to be subtracted from the current counter.
    */
-  void decCounter(const std::string &CounterId, unsigned CValue = 1);
+  void decCounter(Id_t CounterId, unsigned CValue = 1);
+  void decCounter(const std::string &CounterId, unsigned CValue = 1) {
+    decCounter(getId(CounterId), CValue);
+  }
 
   /**
    * The associated macro does not check PAMM's severity level explicitly.
@@ -190,7 +265,10 @@ public:
    * REG_HISTOGRAM(HISTOGRAM_ID, SEV_LVL).
    * @param HistogramId Unique hitogram id.
    */
-  void regHistogram(const std::string &HistogramId);
+  void regHistogram(Id_t HistogramId);
+  void regHistogram(const std::string &HistogramId) {
+    regHistogram(getId(HistogramId));
+  }
 
   /**
    * @brief Adds a new observed data point to the corresponding histogram -
@@ -200,9 +278,13 @@ public:
    * @param DataPointId ID of the given data point.
    * @param DataPointValue Value of the given data point.
    */
+  void addToHistogram(Id_t HistogramId, const std::string &DataPointId,
+                      unsigned long DataPointValue = 1);
   void addToHistogram(const std::string &HistogramId,
                       const std::string &DataPointId,
-                      unsigned long DataPointValue = 1);
+                      unsigned long DataPointValue = 1) {
+    addToHistogram(getId(HistogramId), DataPointId, DataPointValue);
+  }
 
   void printTimers(std::ostream &os);
 
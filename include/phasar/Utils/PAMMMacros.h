@@ -38,47 +38,55 @@ static constexpr unsigned PAMM_CURR_SEV_LEVEL = 0;
 #define PAMM_GET_INSTANCE PAMM &pamm = PAMM::getInstance()
 #define PAMM_RESET pamm.reset()
 
+// Resolves the interned id of TIMER_ID, COUNTER_ID or HISTOGRAM_ID only once
+// per call site, so that the ids have to be string literals.
+#define PAMM_ID(ID)                                                            \
+  ([]() {                                                                      \
+    static const PAMM::Id_t PAMMId = PAMM::getInstance().getId(ID);            \
+    return PAMMId;                                                             \
+  }())
+
 #define START_TIMER(TIMER_ID, SEV_LVL)                                         \
   if constexpr (PAMM_CURR_SEV_LEVEL >= SEV_LVL) {                              \
-    pamm.startTimer(TIMER_ID);                                                 \
+    pamm.startTimer(PAMM_ID(TIMER_ID));                                        \
   }
 #define RESET_TIMER(TIMER_ID, SEV_LVL)                                         \
   if constexpr (PAMM_CURR_SEV_LEVEL >= SEV_LVL) {                              \
-    pamm.resetTimer(TIMER_ID);                                                 \
+    pamm.resetTimer(PAMM_ID(TIMER_ID));                                        \
   }
 #define PAUSE_TIMER(TIMER_ID, SEV_LVL)                                         \
   if constexpr (PAMM_CURR_SEV_LEVEL >= SEV_LVL) {                              \
-    pamm.stopTimer(TIMER_ID, true);                                            \
+    pamm.stopTimer(PAMM_ID(TIMER_ID), true);                                   \
   }
 #define STOP_TIMER(TIMER_ID, SEV_LVL)                                          \
   if constexpr (PAMM_CURR_SEV_LEVEL >= SEV_LVL) {                              \
-    pamm.stopTimer(TIMER_ID);                                                  \
+    pamm.stopTimer(PAMM_ID(TIMER_ID));                                         \
   }
 #define PRINT_TIMER(TIMER_ID)                                                  \
   pamm.getPrintableDuration(pamm.elapsedTime(TIMER_ID))
 
 #define REG_COUNTER(COUNTER_ID, INIT_VALUE, SEV_LVL)                           \
   if constexpr (PAMM_CURR_SEV_LEVEL >= SEV_LVL) {                              \
-    pamm.regCounter(COUNTER_ID, INIT_VALUE);                                   \
+    pamm.regCounter(PAMM_ID(COUNTER_ID), INIT_VALUE);                          \
   }
 #define INC_COUNTER(COUNTER_ID, VALUE, SEV_LVL)                                \
   if constexpr (PAMM_CURR_SEV_LEVEL >= SEV_LVL) {                              \
-    pamm.incCounter(COUNTER_ID, VALUE);                                        \
+    pamm.incCounter(PAMM_ID(COUNTER_ID), VALUE);                               \
   }
 #define DEC_COUNTER(COUNTER_ID, VALUE, SEV_LVL)                                \
   if constexpr (PAMM_CURR_SEV_LEVEL >= SEV_LVL) {                              \
-    pamm.decCounter(COUNTER_ID, VALUE);                                        \
+    pamm.decCounter(PAMM_ID(COUNTER_ID), VALUE);                               \
   }
 #define GET_COUNTER(COUNTER_ID) pamm.getCounter(COUNTER_ID)
 #define GET_SUM_COUNT(...) pamm.getSumCount(__VA_ARGS__)
 
 #define REG_HISTOGRAM(HISTOGRAM_ID, SEV_LVL)                                   \
   if constexpr (PAMM_CURR_SEV_LEVEL >= SEV_LVL) {                              \
-    pamm.regHistogram(HISTOGRAM_ID);                                           \
+    pamm.regHistogram(PAMM_ID(HISTOGRAM_ID));                                  \
   }
 #define ADD_TO_HISTOGRAM(HISTOGRAM_ID, DATAPOINT_ID, DATAPOINT_VALUE, SEV_LVL) \
   if constexpr (PAMM_CURR_SEV_LEVEL >= SEV_LVL) {                              \
-    pamm.addToHistogram(HISTOGRAM_ID, std::to_string(DATAPOINT_ID),            \
+    pamm.addToHistogram(PAMM_ID(HISTOGRAM_ID), std::to_string(DATAPOINT_ID),   \
                         DATAPOINT_VALUE);                                      \
   }
 
@@ -87,6 +95,7 @@ static constexpr unsigned PAMM_CURR_SEV_LEVEL = 0;
 
 #else
 #define PAMM_GET_INSTANCE
+#define PAMM_ID(ID)
 #define PAMM_RESET
 #define START_TIMER(TIMER_ID, SEV_LVL)
 #define RESET_TIMER(TIMER_ID, SEV_LVL)
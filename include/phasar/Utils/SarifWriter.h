@@ -0,0 +1,78 @@
+/******************************************************************************
+ * Copyright (c) 2019 Philipp Schubert.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Philipp Schubert and others
+ *****************************************************************************/
+
+#ifndef PHASAR_UTILS_SARIFWRITER_H_
+#define PHASAR_UTILS_SARIFWRITER_H_
+
+#include <cstddef> // size_t
+#include <iosfwd>  // ostream
+#include <string>  // string
+
+#include "phasar/Utils/JsonWriter.h"
+
+namespace llvm {
+class Value;
+} // namespace llvm
+
+namespace psr {
+
+/**
+ * Writes a SARIF 2.1.0 log with a single run incrementally to an output
+ * stream. The log is opened on construction, results are written as they are
+ * added and the log is completed by close(), or on destruction at the latest.
+ */
+class SarifWriter {
+public:
+  static const std::string Version;
+  static const std::string Schema;
+
+  enum class Level { None, Note, Warning, Error };
+
+  /**
+   * @brief The source location of a result. Empty or zero members are
+   * omitted from the log.
+   */
+  struct Location {
+    std::string File;
+    unsigned Line = 0;
+    unsigned Column = 0;
+    std::string Function;
+  };
+
+  SarifWriter(std::ostream &OS, const std::string &ToolName = "phasar");
+  ~SarifWriter();
+  SarifWriter(const SarifWriter &) = delete;
+  SarifWriter &operator=(const SarifWriter &) = delete;
+
+  void addResult(const std::string &RuleId, Level L,
+                 const std::string &Message, const Location &Loc);
+
+  /**
+   * @brief Completes the log, no results can be added afterwards.
+   */
+  void close();
+
+  size_t getNumResults() const { return NumResults; }
+
+  /**
+   * @brief Returns the source location of V as far as it is known from the
+   * debug information.
+   */
+  static Location getLocationOf(const llvm::Value *V);
+
+private:
+  std::ostream &OS;
+  JsonWriter W;
+  size_t NumResults = 0;
+  bool Closed = false;
+};
+
+} // namespace psr
+
+#endif
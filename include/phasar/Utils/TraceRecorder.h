@@ -0,0 +1,140 @@
+/******************************************************************************
+ * Copyright (c) 2017 Philipp Schubert.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Philipp Schubert and others
+ *****************************************************************************/
+
+#ifndef PHASAR_UTILS_TRACERECORDER_H_
+#define PHASAR_UTILS_TRACERECORDER_H_
+
+#include <chrono>  // steady_clock
+#include <cstdint> // uint64_t
+#include <iosfwd>  // ostream
+#include <string>  // string
+#include <vector>  // vector
+
+#include "nlohmann/json.hpp"
+
+namespace psr {
+
+/**
+ * Records scoped events (e.g. the processing of a single path edge or the
+ * construction of a flow function) and exports them in the Chrome trace-event
+ * format, which can be loaded into chrome://tracing or Perfetto.
+ *
+ * In order to keep the overhead low on hot paths only every SampleRate-th
+ * scope is timed; all other scopes cost a single counter increment. Events
+ * are capped at MaxEvents, further events are counted as dropped.
+ *
+ * A TraceRecorder is not thread-safe, each solver owns its own recorder.
+ */
+class TraceRecorder {
+public:
+  using Clock_t = std::chrono::steady_clock;
+
+  struct Event {
+    const char *Name;
+    const char *Category;
+    std::string Detail;
+    uint64_t StartNs;
+    uint64_t DurationNs;
+  };
+
+  /**
+   * RAII helper that records an event covering its own lifetime if the
+   * owning recorder decided to sample it. A scope evaluates to true iff it
+   * is sampled, which allows to compute expensive details lazily:
+   *
+   *   TraceRecorder::Scope S(Trace, "Process Call", "solver");
+   *   if (S) {
+   *     S.setDetail(ICF->getFunctionName(ICF->getFunctionOf(n)));
+   *   }
+   *
+   * A null recorder disables the scope entirely.
+   */
+  class Scope {
+  public:
+    Scope(TraceRecorder *Recorder, const char *Name, const char *Category)
+        : Recorder(Recorder && Recorder->sample() ? Recorder : nullptr),
+          Name(Name), Category(Category) {
+      if (this->Recorder) {
+        Start = Clock_t::now();
+      }
+    }
+    Scope(const Scope &) = delete;
+    Scope &operator=(const Scope &) = delete;
+    ~Scope() {
+      if (Recorder) {
+        Recorder->record(Name, Category, std::move(Detail), Start,
+                         Clock_t::now());
+      }
+    }
+    explicit operator bool() const { return Recorder != nullptr; }
+    void setDetail(std::string D) { Detail = std::move(D); }
+
+  private:
+    TraceRecorder *Recorder;
+    const char *Name;
+    const char *Category;
+    std::string Detail;
+    Clock_t::time_point Start;
+  };
+
+  static constexpr size_t DefaultMaxEvents = 1 << 20;
+
+  explicit TraceRecorder(unsigned SampleRate = 1,
+                         size_t MaxEvents = DefaultMaxEvents);
+  ~TraceRecorder() = default;
+  TraceRecorder(const TraceRecorder &) = delete;
+  TraceRecorder &operator=(const TraceRecorder &) = delete;
+
+  /**
+   * @brief Returns true if the next scope shall be recorded.
+   */
+  bool sample() {
+    if (++Seen < SampleRate) {
+      return false;
+    }
+    Seen = 0;
+    return true;
+  }
+
+  void record(const char *Name, const char *Category, std::string Detail,
+              Clock_t::time_point Start, Clock_t::time_point End);
+
+  const std::vector<Event> &getEvents() const { return Events; }
+
+  unsigned getSampleRate() const { return SampleRate; }
+
+  size_t getNumDroppedEvents() const { return Dropped; }
+
+  void clear();
+
+  /**
+   * @brief Returns the recorded events as a Chrome trace-event JSON object.
+   */
+  nlohmann::json getAsJson() const;
+
+  void exportChromeTrace(std::ostream &OS) const;
+
+  /**
+   * @brief Writes the Chrome trace to the given file, throws
+   * std::ios_base::failure if the file could not be written.
+   */
+  void exportChromeTrace(const std::string &OutputPath) const;
+
+private:
+  const unsigned SampleRate;
+  const size_t MaxEvents;
+  unsigned Seen = 0;
+  size_t Dropped = 0;
+  Clock_t::time_point Epoch;
+  std::vector<Event> Events;
+};
+
+} // namespace psr
+
+#endif
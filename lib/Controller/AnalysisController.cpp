@@ -7,16 +7,25 @@
  *     Philipp Schubert and others
  *****************************************************************************/
 
+#include <algorithm>
+#include <atomic>
 #include <cassert>
+#include <exception>
 #include <fstream>
 #include <functional>
 #include <iostream>
 #include <set>
+#include <sstream>
+#include <thread>
 
 #include "llvm/Support/ErrorHandling.h"
 
+#include "phasar/Config/Configuration.h"
 #include "phasar/Controller/AnalysisController.h"
 #include "phasar/DB/ProjectIRDB.h"
+#include "phasar/PhasarLLVM/AnalysisStrategy/DemandDrivenAnalysis.h"
+#include "phasar/PhasarLLVM/AnalysisStrategy/IncrementalUpdateAnalysis.h"
+#include "phasar/PhasarLLVM/AnalysisStrategy/ModuleWiseAnalysis.h"
 #include "phasar/PhasarLLVM/AnalysisStrategy/Strategies.h"
 #include "phasar/PhasarLLVM/AnalysisStrategy/WholeProgramAnalysis.h"
 #include "phasar/PhasarLLVM/DataFlowSolver/IfdsIde/Problems/IDEInstInteractionAnalysis.h"
@@ -72,8 +81,8 @@ AnalysisController::AnalysisController(
     std::set<std::string> EntryPoints, AnalysisStrategy Strategy,
     AnalysisControllerEmitterOptions EmitterOptions, std::string ProjectID,
     std::string OutDirectory)
-    : IRDB(IRDB), TH(IRDB), PT(IRDB, PTATy),
-      ICF(IRDB, CGTy, EntryPoints, &TH, &PT),
+    : IRDB(IRDB), HA(std::make_shared<HelperAnalyses<>>(IRDB, EntryPoints,
+                                                        PTATy, CGTy)),
       DataFlowAnalyses(DataFlowAnalyses), AnalysisConfigs(AnalysisConfigs),
       EntryPoints(EntryPoints), Strategy(Strategy),
       EmitterOptions(EmitterOptions), ProjectID(ProjectID),
@@ -90,13 +99,13 @@ AnalysisController::AnalysisController(
 void AnalysisController::executeAs(AnalysisStrategy Strategy) {
   switch (Strategy) {
   case AnalysisStrategy::DemandDriven:
-    llvm::report_fatal_error("AnalysisStrategy not supported, yet!");
+    executeDemandDriven();
     break;
   case AnalysisStrategy::Incremental:
-    llvm::report_fatal_error("AnalysisStrategy not supported, yet!");
+    executeIncremental();
     break;
   case AnalysisStrategy::ModuleWise:
-    llvm::report_fatal_error("AnalysisStrategy not supported, yet!");
+    executeModuleWise();
     break;
   case AnalysisStrategy::Variational:
     llvm::report_fatal_error("AnalysisStrategy not supported, yet!");
@@ -109,149 +118,443 @@ void AnalysisController::executeAs(AnalysisStrategy Strategy) {
   }
 }
 
-void AnalysisController::executeDemandDriven() {}
-
-void AnalysisController::executeIncremental() {}
-
-void AnalysisController::executeModuleWise() {}
-
-void AnalysisController::executeVariational() {}
-
-void AnalysisController::executeWholeProgram() {
+void AnalysisController::executeDemandDriven() {
+  std::vector<llvm::Instruction *> QueryPoints;
+  if (PhasarConfig::VariablesMap().count("query-points")) {
+    for (auto Id : PhasarConfig::VariablesMap()["query-points"]
+                       .as<std::vector<std::size_t>>()) {
+      if (auto *I = IRDB.getInstruction(Id)) {
+        QueryPoints.push_back(I);
+      } else {
+        std::cerr << "Query point '" << Id << "' does not exist!\n";
+      }
+    }
+  }
+  if (QueryPoints.empty()) {
+    llvm::report_fatal_error(
+        "Demand-driven analysis requires at least one query point!");
+  }
   size_t ConfigIdx = 0;
   for (auto DataFlowAnalysis : DataFlowAnalyses) {
     std::string AnalysisConfigPath =
         (ConfigIdx < AnalysisConfigs.size()) ? AnalysisConfigs[ConfigIdx] : "";
     switch (DataFlowAnalysis) {
     case DataFlowAnalysisType::IFDSUninitializedVariables: {
-      WholeProgramAnalysis<IFDSSolver_P<IFDSUninitializedVariables>,
+      DemandDrivenAnalysis<IFDSSolver_P<IFDSUninitializedVariables>,
                            IFDSUninitializedVariables>
-          WPA(IRDB, EntryPoints, &PT, &ICF, &TH);
-      WPA.solve();
-      emitRequestedDataFlowResults(WPA);
-      WPA.releaseAllHelperAnalyses();
+          DDA(HA);
+      executeQueries(DDA, QueryPoints);
     } break;
     case DataFlowAnalysisType::IFDSConstAnalysis: {
-      WholeProgramAnalysis<IFDSSolver_P<IFDSConstAnalysis>, IFDSConstAnalysis>
-          WPA(IRDB, EntryPoints, &PT, &ICF, &TH);
-      WPA.solve();
-      emitRequestedDataFlowResults(WPA);
-      WPA.releaseAllHelperAnalyses();
+      DemandDrivenAnalysis<IFDSSolver_P<IFDSConstAnalysis>, IFDSConstAnalysis>
+          DDA(HA);
+      executeQueries(DDA, QueryPoints);
     } break;
     case DataFlowAnalysisType::IFDSTaintAnalysis: {
-      WholeProgramAnalysis<IFDSSolver_P<IFDSTaintAnalysis>, IFDSTaintAnalysis>
-          WPA(IRDB, AnalysisConfigPath, EntryPoints, &PT, &ICF, &TH);
+      DemandDrivenAnalysis<IFDSSolver_P<IFDSTaintAnalysis>, IFDSTaintAnalysis>
+          DDA(HA, AnalysisConfigPath);
+      executeQueries(DDA, QueryPoints);
     } break;
     case DataFlowAnalysisType::IDETaintAnalysis: {
-      WholeProgramAnalysis<IDESolver_P<IDETaintAnalysis>, IDETaintAnalysis> WPA(
-          IRDB, EntryPoints, &PT, &ICF, &TH);
-      WPA.solve();
-      emitRequestedDataFlowResults(WPA);
-      WPA.releaseAllHelperAnalyses();
-    } break;
-    case DataFlowAnalysisType::IDEOpenSSLTypeStateAnalysis: {
-      OpenSSLEVPKDFDescription TSDesc;
-      WholeProgramAnalysis<IDESolver_P<IDETypeStateAnalysis>,
-                           IDETypeStateAnalysis>
-          WPA(IRDB, &TSDesc, EntryPoints, &PT, &ICF, &TH);
-      WPA.solve();
-      emitRequestedDataFlowResults(WPA);
-      WPA.releaseAllHelperAnalyses();
-      WPA.releaseConfiguration();
+      DemandDrivenAnalysis<IDESolver_P<IDETaintAnalysis>, IDETaintAnalysis>
+          DDA(HA);
+      executeQueries(DDA, QueryPoints);
     } break;
     case DataFlowAnalysisType::IFDSTypeAnalysis: {
-      WholeProgramAnalysis<IFDSSolver_P<IFDSTypeAnalysis>, IFDSTypeAnalysis>
-          WPA(IRDB, EntryPoints, &PT, &ICF, &TH);
-      WPA.solve();
-      emitRequestedDataFlowResults(WPA);
-      WPA.releaseAllHelperAnalyses();
+      DemandDrivenAnalysis<IFDSSolver_P<IFDSTypeAnalysis>, IFDSTypeAnalysis>
+          DDA(HA);
+      executeQueries(DDA, QueryPoints);
     } break;
     case DataFlowAnalysisType::IFDSSolverTest: {
-      WholeProgramAnalysis<IFDSSolver_P<IFDSSolverTest>, IFDSSolverTest> WPA(
-          IRDB, EntryPoints, &PT, &ICF, &TH);
-      WPA.solve();
-      emitRequestedDataFlowResults(WPA);
-      WPA.releaseAllHelperAnalyses();
+      DemandDrivenAnalysis<IFDSSolver_P<IFDSSolverTest>, IFDSSolverTest>
+          DDA(HA);
+      executeQueries(DDA, QueryPoints);
     } break;
     case DataFlowAnalysisType::IFDSLinearConstantAnalysis: {
-      WholeProgramAnalysis<IFDSSolver_P<IFDSLinearConstantAnalysis>,
+      DemandDrivenAnalysis<IFDSSolver_P<IFDSLinearConstantAnalysis>,
                            IFDSLinearConstantAnalysis>
-          WPA(IRDB, EntryPoints, &PT, &ICF, &TH);
-      WPA.solve();
-      emitRequestedDataFlowResults(WPA);
-      WPA.releaseAllHelperAnalyses();
+          DDA(HA);
+      executeQueries(DDA, QueryPoints);
     } break;
     case DataFlowAnalysisType::IFDSFieldSensTaintAnalysis: {
-      WholeProgramAnalysis<IFDSSolver_P<IFDSFieldSensTaintAnalysis>,
+      DemandDrivenAnalysis<IFDSSolver_P<IFDSFieldSensTaintAnalysis>,
                            IFDSFieldSensTaintAnalysis>
-          WPA(IRDB, AnalysisConfigPath, EntryPoints, &PT, &ICF, &TH);
-      WPA.solve();
-      emitRequestedDataFlowResults(WPA);
-      WPA.releaseAllHelperAnalyses();
+          DDA(HA, AnalysisConfigPath);
+      executeQueries(DDA, QueryPoints);
     } break;
     case DataFlowAnalysisType::IDELinearConstantAnalysis: {
-      WholeProgramAnalysis<IDESolver_P<IDELinearConstantAnalysis>,
+      DemandDrivenAnalysis<IDESolver_P<IDELinearConstantAnalysis>,
                            IDELinearConstantAnalysis>
-          WPA(IRDB, EntryPoints, &PT, &ICF, &TH);
-      WPA.solve();
-      emitRequestedDataFlowResults(WPA);
-      WPA.releaseAllHelperAnalyses();
+          DDA(HA);
+      executeQueries(DDA, QueryPoints);
     } break;
     case DataFlowAnalysisType::IDESolverTest: {
-      WholeProgramAnalysis<IDESolver_P<IDESolverTest>, IDESolverTest> WPA(
-          IRDB, EntryPoints, &PT, &ICF, &TH);
-      WPA.solve();
-      emitRequestedDataFlowResults(WPA);
-      WPA.releaseAllHelperAnalyses();
+      DemandDrivenAnalysis<IDESolver_P<IDESolverTest>, IDESolverTest>
+          DDA(HA);
+      executeQueries(DDA, QueryPoints);
     } break;
     case DataFlowAnalysisType::IDEInstInteractionAnalysis: {
-      WholeProgramAnalysis<IDESolver_P<IDEInstInteractionAnalysis>,
+      DemandDrivenAnalysis<IDESolver_P<IDEInstInteractionAnalysis>,
                            IDEInstInteractionAnalysis>
-          WPA(IRDB, EntryPoints, &PT, &ICF, &TH);
-      WPA.solve();
-      emitRequestedDataFlowResults(WPA);
-      WPA.releaseAllHelperAnalyses();
+          DDA(HA);
+      executeQueries(DDA, QueryPoints);
     } break;
-    case DataFlowAnalysisType::IntraMonoFullConstantPropagation: {
-      WholeProgramAnalysis<IntraMonoSolver_P<IntraMonoFullConstantPropagation>,
-                           IntraMonoFullConstantPropagation>
-          WPA(IRDB, EntryPoints, &PT, &ICF, &TH);
-      WPA.solve();
-      emitRequestedDataFlowResults(WPA);
-      WPA.releaseAllHelperAnalyses();
+    default:
+      std::cerr << "Data-flow analysis '" << DataFlowAnalysis
+                << "' is not supported by the demand-driven strategy!\n";
+      break;
+    }
+  }
+}
+
+void AnalysisController::executeIncremental() {
+  size_t ConfigIdx = 0;
+  for (auto DataFlowAnalysis : DataFlowAnalyses) {
+    std::string AnalysisConfigPath =
+        (ConfigIdx < AnalysisConfigs.size()) ? AnalysisConfigs[ConfigIdx] : "";
+    switch (DataFlowAnalysis) {
+    case DataFlowAnalysisType::IFDSUninitializedVariables: {
+      IncrementalUpdateAnalysis<IFDSSolver_P<IFDSUninitializedVariables>,
+                                IFDSUninitializedVariables>
+          IUA(HA);
+      executeIncrementally(IUA, DataFlowAnalysis);
     } break;
-    case DataFlowAnalysisType::IntraMonoSolverTest: {
-      WholeProgramAnalysis<IntraMonoSolver_P<IntraMonoSolverTest>,
-                           IntraMonoSolverTest>
-          WPA(IRDB, EntryPoints, &PT, &ICF, &TH);
-      WPA.solve();
-      emitRequestedDataFlowResults(WPA);
-      WPA.releaseAllHelperAnalyses();
+    case DataFlowAnalysisType::IFDSConstAnalysis: {
+      IncrementalUpdateAnalysis<IFDSSolver_P<IFDSConstAnalysis>,
+                                IFDSConstAnalysis>
+          IUA(HA);
+      executeIncrementally(IUA, DataFlowAnalysis);
     } break;
-    case DataFlowAnalysisType::InterMonoSolverTest: {
-      WholeProgramAnalysis<InterMonoSolver_P<InterMonoSolverTest, 3>,
-                           InterMonoSolverTest>
-          WPA(IRDB, EntryPoints, &PT, &ICF, &TH);
-      WPA.solve();
-      emitRequestedDataFlowResults(WPA);
-      WPA.releaseAllHelperAnalyses();
+    case DataFlowAnalysisType::IFDSTaintAnalysis: {
+      IncrementalUpdateAnalysis<IFDSSolver_P<IFDSTaintAnalysis>,
+                                IFDSTaintAnalysis>
+          IUA(HA, AnalysisConfigPath);
+      executeIncrementally(IUA, DataFlowAnalysis);
     } break;
-    case DataFlowAnalysisType::InterMonoTaintAnalysis: {
-      WholeProgramAnalysis<InterMonoSolver_P<InterMonoTaintAnalysis, 3>,
-                           InterMonoTaintAnalysis>
-          WPA(IRDB, AnalysisConfigPath, EntryPoints, &PT, &ICF, &TH);
-      WPA.solve();
-      emitRequestedDataFlowResults(WPA);
-      WPA.releaseAllHelperAnalyses();
+    case DataFlowAnalysisType::IFDSTypeAnalysis: {
+      IncrementalUpdateAnalysis<IFDSSolver_P<IFDSTypeAnalysis>,
+                                IFDSTypeAnalysis>
+          IUA(HA);
+      executeIncrementally(IUA, DataFlowAnalysis);
     } break;
-    case DataFlowAnalysisType::Plugin:
+    case DataFlowAnalysisType::IFDSSolverTest: {
+      IncrementalUpdateAnalysis<IFDSSolver_P<IFDSSolverTest>, IFDSSolverTest>
+          IUA(HA);
+      executeIncrementally(IUA, DataFlowAnalysis);
+    } break;
+    default:
+      std::cerr << "Data-flow analysis '" << DataFlowAnalysis
+                << "' is not supported by the incremental strategy!\n";
       break;
+    }
+  }
+}
+
+std::string AnalysisController::getIncrementalStatePath(
+    DataFlowAnalysisType DataFlowAnalysis) {
+  // the result directory is unique per run, hence runs are persisted next to
+  // it such that the next run can find them
+  std::string StateDir = OutDirectory.empty() ? "." : OutDirectory;
+  if (PhasarConfig::VariablesMap().count("incremental-state-dir")) {
+    StateDir =
+        PhasarConfig::VariablesMap()["incremental-state-dir"].as<std::string>();
+  }
+  return StateDir + "/" + ProjectID + "-" + to_string(DataFlowAnalysis) +
+         "-incremental.json";
+}
+
+void AnalysisController::executeModuleWise() {
+  // without summaries to link, the modules are summarized
+  std::vector<std::string> SummaryPaths;
+  if (PhasarConfig::VariablesMap().count("module-summaries")) {
+    SummaryPaths = PhasarConfig::VariablesMap()["module-summaries"]
+                       .as<std::vector<std::string>>();
+  }
+  size_t ConfigIdx = 0;
+  for (auto DataFlowAnalysis : DataFlowAnalyses) {
+    std::string AnalysisConfigPath =
+        (ConfigIdx < AnalysisConfigs.size()) ? AnalysisConfigs[ConfigIdx] : "";
+    switch (DataFlowAnalysis) {
+    case DataFlowAnalysisType::IFDSUninitializedVariables: {
+      using MWATy =
+          ModuleWiseAnalysis<IFDSSolver_P<IFDSUninitializedVariables>,
+                             IFDSUninitializedVariables>;
+      if (SummaryPaths.empty()) {
+        summarizeModules<MWATy>(DataFlowAnalysis);
+      } else {
+        MWATy MWA(HA);
+        executeWithSummaries(MWA, DataFlowAnalysis, SummaryPaths);
+      }
+    } break;
+    case DataFlowAnalysisType::IFDSConstAnalysis: {
+      using MWATy = ModuleWiseAnalysis<IFDSSolver_P<IFDSConstAnalysis>,
+                                       IFDSConstAnalysis>;
+      if (SummaryPaths.empty()) {
+        summarizeModules<MWATy>(DataFlowAnalysis);
+      } else {
+        MWATy MWA(HA);
+        executeWithSummaries(MWA, DataFlowAnalysis, SummaryPaths);
+      }
+    } break;
+    case DataFlowAnalysisType::IFDSTaintAnalysis: {
+      using MWATy = ModuleWiseAnalysis<IFDSSolver_P<IFDSTaintAnalysis>,
+                                       IFDSTaintAnalysis>;
+      if (SummaryPaths.empty()) {
+        summarizeModules<MWATy>(DataFlowAnalysis, AnalysisConfigPath);
+      } else {
+        MWATy MWA(HA, AnalysisConfigPath);
+        executeWithSummaries(MWA, DataFlowAnalysis, SummaryPaths);
+      }
+    } break;
+    case DataFlowAnalysisType::IFDSTypeAnalysis: {
+      using MWATy = ModuleWiseAnalysis<IFDSSolver_P<IFDSTypeAnalysis>,
+                                       IFDSTypeAnalysis>;
+      if (SummaryPaths.empty()) {
+        summarizeModules<MWATy>(DataFlowAnalysis);
+      } else {
+        MWATy MWA(HA);
+        executeWithSummaries(MWA, DataFlowAnalysis, SummaryPaths);
+      }
+    } break;
+    case DataFlowAnalysisType::IFDSSolverTest: {
+      using MWATy =
+          ModuleWiseAnalysis<IFDSSolver_P<IFDSSolverTest>, IFDSSolverTest>;
+      if (SummaryPaths.empty()) {
+        summarizeModules<MWATy>(DataFlowAnalysis);
+      } else {
+        MWATy MWA(HA);
+        executeWithSummaries(MWA, DataFlowAnalysis, SummaryPaths);
+      }
+    } break;
     default:
+      std::cerr << "Data-flow analysis '" << DataFlowAnalysis
+                << "' is not supported by the module-wise strategy!\n";
       break;
     }
   }
 }
 
+std::string AnalysisController::getModuleSummaryPath(
+    const llvm::Module &M, DataFlowAnalysisType DataFlowAnalysis) {
+  // summaries are looked up by later runs, hence they are not placed into
+  // the result directory which is unique per run
+  std::string SummaryDir = OutDirectory.empty() ? "." : OutDirectory;
+  return SummaryDir + "/" +
+         boost::filesystem::path(M.getModuleIdentifier()).stem().string() +
+         "-" + to_string(DataFlowAnalysis) + ".summary";
+}
+
+void AnalysisController::executeVariational() {}
+
+void AnalysisController::executeWholeProgram() {
+  size_t ConfigIdx = 0;
+  std::string AnalysisConfigPath =
+      (ConfigIdx < AnalysisConfigs.size()) ? AnalysisConfigs[ConfigIdx] : "";
+  unsigned Jobs = 1;
+  if (PhasarConfig::VariablesMap().count("analysis-jobs")) {
+    Jobs = PhasarConfig::VariablesMap()["analysis-jobs"].as<unsigned>();
+  }
+  if (Jobs > 1 && DataFlowAnalyses.size() > 1) {
+    executeWholeProgramConcurrently(Jobs, AnalysisConfigPath);
+    return;
+  }
+  for (auto DataFlowAnalysis : DataFlowAnalyses) {
+    executeWholeProgram(DataFlowAnalysis, AnalysisConfigPath,
+                        to_string(DataFlowAnalysis), ResultDirectory,
+                        std::cout);
+  }
+}
+
+void AnalysisController::executeWholeProgramConcurrently(
+    unsigned Jobs, const std::string &AnalysisConfigPath) {
+  // Each analysis writes into its own stream and result directory. The
+  // streams are printed in the order in which the analyses were requested
+  // once all of them are done, such that their outputs do not interleave.
+  // Files that are written even without a result directory, e.g. the result
+  // store, are prefixed by the index of the run.
+  struct AnalysisRun {
+    DataFlowAnalysisType DataFlowAnalysis;
+    std::string Name;
+    boost::filesystem::path ResultDir;
+    std::stringstream OS;
+    std::exception_ptr Error;
+  };
+  std::vector<AnalysisRun> Runs(DataFlowAnalyses.size());
+  // The field-sensitive taint analysis splits GEP instructions and thereby
+  // modifies the use lists of the shared IR. It is run after the others.
+  std::vector<AnalysisRun *> ConcurrentRuns;
+  std::vector<AnalysisRun *> SequentialRuns;
+  for (size_t Idx = 0; Idx < DataFlowAnalyses.size(); ++Idx) {
+    auto &Run = Runs[Idx];
+    Run.DataFlowAnalysis = DataFlowAnalyses[Idx];
+    Run.Name = std::to_string(Idx) + "-" + to_string(Run.DataFlowAnalysis);
+    if (!ResultDirectory.empty()) {
+      Run.ResultDir = ResultDirectory / Run.Name;
+      boost::filesystem::create_directory(Run.ResultDir);
+    }
+    if (Run.DataFlowAnalysis ==
+        DataFlowAnalysisType::IFDSFieldSensTaintAnalysis) {
+      SequentialRuns.push_back(&Run);
+    } else {
+      ConcurrentRuns.push_back(&Run);
+    }
+  }
+  auto execute = [this, &AnalysisConfigPath](AnalysisRun &Run) {
+    try {
+      executeWholeProgram(Run.DataFlowAnalysis, AnalysisConfigPath, Run.Name,
+                          Run.ResultDir, Run.OS);
+    } catch (...) {
+      Run.Error = std::current_exception();
+    }
+  };
+  // the type hierarchy, points-to information and call graph are only read
+  // while the analyses are solved, hence they can be shared by the workers
+  std::atomic<size_t> Next(0);
+  std::vector<std::thread> Workers;
+  for (size_t Worker = 0;
+       Worker < std::min<size_t>(Jobs, ConcurrentRuns.size()); ++Worker) {
+    Workers.emplace_back([&Next, &ConcurrentRuns, &execute]() {
+      for (size_t Idx = Next++; Idx < ConcurrentRuns.size(); Idx = Next++) {
+        execute(*ConcurrentRuns[Idx]);
+      }
+    });
+  }
+  for (auto &Worker : Workers) {
+    Worker.join();
+  }
+  for (auto *Run : SequentialRuns) {
+    execute(*Run);
+  }
+  for (auto &Run : Runs) {
+    std::cout << Run.OS.str();
+  }
+  for (auto &Run : Runs) {
+    if (Run.Error) {
+      std::rethrow_exception(Run.Error);
+    }
+  }
+}
+
+void AnalysisController::executeWholeProgram(
+    DataFlowAnalysisType DataFlowAnalysis,
+    const std::string &AnalysisConfigPath, const std::string &RunName,
+    const boost::filesystem::path &ResultDir, std::ostream &OS) {
+  switch (DataFlowAnalysis) {
+  case DataFlowAnalysisType::IFDSUninitializedVariables: {
+    WholeProgramAnalysis<IFDSSolver_P<IFDSUninitializedVariables>,
+                         IFDSUninitializedVariables>
+        WPA(HA);
+    WPA.solve();
+    emitRequestedDataFlowResults(WPA, RunName, ResultDir, OS);
+  } break;
+  case DataFlowAnalysisType::IFDSConstAnalysis: {
+    WholeProgramAnalysis<IFDSSolver_P<IFDSConstAnalysis>, IFDSConstAnalysis>
+        WPA(HA);
+    WPA.solve();
+    emitRequestedDataFlowResults(WPA, RunName, ResultDir, OS);
+  } break;
+  case DataFlowAnalysisType::IFDSTaintAnalysis: {
+    WholeProgramAnalysis<IFDSSolver_P<IFDSTaintAnalysis>, IFDSTaintAnalysis>
+        WPA(HA, AnalysisConfigPath);
+    WPA.solve();
+    emitRequestedDataFlowResults(WPA, RunName, ResultDir, OS);
+  } break;
+  case DataFlowAnalysisType::IDETaintAnalysis: {
+    WholeProgramAnalysis<IDESolver_P<IDETaintAnalysis>, IDETaintAnalysis>
+        WPA(HA);
+    WPA.solve();
+    emitRequestedDataFlowResults(WPA, RunName, ResultDir, OS);
+  } break;
+  case DataFlowAnalysisType::IDEOpenSSLTypeStateAnalysis: {
+    OpenSSLEVPKDFDescription TSDesc;
+    WholeProgramAnalysis<IDESolver_P<IDETypeStateAnalysis>,
+                         IDETypeStateAnalysis>
+        WPA(HA, &TSDesc);
+    WPA.solve();
+    emitRequestedDataFlowResults(WPA, RunName, ResultDir, OS);
+    WPA.releaseConfiguration();
+  } break;
+  case DataFlowAnalysisType::IFDSTypeAnalysis: {
+    WholeProgramAnalysis<IFDSSolver_P<IFDSTypeAnalysis>, IFDSTypeAnalysis>
+        WPA(HA);
+    WPA.solve();
+    emitRequestedDataFlowResults(WPA, RunName, ResultDir, OS);
+  } break;
+  case DataFlowAnalysisType::IFDSSolverTest: {
+    WholeProgramAnalysis<IFDSSolver_P<IFDSSolverTest>, IFDSSolverTest>
+        WPA(HA);
+    WPA.solve();
+    emitRequestedDataFlowResults(WPA, RunName, ResultDir, OS);
+  } break;
+  case DataFlowAnalysisType::IFDSLinearConstantAnalysis: {
+    WholeProgramAnalysis<IFDSSolver_P<IFDSLinearConstantAnalysis>,
+                         IFDSLinearConstantAnalysis>
+        WPA(HA);
+    WPA.solve();
+    emitRequestedDataFlowResults(WPA, RunName, ResultDir, OS);
+  } break;
+  case DataFlowAnalysisType::IFDSFieldSensTaintAnalysis: {
+    WholeProgramAnalysis<IFDSSolver_P<IFDSFieldSensTaintAnalysis>,
+                         IFDSFieldSensTaintAnalysis>
+        WPA(HA, AnalysisConfigPath);
+    WPA.solve();
+    emitRequestedDataFlowResults(WPA, RunName, ResultDir, OS);
+  } break;
+  case DataFlowAnalysisType::IDELinearConstantAnalysis: {
+    WholeProgramAnalysis<IDESolver_P<IDELinearConstantAnalysis>,
+                         IDELinearConstantAnalysis>
+        WPA(HA);
+    WPA.solve();
+    emitRequestedDataFlowResults(WPA, RunName, ResultDir, OS);
+  } break;
+  case DataFlowAnalysisType::IDESolverTest: {
+    WholeProgramAnalysis<IDESolver_P<IDESolverTest>, IDESolverTest>
+        WPA(HA);
+    WPA.solve();
+    emitRequestedDataFlowResults(WPA, RunName, ResultDir, OS);
+  } break;
+  case DataFlowAnalysisType::IDEInstInteractionAnalysis: {
+    WholeProgramAnalysis<IDESolver_P<IDEInstInteractionAnalysis>,
+                         IDEInstInteractionAnalysis>
+        WPA(HA);
+    WPA.solve();
+    emitRequestedDataFlowResults(WPA, RunName, ResultDir, OS);
+  } break;
+  case DataFlowAnalysisType::IntraMonoFullConstantPropagation: {
+    WholeProgramAnalysis<IntraMonoSolver_P<IntraMonoFullConstantPropagation>,
+                         IntraMonoFullConstantPropagation>
+        WPA(HA);
+    WPA.solve();
+    emitRequestedDataFlowResults(WPA, RunName, ResultDir, OS);
+  } break;
+  case DataFlowAnalysisType::IntraMonoSolverTest: {
+    WholeProgramAnalysis<IntraMonoSolver_P<IntraMonoSolverTest>,
+                         IntraMonoSolverTest>
+        WPA(HA);
+    WPA.solve();
+    emitRequestedDataFlowResults(WPA, RunName, ResultDir, OS);
+  } break;
+  case DataFlowAnalysisType::InterMonoSolverTest: {
+    WholeProgramAnalysis<InterMonoSolver_P<InterMonoSolverTest, 3>,
+                         InterMonoSolverTest>
+        WPA(HA);
+    WPA.solve();
+    emitRequestedDataFlowResults(WPA, RunName, ResultDir, OS);
+  } break;
+  case DataFlowAnalysisType::InterMonoTaintAnalysis: {
+    WholeProgramAnalysis<InterMonoSolver_P<InterMonoTaintAnalysis, 3>,
+                         InterMonoTaintAnalysis>
+        WPA(HA, AnalysisConfigPath);
+    WPA.solve();
+    emitRequestedDataFlowResults(WPA, RunName, ResultDir, OS);
+  } break;
+  case DataFlowAnalysisType::Plugin:
+    break;
+  default:
+    break;
+  }
+}
+
 void AnalysisController::emitRequestedHelperAnalysisResults() {
   if (EmitterOptions & AnalysisControllerEmitterOptions::EmitIR) {
     if (!ResultDirectory.empty()) {
@@ -264,74 +567,74 @@ void AnalysisController::emitRequestedHelperAnalysisResults() {
   if (EmitterOptions & AnalysisControllerEmitterOptions::EmitTHAsText) {
     if (!ResultDirectory.empty()) {
       std::ofstream OFS(ResultDirectory.string() + "/psr-th.txt");
-      TH.print(OFS);
+      HA->getTypeHierarchy().print(OFS);
     } else {
-      TH.print();
+      HA->getTypeHierarchy().print();
     }
   }
   if (EmitterOptions & AnalysisControllerEmitterOptions::EmitTHAsDot) {
     if (!ResultDirectory.empty()) {
       std::ofstream OFS(ResultDirectory.string() + "/psr-th.dot");
-      TH.printAsDot(OFS);
+      HA->getTypeHierarchy().printAsDot(OFS);
     } else {
-      TH.printAsDot();
+      HA->getTypeHierarchy().printAsDot();
     }
   }
   if (EmitterOptions & AnalysisControllerEmitterOptions::EmitTHAsJson) {
     if (!ResultDirectory.empty()) {
       std::ofstream OFS(ResultDirectory.string() + "/psr-th.json");
-      TH.printAsJson(OFS);
+      HA->getTypeHierarchy().printAsJson(OFS);
     } else {
-      TH.printAsJson();
+      HA->getTypeHierarchy().printAsJson();
     }
   }
   if (EmitterOptions & AnalysisControllerEmitterOptions::EmitPTAAsText) {
     if (!ResultDirectory.empty()) {
       std::ofstream OFS(ResultDirectory.string() + "/psr-pta.txt");
-      PT.print(OFS);
+      HA->getPointsToInfo().print(OFS);
     } else {
-      PT.print();
+      HA->getPointsToInfo().print();
     }
   }
   if (EmitterOptions & AnalysisControllerEmitterOptions::EmitPTAAsDot) {
     if (!ResultDirectory.empty()) {
       std::ofstream OFS(ResultDirectory.string() + "/psr-pta.dot");
-      PT.print(OFS);
+      HA->getPointsToInfo().print(OFS);
     } else {
-      PT.print();
+      HA->getPointsToInfo().print();
     }
   }
   if (EmitterOptions & AnalysisControllerEmitterOptions::EmitPTAAsJson) {
     if (!ResultDirectory.empty()) {
       std::ofstream OFS(ResultDirectory.string() + "/psr-pta.json");
-      PT.printAsJson(OFS);
+      HA->getPointsToInfo().printAsJson(OFS);
     } else {
-      PT.printAsJson();
+      HA->getPointsToInfo().printAsJson();
     }
   }
   if (EmitterOptions & AnalysisControllerEmitterOptions::EmitCGAsText) {
     if (!ResultDirectory.empty()) {
       std::ofstream OFS(ResultDirectory.string() + "/psr-cg.txt");
-      ICF.print(OFS);
+      HA->getICFG().print(OFS);
     } else {
-      ICF.print();
+      HA->getICFG().print();
     }
   }
   if (EmitterOptions & AnalysisControllerEmitterOptions::EmitCGAsDot) {
     if (!ResultDirectory.empty()) {
       std::ofstream OFS(ResultDirectory.string() + "/psr-cg.dot");
-      ICF.printAsDot(OFS);
+      HA->getICFG().printAsDot(OFS);
     } else {
-      ICF.printAsDot();
+      HA->getICFG().printAsDot();
     }
   }
 
   if (EmitterOptions & AnalysisControllerEmitterOptions::EmitCGAsJson) {
     if (!ResultDirectory.empty()) {
       std::ofstream OFS(ResultDirectory.string() + "/psr-cg.json");
-      ICF.printAsJson(OFS);
+      HA->getICFG().printAsJson(OFS);
     } else {
-      ICF.printAsJson();
+      HA->getICFG().printAsJson();
     }
   }
 }
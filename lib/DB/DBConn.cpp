@@ -917,14 +917,16 @@ PointsToGraph DBConn::loadPointsToGraphFromFunction(const string &FunctionName,
 
 void DBConn::storeLTHGraphToHex(const LLVMTypeHierarchy::bidigraph_t &G,
                                 const string hex_id) {
-  Hexastore h(hex_id);
+  Hexastore h(hex_id, true);
+  vector<array<string, 3>> Edges;
+  Edges.reserve(boost::num_edges(G));
   typename boost::graph_traits<LLVMTypeHierarchy::bidigraph_t>::edge_iterator
       ei_start,
       e_end;
   for (tie(ei_start, e_end) = boost::edges(G); ei_start != e_end; ++ei_start) {
     auto source = boost::source(*ei_start, G);
     auto target = boost::target(*ei_start, G);
-    h.put({{G[source].name, "-->", G[target].name}});
+    Edges.push_back({{G[source].name, "-->", G[target].name}});
   }
   typedef boost::graph_traits<LLVMTypeHierarchy::bidigraph_t>::vertex_iterator
       vertex_iterator_t;
@@ -936,9 +938,10 @@ void DBConn::storeLTHGraphToHex(const LLVMTypeHierarchy::bidigraph_t &G,
     boost::tie(ei, ei_end) = boost::out_edges(*vp.first, G);
     if (ei == ei_end) {
       string hs_vertex_rep = G[*vp.first].name;
-      h.put({{hs_vertex_rep, "---", "---"}});
+      Edges.push_back({{hs_vertex_rep, "---", "---"}});
     }
   }
+  h.putBatch(Edges);
   auto result = h.get({{"?", "?", "?"}});
   for_each(result.begin(), result.end(),
            [](hs_result r) { cout << r << endl; });
@@ -8,25 +8,41 @@
  *****************************************************************************/
 
 #include <iostream>
+#include <limits>
 
 #include "phasar/DB/Hexastore.h"
 
 using namespace psr;
 using namespace std;
-using namespace boost;
 
 namespace psr {
 
-Hexastore::Hexastore(string filename) {
+Hexastore::Hexastore(string filename, bool useWAL) {
   sqlite3_open(filename.c_str(), &hs_internal_db);
-  const string query = INIT;
-  char *err;
-  sqlite3_exec(hs_internal_db, query.c_str(), callback, 0, &err);
-  if (err != NULL)
-    cout << err << "\n\n";
+  if (useWAL) {
+    exec(ENABLE_WAL);
+  }
+  exec(INIT);
+  for (size_t I = 0; I < INSERT_PREPARED.size(); ++I) {
+    if (sqlite3_prepare_v2(hs_internal_db, INSERT_PREPARED[I].c_str(), -1,
+                           &InsertStmts[I], nullptr) != SQLITE_OK) {
+      cout << sqlite3_errmsg(hs_internal_db) << "\n\n";
+    }
+  }
 }
 
-Hexastore::~Hexastore() { sqlite3_close(hs_internal_db); }
+Hexastore::~Hexastore() {
+  if (InTransaction) {
+    commitTransaction();
+  }
+  for (auto *Stmt : InsertStmts) {
+    sqlite3_finalize(Stmt);
+  }
+  for (auto *Stmt : SearchStmts) {
+    sqlite3_finalize(Stmt);
+  }
+  sqlite3_close(hs_internal_db);
+}
 
 int Hexastore::callback(void *NotUsed, int argc, char **argv,
                         char **azColName) {
@@ -36,74 +52,207 @@ int Hexastore::callback(void *NotUsed, int argc, char **argv,
   return 0;
 }
 
+void Hexastore::exec(const string &query) {
+  char *err = nullptr;
+  sqlite3_exec(hs_internal_db, query.c_str(), nullptr, nullptr, &err);
+  if (err != NULL) {
+    cout << err << "\n\n";
+    sqlite3_free(err);
+  }
+}
+
+void Hexastore::beginTransaction() {
+  if (!InTransaction) {
+    exec(BEGIN_TRANSACTION);
+    InTransaction = true;
+  }
+}
+
+void Hexastore::commitTransaction() {
+  if (InTransaction) {
+    exec(COMMIT_TRANSACTION);
+    InTransaction = false;
+  }
+}
+
+void Hexastore::rollbackTransaction() {
+  if (InTransaction) {
+    exec(ROLLBACK_TRANSACTION);
+    InTransaction = false;
+  }
+}
+
 void Hexastore::put(array<string, 3> edge) {
-  doPut(SPO_INSERT, edge);
-  doPut(SOP_INSERT, edge);
-  doPut(PSO_INSERT, edge);
-  doPut(POS_INSERT, edge);
-  doPut(OSP_INSERT, edge);
-  doPut(OPS_INSERT, edge);
+  // a single edge is still written by six index permutations, make sure they
+  // share one transaction instead of committing each statement on its own
+  if (InTransaction) {
+    doPut(edge);
+  } else {
+    beginTransaction();
+    doPut(edge);
+    commitTransaction();
+  }
+}
+
+void Hexastore::putBatch(const vector<array<string, 3>> &edges,
+                         size_t batchSize) {
+  if (InTransaction) {
+    for (const auto &Edge : edges) {
+      doPut(Edge);
+    }
+    return;
+  }
+  if (batchSize == 0) {
+    batchSize = DefaultBatchSize;
+  }
+  for (size_t I = 0; I < edges.size(); ++I) {
+    if (I % batchSize == 0) {
+      commitTransaction();
+      beginTransaction();
+    }
+    doPut(edges[I]);
+  }
+  commitTransaction();
 }
 
-void Hexastore::doPut(string query, array<string, 3> edge) {
-  string compiled_query = str(format(query) % edge[0] % edge[1] % edge[2]);
-  char *err;
-  sqlite3_exec(hs_internal_db, compiled_query.c_str(), callback, 0, &err);
-  if (err != NULL)
-    cout << err;
+void Hexastore::doPut(const array<string, 3> &edge) {
+  for (auto *Stmt : InsertStmts) {
+    if (!Stmt) {
+      continue;
+    }
+    for (int I = 1; I <= sqlite3_bind_parameter_count(Stmt); ++I) {
+      sqlite3_bind_text(Stmt, I, edge[I - 1].data(),
+                        static_cast<int>(edge[I - 1].size()), SQLITE_STATIC);
+    }
+    if (sqlite3_step(Stmt) != SQLITE_DONE) {
+      cout << sqlite3_errmsg(hs_internal_db);
+    }
+    sqlite3_reset(Stmt);
+    sqlite3_clear_bindings(Stmt);
+  }
 }
 
 vector<hs_result> Hexastore::get(array<string, 3> edge_query,
                                  size_t result_size_hint) {
   vector<hs_result> result;
   result.reserve(result_size_hint);
-  string querystring;
-  if (edge_query[0] == "?") {
-    if (edge_query[1] == "?") {
-      if (edge_query[2] == "?") {
-        querystring = SEARCH_XXX;
-      } else {
-        querystring = SEARCH_XXO;
-      }
-    } else {
-      if (edge_query[2] == "?") {
-        querystring = SEARCH_XPX;
-      } else {
-        querystring = SEARCH_XPO;
-      }
+  auto C = query(edge_query);
+  while (C.next()) {
+    result.push_back(C.result());
+  }
+  return result;
+}
+
+Hexastore::Cursor Hexastore::query(const array<string, 3> &edge_query,
+                                   bool prefix) {
+  unsigned Pattern = 0;
+  for (unsigned I = 0; I < 3; ++I) {
+    // an empty prefix matches everything, just as "?" does
+    if (edge_query[I] != "?" && !(prefix && edge_query[I].empty())) {
+      Pattern |= 4u >> I;
     }
-  } else {
-    if (edge_query[1] == "?") {
-      if (edge_query[2] == "?") {
-        querystring = SEARCH_SXX;
-      } else {
-        querystring = SEARCH_SXO;
+  }
+  unsigned Slot = Pattern + (prefix ? 8 : 0);
+  sqlite3_stmt *Stmt = SearchStmts[Slot];
+  SearchStmts[Slot] = nullptr;
+  if (!Stmt) {
+    // the cached statement is either not yet compiled or still in use
+    const string Query = getSearchQuery(Pattern, prefix);
+    if (sqlite3_prepare_v2(hs_internal_db, Query.c_str(), -1, &Stmt,
+                           nullptr) != SQLITE_OK) {
+      cout << sqlite3_errmsg(hs_internal_db);
+    }
+  }
+  if (Stmt) {
+    for (int I = 0; I < 3; ++I) {
+      if (!(Pattern & (4u >> I))) {
+        continue;
       }
-    } else {
-      if (edge_query[2] == "?") {
-        querystring = SEARCH_SPX;
-      } else {
-        querystring = SEARCH_SPO;
+      sqlite3_bind_text(Stmt, I + 1, edge_query[I].data(),
+                        static_cast<int>(edge_query[I].size()),
+                        SQLITE_TRANSIENT);
+      if (prefix) {
+        // the smallest string greater than all strings starting with the
+        // prefix; names are UTF-8 and thus never contain the byte 0xff
+        string Upper = edge_query[I];
+        while (!Upper.empty() && static_cast<unsigned char>(Upper.back()) ==
+                                     numeric_limits<unsigned char>::max()) {
+          Upper.pop_back();
+        }
+        if (Upper.empty()) {
+          Upper = edge_query[I] + '\xff';
+        } else {
+          Upper.back() = static_cast<char>(Upper.back() + 1);
+        }
+        sqlite3_bind_text(Stmt, I + 4, Upper.data(),
+                          static_cast<int>(Upper.size()), SQLITE_TRANSIENT);
       }
     }
   }
-  string compiled_query =
-      str(format(querystring) % edge_query[0] % edge_query[1] % edge_query[2]);
-  // this lambda will collect all of our results, since it is called on every
-  // row of the result set
-  auto sqlite_cb_result_collector = [](void *cb, int argc, char **argv,
-                                       char **azColName) {
-    vector<hs_result> *res = static_cast<vector<hs_result> *>(cb);
-    res->emplace_back(argv[0], argv[1], argv[2]);
-    return 0;
-  };
-  char *err;
-  sqlite3_exec(hs_internal_db, compiled_query.c_str(),
-               sqlite_cb_result_collector, &result, &err);
-  if (err != NULL) {
-    cout << err;
+  return Cursor(*this, Stmt, Slot);
+}
+
+void Hexastore::forEach(const array<string, 3> &edge_query,
+                        RowCallback callback, bool prefix) {
+  auto C = query(edge_query, prefix);
+  while (C.next()) {
+    callback(C.subject(), C.predicate(), C.object());
   }
-  return result;
+}
+
+void Hexastore::forEachBatch(const vector<array<string, 3>> &edge_queries,
+                             RowCallback callback, bool prefix) {
+  for (const auto &EdgeQuery : edge_queries) {
+    forEach(EdgeQuery, callback, prefix);
+  }
+}
+
+void Hexastore::returnSearchStmt(sqlite3_stmt *Stmt, unsigned Slot) {
+  sqlite3_reset(Stmt);
+  sqlite3_clear_bindings(Stmt);
+  if (SearchStmts[Slot]) {
+    sqlite3_finalize(Stmt);
+  } else {
+    SearchStmts[Slot] = Stmt;
+  }
+}
+
+Hexastore::Cursor::Cursor(Hexastore &HS, sqlite3_stmt *Stmt, unsigned Slot)
+    : HS(&HS), Stmt(Stmt), Slot(Slot) {}
+
+Hexastore::Cursor::Cursor(Cursor &&Other) noexcept
+    : HS(Other.HS), Stmt(Other.Stmt), Slot(Other.Slot) {
+  Other.Stmt = nullptr;
+}
+
+Hexastore::Cursor::~Cursor() {
+  if (Stmt) {
+    HS->returnSearchStmt(Stmt, Slot);
+  }
+}
+
+bool Hexastore::Cursor::next() {
+  if (!Stmt) {
+    return false;
+  }
+  int RC = sqlite3_step(Stmt);
+  if (RC == SQLITE_ROW) {
+    return true;
+  }
+  if (RC != SQLITE_DONE) {
+    cout << sqlite3_errmsg(sqlite3_db_handle(Stmt));
+  }
+  return false;
+}
+
+llvm::StringRef Hexastore::Cursor::column(int Col) const {
+  const auto *Text =
+      reinterpret_cast<const char *>(sqlite3_column_text(Stmt, Col));
+  return llvm::StringRef(Text, sqlite3_column_bytes(Stmt, Col));
+}
+
+hs_result Hexastore::Cursor::result() const {
+  return hs_result(subject().str(), predicate().str(), object().str());
 }
 
 } // namespace psr
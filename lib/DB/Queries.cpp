@@ -299,4 +299,110 @@ create table if not exists ops_subject(
 
   )";
 
+const array<string, 18> INSERT_PREPARED = {
+    // SPO
+    "insert or ignore into spo_subject (name) values (?1);",
+    "insert or ignore into spo_predicate (name, sid) "
+    "values (?2, (select id from spo_subject where name=?1));",
+    "insert or ignore into spo_object (name, sid, pid) "
+    "values (?3, (select id from spo_subject where name=?1), "
+    "(select id from spo_predicate where name=?2 and sid=(select id from "
+    "spo_subject where name=?1)));",
+    // SOP
+    "insert or ignore into sop_subject (name) values (?1);",
+    "insert or ignore into sop_object (name, sid) "
+    "values (?3, (select id from sop_subject where name=?1));",
+    "insert or ignore into sop_predicate (name, sid, oid) "
+    "values (?2, (select id from sop_subject where name=?1), "
+    "(select id from sop_object where name=?3 and sid=(select id from "
+    "sop_subject where name=?1)));",
+    // PSO
+    "insert or ignore into pso_predicate (name) values (?2);",
+    "insert or ignore into pso_subject (name, pid) "
+    "values (?1, (select id from pso_predicate where name=?2));",
+    "insert or ignore into pso_object (name, pid, sid) "
+    "values (?3, (select id from pso_predicate where name=?2), "
+    "(select id from pso_subject where name=?1 and pid=(select id from "
+    "pso_predicate where name=?2)));",
+    // POS
+    "insert or ignore into pos_predicate (name) values (?2);",
+    "insert or ignore into pos_object (name, pid) "
+    "values (?3, (select id from pos_predicate where name=?2));",
+    "insert or ignore into pos_subject (name, oid, pid) "
+    "values (?1, (select id from pos_object where pos_object.name=?3 and "
+    "pos_object.pid=(select id from pos_predicate where name=?2)), "
+    "(select pid from pos_object where name=?3 and pid=(select id from "
+    "pos_predicate where name=?2)));",
+    // OSP
+    "insert or ignore into osp_object (name) values (?3);",
+    "insert or ignore into osp_subject (name, oid) "
+    "values (?1, (select id from osp_object where name=?3));",
+    "insert or ignore into osp_predicate (name, sid, oid) "
+    "values (?2, (select id from osp_subject where name=?1 and "
+    "oid=(select id from osp_object where name=?3)), "
+    "(select id from osp_object where name=?3 and oid=(select id from "
+    "osp_object where name=?3)));",
+    // OPS
+    "insert or ignore into ops_object (name) values (?3);",
+    "insert or ignore into ops_predicate (name, oid) "
+    "values (?2, (select id from ops_object where name=?3));",
+    "insert or ignore into ops_subject (name, pid, oid) "
+    "values (?1, (select id from ops_predicate where name=?2), "
+    "(select id from pos_object where name=?3 and oid=(select id from "
+    "osp_object where name=?3)));"};
+
+const string BEGIN_TRANSACTION = "begin transaction;";
+
+const string COMMIT_TRANSACTION = "commit transaction;";
+
+const string ROLLBACK_TRANSACTION = "rollback transaction;";
+
+const string ENABLE_WAL = "pragma journal_mode=WAL;"
+                          "pragma synchronous=NORMAL;";
+
+string getSearchQuery(unsigned pattern, bool prefix) {
+  // each pattern is answered by the index permutation that starts with its
+  // fixed elements, the full scan uses the spo tables
+  static const array<string, 8> Indices = {"spo", "osp", "pso", "pos",
+                                           "spo", "sop", "spo", "spo"};
+  const string &Idx = Indices[pattern & 7];
+  auto table = [&Idx](char Element) {
+    switch (Element) {
+    case 's':
+      return Idx + "_subject";
+    case 'p':
+      return Idx + "_predicate";
+    default:
+      return Idx + "_object";
+    }
+  };
+  // e.g. for 'spo': spo_subject -> spo_predicate.sid -> spo_object.pid/sid
+  const string Outer = table(Idx[0]);
+  const string Middle = table(Idx[1]);
+  const string Inner = table(Idx[2]);
+  string Query = "select " + table('s') + ".name, " + table('p') + ".name, " +
+                 table('o') + ".name from " + Outer + " inner join " + Middle +
+                 " on " + Outer + ".id=" + Middle + "." + Idx[0] +
+                 "id inner join " + Inner + " on " + Middle + ".id=" + Inner +
+                 "." + Idx[1] + "id and " + Outer + ".id=" + Inner + "." +
+                 Idx[0] + "id";
+  const char Elements[3] = {'s', 'p', 'o'};
+  bool HasWhere = false;
+  for (unsigned I = 0; I < 3; ++I) {
+    if (!(pattern & (4u >> I))) {
+      continue;
+    }
+    const string Column = table(Elements[I]) + ".name";
+    Query += HasWhere ? " and " : " where ";
+    HasWhere = true;
+    if (prefix) {
+      Query += Column + ">=?" + to_string(I + 1) + " and " + Column + "<?" +
+               to_string(I + 4);
+    } else {
+      Query += Column + "=?" + to_string(I + 1);
+    }
+  }
+  return Query + ";";
+}
+
 } // namespace psr
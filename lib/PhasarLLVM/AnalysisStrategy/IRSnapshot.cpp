@@ -0,0 +1,324 @@
+/******************************************************************************
+ * Copyright (c) 2019 Philipp Schubert.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Philipp Schubert and others
+ *****************************************************************************/
+
+#include <iterator>
+#include <stdexcept>
+#include <string>
+
+#include "llvm/IR/Constants.h"
+#include "llvm/IR/Function.h"
+#include "llvm/IR/GlobalVariable.h"
+#include "llvm/IR/InstIterator.h"
+#include "llvm/IR/Instructions.h"
+#include "llvm/IR/Metadata.h"
+#include "llvm/IR/Module.h"
+#include "llvm/Support/MD5.h"
+#include "llvm/Support/raw_ostream.h"
+
+#include "phasar/DB/ProjectIRDB.h"
+#include "phasar/PhasarLLVM/AnalysisStrategy/IRSnapshot.h"
+
+using namespace std;
+using namespace psr;
+
+namespace psr {
+
+namespace {
+
+std::string md5(llvm::StringRef Data) {
+  llvm::MD5 Hash;
+  Hash.update(Data);
+  llvm::MD5::MD5Result Result;
+  Hash.final(Result);
+  return std::string(Result.digest().str());
+}
+
+class FunctionPrinter {
+public:
+  explicit FunctionPrinter(const llvm::Function *F) : F(F), OS(Buffer) {
+    unsigned Idx = 0;
+    for (const auto &BB : *F) {
+      BlockIndices[&BB] = Idx++;
+    }
+    Idx = 0;
+    for (const auto &I : llvm::instructions(F)) {
+      InstructionIndices[&I] = Idx++;
+    }
+  }
+
+  std::string print() {
+    F->getFunctionType()->print(OS);
+    OS << ' ' << F->getName() << '\n';
+    for (const auto &BB : *F) {
+      OS << "bb" << BlockIndices[&BB] << ":\n";
+      for (const auto &I : BB) {
+        printInstruction(I);
+      }
+    }
+    return OS.str();
+  }
+
+private:
+  const llvm::Function *F;
+  std::string Buffer;
+  llvm::raw_string_ostream OS;
+  std::unordered_map<const llvm::BasicBlock *, unsigned> BlockIndices;
+  std::unordered_map<const llvm::Instruction *, unsigned> InstructionIndices;
+
+  void printInstruction(const llvm::Instruction &I) {
+    OS << I.getOpcodeName() << ' ';
+    I.getType()->print(OS);
+    if (const auto *Cmp = llvm::dyn_cast<llvm::CmpInst>(&I)) {
+      OS << " pred" << Cmp->getPredicate();
+    } else if (const auto *Alloca = llvm::dyn_cast<llvm::AllocaInst>(&I)) {
+      OS << ' ';
+      Alloca->getAllocatedType()->print(OS);
+    } else if (const auto *Phi = llvm::dyn_cast<llvm::PHINode>(&I)) {
+      for (const auto *BB : Phi->blocks()) {
+        OS << " bb" << BlockIndices[BB];
+      }
+    }
+    for (const auto &Op : I.operands()) {
+      OS << ", ";
+      printOperand(Op.get());
+    }
+    OS << '\n';
+  }
+
+  void printOperand(const llvm::Value *V) {
+    if (const auto *I = llvm::dyn_cast<llvm::Instruction>(V)) {
+      OS << '%' << InstructionIndices[I];
+    } else if (const auto *A = llvm::dyn_cast<llvm::Argument>(V)) {
+      OS << "arg" << A->getArgNo();
+    } else if (const auto *BB = llvm::dyn_cast<llvm::BasicBlock>(V)) {
+      OS << "bb" << BlockIndices[BB];
+    } else if (const auto *G = llvm::dyn_cast<llvm::GlobalValue>(V)) {
+      OS << '@' << G->getName();
+    } else if (const auto *MV = llvm::dyn_cast<llvm::MetadataAsValue>(V)) {
+      // debug information changes with unrelated edits, only local values
+      // that are wrapped into metadata matter
+      if (const auto *LV =
+              llvm::dyn_cast<llvm::LocalAsMetadata>(MV->getMetadata())) {
+        printOperand(LV->getValue());
+      } else {
+        OS << "metadata";
+      }
+    } else {
+      V->print(OS);
+    }
+  }
+};
+
+} // anonymous namespace
+
+IRSnapshot::IRSnapshot(const ProjectIRDB &IRDB)
+    : IRSnapshot(IRDB.getAllModules()) {}
+
+IRSnapshot::IRSnapshot(const std::set<llvm::Module *> &Modules) {
+  std::map<std::string, std::string> GlobalDefs;
+  for (const auto *M : Modules) {
+    this->Modules.push_back(M);
+    for (const auto &F : *M) {
+      if (F.isDeclaration()) {
+        continue;
+      }
+      std::string Key = getGlobalKey(&F);
+      Functions[Key] = &F;
+      FunctionHashes[Key] = getFunctionHash(&F);
+      auto &Insts = Instructions[&F];
+      for (const auto &I : llvm::instructions(&F)) {
+        InstructionIndices[&I] = Insts.size();
+        Insts.push_back(&I);
+      }
+    }
+    for (const auto &GV : M->globals()) {
+      if (GV.isDeclaration()) {
+        continue;
+      }
+      std::string Def;
+      llvm::raw_string_ostream OS(Def);
+      GV.getValueType()->print(OS);
+      OS << (GV.isConstant() ? " constant " : " global ");
+      GV.getInitializer()->print(OS);
+      GlobalDefs[getGlobalKey(&GV)] = OS.str();
+    }
+  }
+  std::string AllGlobals;
+  for (const auto &[Name, Def] : GlobalDefs) {
+    AllGlobals += Name + " = " + Def + '\n';
+    GlobalHashes[Name] = md5(Def);
+  }
+  GlobalsHash = md5(AllGlobals);
+}
+
+std::string IRSnapshot::getGlobalKey(const llvm::GlobalValue *G) {
+  if (G->hasLocalLinkage() && G->getParent()) {
+    return G->getParent()->getModuleIdentifier() + ':' + G->getName().str();
+  }
+  return G->getName().str();
+}
+
+std::string IRSnapshot::getFunctionHash(const llvm::Function *F) {
+  return md5(FunctionPrinter(F).print());
+}
+
+IRSnapshot::Diff
+IRSnapshot::diff(const std::map<std::string, std::string> &PreviousFunctionHashes,
+                 const std::string &PreviousGlobalsHash) const {
+  Diff D;
+  D.GlobalsChanged = PreviousGlobalsHash != GlobalsHash;
+  for (const auto &[Name, Hash] : FunctionHashes) {
+    auto Search = PreviousFunctionHashes.find(Name);
+    if (Search == PreviousFunctionHashes.end()) {
+      D.Added.insert(Name);
+    } else if (Search->second != Hash) {
+      D.Changed.insert(Name);
+    }
+  }
+  for (const auto &Entry : PreviousFunctionHashes) {
+    if (!FunctionHashes.count(Entry.first)) {
+      D.Removed.insert(Entry.first);
+    }
+  }
+  return D;
+}
+
+const llvm::Function *IRSnapshot::getFunction(const std::string &Key) const {
+  auto Search = Functions.find(Key);
+  return Search != Functions.end() ? Search->second : nullptr;
+}
+
+const llvm::Instruction *IRSnapshot::getInstruction(const llvm::Function *F,
+                                                    unsigned Idx) const {
+  auto Search = Instructions.find(F);
+  if (Search == Instructions.end() || Idx >= Search->second.size()) {
+    return nullptr;
+  }
+  return Search->second[Idx];
+}
+
+unsigned IRSnapshot::getInstructionIndex(const llvm::Instruction *I) const {
+  return InstructionIndices.at(I);
+}
+
+std::string IRSnapshot::getStableId(const llvm::Value *V) const {
+  if (const auto *I = llvm::dyn_cast<llvm::Instruction>(V)) {
+    auto Search = InstructionIndices.find(I);
+    if (Search != InstructionIndices.end()) {
+      return "i:" + std::to_string(Search->second) + ':' +
+             getGlobalKey(I->getFunction());
+    }
+  } else if (const auto *A = llvm::dyn_cast<llvm::Argument>(V)) {
+    std::string Key = getGlobalKey(A->getParent());
+    if (Functions.count(Key)) {
+      return "a:" + std::to_string(A->getArgNo()) + ':' + Key;
+    }
+  } else if (const auto *G = llvm::dyn_cast<llvm::GlobalValue>(V)) {
+    if (G->hasName() && G->getParent()) {
+      return "g:" + getGlobalKey(G);
+    }
+  } else if (llvm::isa<llvm::Constant>(V)) {
+    // constants are uniqued, hence any instruction using it identifies it
+    for (const auto *User : V->users()) {
+      const auto *I = llvm::dyn_cast<llvm::Instruction>(User);
+      if (!I || !InstructionIndices.count(I)) {
+        continue;
+      }
+      for (unsigned OpNo = 0; OpNo < I->getNumOperands(); ++OpNo) {
+        if (I->getOperand(OpNo) == V) {
+          return "o:" + std::to_string(InstructionIndices.at(I)) + '.' +
+                 std::to_string(OpNo) + ':' + getGlobalKey(I->getFunction());
+        }
+      }
+    }
+  }
+  return "";
+}
+
+const llvm::Value *IRSnapshot::getValue(const std::string &Id) const {
+  if (Id.size() < 2 || Id[1] != ':') {
+    return nullptr;
+  }
+  if (Id[0] == 'g') {
+    std::string Name = Id.substr(2);
+    // local globals are qualified by their module
+    auto Sep = Name.rfind(':');
+    if (Sep != std::string::npos) {
+      std::string ModuleId = Name.substr(0, Sep);
+      for (const auto *M : Modules) {
+        if (M->getModuleIdentifier() == ModuleId) {
+          return M->getNamedValue(Name.substr(Sep + 1));
+        }
+      }
+      return nullptr;
+    }
+    for (const auto *M : Modules) {
+      if (const auto *G = M->getNamedValue(Name)) {
+        if (!G->isDeclaration()) {
+          return G;
+        }
+      }
+    }
+    for (const auto *M : Modules) {
+      if (const auto *G = M->getNamedValue(Name)) {
+        return G;
+      }
+    }
+    return nullptr;
+  }
+  auto Sep = Id.find(':', 2);
+  if (Sep == std::string::npos) {
+    return nullptr;
+  }
+  const llvm::Function *F = getFunction(Id.substr(Sep + 1));
+  if (!F) {
+    return nullptr;
+  }
+  std::string Pos = Id.substr(2, Sep - 2);
+  try {
+    switch (Id[0]) {
+    case 'i':
+      return getInstruction(F, std::stoul(Pos));
+    case 'a': {
+      unsigned ArgNo = std::stoul(Pos);
+      if (ArgNo >= F->arg_size()) {
+        return nullptr;
+      }
+      return &*std::next(F->arg_begin(), ArgNo);
+    }
+    case 'o': {
+      auto Dot = Pos.find('.');
+      if (Dot == std::string::npos) {
+        return nullptr;
+      }
+      const auto *I = getInstruction(F, std::stoul(Pos.substr(0, Dot)));
+      unsigned OpNo = std::stoul(Pos.substr(Dot + 1));
+      if (!I || OpNo >= I->getNumOperands()) {
+        return nullptr;
+      }
+      return I->getOperand(OpNo);
+    }
+    default:
+      return nullptr;
+    }
+  } catch (const std::logic_error &) {
+    // malformed id
+    return nullptr;
+  }
+}
+
+std::string IRSnapshot::getFunctionNameOfId(const std::string &Id) {
+  if (Id.size() < 2 || Id[0] == 'g') {
+    return "";
+  }
+  auto Sep = Id.find(':', 2);
+  return Sep != std::string::npos ? Id.substr(Sep + 1) : "";
+}
+
+} // namespace psr
@@ -39,6 +39,7 @@
 #include "phasar/PhasarLLVM/ControlFlow/Resolver/RTAResolver.h"
 #include "phasar/PhasarLLVM/ControlFlow/Resolver/Resolver.h"
 
+#include "phasar/Utils/JsonWriter.h"
 #include "phasar/Utils/LLVMShorthands.h"
 #include "phasar/Utils/Logger.h"
 #include "phasar/Utils/PAMMMacros.h"
@@ -661,7 +662,29 @@ nlohmann::json LLVMBasedICFG::getAsJson() const {
 }
 
 void LLVMBasedICFG::printAsJson(std::ostream &OS) const {
-  OS << getAsJson();
+  // streams the same document as getAsJson() without building it in memory
+  JsonWriter W(OS);
+  W.beginObject();
+  W.key(PhasarConfig::JsonCallGraphID());
+  W.beginObject();
+  vertex_iterator vi_v, vi_v_end;
+  out_edge_iterator ei, ei_end;
+  for (boost::tie(vi_v, vi_v_end) = boost::vertices(CallGraph);
+       vi_v != vi_v_end; ++vi_v) {
+    W.key(CallGraph[*vi_v].getFunctionName());
+    if (boost::out_degree(*vi_v, CallGraph) == 0) {
+      W.null();
+      continue;
+    }
+    W.beginArray();
+    for (boost::tie(ei, ei_end) = boost::out_edges(*vi_v, CallGraph);
+         ei != ei_end; ++ei) {
+      W.value(CallGraph[boost::target(*ei, CallGraph)].getFunctionName());
+    }
+    W.endArray();
+  }
+  W.endObject();
+  W.endObject();
 }
 
 const PointsToGraph &LLVMBasedICFG::getWholeModulePTG() const {
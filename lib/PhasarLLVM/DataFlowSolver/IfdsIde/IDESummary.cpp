@@ -0,0 +1,36 @@
+/******************************************************************************
+ * Copyright (c) 2017 Philipp Schubert.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Philipp Schubert and others
+ *****************************************************************************/
+
+#include <utility>
+
+#include "phasar/PhasarLLVM/DataFlowSolver/IfdsIde/IDESummary.h"
+
+using namespace std;
+using namespace psr;
+
+namespace psr {
+
+IDESummary::IDESummary(std::string FunctionName, const nlohmann::json &J)
+    : FunctionName(std::move(FunctionName)),
+      Hash(J.at("hash").get<std::string>()),
+      Callees(J.at("callees").get<std::set<std::string>>()),
+      Contexts(J.at("contexts")) {
+  if (J.contains("declarations")) {
+    Declarations = J["declarations"].get<std::set<std::string>>();
+  }
+}
+
+nlohmann::json IDESummary::getAsJson() const {
+  return {{"hash", Hash},
+          {"callees", Callees},
+          {"declarations", Declarations},
+          {"contexts", Contexts}};
+}
+
+} // namespace psr
@@ -25,7 +25,7 @@ BranchSwitchInstFlowFunction::computeTargetsExt(ExtendedValue &fact) {
   if (condition) {
     bool isConditionTainted =
         DataFlowUtils::isValueTainted(condition, fact) ||
-        DataFlowUtils::isMemoryLocationTainted(condition, fact);
+        DataFlowUtils::isMemoryLocationTainted(condition, fact, typeCache);
 
     if (isConditionTainted) {
       const auto startBasicBlock = currentInst->getParent();
@@ -40,7 +40,7 @@ BranchSwitchInstFlowFunction::computeTargetsExt(ExtendedValue &fact) {
 
       LOG_DEBUG("End of block label: " << endBasicBlockLabel);
 
-      ExtendedValue ev(currentInst);
+      ExtendedValue ev(zeroValue.getInternTable(), currentInst);
       ev.setEndOfTaintedBlockLabel(endBasicBlockLabel);
 
       traceStats.add(currentInst);
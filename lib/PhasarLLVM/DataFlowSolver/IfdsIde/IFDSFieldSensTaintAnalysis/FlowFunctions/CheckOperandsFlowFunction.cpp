@@ -13,12 +13,12 @@ CheckOperandsFlowFunction::computeTargetsExt(ExtendedValue &fact) {
 
     bool isOperandTainted =
         DataFlowUtils::isValueTainted(operand, fact) ||
-        DataFlowUtils::isMemoryLocationTainted(operand, fact);
+        DataFlowUtils::isMemoryLocationTainted(operand, fact, typeCache);
 
     if (isOperandTainted) {
       traceStats.add(currentInst);
 
-      return {fact, ExtendedValue(currentInst)};
+      return {fact, ExtendedValue(zeroValue.getInternTable(), currentInst)};
     }
   }
 
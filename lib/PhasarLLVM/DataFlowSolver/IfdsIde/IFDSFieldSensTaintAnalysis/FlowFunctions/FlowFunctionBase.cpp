@@ -9,7 +9,8 @@
 namespace psr {
 
 std::set<ExtendedValue> FlowFunctionBase::computeTargets(ExtendedValue fact) {
-  bool isAutoIdentity = DataFlowUtils::isAutoIdentity(currentInst, fact);
+  bool isAutoIdentity =
+      DataFlowUtils::isAutoIdentity(currentInst, fact, typeCache);
   if (isAutoIdentity)
     return {fact};
 
@@ -28,7 +29,7 @@ std::set<ExtendedValue> FlowFunctionBase::computeTargets(ExtendedValue fact) {
     if (isAutoGEN) {
       traceStats.add(currentInst);
 
-      return {fact, ExtendedValue(currentInst)};
+      return {fact, ExtendedValue(zeroValue.getInternTable(), currentInst)};
     }
 
     std::set<ExtendedValue> targetFacts;
@@ -54,9 +55,9 @@ std::set<ExtendedValue> FlowFunctionBase::computeTargets(ExtendedValue fact) {
     if (const auto storeInst = llvm::dyn_cast<llvm::StoreInst>(currentInst)) {
       const auto dstMemLocationSeq =
           DataFlowUtils::getMemoryLocationSeqFromMatr(
-              storeInst->getPointerOperand());
+              storeInst->getPointerOperand(), typeCache);
 
-      ExtendedValue ev(currentInst);
+      ExtendedValue ev(zeroValue.getInternTable(), currentInst);
       ev.setMemLocationSeq(dstMemLocationSeq);
 
       targetFacts.insert(ev);
@@ -65,9 +66,9 @@ std::set<ExtendedValue> FlowFunctionBase::computeTargets(ExtendedValue fact) {
                    llvm::dyn_cast<llvm::MemTransferInst>(currentInst)) {
       const auto dstMemLocationSeq =
           DataFlowUtils::getMemoryLocationSeqFromMatr(
-              memTransferInst->getRawDest());
+              memTransferInst->getRawDest(), typeCache);
 
-      ExtendedValue ev(currentInst);
+      ExtendedValue ev(zeroValue.getInternTable(), currentInst);
       ev.setMemLocationSeq(dstMemLocationSeq);
 
       targetFacts.insert(ev);
@@ -21,7 +21,7 @@ GEPInstFlowFunction::computeTargetsExt(ExtendedValue &fact) {
         gepInst->getName().contains_lower("overflow_arg_area.next");
     if (incrementCurrentVarArgIndex) {
       const auto gepVaListMemLocationSeq =
-          DataFlowUtils::getMemoryLocationSeqFromMatr(gepInstPtr);
+          DataFlowUtils::getMemoryLocationSeqFromMatr(gepInstPtr, typeCache);
 
       bool isVaListEqual = DataFlowUtils::isSubsetMemoryLocationSeq(
           DataFlowUtils::getVaListMemoryLocationSeqFromFact(fact),
@@ -36,7 +36,7 @@ GEPInstFlowFunction::computeTargetsExt(ExtendedValue &fact) {
   } else {
     bool isPtrTainted = DataFlowUtils::isValueTainted(gepInstPtr, fact);
     if (isPtrTainted)
-      return {fact, ExtendedValue(gepInst)};
+      return {fact, ExtendedValue(zeroValue.getInternTable(), gepInst)};
   }
 
   return {fact};
@@ -11,7 +11,7 @@ GenerateFlowFunction::computeTargetsExt(ExtendedValue &fact) {
   traceStats.add(currentInst);
 
   if (fact == zeroValue)
-    return {ExtendedValue(currentInst)};
+    return {ExtendedValue(zeroValue.getInternTable(), currentInst)};
 
   return {fact};
 }
@@ -27,8 +27,8 @@ MapTaintedValuesToCaller::computeTargets(ExtendedValue fact) {
   if (!retValMemLocationMatr)
     return targetGlobalFacts;
 
-  auto retValMemLocationSeq =
-      DataFlowUtils::getMemoryLocationSeqFromMatr(retValMemLocationMatr);
+  auto retValMemLocationSeq = DataFlowUtils::getMemoryLocationSeqFromMatr(
+      retValMemLocationMatr, typeCache);
 
   bool isRetValMemLocation = !retValMemLocationSeq.empty();
   if (isRetValMemLocation) {
@@ -56,7 +56,7 @@ MapTaintedValuesToCaller::computeTargets(ExtendedValue fact) {
        * a memory address). We then land in the else branch below and need to
        * find the call instance (see test case 230-function-ptr-2).
        */
-      ExtendedValue ev(callInst);
+      ExtendedValue ev(zeroValue.getInternTable(), callInst);
       ev.setMemLocationSeq(patchableMemLocationSeq);
 
       targetRetFacts.insert(ev);
@@ -72,7 +72,7 @@ MapTaintedValuesToCaller::computeTargets(ExtendedValue fact) {
     if (genFact) {
       std::vector<const llvm::Value *> patchablePart{callInst};
 
-      ExtendedValue ev(callInst);
+      ExtendedValue ev(zeroValue.getInternTable(), callInst);
       ev.setMemLocationSeq(patchablePart);
 
       targetRetFacts.insert(ev);
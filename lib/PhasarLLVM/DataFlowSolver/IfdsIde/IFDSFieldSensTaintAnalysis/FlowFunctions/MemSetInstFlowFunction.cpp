@@ -13,8 +13,8 @@ MemSetInstFlowFunction::computeTargetsExt(ExtendedValue &fact) {
   const auto memSetInst = llvm::cast<const llvm::MemSetInst>(currentInst);
   const auto dstMemLocationMatr = memSetInst->getRawDest();
 
-  bool killFact =
-      DataFlowUtils::isMemoryLocationTainted(dstMemLocationMatr, fact);
+  bool killFact = DataFlowUtils::isMemoryLocationTainted(
+      dstMemLocationMatr, fact, typeCache);
   if (killFact) {
     traceStats.add(memSetInst);
 
@@ -18,13 +18,13 @@ MemTransferInstFlowFunction::computeTargetsExt(ExtendedValue &fact) {
 
   const auto factMemLocationSeq =
       DataFlowUtils::getMemoryLocationSeqFromFact(fact);
-  auto srcMemLocationSeq =
-      DataFlowUtils::getMemoryLocationSeqFromMatr(srcMemLocationMatr);
-  auto dstMemLocationSeq =
-      DataFlowUtils::getMemoryLocationSeqFromMatr(dstMemLocationMatr);
+  auto srcMemLocationSeq = DataFlowUtils::getMemoryLocationSeqFromMatr(
+      srcMemLocationMatr, typeCache);
+  auto dstMemLocationSeq = DataFlowUtils::getMemoryLocationSeqFromMatr(
+      dstMemLocationMatr, typeCache);
 
   bool isArgumentPatch = DataFlowUtils::isPatchableArgumentMemcpy(
-      memTransferInst->getRawSource(), srcMemLocationSeq, fact);
+      memTransferInst->getRawSource(), srcMemLocationSeq, fact, typeCache);
   std::set<ExtendedValue> targetFacts;
 
   /*
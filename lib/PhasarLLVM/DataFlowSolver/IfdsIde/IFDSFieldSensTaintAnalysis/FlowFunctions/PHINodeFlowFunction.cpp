@@ -15,12 +15,12 @@ PHINodeFlowFunction::computeTargetsExt(ExtendedValue &fact) {
 
     bool isIncomingValueTainted =
         DataFlowUtils::isValueTainted(incomingValue, fact) ||
-        DataFlowUtils::isMemoryLocationTainted(incomingValue, fact);
+        DataFlowUtils::isMemoryLocationTainted(incomingValue, fact, typeCache);
 
     if (isIncomingValueTainted) {
       traceStats.add(phiNodeInst);
 
-      return {fact, ExtendedValue(phiNodeInst)};
+      return {fact, ExtendedValue(zeroValue.getInternTable(), phiNodeInst)};
     }
   }
 
@@ -14,7 +14,8 @@ ReturnInstFlowFunction::computeTargetsExt(ExtendedValue &fact) {
   if (retValMemLocationMatr) {
     bool isRetValTainted =
         DataFlowUtils::isValueTainted(retValMemLocationMatr, fact) ||
-        DataFlowUtils::isMemoryLocationTainted(retValMemLocationMatr, fact);
+        DataFlowUtils::isMemoryLocationTainted(retValMemLocationMatr, fact,
+                                               typeCache);
 
     /*
      * We don't need to GEN/KILL any facts here as this is all handled
@@ -15,13 +15,13 @@ StoreInstFlowFunction::computeTargetsExt(ExtendedValue &fact) {
 
   const auto factMemLocationSeq =
       DataFlowUtils::getMemoryLocationSeqFromFact(fact);
-  auto srcMemLocationSeq =
-      DataFlowUtils::getMemoryLocationSeqFromMatr(srcMemLocationMatr);
-  auto dstMemLocationSeq =
-      DataFlowUtils::getMemoryLocationSeqFromMatr(dstMemLocationMatr);
+  auto srcMemLocationSeq = DataFlowUtils::getMemoryLocationSeqFromMatr(
+      srcMemLocationMatr, typeCache);
+  auto dstMemLocationSeq = DataFlowUtils::getMemoryLocationSeqFromMatr(
+      dstMemLocationMatr, typeCache);
 
-  bool isArgumentPatch =
-      DataFlowUtils::isPatchableArgumentStore(srcMemLocationMatr, fact);
+  bool isArgumentPatch = DataFlowUtils::isPatchableArgumentStore(
+      srcMemLocationMatr, fact, typeCache);
   bool isVaListArgumentPatch =
       DataFlowUtils::isPatchableVaListArgument(srcMemLocationMatr, fact);
 
@@ -158,7 +158,7 @@ StoreInstFlowFunction::computeTargetsExt(ExtendedValue &fact) {
                     DataFlowUtils::isKillAfterStoreFact(fact);
 
     if (genFact) {
-      ExtendedValue ev(storeInst);
+      ExtendedValue ev(zeroValue.getInternTable(), storeInst);
       ev.setMemLocationSeq(dstMemLocationSeq);
 
       targetFacts.insert(ev);
@@ -17,8 +17,8 @@ VAEndInstFlowFunction::computeTargetsExt(ExtendedValue &fact) {
   const auto vaEndInst = llvm::cast<llvm::VAEndInst>(currentInst);
   const auto vaEndMemLocationMatr = vaEndInst->getArgList();
 
-  auto vaEndMemLocationSeq =
-      DataFlowUtils::getMemoryLocationSeqFromMatr(vaEndMemLocationMatr);
+  auto vaEndMemLocationSeq = DataFlowUtils::getMemoryLocationSeqFromMatr(
+      vaEndMemLocationMatr, typeCache);
 
   bool isValidMemLocationSeq = !vaEndMemLocationSeq.empty();
   if (isValidMemLocationSeq) {
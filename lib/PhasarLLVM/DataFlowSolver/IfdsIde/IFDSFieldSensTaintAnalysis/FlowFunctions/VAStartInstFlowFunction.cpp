@@ -20,8 +20,8 @@ VAStartInstFlowFunction::computeTargetsExt(ExtendedValue &fact) {
   const auto vaStartInst = llvm::cast<llvm::VAStartInst>(currentInst);
   const auto vaListMemLocationMatr = vaStartInst->getArgList();
 
-  auto vaListMemLocationSeq =
-      DataFlowUtils::getMemoryLocationSeqFromMatr(vaListMemLocationMatr);
+  auto vaListMemLocationSeq = DataFlowUtils::getMemoryLocationSeqFromMatr(
+      vaListMemLocationMatr, typeCache);
 
   bool isValidMemLocationSeq = !vaListMemLocationSeq.empty();
   if (isValidMemLocationSeq) {
@@ -31,12 +31,48 @@ static const llvm::Value *POISON_PILL = reinterpret_cast<const llvm::Value *>(
 static const std::vector<const llvm::Value *> EMPTY_SEQ;
 static const std::set<std::string> EMPTY_STRING_SET;
 
-static const std::string getTypeName(const llvm::Type *type) {
-  std::string typeName;
-  llvm::raw_string_ostream typeRawOutputStream(typeName);
-  type->print(typeRawOutputStream);
+/*
+ * Checks the names that show up in the textual representation of a type
+ * without printing it: identified structs are printed by name, all other
+ * types together with their contained types.
+ */
+static unsigned classifyTypeNames(const llvm::Type *type) {
+  if (const auto structType = llvm::dyn_cast<llvm::StructType>(type)) {
+    if (!structType->isLiteral()) {
+      const auto structName = structType->getName();
+      unsigned flags = 0;
+      if (structName.startswith("struct.__va_list_tag"))
+        flags |= DataFlowUtils::VA_LIST_TYPE;
+      if (structName.find("union") != llvm::StringRef::npos)
+        flags |= DataFlowUtils::UNION_TYPE;
+
+      return flags;
+    }
+  }
+
+  unsigned flags = 0;
+  for (const auto subType : type->subtypes())
+    flags |= classifyTypeNames(subType);
+
+  return flags;
+}
+
+unsigned DataFlowUtils::classifyType(const llvm::Type *type) {
+  unsigned flags = classifyTypeNames(type);
+  // Only the magic type itself is printed as "i4711"
+  if (type->isIntegerTy(4711))
+    flags |= MAGIC_RETURN_TYPE;
 
-  return typeRawOutputStream.str();
+  return flags;
+}
+
+unsigned DataFlowUtils::getTypeFlags(const llvm::Type *type,
+                                     TypeCache &typeCache) {
+  auto [typeFlagsIt, isNewType] = typeCache.try_emplace(type, 0);
+  if (isNewType)
+    typeFlagsIt->second = classifyType(type);
+
+  return typeFlagsIt->second;
 }
 
 static bool isMemoryLocationFrame(const llvm::Value *memLocationPart) {
@@ -170,17 +206,18 @@ static bool isFirstNMemoryLocationPartsEqual(
   return true;
 }
 
-static bool isUnionBitCast(const llvm::CastInst *castInst) {
+static bool isUnionBitCast(const llvm::CastInst *castInst,
+                           DataFlowUtils::TypeCache &typeCache) {
   if (const auto bitCastInst = llvm::dyn_cast<llvm::BitCastInst>(castInst)) {
-    const auto typeName = getTypeName(bitCastInst->getSrcTy());
-
-    return typeName.find("union") != std::string::npos;
+    return DataFlowUtils::getTypeFlags(bitCastInst->getSrcTy(), typeCache) &
+           DataFlowUtils::UNION_TYPE;
   }
   return false;
 }
 
 static std::vector<const llvm::Value *>
-getMemoryLocationSeqFromMatrRec(const llvm::Value *memLocationPart) {
+getMemoryLocationSeqFromMatrRec(const llvm::Value *memLocationPart,
+                                DataFlowUtils::TypeCache &typeCache) {
   // Globals
   if (const auto constExpr =
           llvm::dyn_cast<llvm::ConstantExpr>(memLocationPart)) {
@@ -198,20 +235,21 @@ getMemoryLocationSeqFromMatrRec(const llvm::Value *memLocationPart) {
   }
 
   if (const auto castInst = llvm::dyn_cast<llvm::CastInst>(memLocationPart)) {
-    memLocationSeq = getMemoryLocationSeqFromMatrRec(castInst->getOperand(0));
+    memLocationSeq =
+        getMemoryLocationSeqFromMatrRec(castInst->getOperand(0), typeCache);
 
-    bool poisonSeq = isUnionBitCast(castInst);
+    bool poisonSeq = isUnionBitCast(castInst, typeCache);
     if (!poisonSeq)
       return memLocationSeq;
 
     // FALLTHROUGH
   } else if (const auto loadInst =
                  llvm::dyn_cast<llvm::LoadInst>(memLocationPart)) {
-    return getMemoryLocationSeqFromMatrRec(loadInst->getOperand(0));
+    return getMemoryLocationSeqFromMatrRec(loadInst->getOperand(0), typeCache);
   } else if (const auto gepInst =
                  llvm::dyn_cast<llvm::GetElementPtrInst>(memLocationPart)) {
-    memLocationSeq =
-        getMemoryLocationSeqFromMatrRec(gepInst->getPointerOperand());
+    memLocationSeq = getMemoryLocationSeqFromMatrRec(
+        gepInst->getPointerOperand(), typeCache);
 
     bool isSeqPoisoned =
         !memLocationSeq.empty() && memLocationSeq.back() == POISON_PILL;
@@ -299,10 +337,10 @@ normalizeMemoryLocationSeq(std::vector<const llvm::Value *> memLocationSeq) {
 }
 
 const std::vector<const llvm::Value *>
-DataFlowUtils::getMemoryLocationSeqFromMatr(
-    const llvm::Value *memLocationMatr) {
+DataFlowUtils::getMemoryLocationSeqFromMatr(const llvm::Value *memLocationMatr,
+                                            TypeCache &typeCache) {
   auto memLocationSeq = normalizeMemoryLocationSeq(
-      getMemoryLocationSeqFromMatrRec(memLocationMatr));
+      getMemoryLocationSeqFromMatrRec(memLocationMatr, typeCache));
 
   assert(memLocationSeq.empty() ||
          isMemoryLocationFrame(memLocationSeq.front()));
@@ -343,9 +381,10 @@ getVaListMemoryLocationFrameFromFact(const ExtendedValue &vaListFact) {
 }
 
 static const llvm::Value *
-getMemoryLocationFrameFromMatr(const llvm::Value *memLocationMatr) {
+getMemoryLocationFrameFromMatr(const llvm::Value *memLocationMatr,
+                               DataFlowUtils::TypeCache &typeCache) {
   const auto memLocationSeq =
-      DataFlowUtils::getMemoryLocationSeqFromMatr(memLocationMatr);
+      DataFlowUtils::getMemoryLocationSeqFromMatr(memLocationMatr, typeCache);
   if (memLocationSeq.empty())
     return nullptr;
 
@@ -358,8 +397,10 @@ bool DataFlowUtils::isValueTainted(const llvm::Value *currentInst,
 }
 
 bool DataFlowUtils::isMemoryLocationTainted(const llvm::Value *memLocationMatr,
-                                            const ExtendedValue &fact) {
-  auto memLocationInstSeq = getMemoryLocationSeqFromMatr(memLocationMatr);
+                                            const ExtendedValue &fact,
+                                            TypeCache &typeCache) {
+  auto memLocationInstSeq =
+      getMemoryLocationSeqFromMatr(memLocationMatr, typeCache);
   if (memLocationInstSeq.empty())
     return false;
 
@@ -438,7 +479,8 @@ const std::vector<const llvm::Value *> DataFlowUtils::joinMemoryLocationSeqs(
 }
 
 const std::vector<const llvm::Value *>
-getVaListMemoryLocationSeq(const llvm::Value *value) {
+getVaListMemoryLocationSeq(const llvm::Value *value,
+                           DataFlowUtils::TypeCache &typeCache) {
   if (const auto phiNodeInst = llvm::dyn_cast<llvm::PHINode>(value)) {
     const auto phiNodeName = phiNodeInst->getName();
     bool isVarArgAddr = phiNodeName.contains_lower("vaarg.addr");
@@ -454,7 +496,8 @@ getVaListMemoryLocationSeq(const llvm::Value *value) {
       const auto vaListMemLocationMatr =
           phiNodeInst->getIncomingValueForBlock(block);
       const auto vaListMemLocationSeq =
-          DataFlowUtils::getMemoryLocationSeqFromMatr(vaListMemLocationMatr);
+          DataFlowUtils::getMemoryLocationSeqFromMatr(vaListMemLocationMatr,
+                                                      typeCache);
 
       bool isValidMemLocation = !vaListMemLocationSeq.empty();
       if (!isValidMemLocation)
@@ -492,7 +535,8 @@ static bool isArgumentEqual(const llvm::Value *srcValue,
 }
 
 bool DataFlowUtils::isPatchableArgumentStore(const llvm::Value *srcValue,
-                                             const ExtendedValue &fact) {
+                                             const ExtendedValue &fact,
+                                             TypeCache &typeCache) {
   bool isVarArgFact = fact.isVarArg();
 
   bool isArgEqual = isArgumentEqual(srcValue, fact, isVarArgFact);
@@ -511,7 +555,7 @@ bool DataFlowUtils::isPatchableArgumentStore(const llvm::Value *srcValue,
       const auto pointerOperand = loadInst->getPointerOperand();
 
       const auto vaListMemLocationSeq =
-          getVaListMemoryLocationSeq(pointerOperand);
+          getVaListMemoryLocationSeq(pointerOperand, typeCache);
       bool isValidMemLocation = !vaListMemLocationSeq.empty();
       if (!isValidMemLocation)
         return false;
@@ -535,7 +579,7 @@ bool DataFlowUtils::isPatchableVaListArgument(const llvm::Value *srcValue,
 bool DataFlowUtils::isPatchableArgumentMemcpy(
     const llvm::Value *srcValue,
     const std::vector<const llvm::Value *> srcMemLocationSeq,
-    const ExtendedValue &fact) {
+    const ExtendedValue &fact, TypeCache &typeCache) {
   bool isVarArgFact = fact.isVarArg();
   if (!isVarArgFact)
     return false;
@@ -554,7 +598,7 @@ bool DataFlowUtils::isPatchableArgumentMemcpy(
     const auto pointerOperand = bitCastInst->getOperand(0);
 
     const auto vaListMemLocationSeq =
-        getVaListMemoryLocationSeq(pointerOperand);
+        getVaListMemoryLocationSeq(pointerOperand, typeCache);
     bool isValidMemLocation = !vaListMemLocationSeq.empty();
     if (!isValidMemLocation)
       return false;
@@ -693,7 +737,8 @@ const std::vector<
                const llvm::Value *>>
 DataFlowUtils::getSanitizedArgList(const llvm::CallInst *callInst,
                                    const llvm::Function *destFun,
-                                   const llvm::Value *zeroValue) {
+                                   const llvm::Value *zeroValue,
+                                   TypeCache &typeCache) {
   std::vector<
       std::tuple<const llvm::Value *, const std::vector<const llvm::Value *>,
                  const llvm::Value *>>
@@ -703,7 +748,8 @@ DataFlowUtils::getSanitizedArgList(const llvm::CallInst *callInst,
     const auto arg = callInst->getOperand(i);
     const auto param = getNthFunctionArgument(destFun, i);
 
-    auto argMemLocationSeq = DataFlowUtils::getMemoryLocationSeqFromMatr(arg);
+    auto argMemLocationSeq =
+        DataFlowUtils::getMemoryLocationSeqFromMatr(arg, typeCache);
 
     long numCoersedArgs = getNumCoercedArgs(arg);
     bool isCoersedArg = numCoersedArgs > 0;
@@ -818,7 +864,8 @@ bool DataFlowUtils::isCheckOperandsInst(const llvm::Instruction *currentInst) {
 }
 
 bool DataFlowUtils::isAutoIdentity(const llvm::Instruction *currentInst,
-                                   const ExtendedValue &fact) {
+                                   const ExtendedValue &fact,
+                                   TypeCache &typeCache) {
   bool isVarArgTemplate = fact.isVarArgTemplate();
   if (isVarArgTemplate) {
 
@@ -837,7 +884,7 @@ bool DataFlowUtils::isAutoIdentity(const llvm::Instruction *currentInst,
   if (const auto storeInst = llvm::dyn_cast<llvm::StoreInst>(currentInst)) {
     const auto srcMemLocationMatr = storeInst->getValueOperand();
     const auto srcMemLocationFrame =
-        getMemoryLocationFrameFromMatr(srcMemLocationMatr);
+        getMemoryLocationFrameFromMatr(srcMemLocationMatr, typeCache);
 
     bool isArgumentPatch =
         llvm::isa_and_nonnull<llvm::Argument>(srcMemLocationFrame);
@@ -846,13 +893,14 @@ bool DataFlowUtils::isAutoIdentity(const llvm::Instruction *currentInst,
 
     const auto dstMemLocationMatr = storeInst->getPointerOperand();
     const auto dstMemLocationSeq =
-        getMemoryLocationSeqFromMatr(dstMemLocationMatr);
+        getMemoryLocationSeqFromMatr(dstMemLocationMatr, typeCache);
 
     bool isDstMemLocation = !dstMemLocationSeq.empty();
     if (isDstMemLocation) {
       const auto memLocationFrameType = dstMemLocationSeq.front()->getType();
 
-      bool isMemLocationFrameTypeVaList = isVaListType(memLocationFrameType);
+      bool isMemLocationFrameTypeVaList =
+          isVaListType(memLocationFrameType, typeCache);
       if (isMemLocationFrameTypeVaList)
         return true;
     }
@@ -866,14 +914,13 @@ bool DataFlowUtils::isVarArgParam(const llvm::Value *param,
   return param == zeroValue;
 }
 
-bool DataFlowUtils::isVaListType(const llvm::Type *type) {
-  const auto typeName = getTypeName(type);
-
-  return typeName.find("%struct.__va_list_tag") != std::string::npos;
+bool DataFlowUtils::isVaListType(const llvm::Type *type, TypeCache &typeCache) {
+  return getTypeFlags(type, typeCache) & VA_LIST_TYPE;
 }
 
 bool DataFlowUtils::isReturnValue(const llvm::Instruction *currentInst,
-                                  const llvm::Instruction *successorInst) {
+                                  const llvm::Instruction *successorInst,
+                                  TypeCache &typeCache) {
   bool isSuccessorRetVal = llvm::isa<llvm::ReturnInst>(successorInst);
   if (!isSuccessorRetVal)
     return false;
@@ -884,7 +931,8 @@ bool DataFlowUtils::isReturnValue(const llvm::Instruction *currentInst,
     if (!isMagicOpCode)
       return false;
 
-    bool isMagicType = getTypeName(binaryOpInst->getType()) == "i4711";
+    bool isMagicType =
+        getTypeFlags(binaryOpInst->getType(), typeCache) & MAGIC_RETURN_TYPE;
     if (!isMagicType)
       return false;
 
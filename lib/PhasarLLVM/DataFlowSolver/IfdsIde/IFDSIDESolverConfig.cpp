@@ -30,7 +30,10 @@ ostream &operator<<(ostream &os, const IFDSIDESolverConfig &sc) {
             << "\tautoAddZero: " << sc.autoAddZero << "\n"
             << "\tcomputeValues: " << sc.computeValues << "\n"
             << "\trecordEdges: " << sc.recordEdges << "\n"
-            << "\tcomputePersistedSummaries: " << sc.computePersistedSummaries;
+            << "\tcomputePersistedSummaries: " << sc.computePersistedSummaries
+            << "\n"
+            << "\ttraceFile: " << sc.traceFile << "\n"
+            << "\ttraceSampleRate: " << sc.traceSampleRate;
 }
 
 } // namespace psr
@@ -0,0 +1,76 @@
+/******************************************************************************
+ * Copyright (c) 2020 Philipp Schubert.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Philipp Schubert and others
+ *****************************************************************************/
+
+#include "llvm/IR/CallSite.h"
+#include "llvm/IR/Instruction.h"
+#include "llvm/IR/Module.h"
+#include "llvm/IR/Value.h"
+
+#include "phasar/PhasarLLVM/DataFlowSolver/IfdsIde/LLVMFlowFunctions/LibrarySummaryFlow.h"
+#include "phasar/PhasarLLVM/DataFlowSolver/IfdsIde/LLVMZeroValue.h"
+
+using namespace psr;
+
+namespace psr {
+
+namespace {
+
+// Returns the value a location refers to at the given call site or nullptr
+// if the call site has no such value.
+const llvm::Value *resolve(llvm::ImmutableCallSite CS,
+                           const LibrarySummaries::Location &L) {
+  using Kind = LibrarySummaries::Location::Kind;
+  switch (L.K) {
+  case Kind::Arg:
+    return L.ArgNo < CS.getNumArgOperands() ? CS.getArgOperand(L.ArgNo)
+                                            : nullptr;
+  case Kind::Return:
+    return CS.getType()->isVoidTy() ? nullptr : CS.getInstruction();
+  case Kind::Global:
+    return CS.getInstruction()->getModule()->getNamedValue(L.Global);
+  default:
+    return nullptr;
+  }
+}
+
+} // anonymous namespace
+
+LibrarySummaryFlow::LibrarySummaryFlow(
+    const llvm::Instruction *CallSite,
+    const LibrarySummaries::Summary &Summary) {
+  llvm::ImmutableCallSite CS(CallSite);
+  for (const auto &Flow : Summary) {
+    const llvm::Value *From = resolve(CS, Flow.From);
+    if (!From && Flow.From.K != LibrarySummaries::Location::Kind::Zero) {
+      continue;
+    }
+    auto &Targets = From ? Flows[From] : ZeroFlows;
+    for (const auto &To : Flow.To) {
+      if (const auto *Target = resolve(CS, To)) {
+        Targets.insert(Target);
+      }
+    }
+  }
+}
+
+std::set<const llvm::Value *>
+LibrarySummaryFlow::computeTargets(const llvm::Value *Source) {
+  std::set<const llvm::Value *> Targets = {Source};
+  if (LLVMZeroValue::getInstance()->isLLVMZeroValue(Source)) {
+    Targets.insert(ZeroFlows.begin(), ZeroFlows.end());
+    return Targets;
+  }
+  auto Search = Flows.find(Source);
+  if (Search != Flows.end()) {
+    Targets.insert(Search->second.begin(), Search->second.end());
+  }
+  return Targets;
+}
+
+} // namespace psr
@@ -0,0 +1,103 @@
+/******************************************************************************
+ * Copyright (c) 2019 Philipp Schubert.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Philipp Schubert and others
+ *****************************************************************************/
+
+#include <stdexcept>
+
+#include "llvm/IR/Function.h"
+
+#include "phasar/PhasarLLVM/DataFlowSolver/IfdsIde/LibrarySummaries.h"
+#include "phasar/Utils/IO.h"
+#include "phasar/Utils/Utilities.h"
+
+using namespace std;
+using namespace psr;
+
+namespace psr {
+
+LibrarySummaries::LibrarySummaries(const nlohmann::json &J) {
+  try {
+    if (J.at("Version").get<unsigned>() != FormatVersion) {
+      throw std::runtime_error("unsupported library summary version");
+    }
+    for (const auto &[Name, JFunction] : J.at("Functions").items()) {
+      Summary &S = Summaries[Name];
+      for (const auto &JFlow : JFunction.at("Flows")) {
+        Flow F{parseLocation(JFlow.at("From").get<std::string>()), {}};
+        for (const auto &JTo : JFlow.at("To")) {
+          F.To.push_back(parseLocation(JTo.get<std::string>()));
+          if (F.To.back().K == Location::Kind::Zero) {
+            throw std::runtime_error("Zero is no valid flow target in " +
+                                     Name);
+          }
+        }
+        S.push_back(std::move(F));
+      }
+    }
+  } catch (const nlohmann::json::exception &E) {
+    throw std::runtime_error(std::string("malformed library summaries: ") +
+                             E.what());
+  }
+}
+
+LibrarySummaries LibrarySummaries::loadFromFile(const std::string &Path) {
+  nlohmann::json J;
+  try {
+    J = nlohmann::json::parse(readFile(Path));
+  } catch (const nlohmann::json::parse_error &E) {
+    throw std::runtime_error(Path + " is malformed: " + E.what());
+  }
+  return LibrarySummaries(J);
+}
+
+LibrarySummaries::Location
+LibrarySummaries::parseLocation(const std::string &Str) {
+  const std::string ArgPrefix = "Arg";
+  const std::string GlobalPrefix = "Global:";
+  if (Str == "Zero") {
+    return {Location::Kind::Zero};
+  }
+  if (Str == "Return") {
+    return {Location::Kind::Return};
+  }
+  if (Str.compare(0, GlobalPrefix.size(), GlobalPrefix) == 0 &&
+      Str.size() > GlobalPrefix.size()) {
+    return {Location::Kind::Global, 0, Str.substr(GlobalPrefix.size())};
+  }
+  if (Str.compare(0, ArgPrefix.size(), ArgPrefix) == 0 &&
+      Str.size() > ArgPrefix.size() &&
+      Str.find_first_not_of("0123456789", ArgPrefix.size()) ==
+          std::string::npos) {
+    return {Location::Kind::Arg,
+            static_cast<unsigned>(std::stoul(Str.substr(ArgPrefix.size())))};
+  }
+  throw std::runtime_error("invalid location in library summary: " + Str);
+}
+
+const LibrarySummaries::Summary *
+LibrarySummaries::getSummary(const llvm::Function *F) const {
+  std::string Name = F->getName().str();
+  if (const auto *S = getSummary(Name)) {
+    return S;
+  }
+  return getSummary(cxx_demangle(Name));
+}
+
+const LibrarySummaries::Summary *
+LibrarySummaries::getSummary(const std::string &FunctionName) const {
+  auto Search = Summaries.find(FunctionName);
+  return Search != Summaries.end() ? &Search->second : nullptr;
+}
+
+void LibrarySummaries::merge(const LibrarySummaries &Other) {
+  for (const auto &[Name, S] : Other.Summaries) {
+    Summaries[Name] = S;
+  }
+}
+
+} // namespace psr
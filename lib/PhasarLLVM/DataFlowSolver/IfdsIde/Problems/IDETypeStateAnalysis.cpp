@@ -50,7 +50,7 @@ IDETypeStateAnalysis::IDETypeStateAnalysis(const ProjectIRDB *IRDB,
                                            const TypeStateDescription &TSD,
                                            std::set<std::string> EntryPoints)
     : IDETabulationProblem(IRDB, TH, ICF, PT, EntryPoints), TSD(TSD),
-      TOP(TSD.top()), BOTTOM(TSD.bottom()) {
+      CTSD(TSD, *IRDB), TOP(TSD.top()), BOTTOM(TSD.bottom()) {
   IDETabulationProblem::ZeroValue = createZeroValue();
 }
 
@@ -146,7 +146,7 @@ IDETypeStateAnalysis::getCallFlowFunction(IDETypeStateAnalysis::n_t callStmt,
                                           IDETypeStateAnalysis::f_t destFun) {
   // Kill all data-flow facts if we hit a function of the target API.
   // Those functions are modled within Call-To-Return.
-  if (TSD.isAPIFunction(cxx_demangle(destFun->getName().str()))) {
+  if (CTSD.isAPIFunction(destFun)) {
     return KillAll<IDETypeStateAnalysis::d_t>::getInstance();
   }
   // Otherwise, if we have an ordinary function call, we can just use the
@@ -258,9 +258,8 @@ IDETypeStateAnalysis::getCallToRetFlowFunction(
     set<IDETypeStateAnalysis::f_t> callees) {
   const llvm::ImmutableCallSite CS(callSite);
   for (auto Callee : callees) {
-    std::string demangledFname = cxx_demangle(Callee->getName().str());
     // Generate the return value of factory functions from zero value
-    if (TSD.isFactoryFunction(demangledFname)) {
+    if (CTSD.isFactoryFunction(Callee)) {
       struct TSFlowFunction : FlowFunction<IDETypeStateAnalysis::d_t> {
         IDETypeStateAnalysis::d_t CallSite, ZeroValue;
 
@@ -292,7 +291,7 @@ IDETypeStateAnalysis::getCallToRetFlowFunction(
     // not be killed during call-to-return, since it is not safe to assume
     // that the return value will be used afterwards, i.e. is stored to memory
     // pointed to by related alloca's.
-    if (!TSD.isAPIFunction(demangledFname) && !Callee->isDeclaration()) {
+    if (!CTSD.isAPIFunction(Callee) && !Callee->isDeclaration()) {
       for (auto &Arg : CS.args()) {
         if (hasMatchingType(Arg)) {
           std::set<IDETypeStateAnalysis::d_t> FactsToKill =
@@ -435,23 +434,26 @@ IDETypeStateAnalysis::getCallToRetEdgeFunction(
   auto &lg = lg::get();
   const llvm::ImmutableCallSite CS(callSite);
   for (auto Callee : callees) {
-    std::string demangledFname = cxx_demangle(Callee->getName().str());
+    auto FunctionId = CTSD.getFunctionId(Callee);
+    if (!FunctionId) {
+      continue;
+    }
 
     // For now we assume that we can only generate from the return value.
     // We apply the same edge function for the return value, i.e. callsite.
-    if (TSD.isFactoryFunction(demangledFname)) {
+    if (CTSD.isFactoryFunction(Callee)) {
       LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << "Processing factory function");
       if (isZeroValue(callNode) && retSiteNode == CS.getInstruction()) {
         struct TSFactoryEF : public TSEdgeFunction {
-          TSFactoryEF(const TypeStateDescription &tsd, const std::string &tok,
-                      llvm::ImmutableCallSite cs)
-              : TSEdgeFunction(tsd, tok, cs) {}
+          TSFactoryEF(const CompiledTypeStateDescription &ctsd,
+                      unsigned funId, llvm::ImmutableCallSite cs)
+              : TSEdgeFunction(ctsd, funId, cs) {}
 
           IDETypeStateAnalysis::l_t
           computeTarget(IDETypeStateAnalysis::l_t source) override {
             // CurrentState = TSD.start();
-            CurrentState = TSD.getNextState(
-                Token, source == TSD.top() ? TSD.uninit() : source, CS);
+            CurrentState = CTSD.getNextState(
+                FunctionId, source == TSD.top() ? TSD.uninit() : source, CS);
             return CurrentState;
           }
 
@@ -459,22 +461,22 @@ IDETypeStateAnalysis::getCallToRetEdgeFunction(
             OS << "Factory(" << TSD.stateToString(CurrentState) << ")";
           }
         };
-        return make_shared<TSFactoryEF>(TSD, demangledFname, CS);
+        return make_shared<TSFactoryEF>(CTSD, *FunctionId, CS);
       }
     }
 
     // For every consuming parameter and all its aliases and relevant alloca's
     // we apply the same edge function.
-    if (TSD.isConsumingFunction(demangledFname)) {
+    if (CTSD.isConsumingFunction(Callee)) {
       LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
                     << "Processing consuming function");
-      for (auto Idx : TSD.getConsumerParamIdx(demangledFname)) {
+      for (auto Idx : CTSD.getConsumerParamIdx(*FunctionId)) {
         std::set<IDETypeStateAnalysis::d_t> PointsToAndAllocas =
             getWMAliasesAndAllocas(CS.getArgument(Idx));
 
         if (callNode == retSiteNode &&
             PointsToAndAllocas.find(callNode) != PointsToAndAllocas.end()) {
-          return make_shared<TSEdgeFunction>(TSD, demangledFname, CS);
+          return make_shared<TSEdgeFunction>(CTSD, *FunctionId, CS);
         }
       }
     }
@@ -549,9 +551,10 @@ IDETypeStateAnalysis::TSEdgeFunctionComposer::joinWith(
 IDETypeStateAnalysis::l_t IDETypeStateAnalysis::TSEdgeFunction::computeTarget(
     IDETypeStateAnalysis::l_t source) {
   auto &lg = lg::get();
-  CurrentState = TSD.getNextState(Token, source);
+  CurrentState = CTSD.getNextState(FunctionId, source);
   LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                << "State machine transition: (" << Token << " , "
+                << "State machine transition: ("
+                << CTSD.getFunctionName(FunctionId) << " , "
                 << TSD.stateToString(source) << ") -> "
                 << TSD.stateToString(CurrentState));
   return CurrentState;
@@ -58,33 +58,33 @@ IFDSFieldSensTaintAnalysis::getNormalFlowFunction(
     // TODO: report leak as done for the functions
   }
 
-  if (DataFlowUtils::isReturnValue(currentInst, successorInst))
+  if (DataFlowUtils::isReturnValue(currentInst, successorInst, typeCache))
     return std::make_shared<ReturnInstFlowFunction>(successorInst, traceStats,
-                                                    getZeroValue());
+                                                    getZeroValue(), typeCache);
 
   if (llvm::isa<llvm::StoreInst>(currentInst))
     return std::make_shared<StoreInstFlowFunction>(currentInst, traceStats,
-                                                   getZeroValue());
+                                                   getZeroValue(), typeCache);
 
   if (llvm::isa<llvm::BranchInst>(currentInst) ||
       llvm::isa<llvm::SwitchInst>(currentInst))
     return std::make_shared<BranchSwitchInstFlowFunction>(
-        currentInst, traceStats, getZeroValue());
+        currentInst, traceStats, getZeroValue(), typeCache);
 
   if (llvm::isa<llvm::GetElementPtrInst>(currentInst))
     return std::make_shared<GEPInstFlowFunction>(currentInst, traceStats,
-                                                 getZeroValue());
+                                                 getZeroValue(), typeCache);
 
   if (llvm::isa<llvm::PHINode>(currentInst))
     return std::make_shared<PHINodeFlowFunction>(currentInst, traceStats,
-                                                 getZeroValue());
+                                                 getZeroValue(), typeCache);
 
   if (DataFlowUtils::isCheckOperandsInst(currentInst))
-    return std::make_shared<CheckOperandsFlowFunction>(currentInst, traceStats,
-                                                       getZeroValue());
+    return std::make_shared<CheckOperandsFlowFunction>(
+        currentInst, traceStats, getZeroValue(), typeCache);
 
   return std::make_shared<IdentityFlowFunction>(currentInst, traceStats,
-                                                getZeroValue());
+                                                getZeroValue(), typeCache);
 }
 
 std::shared_ptr<FlowFunction<ExtendedValue>>
@@ -92,7 +92,7 @@ IFDSFieldSensTaintAnalysis::getCallFlowFunction(
     const llvm::Instruction *callStmt, const llvm::Function *destFun) {
   return std::make_shared<MapTaintedValuesToCallee>(
       llvm::cast<llvm::CallInst>(callStmt), destFun, traceStats,
-      getZeroValue());
+      getZeroValue(), typeCache);
 }
 
 std::shared_ptr<FlowFunction<ExtendedValue>>
@@ -101,7 +101,8 @@ IFDSFieldSensTaintAnalysis::getRetFlowFunction(
     const llvm::Instruction *exitStmt, const llvm::Instruction *retSite) {
   return std::make_shared<MapTaintedValuesToCaller>(
       llvm::cast<llvm::CallInst>(callSite),
-      llvm::cast<llvm::ReturnInst>(exitStmt), traceStats, getZeroValue());
+      llvm::cast<llvm::ReturnInst>(exitStmt), traceStats, getZeroValue(),
+      typeCache);
 }
 
 /*
@@ -133,7 +134,7 @@ IFDSFieldSensTaintAnalysis::getCallToRetFlowFunction(
    * instruction fact.
    */
   return std::make_shared<CallToRetFlowFunction>(callSite, traceStats,
-                                                 getZeroValue());
+                                                 getZeroValue(), typeCache);
 }
 
 /*
@@ -154,7 +155,7 @@ IFDSFieldSensTaintAnalysis::getSummaryFlowFunction(
   bool isStaticCallSite = callInst->getCalledFunction();
   if (!isStaticCallSite)
     return std::make_shared<IdentityFlowFunction>(callStmt, traceStats,
-                                                  getZeroValue());
+                                                  getZeroValue(), typeCache);
 
   /*
    * Exclude blacklisted functions here.
@@ -162,33 +163,33 @@ IFDSFieldSensTaintAnalysis::getSummaryFlowFunction(
 
   if (taintConfig.isSink(destFunName))
     return std::make_shared<IdentityFlowFunction>(callStmt, traceStats,
-                                                  getZeroValue());
+                                                  getZeroValue(), typeCache);
 
   /*
    * Intrinsics.
    */
   if (llvm::isa<llvm::MemTransferInst>(callStmt))
-    return std::make_shared<MemTransferInstFlowFunction>(callStmt, traceStats,
-                                                         getZeroValue());
+    return std::make_shared<MemTransferInstFlowFunction>(
+        callStmt, traceStats, getZeroValue(), typeCache);
 
   if (llvm::isa<llvm::MemSetInst>(callStmt))
     return std::make_shared<MemSetInstFlowFunction>(callStmt, traceStats,
-                                                    getZeroValue());
+                                                    getZeroValue(), typeCache);
 
   if (llvm::isa<llvm::VAStartInst>(callStmt))
     return std::make_shared<VAStartInstFlowFunction>(callStmt, traceStats,
-                                                     getZeroValue());
+                                                     getZeroValue(), typeCache);
 
   if (llvm::isa<llvm::VAEndInst>(callStmt))
     return std::make_shared<VAEndInstFlowFunction>(callStmt, traceStats,
-                                                   getZeroValue());
+                                                   getZeroValue(), typeCache);
 
   /*
    * Provide summary for tainted functions.
    */
   if (taintConfig.isSource(destFunName))
     return std::make_shared<GenerateFlowFunction>(callStmt, traceStats,
-                                                  getZeroValue());
+                                                  getZeroValue(), typeCache);
 
   /*
    * Skip all (other) declarations.
@@ -196,7 +197,7 @@ IFDSFieldSensTaintAnalysis::getSummaryFlowFunction(
   bool isDeclaration = destFun->isDeclaration();
   if (isDeclaration)
     return std::make_shared<IdentityFlowFunction>(callStmt, traceStats,
-                                                  getZeroValue());
+                                                  getZeroValue(), typeCache);
 
   /*
    * Follow call -> getCallFlowFunction()
@@ -214,10 +215,13 @@ IFDSFieldSensTaintAnalysis::initialSeeds() {
         std::make_pair(&ICF->getFunction(entryPoint)->front().front(),
                        std::set<ExtendedValue>({getZeroValue()})));
   }
-  // additionally, add initial seeds if there are any
+  // additionally, add initial seeds if there are any, which may have been
+  // interned by another table
   auto taintConfigSeeds = taintConfig.getInitialSeeds();
   for (auto &seed : taintConfigSeeds) {
-    seedMap[seed.first].insert(seed.second.begin(), seed.second.end());
+    for (const auto &fact : seed.second) {
+      seedMap[seed.first].insert(internTable.import(fact));
+    }
   }
   return seedMap;
 }
@@ -43,6 +43,68 @@ IFDSTaintAnalysis::IFDSTaintAnalysis(
     : IFDSTabulationProblem(IRDB, TH, ICF, PT, EntryPoints),
       SourceSinkFunctions(TSF) {
   IFDSTaintAnalysis::ZeroValue = createZeroValue();
+  indexSourceSinkCallSites();
+}
+
+void IFDSTaintAnalysis::indexSourceSinkCallSites() {
+  auto &lg = lg::get();
+  for (auto *F : ICF->getAllFunctions()) {
+    for (const auto &BB : *F) {
+      for (const auto &I : BB) {
+        llvm::ImmutableCallSite CallSite(&I);
+        if (!CallSite) {
+          continue;
+        }
+        // The first source or sink function called determines the effects
+        std::string FunctionName;
+        for (auto *Callee : ICF->getCalleesOfCallAt(&I)) {
+          std::string Name = cxx_demangle(Callee->getName().str());
+          if (SourceSinkFunctions.isSource(Name) ||
+              SourceSinkFunctions.isSink(Name)) {
+            SourceSinkCallees.insert(Callee);
+            if (FunctionName.empty()) {
+              FunctionName = std::move(Name);
+            }
+          }
+        }
+        if (FunctionName.empty()) {
+          continue;
+        }
+        if (SourceSinkFunctions.isSource(FunctionName)) {
+          LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
+                        << "Source call: " << llvmIRToShortString(&I));
+          auto Source = SourceSinkFunctions.getSource(FunctionName);
+          set<IFDSTaintAnalysis::d_t> ToGenerate;
+          for (unsigned Idx = 0; Idx < CallSite.getNumArgOperands(); ++Idx) {
+            if (!Source.isTaintedArg(Idx)) {
+              continue;
+            }
+            IFDSTaintAnalysis::d_t V = CallSite.getArgOperand(Idx);
+            // Insert the value V that gets tainted
+            ToGenerate.insert(V);
+            // We also have to collect all aliases of V and generate them
+            auto PTS = ICF->getWholeModulePTG().getPointsToSet(V);
+            ToGenerate.insert(PTS.begin(), PTS.end());
+          }
+          if (Source.TaintsReturn) {
+            ToGenerate.insert(&I);
+          }
+          SourceCallSites[&I] = std::move(ToGenerate);
+        } else {
+          LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
+                        << "Sink call: " << llvmIRToShortString(&I));
+          auto Sink = SourceSinkFunctions.getSink(FunctionName);
+          llvm::SmallBitVector LeakedArgs(CallSite.getNumArgOperands());
+          for (unsigned Idx = 0; Idx < LeakedArgs.size(); ++Idx) {
+            if (Sink.isLeakedArg(Idx)) {
+              LeakedArgs.set(Idx);
+            }
+          }
+          SinkCallSites[&I] = std::move(LeakedArgs);
+        }
+      }
+    }
+  }
 }
 
 shared_ptr<FlowFunction<IFDSTaintAnalysis::d_t>>
@@ -90,13 +152,11 @@ IFDSTaintAnalysis::getNormalFlowFunction(IFDSTaintAnalysis::n_t curr,
 shared_ptr<FlowFunction<IFDSTaintAnalysis::d_t>>
 IFDSTaintAnalysis::getCallFlowFunction(IFDSTaintAnalysis::n_t callStmt,
                                        IFDSTaintAnalysis::f_t destFun) {
-  string FunctionName = cxx_demangle(destFun->getName().str());
   // Check if a source or sink function is called:
   // We then can kill all data-flow facts not following the called function.
-  // The respective taints or leaks are then generated in the corresponding
-  // call to return flow function.
-  if (SourceSinkFunctions.isSource(FunctionName) ||
-      (SourceSinkFunctions.isSink(FunctionName))) {
+  // The respective taints are generated and leaks are detected in the
+  // corresponding call to return flow function.
+  if (SourceSinkCallees.count(destFun)) {
     return KillAll<IFDSTaintAnalysis::d_t>::getInstance();
   }
   // Map the actual into the formal parameters
@@ -130,91 +190,45 @@ IFDSTaintAnalysis::getCallToRetFlowFunction(
     IFDSTaintAnalysis::n_t callSite, IFDSTaintAnalysis::n_t retSite,
     set<IFDSTaintAnalysis::f_t> callees) {
   auto &lg = lg::get();
-  // Process the effects of source or sink functions that are called
-  for (auto *Callee : ICF->getCalleesOfCallAt(callSite)) {
-    string FunctionName = cxx_demangle(Callee->getName().str());
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << "F:" << Callee->getName().str());
-    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << "demangled F:" << FunctionName);
-    if (SourceSinkFunctions.isSource(FunctionName)) {
-      // process generated taints
-      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << "Plugin SOURCE effects");
-      auto Source = SourceSinkFunctions.getSource(FunctionName);
-      set<IFDSTaintAnalysis::d_t> ToGenerate;
-      llvm::ImmutableCallSite CallSite(callSite);
-      if (auto pval =
-              std::get_if<TaintConfiguration<IFDSTaintAnalysis::d_t>::All>(
-                  &Source.TaintedArgs)) {
-        for (unsigned i = 0; i < CallSite.getNumArgOperands(); ++i) {
-          IFDSTaintAnalysis::d_t V = CallSite.getArgOperand(i);
-          // Insert the value V that gets tainted
-          ToGenerate.insert(V);
-          // We also have to collect all aliases of V and generate them
-          auto PTS = ICF->getWholeModulePTG().getPointsToSet(V);
-          for (auto Alias : PTS) {
-            ToGenerate.insert(Alias);
-          }
-        }
-      } else if (auto pval = std::get_if<
-                     TaintConfiguration<IFDSTaintAnalysis::d_t>::None>(
-                     &Source.TaintedArgs)) {
-        // don't do anything
-      } else if (auto pval =
-                     std::get_if<std::vector<unsigned>>(&Source.TaintedArgs)) {
-        for (auto FormalIndex : *pval) {
-          IFDSTaintAnalysis::d_t V = CallSite.getArgOperand(FormalIndex);
-          // Insert the value V that gets tainted
-          ToGenerate.insert(V);
-          // We also have to collect all aliases of V and generate them
-          auto PTS = ICF->getWholeModulePTG().getPointsToSet(V);
-          for (auto Alias : PTS) {
-            ToGenerate.insert(Alias);
-          }
-        }
-      } else {
-        throw std::runtime_error("Something went wrong, unexpected type");
-      }
-
-      if (Source.TaintsReturn) {
-        ToGenerate.insert(callSite);
-      }
-      return make_shared<GenAll<IFDSTaintAnalysis::d_t>>(ToGenerate,
-                                                         getZeroValue());
-    }
-    if (SourceSinkFunctions.isSink(FunctionName)) {
-      // process leaks
-      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << "Plugin SINK effects");
-      struct TAFF : FlowFunction<IFDSTaintAnalysis::d_t> {
-        llvm::ImmutableCallSite callSite;
-        IFDSTaintAnalysis::f_t calledMthd;
-        TaintConfiguration<IFDSTaintAnalysis::d_t>::SinkFunction Sink;
-        map<IFDSTaintAnalysis::n_t, set<IFDSTaintAnalysis::d_t>> &Leaks;
-        const IFDSTaintAnalysis *taintanalysis;
-        TAFF(llvm::ImmutableCallSite cs, IFDSTaintAnalysis::f_t calledMthd,
-             TaintConfiguration<IFDSTaintAnalysis::d_t>::SinkFunction s,
-             map<IFDSTaintAnalysis::n_t, set<IFDSTaintAnalysis::d_t>> &leaks,
-             const IFDSTaintAnalysis *ta)
-            : callSite(cs), calledMthd(calledMthd), Sink(s), Leaks(leaks),
-              taintanalysis(ta) {}
-        set<IFDSTaintAnalysis::d_t>
-        computeTargets(IFDSTaintAnalysis::d_t source) override {
-          // check if a tainted value flows into a sink
-          // if so, add to Leaks and return id
-          if (!taintanalysis->isZeroValue(source)) {
-            for (unsigned Idx = 0; Idx < callSite.getNumArgOperands(); ++Idx) {
-              if (source == callSite.getArgOperand(Idx) &&
-                  Sink.isLeakedArg(Idx)) {
-                cout << "FOUND LEAK" << endl;
-                Leaks[callSite.getInstruction()].insert(source);
-              }
+  // Process the effects of source functions
+  auto SourceSearch = SourceCallSites.find(callSite);
+  if (SourceSearch != SourceCallSites.end()) {
+    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << "Plugin SOURCE effects");
+    return make_shared<GenAll<IFDSTaintAnalysis::d_t>>(SourceSearch->second,
+                                                       getZeroValue());
+  }
+  // Process the effects of sink functions
+  auto Search = SinkCallSites.find(callSite);
+  if (Search != SinkCallSites.end()) {
+    // process leaks
+    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << "Plugin SINK effects");
+    struct TAFF : FlowFunction<IFDSTaintAnalysis::d_t> {
+      llvm::ImmutableCallSite callSite;
+      const llvm::SmallBitVector &LeakedArgs;
+      map<IFDSTaintAnalysis::n_t, set<IFDSTaintAnalysis::d_t>> &Leaks;
+      const IFDSTaintAnalysis *taintanalysis;
+      TAFF(llvm::ImmutableCallSite cs, const llvm::SmallBitVector &leakedArgs,
+           map<IFDSTaintAnalysis::n_t, set<IFDSTaintAnalysis::d_t>> &leaks,
+           const IFDSTaintAnalysis *ta)
+          : callSite(cs), LeakedArgs(leakedArgs), Leaks(leaks),
+            taintanalysis(ta) {}
+      set<IFDSTaintAnalysis::d_t>
+      computeTargets(IFDSTaintAnalysis::d_t source) override {
+        // check if a tainted value flows into a sink
+        // if so, add to Leaks and return id
+        if (!taintanalysis->isZeroValue(source)) {
+          for (unsigned Idx = 0; Idx < LeakedArgs.size(); ++Idx) {
+            if (source == callSite.getArgOperand(Idx) && LeakedArgs.test(Idx)) {
+              cout << "FOUND LEAK" << endl;
+              Leaks[callSite.getInstruction()].insert(source);
             }
           }
-          return {source};
         }
-      };
-      return make_shared<TAFF>(llvm::ImmutableCallSite(callSite), Callee,
-                               SourceSinkFunctions.getSink(FunctionName), Leaks,
-                               this);
-    }
+        return {source};
+      }
+    };
+    return make_shared<TAFF>(llvm::ImmutableCallSite(callSite), Search->second,
+                             Leaks, this);
   }
   // Otherwise pass everything as it is
   return Identity<IFDSTaintAnalysis::d_t>::getInstance();
@@ -225,13 +239,12 @@ IFDSTaintAnalysis::getSummaryFlowFunction(IFDSTaintAnalysis::n_t callStmt,
                                           IFDSTaintAnalysis::f_t destFun) {
   SpecialSummaries<IFDSTaintAnalysis::d_t> &specialSummaries =
       SpecialSummaries<IFDSTaintAnalysis::d_t>::getInstance();
-  string FunctionName = cxx_demangle(destFun->getName().str());
   // If we have a special summary, which is neither a source function, nor
-  // a sink function, then we provide it to the solver.
-  if (specialSummaries.containsSpecialSummary(FunctionName) &&
-      !SourceSinkFunctions.isSource(FunctionName) &&
-      !SourceSinkFunctions.isSink(FunctionName)) {
-    return specialSummaries.getSpecialFlowFunctionSummary(FunctionName);
+  // a sink function, then we provide it to the solver. Declarative library
+  // summaries are compiled for the call site.
+  if (specialSummaries.containsSpecialSummary(destFun) &&
+      !SourceSinkCallees.count(destFun)) {
+    return specialSummaries.getSpecialFlowFunctionSummary(callStmt, destFun);
   } else {
     // Otherwise we indicate, that not special summary exists
     // and the solver thus calls the call flow function instead
@@ -0,0 +1,67 @@
+/******************************************************************************
+ * Copyright (c) 2019 Philipp Schubert.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Philipp Schubert and others
+ *****************************************************************************/
+
+#include <unordered_map>
+
+#include "llvm/IR/Function.h"
+
+#include "phasar/DB/ProjectIRDB.h"
+#include "phasar/PhasarLLVM/DataFlowSolver/IfdsIde/Problems/TypeStateDescriptions/CompiledTypeStateDescription.h"
+#include "phasar/Utils/Utilities.h"
+
+using namespace std;
+using namespace psr;
+
+namespace psr {
+
+CompiledTypeStateDescription::CompiledTypeStateDescription(
+    const TypeStateDescription &TSD, const ProjectIRDB &IRDB)
+    : TSD(TSD) {
+  // functions of different modules with the same name share their id
+  std::unordered_map<std::string, unsigned> NameToId;
+  for (const auto *F : IRDB.getAllFunctions()) {
+    auto Name = cxx_demangle(F->getName().str());
+    if (!TSD.isAPIFunction(Name)) {
+      continue;
+    }
+    auto [It, Inserted] = NameToId.try_emplace(Name, Functions.size());
+    if (Inserted) {
+      Functions.push_back({Name, TSD.isFactoryFunction(Name),
+                           TSD.isConsumingFunction(Name),
+                           TSD.getConsumerParamIdx(Name)});
+    }
+    FunctionIds[F] = It->second;
+  }
+  // collect the states that can be reached by transitions, top is never
+  // passed to the description's delta function
+  std::set<State> States = {TSD.bottom(), TSD.uninit(), TSD.start(),
+                            TSD.error()};
+  std::vector<State> WorkList(States.begin(), States.end());
+  while (!WorkList.empty()) {
+    State S = WorkList.back();
+    WorkList.pop_back();
+    for (const auto &Fun : Functions) {
+      State Next = TSD.getNextState(Fun.Name, S);
+      if (Next != TSD.top() && States.insert(Next).second) {
+        WorkList.push_back(Next);
+      }
+    }
+  }
+  MinState = *States.begin();
+  NumStates = *States.rbegin() - MinState + 1;
+  Delta.assign(Functions.size() * NumStates, Unknown);
+  for (unsigned Id = 0; Id < Functions.size(); ++Id) {
+    for (auto S : States) {
+      Delta[Id * NumStates + (S - MinState)] =
+          TSD.getNextState(Functions[Id].Name, S);
+    }
+  }
+}
+
+} // namespace psr
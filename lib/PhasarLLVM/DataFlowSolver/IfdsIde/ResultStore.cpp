@@ -0,0 +1,263 @@
+/******************************************************************************
+ * Copyright (c) 2019 Philipp Schubert.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Philipp Schubert and others
+ *****************************************************************************/
+
+#include <algorithm>
+#include <ios>
+#include <numeric>
+#include <stdexcept>
+#include <system_error>
+
+#include "llvm/Support/Endian.h"
+#include "llvm/Support/EndianStream.h"
+#include "llvm/Support/FileSystem.h"
+#include "llvm/Support/MemoryBuffer.h"
+#include "llvm/Support/raw_ostream.h"
+
+#include "phasar/PhasarLLVM/DataFlowSolver/IfdsIde/ResultStore.h"
+
+using namespace std;
+using namespace psr;
+
+namespace psr {
+
+namespace {
+
+const llvm::StringLiteral Magic = "PSRRESST";
+const uint64_t HeaderSize = 32;
+const uint64_t StringEntrySize = 12;
+
+// returns the permutation that sorts Strings, i.e. the new index of each
+// string
+std::vector<uint32_t> getSortedIds(const std::vector<std::string> &Strings) {
+  std::vector<uint32_t> Order(Strings.size());
+  std::iota(Order.begin(), Order.end(), 0);
+  std::sort(Order.begin(), Order.end(), [&Strings](uint32_t Lhs, uint32_t Rhs) {
+    return Strings[Lhs] < Strings[Rhs];
+  });
+  std::vector<uint32_t> Ids(Strings.size());
+  for (uint32_t Idx = 0; Idx < Order.size(); ++Idx) {
+    Ids[Order[Idx]] = Idx;
+  }
+  return Ids;
+}
+
+} // anonymous namespace
+
+ResultStore::ResultStore(const std::string &Path) {
+  // mapping the file requires to not insist on a null terminator
+  auto BufferOrErr = llvm::MemoryBuffer::getFile(Path, -1, false);
+  if (!BufferOrErr) {
+    throw std::runtime_error(Path + " could not be read: " +
+                             BufferOrErr.getError().message());
+  }
+  Buffer = std::move(*BufferOrErr);
+  llvm::StringRef Data = Buffer->getBuffer();
+  if (Data.size() < HeaderSize || !Data.startswith(Magic)) {
+    throw std::runtime_error(Path + " is not a result store");
+  }
+  if (read32(8) != FormatVersion) {
+    throw std::runtime_error(Path + " has an unsupported version");
+  }
+  NumNodes = read32(12);
+  NumFacts = read32(16);
+  NumValues = read32(20);
+  NumCells = read64(24);
+  NodeKeys = HeaderSize;
+  NodeLabels = NodeKeys + NumNodes * StringEntrySize;
+  Facts = NodeLabels + NumNodes * StringEntrySize;
+  Values = Facts + NumFacts * StringEntrySize;
+  Rows = Values + NumValues * StringEntrySize;
+  FactColumn = Rows + (NumNodes + 1ULL) * 8;
+  ValueColumn = FactColumn + NumCells * 4;
+  if (NumCells > Data.size() || ValueColumn + NumCells * 4 > Data.size()) {
+    throw std::runtime_error(Path + " is truncated");
+  }
+}
+
+ResultStore::~ResultStore() = default;
+
+uint32_t ResultStore::read32(uint64_t Offset) const {
+  return llvm::support::endian::read32le(Buffer->getBufferStart() + Offset);
+}
+
+uint64_t ResultStore::read64(uint64_t Offset) const {
+  return llvm::support::endian::read64le(Buffer->getBufferStart() + Offset);
+}
+
+llvm::StringRef ResultStore::getString(uint64_t Table, uint32_t Idx) const {
+  uint64_t Entry = Table + Idx * StringEntrySize;
+  uint64_t Offset = read64(Entry);
+  uint64_t Size = read32(Entry + 8);
+  if (Offset + Size > Buffer->getBufferSize()) {
+    return llvm::StringRef();
+  }
+  return Buffer->getBuffer().substr(Offset, Size);
+}
+
+std::optional<uint32_t> ResultStore::findNode(llvm::StringRef Key) const {
+  uint32_t Lo = 0;
+  uint32_t Hi = NumNodes;
+  while (Lo < Hi) {
+    uint32_t Mid = Lo + (Hi - Lo) / 2;
+    if (getString(NodeKeys, Mid).compare(Key) < 0) {
+      Lo = Mid + 1;
+    } else {
+      Hi = Mid;
+    }
+  }
+  if (Lo == NumNodes || getString(NodeKeys, Lo) != Key) {
+    return std::nullopt;
+  }
+  return Lo;
+}
+
+llvm::StringRef ResultStore::getNodeKey(uint32_t Node) const {
+  return Node < NumNodes ? getString(NodeKeys, Node) : llvm::StringRef();
+}
+
+llvm::StringRef ResultStore::getNodeLabel(uint32_t Node) const {
+  return Node < NumNodes ? getString(NodeLabels, Node) : llvm::StringRef();
+}
+
+std::vector<std::pair<llvm::StringRef, llvm::StringRef>>
+ResultStore::getFactsAt(uint32_t Node) const {
+  std::vector<std::pair<llvm::StringRef, llvm::StringRef>> Result;
+  if (Node >= NumNodes) {
+    return Result;
+  }
+  uint64_t Begin = read64(Rows + Node * 8ULL);
+  uint64_t End = std::min(read64(Rows + (Node + 1ULL) * 8), NumCells);
+  for (uint64_t Cell = Begin; Cell < End; ++Cell) {
+    uint32_t Fact = read32(FactColumn + Cell * 4);
+    uint32_t Value = read32(ValueColumn + Cell * 4);
+    if (Fact >= NumFacts || Value >= NumValues) {
+      continue;
+    }
+    Result.emplace_back(getString(Facts, Fact), getString(Values, Value));
+  }
+  return Result;
+}
+
+std::vector<std::pair<llvm::StringRef, llvm::StringRef>>
+ResultStore::getFactsAt(llvm::StringRef Key) const {
+  if (auto Node = findNode(Key)) {
+    return getFactsAt(*Node);
+  }
+  return {};
+}
+
+uint32_t ResultStoreWriter::StringTable::intern(const std::string &S) {
+  auto [It, Inserted] = Ids.try_emplace(S, Strings.size());
+  if (Inserted) {
+    Strings.push_back(S);
+  }
+  return It->second;
+}
+
+uint32_t ResultStoreWriter::addNode(const std::string &Key,
+                                    const std::string &Label) {
+  uint32_t Id = NodeKeys.intern(Key);
+  if (Id == NodeLabels.size()) {
+    NodeLabels.push_back(Label);
+  }
+  return Id;
+}
+
+uint32_t ResultStoreWriter::addFact(const std::string &Fact) {
+  return Facts.intern(Fact);
+}
+
+uint32_t ResultStoreWriter::addValue(const std::string &Value) {
+  return Values.intern(Value);
+}
+
+void ResultStoreWriter::addCell(uint32_t Node, uint32_t Fact, uint32_t Value) {
+  Cells.emplace_back(Node, Fact, Value);
+}
+
+void ResultStoreWriter::write(const std::string &Path) const {
+  // all tables are sorted, such that nodes can be found by binary search and
+  // the store does not depend on the order in which results were added
+  auto NodeIds = getSortedIds(NodeKeys.Strings);
+  auto FactIds = getSortedIds(Facts.Strings);
+  auto ValueIds = getSortedIds(Values.Strings);
+  std::vector<std::tuple<uint32_t, uint32_t, uint32_t>> SortedCells;
+  SortedCells.reserve(Cells.size());
+  for (const auto &[Node, Fact, Value] : Cells) {
+    SortedCells.emplace_back(NodeIds[Node], FactIds[Fact], ValueIds[Value]);
+  }
+  std::sort(SortedCells.begin(), SortedCells.end());
+  std::error_code EC;
+  llvm::raw_fd_ostream OS(Path, EC, llvm::sys::fs::OF_None);
+  if (EC) {
+    throw std::ios_base::failure("could not write file: " + Path);
+  }
+  auto Write32 = [&OS](uint32_t Value) {
+    llvm::support::endian::write<uint32_t>(OS, Value, llvm::support::little);
+  };
+  auto Write64 = [&OS](uint64_t Value) {
+    llvm::support::endian::write<uint64_t>(OS, Value, llvm::support::little);
+  };
+  size_t NumNodes = NodeKeys.Strings.size();
+  OS << Magic;
+  Write32(ResultStore::FormatVersion);
+  Write32(NumNodes);
+  Write32(Facts.Strings.size());
+  Write32(Values.Strings.size());
+  Write64(SortedCells.size());
+  // the strings of each table in sorted order
+  auto getSorted = [](const std::vector<std::string> &Strings,
+                      const std::vector<uint32_t> &Ids) {
+    std::vector<const std::string *> Sorted(Strings.size());
+    for (size_t Idx = 0; Idx < Strings.size(); ++Idx) {
+      Sorted[Ids[Idx]] = &Strings[Idx];
+    }
+    return Sorted;
+  };
+  std::vector<std::vector<const std::string *>> Tables = {
+      getSorted(NodeKeys.Strings, NodeIds), getSorted(NodeLabels, NodeIds),
+      getSorted(Facts.Strings, FactIds), getSorted(Values.Strings, ValueIds)};
+  uint64_t NumStrings = 2 * NumNodes + Facts.Strings.size() +
+                        Values.Strings.size();
+  uint64_t Offset = HeaderSize + NumStrings * StringEntrySize +
+                    (NumNodes + 1) * 8 + SortedCells.size() * 8;
+  for (const auto &Table : Tables) {
+    for (const auto *S : Table) {
+      Write64(Offset);
+      Write32(S->size());
+      Offset += S->size();
+    }
+  }
+  uint64_t Cell = 0;
+  for (uint32_t Node = 0; Node <= NumNodes; ++Node) {
+    while (Cell < SortedCells.size() &&
+           std::get<0>(SortedCells[Cell]) < Node) {
+      ++Cell;
+    }
+    Write64(Cell);
+  }
+  for (const auto &SortedCell : SortedCells) {
+    Write32(std::get<1>(SortedCell));
+  }
+  for (const auto &SortedCell : SortedCells) {
+    Write32(std::get<2>(SortedCell));
+  }
+  for (const auto &Table : Tables) {
+    for (const auto *S : Table) {
+      OS << *S;
+    }
+  }
+  OS.close();
+  if (OS.has_error()) {
+    OS.clear_error();
+    throw std::ios_base::failure("could not write file: " + Path);
+  }
+}
+
+} // namespace psr
@@ -0,0 +1,184 @@
+/******************************************************************************
+ * Copyright (c) 2019 Philipp Schubert.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Philipp Schubert and others
+ *****************************************************************************/
+
+#include <algorithm>
+#include <ios>
+#include <stdexcept>
+#include <system_error>
+#include <utility>
+
+#include "llvm/ADT/StringRef.h"
+#include "llvm/Support/Endian.h"
+#include "llvm/Support/EndianStream.h"
+#include "llvm/Support/FileSystem.h"
+#include "llvm/Support/MemoryBuffer.h"
+#include "llvm/Support/raw_ostream.h"
+
+#include "phasar/PhasarLLVM/DataFlowSolver/IfdsIde/SummaryStore.h"
+
+using namespace std;
+using namespace psr;
+
+namespace psr {
+
+namespace {
+
+const llvm::StringLiteral Magic = "PSRSUMST";
+const size_t HeaderSize = 16;
+const size_t EntrySize = 16;
+
+std::string getKey(const std::string &Analysis, const std::string &FunctionHash,
+                   const std::string &EntryFact) {
+  std::string Key = Analysis;
+  Key += '\0';
+  Key += FunctionHash;
+  Key += '\0';
+  Key += EntryFact;
+  return Key;
+}
+
+} // anonymous namespace
+
+SummaryStore::SummaryStore(const std::string &Path) {
+  // mapping the file requires to not insist on a null terminator
+  auto BufferOrErr = llvm::MemoryBuffer::getFile(Path, -1, false);
+  if (!BufferOrErr) {
+    throw std::runtime_error(Path + " could not be read: " +
+                             BufferOrErr.getError().message());
+  }
+  Buffer = std::move(*BufferOrErr);
+  llvm::StringRef Data = Buffer->getBuffer();
+  if (Data.size() < HeaderSize || !Data.startswith(Magic)) {
+    throw std::runtime_error(Path + " is not a summary store");
+  }
+  if (llvm::support::endian::read32le(Data.data() + 8) != FormatVersion) {
+    throw std::runtime_error(Path + " has an unsupported version");
+  }
+  NumEntries = llvm::support::endian::read32le(Data.data() + 12);
+  if ((Data.size() - HeaderSize) / EntrySize < NumEntries) {
+    throw std::runtime_error(Path + " is truncated");
+  }
+}
+
+SummaryStore::~SummaryStore() = default;
+
+llvm::StringRef SummaryStore::getField(size_t Entry, size_t Field) const {
+  llvm::StringRef Data = Buffer->getBuffer();
+  const char *Pos = Data.data() + HeaderSize + Entry * EntrySize + Field * 8;
+  uint64_t Offset = llvm::support::endian::read32le(Pos);
+  uint64_t Size = llvm::support::endian::read32le(Pos + 4);
+  if (Offset + Size > Data.size()) {
+    return llvm::StringRef();
+  }
+  return Data.substr(Offset, Size);
+}
+
+bool SummaryStore::lookup(const std::string &Analysis,
+                          const std::string &FunctionHash,
+                          const std::string &EntryFact,
+                          std::vector<Exit> &Exits) const {
+  std::string Key = getKey(Analysis, FunctionHash, EntryFact);
+  size_t Lo = 0;
+  size_t Hi = NumEntries;
+  while (Lo < Hi) {
+    size_t Mid = Lo + (Hi - Lo) / 2;
+    if (getField(Mid, 0).compare(Key) < 0) {
+      Lo = Mid + 1;
+    } else {
+      Hi = Mid;
+    }
+  }
+  if (Lo == NumEntries || getField(Lo, 0) != Key) {
+    return false;
+  }
+  llvm::StringRef Value = getField(Lo, 1);
+  std::vector<Exit> Decoded;
+  while (!Value.empty()) {
+    if (Value.size() < 9) {
+      return false;
+    }
+    unsigned Idx = llvm::support::endian::read32le(Value.data());
+    bool Identity = Value[4] != 0;
+    uint32_t FactSize = llvm::support::endian::read32le(Value.data() + 5);
+    Value = Value.drop_front(9);
+    if (Value.size() < FactSize) {
+      return false;
+    }
+    Decoded.push_back({Idx, Value.take_front(FactSize).str(), Identity});
+    Value = Value.drop_front(FactSize);
+  }
+  Exits = std::move(Decoded);
+  return true;
+}
+
+void SummaryStoreWriter::add(const std::string &Analysis,
+                             const std::string &FunctionHash,
+                             const std::string &EntryFact,
+                             std::vector<SummaryStore::Exit> Exits) {
+  std::sort(Exits.begin(), Exits.end());
+  Entries[getKey(Analysis, FunctionHash, EntryFact)] = std::move(Exits);
+}
+
+void SummaryStoreWriter::write(const std::string &Path) const {
+  std::vector<std::string> Values;
+  for (const auto &Entry : Entries) {
+    std::string Value;
+    llvm::raw_string_ostream VOS(Value);
+    for (const auto &Exit : Entry.second) {
+      llvm::support::endian::write<uint32_t>(VOS, Exit.Idx,
+                                             llvm::support::little);
+      VOS << static_cast<char>(Exit.Identity);
+      llvm::support::endian::write<uint32_t>(VOS, Exit.Fact.size(),
+                                             llvm::support::little);
+      VOS << Exit.Fact;
+    }
+    Values.push_back(VOS.str());
+  }
+  uint64_t Size = HeaderSize + Entries.size() * EntrySize;
+  size_t Idx = 0;
+  for (const auto &Entry : Entries) {
+    Size += Entry.first.size() + Values[Idx++].size();
+  }
+  if (Size > UINT32_MAX) {
+    throw std::ios_base::failure("summary store too large: " + Path);
+  }
+  std::error_code EC;
+  llvm::raw_fd_ostream OS(Path, EC, llvm::sys::fs::OF_None);
+  if (EC) {
+    throw std::ios_base::failure("could not write file: " + Path);
+  }
+  auto Write32 = [&OS](uint64_t Value) {
+    llvm::support::endian::write<uint32_t>(OS, Value, llvm::support::little);
+  };
+  OS << Magic;
+  Write32(SummaryStore::FormatVersion);
+  Write32(Entries.size());
+  uint64_t Offset = HeaderSize + Entries.size() * EntrySize;
+  Idx = 0;
+  for (const auto &Entry : Entries) {
+    Write32(Offset);
+    Write32(Entry.first.size());
+    Offset += Entry.first.size();
+    Write32(Offset);
+    Write32(Values[Idx].size());
+    Offset += Values[Idx].size();
+    ++Idx;
+  }
+  Idx = 0;
+  for (const auto &Entry : Entries) {
+    OS << Entry.first << Values[Idx++];
+  }
+  OS.close();
+  if (OS.has_error()) {
+    OS.clear_error();
+    throw std::ios_base::failure("could not write file: " + Path);
+  }
+}
+
+} // namespace psr
@@ -1,29 +1,366 @@
-// /******************************************************************************
-//  * Copyright (c) 2018 Philipp Schubert.
-//  * All rights reserved. This program and the accompanying materials are made
-//  * available under the terms of LICENSE.txt.
-//  *
-//  * Contributors:
-//  *     Philipp Schubert and others
-//  *****************************************************************************/
-
-// #include "phasar/PhasarLLVM/SPDS/Solver/SyncPDSSolver.h"
-// #include "phasar/PhasarLLVM/ControlFlow/LLVMBasedICFG.h"
-// #include "phasar/PhasarLLVM/DataFlowSolver/WPDS/Solver/LLVMWPDSSolver.h"
-// #include
-// <phasar/PhasarLLVM/DataFlowSolver/WPDS/Problems/WPDSAliasCollector.h>
-// #include "phasar/PhasarLLVM/Utils/BinaryDomain.h"
-
-// namespace psr {
-
-// SyncPDSSolver::SyncPDSSolver(LLVMBasedICFG &I) : I(I) {}
-
-// std::set<const llvm::Value *> SyncPDSSolver::getAliasesOf(const llvm::Value
-// *V)
-// {
-//   WPDSAliasCollector AC(I, WPDSType::FWPDS, SearchDirection::FORWARD);
-//   LLVMWPDSSolver<const llvm::Value *, BinaryDomain, LLVMBasedICFG&>
-//   WpdsSolver(AC); return {V};
-// }
-
-// }
+/******************************************************************************
+ * Copyright (c) 2018 Philipp Schubert.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Philipp Schubert and others
+ *****************************************************************************/
+
+#include <algorithm>
+#include <iterator>
+
+#include "llvm/IR/CallSite.h"
+#include "llvm/IR/Constants.h"
+#include "llvm/IR/Function.h"
+#include "llvm/IR/GetElementPtrTypeIterator.h"
+#include "llvm/IR/InstIterator.h"
+#include "llvm/IR/Instructions.h"
+#include "llvm/IR/Operator.h"
+
+#include "phasar/PhasarLLVM/ControlFlow/LLVMBasedICFG.h"
+#include "phasar/PhasarLLVM/DataFlowSolver/SyncPDS/Solver/SyncPDSSolver.h"
+#include "phasar/Utils/LLVMShorthands.h"
+#include "phasar/Utils/Logger.h"
+
+using namespace std;
+using namespace psr;
+
+namespace psr {
+
+namespace {
+
+bool isCopy(const llvm::Value *V) {
+  if (const auto *Op = llvm::dyn_cast<llvm::Operator>(V)) {
+    return Op->getOpcode() == llvm::Instruction::BitCast ||
+           Op->getOpcode() == llvm::Instruction::AddrSpaceCast;
+  }
+  return false;
+}
+
+} // anonymous namespace
+
+SyncPDSSolver::SyncPDSSolver(const LLVMBasedICFG &ICF,
+                             unsigned FieldStackBound, unsigned CallStackBound)
+    : ICF(ICF), FieldStackBound(FieldStackBound),
+      CallStackBound(CallStackBound) {}
+
+std::set<SyncPDSSolver::AllocationSite>
+SyncPDSSolver::getObjectsOf(const llvm::Value *V) {
+  return solve({Direction::Backward, V, {}, {}}).Objects;
+}
+
+std::set<const llvm::Value *>
+SyncPDSSolver::getAllocationSitesOf(const llvm::Value *V) {
+  std::set<const llvm::Value *> AllocationSites;
+  for (const auto &Object : getObjectsOf(V)) {
+    AllocationSites.insert(Object.V);
+  }
+  return AllocationSites;
+}
+
+std::set<const llvm::Value *>
+SyncPDSSolver::getAliasesOf(const llvm::Value *V) {
+  std::set<const llvm::Value *> Aliases = {V};
+  for (const auto &Object : getObjectsOf(V)) {
+    const auto &Found = solve(
+        {Direction::Forward, Object.V, Object.Fields, Object.Context});
+    for (const auto &Pointer : Found.Pointers) {
+      Aliases.insert(Pointer.first);
+    }
+  }
+  return Aliases;
+}
+
+bool SyncPDSSolver::alias(const llvm::Value *V, const llvm::Value *W) {
+  // objects are compared regardless of the context they have been found in,
+  // since the contexts of both queries are unrelated
+  std::set<std::pair<const llvm::Value *, FieldStack>> Objects;
+  for (const auto &Object : getObjectsOf(V)) {
+    Objects.emplace(Object.V, Object.Fields);
+  }
+  for (const auto &Object : getObjectsOf(W)) {
+    if (Objects.count({Object.V, Object.Fields})) {
+      return true;
+    }
+  }
+  return false;
+}
+
+const SyncPDSSolver::SearchResults &SyncPDSSolver::solve(const Search &S) {
+  if (Solved.count(S)) {
+    return Results[S];
+  }
+  if (Solving) {
+    return evaluate(S);
+  }
+  auto &lg = lg::get();
+  Solving = true;
+  size_t NumRounds = 0;
+  do {
+    ++Round;
+    ++NumRounds;
+    Changed = false;
+    evaluate(S);
+  } while (Changed);
+  Solving = false;
+  LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
+                << "Solved " << Pending.size() << " searches in " << NumRounds
+                << " rounds for " << llvmIRToString(std::get<1>(S)));
+  Solved.insert(Pending.begin(), Pending.end());
+  Pending.clear();
+  return Results[S];
+}
+
+const SyncPDSSolver::SearchResults &SyncPDSSolver::evaluate(const Search &S) {
+  auto [It, Inserted] = EvaluatedIn.try_emplace(S, 0);
+  if (!Inserted && It->second == Round) {
+    // S is evaluated already, use what has been found so far
+    return Results[S];
+  }
+  if (Inserted) {
+    Pending.push_back(S);
+  }
+  It->second = Round;
+  const auto &[Dir, V, FS, CS] = S;
+  SearchResults New = (Dir == Direction::Backward)
+                          ? searchBackward({V, FS, CS})
+                          : searchForward({V, FS, CS});
+  SearchResults &Old = Results[S];
+  size_t Size = Old.Objects.size() + Old.Pointers.size();
+  Old.Objects.insert(New.Objects.begin(), New.Objects.end());
+  Old.Pointers.insert(New.Pointers.begin(), New.Pointers.end());
+  Changed |= Size != Old.Objects.size() + Old.Pointers.size();
+  return Old;
+}
+
+SyncPDSSolver::SearchResults SyncPDSSolver::searchBackward(const Node &Start) {
+  SearchResults Found;
+  std::vector<Node> WorkList;
+  std::set<Node> Visited;
+  push(WorkList, Visited, Start);
+  while (!WorkList.empty()) {
+    auto [V, FS, CS] = WorkList.back();
+    WorkList.pop_back();
+    if (isAllocationSite(V, CS)) {
+      if (llvm::isa<llvm::GlobalValue>(V)) {
+        CS.clear();
+      }
+      auto DerefIt = std::find(FS.begin(), FS.end(), Deref);
+      if (DerefIt == FS.end()) {
+        Found.Objects.insert({V, FS, CS});
+      } else {
+        // the pointer has been loaded from the object, continue with the
+        // values that have been stored to it
+        FieldStack Fields(FS.begin(), DerefIt);
+        FieldStack Rest(std::next(DerefIt), FS.end());
+        const auto &Targets = solve({Direction::Forward, V, Fields, CS});
+        for (const auto &[Pointer, PointerCS] : Targets.Pointers) {
+          for (const auto *User : Pointer->users()) {
+            const auto *Store = llvm::dyn_cast<llvm::StoreInst>(User);
+            if (Store && Store->getPointerOperand() == Pointer) {
+              push(WorkList, Visited,
+                   {Store->getValueOperand(), Rest, PointerCS});
+            }
+          }
+        }
+      }
+    }
+    if (const auto *Load = llvm::dyn_cast<llvm::LoadInst>(V)) {
+      FS.insert(FS.begin(), Deref);
+      push(WorkList, Visited, {Load->getPointerOperand(), FS, CS});
+    } else if (const auto *GEP = llvm::dyn_cast<llvm::GEPOperator>(V)) {
+      FieldStack Fields = getFields(GEP);
+      Fields.insert(Fields.end(), FS.begin(), FS.end());
+      push(WorkList, Visited, {GEP->getPointerOperand(), Fields, CS});
+    } else if (isCopy(V)) {
+      push(WorkList, Visited,
+           {llvm::cast<llvm::Operator>(V)->getOperand(0), FS, CS});
+    } else if (const auto *Phi = llvm::dyn_cast<llvm::PHINode>(V)) {
+      for (const auto &Incoming : Phi->incoming_values()) {
+        push(WorkList, Visited, {Incoming.get(), FS, CS});
+      }
+    } else if (const auto *Select = llvm::dyn_cast<llvm::SelectInst>(V)) {
+      push(WorkList, Visited, {Select->getTrueValue(), FS, CS});
+      push(WorkList, Visited, {Select->getFalseValue(), FS, CS});
+    } else if (llvm::ImmutableCallSite CallSite{V}) {
+      // enter the callees through their return statements
+      const auto *Call = CallSite.getInstruction();
+      for (const auto *Callee : ICF.getCalleesOfCallAt(Call)) {
+        for (const auto &I : llvm::instructions(Callee)) {
+          const auto *Ret = llvm::dyn_cast<llvm::ReturnInst>(&I);
+          if (Ret && Ret->getReturnValue()) {
+            push(WorkList, Visited,
+                 {Ret->getReturnValue(), FS, enter(CS, Call)});
+          }
+        }
+      }
+    } else if (const auto *Arg = llvm::dyn_cast<llvm::Argument>(V)) {
+      // leave the function towards the call site that has been entered, or
+      // towards all of its callers if the call stack is empty
+      std::set<const llvm::Instruction *> Callers;
+      CallStack CallerCS;
+      if (CS.empty()) {
+        Callers = ICF.getCallersOf(Arg->getParent());
+      } else {
+        Callers.insert(CS.back());
+        CallerCS.assign(CS.begin(), std::prev(CS.end()));
+      }
+      for (const auto *Caller : Callers) {
+        llvm::ImmutableCallSite CallerCallSite(Caller);
+        if (CallerCallSite &&
+            Arg->getArgNo() < CallerCallSite.getNumArgOperands()) {
+          push(WorkList, Visited,
+               {CallerCallSite.getArgOperand(Arg->getArgNo()), FS, CallerCS});
+        }
+      }
+    }
+  }
+  return Found;
+}
+
+SyncPDSSolver::SearchResults SyncPDSSolver::searchForward(const Node &Start) {
+  SearchResults Found;
+  std::vector<Node> WorkList;
+  std::set<Node> Visited;
+  push(WorkList, Visited, Start);
+  while (!WorkList.empty()) {
+    auto [V, FS, CS] = WorkList.back();
+    WorkList.pop_back();
+    if (FS.empty()) {
+      Found.Pointers.emplace(V, CS);
+    }
+    for (const auto *User : V->users()) {
+      if (const auto *Load = llvm::dyn_cast<llvm::LoadInst>(User)) {
+        if (!FS.empty() && FS.front() == Deref) {
+          push(WorkList, Visited,
+               {Load, FieldStack(std::next(FS.begin()), FS.end()), CS});
+        }
+      } else if (const auto *Store = llvm::dyn_cast<llvm::StoreInst>(User)) {
+        if (Store->getValueOperand() != V) {
+          continue;
+        }
+        // the pointer is stored to memory, continue with the objects the
+        // memory belongs to
+        const auto &Targets = solve(
+            {Direction::Backward, Store->getPointerOperand(), {}, CS});
+        for (const auto &Object : Targets.Objects) {
+          FieldStack Fields = Object.Fields;
+          Fields.push_back(Deref);
+          Fields.insert(Fields.end(), FS.begin(), FS.end());
+          push(WorkList, Visited, {Object.V, Fields, Object.Context});
+        }
+      } else if (const auto *GEP = llvm::dyn_cast<llvm::GEPOperator>(User)) {
+        FieldStack Fields = getFields(GEP);
+        if (GEP->getPointerOperand() == V && Fields.size() <= FS.size() &&
+            std::equal(Fields.begin(), Fields.end(), FS.begin())) {
+          push(WorkList, Visited,
+               {GEP, FieldStack(FS.begin() + Fields.size(), FS.end()), CS});
+        }
+      } else if (isCopy(User) || llvm::isa<llvm::PHINode>(User)) {
+        push(WorkList, Visited, {User, FS, CS});
+      } else if (const auto *Select = llvm::dyn_cast<llvm::SelectInst>(User)) {
+        if (Select->getCondition() != V) {
+          push(WorkList, Visited, {Select, FS, CS});
+        }
+      } else if (llvm::ImmutableCallSite CallSite{User}) {
+        // enter the callees through the parameters the pointer is passed to
+        const auto *Call = CallSite.getInstruction();
+        for (unsigned Idx = 0; Idx < CallSite.getNumArgOperands(); ++Idx) {
+          if (CallSite.getArgOperand(Idx) != V) {
+            continue;
+          }
+          for (const auto *Callee : ICF.getCalleesOfCallAt(Call)) {
+            if (!Callee->isDeclaration() && Idx < Callee->arg_size()) {
+              push(WorkList, Visited,
+                   {std::next(Callee->arg_begin(), Idx), FS, enter(CS, Call)});
+            }
+          }
+        }
+      } else if (const auto *Ret = llvm::dyn_cast<llvm::ReturnInst>(User)) {
+        // leave the function towards the call site that has been entered, or
+        // towards all of its callers if the call stack is empty
+        if (CS.empty()) {
+          for (const auto *Caller : ICF.getCallersOf(Ret->getFunction())) {
+            push(WorkList, Visited, {Caller, FS, {}});
+          }
+        } else {
+          push(WorkList, Visited,
+               {CS.back(), FS, CallStack(CS.begin(), std::prev(CS.end()))});
+        }
+      }
+    }
+  }
+  return Found;
+}
+
+bool SyncPDSSolver::isAllocationSite(const llvm::Value *V,
+                                     const CallStack &CS) const {
+  if (llvm::isa<llvm::AllocaInst>(V) || llvm::isa<llvm::GlobalValue>(V)) {
+    return true;
+  }
+  if (llvm::ImmutableCallSite CallSite{V}) {
+    // the results of calls to external functions are opaque objects
+    auto Callees = ICF.getCalleesOfCallAt(CallSite.getInstruction());
+    return Callees.empty() ||
+           std::any_of(Callees.begin(), Callees.end(),
+                       [](const auto *F) { return F->isDeclaration(); });
+  }
+  if (const auto *Arg = llvm::dyn_cast<llvm::Argument>(V)) {
+    // parameters of entry points are opaque objects
+    return CS.empty() && ICF.getCallersOf(Arg->getParent()).empty();
+  }
+  if (llvm::isa<llvm::Constant>(V) || llvm::isa<llvm::LoadInst>(V) ||
+      llvm::isa<llvm::GetElementPtrInst>(V) || llvm::isa<llvm::PHINode>(V) ||
+      llvm::isa<llvm::SelectInst>(V) || isCopy(V)) {
+    return false;
+  }
+  // pointers of unknown origin, e.g. casted from integers
+  return true;
+}
+
+bool SyncPDSSolver::push(std::vector<Node> &WorkList, std::set<Node> &Visited,
+                         Node N) {
+  if (std::get<1>(N).size() > FieldStackBound) {
+    ++NumTruncated;
+    auto &lg = lg::get();
+    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
+                  << "Field stack bound exceeded at "
+                  << llvmIRToString(std::get<0>(N)));
+    return false;
+  }
+  if (!Visited.insert(N).second) {
+    return false;
+  }
+  WorkList.push_back(std::move(N));
+  return true;
+}
+
+SyncPDSSolver::CallStack
+SyncPDSSolver::enter(CallStack CS, const llvm::Instruction *CallSite) const {
+  CS.push_back(CallSite);
+  if (CS.size() > CallStackBound) {
+    CS.erase(CS.begin());
+  }
+  return CS;
+}
+
+SyncPDSSolver::FieldStack SyncPDSSolver::getFields(const llvm::Value *GEP) {
+  // array indices are ignored, trailing zeros are dropped since a struct
+  // shares its address with its first field
+  FieldStack Fields;
+  const auto *Op = llvm::cast<llvm::GEPOperator>(GEP);
+  for (auto It = llvm::gep_type_begin(Op), End = llvm::gep_type_end(Op);
+       It != End; ++It) {
+    if (It.getStructTypeOrNull()) {
+      Fields.push_back(
+          llvm::cast<llvm::ConstantInt>(It.getOperand())->getZExtValue());
+    }
+  }
+  while (!Fields.empty() && Fields.back() == 0) {
+    Fields.pop_back();
+  }
+  return Fields;
+}
+
+} // namespace psr
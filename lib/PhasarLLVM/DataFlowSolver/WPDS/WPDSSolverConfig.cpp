@@ -26,7 +26,11 @@ ostream &operator<<(ostream &OS, const WPDSSolverConfig &SC) {
   return OS << "WPDSSolverConfig:\n"
             << "\trecordWitnesses: " << SC.recordWitnesses << "\n"
             << "\tsearchDirection: " << SC.searchDirection << "\n"
-            << "\twpdsty: " << SC.wpdsty << "\n";
+            << "\twpdsty: " << SC.wpdsty << "\n"
+            << "\temitPDS: " << SC.emitPDS << "\n"
+            << "\tpdsFile: " << SC.pdsFile << "\n"
+            << "\temitAutomata: " << SC.emitAutomata << "\n"
+            << "\ttestSemiRing: " << SC.testSemiRing << "\n";
 }
 
 } // namespace psr
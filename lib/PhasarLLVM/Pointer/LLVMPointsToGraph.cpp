@@ -30,6 +30,7 @@
 #include "phasar/PhasarLLVM/Pointer/LLVMPointsToGraph.h"
 
 #include "phasar/Utils/GraphExtensions.h"
+#include "phasar/Utils/JsonWriter.h"
 #include "phasar/Utils/LLVMShorthands.h"
 #include "phasar/Utils/Logger.h"
 #include "phasar/Utils/PAMMMacros.h"
@@ -125,12 +126,11 @@ std::string PointsToGraph::VertexProperties::getValueAsString() const {
 
 std::vector<const llvm::User *>
 PointsToGraph::VertexProperties::getUsers() const {
-  if (!users.empty() || V == nullptr) {
-    return users;
+  if (V == nullptr) {
+    return {};
   }
   auto allUsers = V->users();
-  users.insert(users.end(), allUsers.begin(), allUsers.end());
-  return users;
+  return {allUsers.begin(), allUsers.end()};
 }
 
 PointsToGraph::EdgeProperties::EdgeProperties(const llvm::Value *V) : V(V) {}
@@ -466,8 +466,33 @@ size_t PointsToGraph::getNumVertices() const {
 size_t PointsToGraph::getNumEdges() const { return boost::num_edges(PAG); }
 
 void PointsToGraph::printAsJson(std::ostream &OS) const {
-  nlohmann::json J = getAsJson();
-  OS << J;
+  // streams the same document as getAsJson() without building it in memory
+  JsonWriter W(OS);
+  W.beginObject();
+  W.key(PhasarConfig::JsonPointToGraphID());
+  printAsJson(W);
+  W.endObject();
+}
+
+void PointsToGraph::printAsJson(JsonWriter &W) const {
+  W.beginObject();
+  vertex_iterator vi_v, vi_v_end;
+  out_edge_iterator ei, ei_end;
+  for (boost::tie(vi_v, vi_v_end) = boost::vertices(PAG); vi_v != vi_v_end;
+       ++vi_v) {
+    W.key(PAG[*vi_v].getValueAsString());
+    if (boost::out_degree(*vi_v, PAG) == 0) {
+      W.null();
+      continue;
+    }
+    W.beginArray();
+    for (boost::tie(ei, ei_end) = boost::out_edges(*vi_v, PAG); ei != ei_end;
+         ++ei) {
+      W.value(PAG[boost::target(*ei, PAG)].getValueAsString());
+    }
+    W.endArray();
+  }
+  W.endObject();
 }
 
 } // namespace psr
@@ -26,6 +26,7 @@
 #include "phasar/DB/ProjectIRDB.h"
 #include "phasar/PhasarLLVM/Pointer/LLVMPointsToGraph.h"
 #include "phasar/PhasarLLVM/Pointer/LLVMPointsToInfo.h"
+#include "phasar/Utils/JsonWriter.h"
 
 using namespace psr;
 
@@ -461,7 +462,17 @@ llvm::AAResults *LLVMPointsToInfo::getAAResults(const llvm::Function *F) const {
 }
 
 void LLVMPointsToInfo::printAsJson(std::ostream &OS) const {
-  OS << getAsJson();
+  // the points-to graphs of all functions, one after another
+  JsonWriter W(OS);
+  W.beginObject();
+  W.key(PhasarConfig::JsonPointToGraphID());
+  W.beginObject();
+  for (const auto &[F, PTG] : PointsToGraphs) {
+    W.key(F->getName().str());
+    PTG->printAsJson(W);
+  }
+  W.endObject();
+  W.endObject();
 }
 
 } // namespace psr
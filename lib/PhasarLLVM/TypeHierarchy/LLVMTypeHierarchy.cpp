@@ -39,6 +39,7 @@
 #include "phasar/DB/ProjectIRDB.h"
 #include "phasar/PhasarLLVM/TypeHierarchy/LLVMTypeHierarchy.h"
 #include "phasar/Utils/GraphExtensions.h"
+#include "phasar/Utils/JsonWriter.h"
 #include "phasar/Utils/LLVMShorthands.h"
 #include "phasar/Utils/Logger.h"
 #include "phasar/Utils/PAMMMacros.h"
@@ -431,7 +432,29 @@ void LLVMTypeHierarchy::printAsDot(std::ostream &OS) const {
 }
 
 void LLVMTypeHierarchy::printAsJson(std::ostream &OS) const {
-  OS << getAsJson();
+  // streams the same document as getAsJson() without building it in memory
+  JsonWriter W(OS);
+  W.beginObject();
+  W.key(PhasarConfig::JsonTypeHierarchyID());
+  W.beginObject();
+  vertex_iterator vi_v, vi_v_end;
+  out_edge_iterator ei, ei_end;
+  for (boost::tie(vi_v, vi_v_end) = boost::vertices(TypeGraph);
+       vi_v != vi_v_end; ++vi_v) {
+    W.key(TypeGraph[*vi_v].getTypeName());
+    if (boost::out_degree(*vi_v, TypeGraph) == 0) {
+      W.null();
+      continue;
+    }
+    W.beginArray();
+    for (boost::tie(ei, ei_end) = boost::out_edges(*vi_v, TypeGraph);
+         ei != ei_end; ++ei) {
+      W.value(TypeGraph[boost::target(*ei, TypeGraph)].getTypeName());
+    }
+    W.endArray();
+  }
+  W.endObject();
+  W.endObject();
 }
 
 // void LLVMTypeHierarchy::printGraphAsDot(ostream &out) {
@@ -0,0 +1,194 @@
+/**
+ * @author Sebastian Roland <seroland86@gmail.com>
+ */
+
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "phasar/PhasarLLVM/Domain/ExtendedValue.h"
+
+namespace psr {
+
+struct ExtendedValue::MemLocationNode {
+  const MemLocationNode *parent;
+  const llvm::Value *location;
+  std::size_t length;
+  // only accessed while the intern table is locked
+  std::unordered_map<const llvm::Value *, std::unique_ptr<MemLocationNode>>
+      children;
+
+  MemLocationNode(const MemLocationNode *parent, const llvm::Value *location)
+      : parent(parent), location(location),
+        length(parent ? parent->length + 1 : 1) {}
+};
+
+namespace {
+
+using MemLocationNode = ExtendedValue::MemLocationNode;
+
+std::vector<const llvm::Value *> getSeq(const MemLocationNode *node) {
+  std::vector<const llvm::Value *> seq(node ? node->length : 0);
+  for (auto it = seq.rbegin(); node; node = node->parent, ++it) {
+    *it = node->location;
+  }
+  return seq;
+}
+
+std::size_t hashCombine(std::size_t seed, std::size_t value) {
+  return seed ^ (value + 0x9e3779b9 + (seed << 6) + (seed >> 2));
+}
+
+} // anonymous namespace
+
+struct ExtendedValue::InternTable::Impl {
+  struct DataHash {
+    std::size_t operator()(const Data &record) const {
+      std::size_t seed = 0x4711;
+      seed = hashCombine(seed, std::hash<const void *>{}(record.value));
+      seed =
+          hashCombine(seed, std::hash<const void *>{}(record.memLocationSeq));
+      seed = hashCombine(
+          seed, std::hash<const void *>{}(record.endOfTaintedBlockLabel));
+      seed = hashCombine(
+          seed, std::hash<const void *>{}(record.vaListMemLocationSeq));
+      seed = hashCombine(seed, std::hash<long>{}(record.varArgIndex));
+      return hashCombine(seed, std::hash<long>{}(record.currentVarArgIndex));
+    }
+  };
+
+  std::mutex mutex;
+  std::unordered_map<const llvm::Value *, std::unique_ptr<MemLocationNode>>
+      roots;
+  std::unordered_set<std::string> labels;
+  // elements of unordered containers are never moved, hence handles to them
+  // stay valid
+  std::unordered_set<Data, DataHash> facts;
+
+  const MemLocationNode *
+  internSeq(const std::vector<const llvm::Value *> &seq) {
+    MemLocationNode *node = nullptr;
+    for (const auto *location : seq) {
+      auto &children = node ? node->children : roots;
+      auto &child = children[location];
+      if (!child) {
+        child = std::make_unique<MemLocationNode>(node, location);
+      }
+      node = child.get();
+    }
+    return node;
+  }
+
+  const std::string *internLabel(const std::string &label) {
+    if (label.empty()) {
+      return nullptr;
+    }
+    return &*labels.insert(label).first;
+  }
+
+  const Data *intern(Data record) {
+    // the id is neither hashed nor compared, it is only used if the record is
+    // new
+    record.id = facts.size();
+    return &*facts.insert(record).first;
+  }
+};
+
+ExtendedValue::InternTable::InternTable() : impl(std::make_unique<Impl>()) {}
+
+ExtendedValue::InternTable::~InternTable() = default;
+
+ExtendedValue ExtendedValue::InternTable::import(const ExtendedValue &fact) {
+  if (fact.data->table == this) {
+    return fact;
+  }
+  std::lock_guard<std::mutex> lock(impl->mutex);
+  // the nodes and labels of the other table are immutable, hence they are
+  // read without locking it
+  Data record = *fact.data;
+  record.memLocationSeq = impl->internSeq(fact.getMemLocationSeq());
+  record.endOfTaintedBlockLabel =
+      impl->internLabel(fact.getEndOfTaintedBlockLabel());
+  record.vaListMemLocationSeq =
+      impl->internSeq(fact.getVaListMemLocationSeq());
+  record.table = this;
+  ExtendedValue imported;
+  imported.data = impl->intern(record);
+  return imported;
+}
+
+std::size_t ExtendedValue::InternTable::getNumFacts() const {
+  std::lock_guard<std::mutex> lock(impl->mutex);
+  return impl->facts.size();
+}
+
+const ExtendedValue::Data ExtendedValue::emptyRecord;
+
+ExtendedValue::ExtendedValue() : data(&emptyRecord) {}
+
+ExtendedValue::ExtendedValue(InternTable &table, const llvm::Value *_value) {
+  assert(_value && "ExtendedValue requires an llvm::Value* object");
+  std::lock_guard<std::mutex> lock(table.impl->mutex);
+  Data record;
+  record.value = _value;
+  record.table = &table;
+  data = table.impl->intern(record);
+}
+
+const std::vector<const llvm::Value *>
+ExtendedValue::getMemLocationSeq() const {
+  return getSeq(data->memLocationSeq);
+}
+
+void ExtendedValue::setMemLocationSeq(
+    std::vector<const llvm::Value *> _memLocationSeq) {
+  auto &table = *getInternTable().impl;
+  std::lock_guard<std::mutex> lock(table.mutex);
+  Data record = *data;
+  record.memLocationSeq = table.internSeq(_memLocationSeq);
+  data = table.intern(record);
+}
+
+void ExtendedValue::setEndOfTaintedBlockLabel(
+    std::string _endOfTaintedBlockLabel) {
+  auto &table = *getInternTable().impl;
+  std::lock_guard<std::mutex> lock(table.mutex);
+  Data record = *data;
+  record.endOfTaintedBlockLabel = table.internLabel(_endOfTaintedBlockLabel);
+  data = table.intern(record);
+}
+
+const std::vector<const llvm::Value *>
+ExtendedValue::getVaListMemLocationSeq() const {
+  return getSeq(data->vaListMemLocationSeq);
+}
+
+void ExtendedValue::setVaListMemLocationSeq(
+    std::vector<const llvm::Value *> _vaListMemLocationSeq) {
+  auto &table = *getInternTable().impl;
+  std::lock_guard<std::mutex> lock(table.mutex);
+  Data record = *data;
+  record.vaListMemLocationSeq = table.internSeq(_vaListMemLocationSeq);
+  data = table.intern(record);
+}
+
+void ExtendedValue::setVarArgIndex(long _varArgIndex) {
+  auto &table = *getInternTable().impl;
+  std::lock_guard<std::mutex> lock(table.mutex);
+  Data record = *data;
+  record.varArgIndex = _varArgIndex;
+  data = table.intern(record);
+}
+
+void ExtendedValue::incrementCurrentVarArgIndex() {
+  if (isVarArgTemplate())
+    return;
+  auto &table = *getInternTable().impl;
+  std::lock_guard<std::mutex> lock(table.mutex);
+  Data record = *data;
+  ++record.currentVarArgIndex;
+  data = table.intern(record);
+}
+
+} // namespace psr
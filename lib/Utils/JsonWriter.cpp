@@ -0,0 +1,140 @@
+/******************************************************************************
+ * Copyright (c) 2019 Philipp Schubert.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Philipp Schubert and others
+ *****************************************************************************/
+
+#include <cassert>
+#include <cmath>
+#include <iomanip>
+#include <limits>
+#include <ostream>
+
+#include "phasar/Utils/JsonWriter.h"
+
+namespace psr {
+
+JsonWriter::JsonWriter(std::ostream &OS) : OS(OS) {}
+
+void JsonWriter::beginValue() {
+  if (Scopes.empty()) {
+    return;
+  }
+  if (Scopes.back().IsObject) {
+    assert(AfterKey && "expected a key before a member of an object");
+    AfterKey = false;
+    return;
+  }
+  if (!Scopes.back().IsEmpty) {
+    OS << ',';
+  }
+  Scopes.back().IsEmpty = false;
+}
+
+void JsonWriter::beginObject() {
+  beginValue();
+  OS << '{';
+  Scopes.push_back({true, true});
+}
+
+void JsonWriter::endObject() {
+  assert(!Scopes.empty() && Scopes.back().IsObject && !AfterKey &&
+         "no object to close");
+  Scopes.pop_back();
+  OS << '}';
+}
+
+void JsonWriter::beginArray() {
+  beginValue();
+  OS << '[';
+  Scopes.push_back({false, true});
+}
+
+void JsonWriter::endArray() {
+  assert(!Scopes.empty() && !Scopes.back().IsObject && "no array to close");
+  Scopes.pop_back();
+  OS << ']';
+}
+
+void JsonWriter::key(std::string_view Key) {
+  assert(!Scopes.empty() && Scopes.back().IsObject && !AfterKey &&
+         "keys are only allowed within objects");
+  if (!Scopes.back().IsEmpty) {
+    OS << ',';
+  }
+  Scopes.back().IsEmpty = false;
+  writeString(OS, Key);
+  OS << ':';
+  AfterKey = true;
+}
+
+void JsonWriter::value(std::string_view Str) {
+  beginValue();
+  writeString(OS, Str);
+}
+
+void JsonWriter::value(double Number) {
+  // JSON has no representation for infinity and NaN
+  if (!std::isfinite(Number)) {
+    null();
+    return;
+  }
+  beginValue();
+  auto Flags = OS.flags();
+  auto Precision = OS.precision(std::numeric_limits<double>::max_digits10);
+  OS << Number;
+  OS.precision(Precision);
+  OS.flags(Flags);
+}
+
+void JsonWriter::null() { writeRaw("null"); }
+
+void JsonWriter::writeRaw(std::string_view Raw) {
+  beginValue();
+  OS << Raw;
+}
+
+void JsonWriter::writeString(std::ostream &OS, std::string_view S) {
+  OS << '"';
+  for (char C : S) {
+    switch (C) {
+    case '"':
+      OS << "\\\"";
+      break;
+    case '\\':
+      OS << "\\\\";
+      break;
+    case '\b':
+      OS << "\\b";
+      break;
+    case '\f':
+      OS << "\\f";
+      break;
+    case '\n':
+      OS << "\\n";
+      break;
+    case '\r':
+      OS << "\\r";
+      break;
+    case '\t':
+      OS << "\\t";
+      break;
+    default:
+      if (static_cast<unsigned char>(C) < 0x20) {
+        auto Flags = OS.flags();
+        OS << "\\u" << std::hex << std::setw(4) << std::setfill('0')
+           << static_cast<unsigned>(C);
+        OS.flags(Flags);
+        OS << std::setfill(' ');
+      } else {
+        OS << C;
+      }
+    }
+  }
+  OS << '"';
+}
+
+} // namespace psr
@@ -7,13 +7,15 @@
  *     Philipp Schubert and others
  *****************************************************************************/
 
-#include <fstream>
+#include <cstring>
 #include <iostream>
-#include <limits>
+#include <memory>
+#include <mutex>
+#include <vector>
 
-#include "boost/algorithm/string/trim.hpp"
 #include "boost/filesystem.hpp"
 
+#include "llvm/ADT/StringMap.h"
 #include "llvm/IR/DebugInfoMetadata.h"
 #include "llvm/IR/DebugLoc.h"
 #include "llvm/IR/Instruction.h"
@@ -22,6 +24,8 @@
 #include "llvm/IR/Metadata.h"
 #include "llvm/IR/Module.h"
 #include "llvm/IR/Value.h"
+#include "llvm/IR/ValueMap.h"
+#include "llvm/Support/MemoryBuffer.h"
 
 #include "phasar/Utils/LLVMIRToSrc.h"
 
@@ -29,7 +33,57 @@ using namespace psr;
 
 namespace psr {
 
-llvm::DbgVariableIntrinsic *getDbgVarIntrinsic(const llvm::Value *V) {
+namespace {
+
+/// A source file that is mapped into memory together with the offsets at
+/// which its lines start.
+struct SourceFile {
+  std::unique_ptr<llvm::MemoryBuffer> Buffer;
+  std::vector<size_t> LineOffsets;
+
+  SourceFile(std::unique_ptr<llvm::MemoryBuffer> Buffer)
+      : Buffer(std::move(Buffer)) {
+    llvm::StringRef Content = this->Buffer->getBuffer();
+    LineOffsets.push_back(0);
+    const char *Begin = Content.data();
+    const char *End = Begin + Content.size();
+    for (const char *Pos = Begin;
+         (Pos = static_cast<const char *>(
+              std::memchr(Pos, '\n', End - Pos))) != nullptr;) {
+      LineOffsets.push_back(++Pos - Begin);
+    }
+  }
+
+  llvm::StringRef getLine(unsigned int LineNr) const {
+    if (LineNr == 0 || LineNr > LineOffsets.size()) {
+      return "";
+    }
+    llvm::StringRef Content = Buffer->getBuffer();
+    size_t Begin = LineOffsets[LineNr - 1];
+    size_t End =
+        LineNr < LineOffsets.size() ? LineOffsets[LineNr] : Content.size();
+    return Content.slice(Begin, End);
+  }
+};
+
+/// Source files and debug information lookups are requested over and over
+/// again for the same values when reports are generated, so they are
+/// computed only once.
+struct SrcCodeCache {
+  std::mutex Mtx;
+  /// Files that could not be read are stored as nullptr.
+  llvm::StringMap<std::unique_ptr<SourceFile>> Files;
+  llvm::ValueMap<const llvm::Value *, llvm::DbgVariableIntrinsic *>
+      DbgVarIntrinsics;
+  llvm::ValueMap<const llvm::Value *, llvm::DILocation *> DILocations;
+};
+
+SrcCodeCache &getSrcCodeCache() {
+  static SrcCodeCache Cache;
+  return Cache;
+}
+
+llvm::DbgVariableIntrinsic *computeDbgVarIntrinsic(const llvm::Value *V) {
   if (auto *VAM =
           llvm::ValueAsMetadata::getIfExists(const_cast<llvm::Value *>(V))) {
     if (auto *MDV = llvm::MetadataAsValue::getIfExists(V->getContext(), VAM)) {
@@ -47,7 +101,7 @@ llvm::DbgVariableIntrinsic *getDbgVarIntrinsic(const llvm::Value *V) {
       if (auto Store = llvm::dyn_cast<llvm::StoreInst>(User)) {
         if (Store->getValueOperand() == Arg &&
             llvm::isa<llvm::AllocaInst>(Store->getPointerOperand())) {
-          return getDbgVarIntrinsic(Store->getPointerOperand());
+          return computeDbgVarIntrinsic(Store->getPointerOperand());
         }
       }
     }
@@ -55,6 +109,23 @@ llvm::DbgVariableIntrinsic *getDbgVarIntrinsic(const llvm::Value *V) {
   return nullptr;
 }
 
+} // anonymous namespace
+
+llvm::DbgVariableIntrinsic *getDbgVarIntrinsic(const llvm::Value *V) {
+  auto &Cache = getSrcCodeCache();
+  {
+    std::lock_guard<std::mutex> Lock(Cache.Mtx);
+    auto Search = Cache.DbgVarIntrinsics.find(V);
+    if (Search != Cache.DbgVarIntrinsics.end()) {
+      return Search->second;
+    }
+  }
+  auto *DbgIntr = computeDbgVarIntrinsic(V);
+  std::lock_guard<std::mutex> Lock(Cache.Mtx);
+  Cache.DbgVarIntrinsics.insert({V, DbgIntr});
+  return DbgIntr;
+}
+
 llvm::DILocalVariable *getDILocalVariable(const llvm::Value *V) {
   if (auto DbgIntr = getDbgVarIntrinsic(V)) {
     if (auto *DDI = llvm::dyn_cast<llvm::DbgDeclareInst>(DbgIntr)) {
@@ -85,7 +156,9 @@ llvm::DISubprogram *getDISubprogram(const llvm::Value *V) {
   return nullptr;
 }
 
-llvm::DILocation *getDILocation(const llvm::Value *V) {
+namespace {
+
+llvm::DILocation *computeDILocation(const llvm::Value *V) {
   // Arguments and Instruction such as AllocaInst
   if (auto DbgIntr = getDbgVarIntrinsic(V)) {
     if (auto MN = DbgIntr->getMetadata(llvm::LLVMContext::MD_dbg)) {
@@ -99,6 +172,23 @@ llvm::DILocation *getDILocation(const llvm::Value *V) {
   return nullptr;
 }
 
+} // anonymous namespace
+
+llvm::DILocation *getDILocation(const llvm::Value *V) {
+  auto &Cache = getSrcCodeCache();
+  {
+    std::lock_guard<std::mutex> Lock(Cache.Mtx);
+    auto Search = Cache.DILocations.find(V);
+    if (Search != Cache.DILocations.end()) {
+      return Search->second;
+    }
+  }
+  auto *DILoc = computeDILocation(V);
+  std::lock_guard<std::mutex> Lock(Cache.Mtx);
+  Cache.DILocations.insert({V, DILoc});
+  return DILoc;
+}
+
 llvm::DIFile *getDIFile(const llvm::Value *V) {
   if (auto GO = llvm::dyn_cast<llvm::GlobalObject>(V)) {
     if (auto MN = GO->getMetadata(llvm::LLVMContext::MD_dbg)) {
@@ -207,23 +297,37 @@ unsigned int getColumnFromIR(const llvm::Value *V) {
 std::string getSrcCodeFromIR(const llvm::Value *V) {
   unsigned int lineNr = getLineFromIR(V);
   if (lineNr > 0) {
-    boost::filesystem::path path(getFilePathFromIR(V));
-    if (boost::filesystem::exists(path) &&
-        !boost::filesystem::is_directory(path)) {
-      std::ifstream ifs(path.string(), std::ios::binary);
-      if (ifs.is_open()) {
-        ifs.seekg(std::ios::beg);
-        std::string src_line;
-        for (unsigned int i = 0; i < lineNr - 1; ++i) {
-          ifs.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
-        }
-        std::getline(ifs, src_line);
-        boost::algorithm::trim(src_line);
-        return src_line;
+    return getSrcCodeLineFromFile(getFilePathFromIR(V), lineNr).str();
+  }
+  return "";
+}
+
+llvm::StringRef getSrcCodeLineFromFile(const std::string &Path,
+                                       unsigned int LineNr) {
+  auto &Cache = getSrcCodeCache();
+  std::lock_guard<std::mutex> Lock(Cache.Mtx);
+  auto Search = Cache.Files.find(Path);
+  if (Search == Cache.Files.end()) {
+    std::unique_ptr<SourceFile> SF;
+    if (!Path.empty() && !boost::filesystem::is_directory(Path)) {
+      if (auto Buffer = llvm::MemoryBuffer::getFile(Path)) {
+        SF = std::make_unique<SourceFile>(std::move(*Buffer));
       }
     }
+    Search = Cache.Files.try_emplace(Path, std::move(SF)).first;
   }
-  return "";
+  if (!Search->second) {
+    return "";
+  }
+  return Search->second->getLine(LineNr).trim();
+}
+
+void clearSrcCodeCache() {
+  auto &Cache = getSrcCodeCache();
+  std::lock_guard<std::mutex> Lock(Cache.Mtx);
+  Cache.Files.clear();
+  Cache.DbgVarIntrinsics.clear();
+  Cache.DILocations.clear();
 }
 
 std::string getModuleIDFromIR(const llvm::Value *V) {
@@ -243,6 +243,17 @@ bool llvmValueIDLess::operator()(const llvm::Value *lhs,
   return sless(lhs_id, rhs_id);
 }
 
+std::tuple<bool, long, std::string> getMetaDataIDKey(const llvm::Value *V) {
+  std::string ID = getMetaDataID(V);
+  char *End;
+  long Numeric = strtol(ID.c_str(), &End, 10);
+  // numeric IDs are ordered by their value and precede all other IDs
+  if (End != ID.c_str()) {
+    return {false, Numeric, ""};
+  }
+  return {true, 0, ID};
+}
+
 int getFunctionArgumentNr(const llvm::Argument *Arg) {
   int ArgNr = 0;
   for (auto &A : Arg->getParent()->args()) {
@@ -16,6 +16,7 @@
 
 #include <algorithm>
 #include <array>
+#include <cstdlib>
 #include <ctime>
 #include <exception>
 
@@ -51,6 +52,22 @@ severity_level logFilterLevel = DEBUG;
 
 void setLoggerFilterLevel(severity_level level) { logFilterLevel = level; }
 
+const map<string, LogCategory> StringToLogCategory = {
+    {"General", LogCategory::General},
+    {"Solver", LogCategory::Solver},
+    {"FlowEdgeFunctionCache", LogCategory::FlowEdgeFunctionCache}};
+
+std::atomic<unsigned> enabledLogCategories(~0U);
+
+void setLogCategoryEnabled(LogCategory category, bool enabled) {
+  unsigned bit = 1U << static_cast<unsigned>(category);
+  if (enabled) {
+    enabledLogCategories.fetch_or(bit, std::memory_order_relaxed);
+  } else {
+    enabledLogCategories.fetch_and(~bit, std::memory_order_relaxed);
+  }
+}
+
 ostream &operator<<(ostream &os, enum severity_level l) {
   return os << SeverityLevelToString.at(l);
 }
@@ -71,14 +88,38 @@ void LoggerExceptionHandler::operator()(const std::exception &ex) const {
   std::cerr << "std::exception: " << ex.what() << '\n';
 }
 
+namespace {
+
+// records are formatted and written by the sink's own thread, such that the
+// analyses do not wait for the stream
+typedef boost::log::sinks::asynchronous_sink<
+    boost::log::sinks::text_ostream_backend>
+    text_sink;
+
+boost::shared_ptr<text_sink> asyncSink;
+
+void stopLogger() {
+  if (asyncSink) {
+    asyncSink->stop();
+    asyncSink->flush();
+  }
+}
+
+} // anonymous namespace
+
 void initializeLogger(bool use_logger, string log_file) {
   // Using this call, logging can be enabled or disabled
   boost::log::core::get()->set_logging_enabled(use_logger);
+  if (asyncSink) {
+    boost::log::core::get()->remove_sink(asyncSink);
+    stopLogger();
+  } else {
+    // write the pending records before the streams are destroyed
+    std::atexit(&stopLogger);
+  }
   // if (log_file == "") {
-  typedef boost::log::sinks::synchronous_sink<
-      boost::log::sinks::text_ostream_backend>
-      text_sink;
   boost::shared_ptr<text_sink> sink = boost::make_shared<text_sink>();
+  asyncSink = sink;
   // the easiest way is to write the logs to std::clog
   boost::shared_ptr<std::ostream> stream(&std::clog, boost::null_deleter{});
   // } else {
@@ -97,6 +138,8 @@ void initializeLogger(bool use_logger, string log_file) {
   // log_file);
   // }
   sink->locked_backend()->add_stream(stream);
+  // the stream is only flushed on demand instead of after every record
+  sink->locked_backend()->auto_flush(false);
   sink->set_filter(&LogFilter);
   sink->set_formatter(&LogFormatter);
   boost::log::core::get()->add_sink(sink);
@@ -108,4 +151,10 @@ void initializeLogger(bool use_logger, string log_file) {
       boost::log::make_exception_handler<std::exception>(
           LoggerExceptionHandler()));
 }
+
+void flushLogger() {
+  if (asyncSink) {
+    asyncSink->flush();
+  }
+}
 } // namespace psr
@@ -14,9 +14,14 @@
  *      Author: rleer
  */
 
+#include <algorithm>
+#include <atomic>
 #include <cassert>
+#include <deque>
 #include <fstream>
 #include <iomanip>
+#include <limits>
+#include <memory>
 #include <sstream>
 
 #include "boost/filesystem.hpp"
@@ -31,81 +36,239 @@ using json = nlohmann::json;
 
 namespace psr {
 
+/// Holds everything a single thread records. Counters are only ever written
+/// by the owning thread and therefore do not need a lock; other threads read
+/// them while holding Mtx, which the owning thread also acquires whenever it
+/// changes the layout of the shard.
+struct PAMM::ThreadShard {
+  std::mutex Mtx;
+  std::deque<std::atomic<long>> Counter;
+  std::unordered_map<Id_t, TimePoint_t> RunningTimer;
+  std::unordered_map<Id_t, RepeatingTimerStats> RepeatingTimer;
+
+  ThreadShard() { PAMM::getInstance().Shards.insert(this); }
+
+  ~ThreadShard() { PAMM::getInstance().retireThreadShard(*this); }
+
+  std::atomic<long> &getCounter(Id_t CounterId) {
+    if (CounterId >= Counter.size()) {
+      std::lock_guard<std::mutex> Lock(Mtx);
+      while (CounterId >= Counter.size()) {
+        Counter.emplace_back(0);
+      }
+    }
+    return Counter[CounterId];
+  }
+};
+
+void PAMM::RepeatingTimerStats::add(uint64_t Duration) {
+  Min = Count ? std::min(Min, Duration) : Duration;
+  Max = std::max(Max, Duration);
+  ++Count;
+  Sum += Duration;
+  unsigned Bucket = 0;
+  while (Duration >>= 1) {
+    ++Bucket;
+  }
+  ++Buckets[Bucket];
+}
+
+void PAMM::RepeatingTimerStats::merge(const RepeatingTimerStats &Other) {
+  if (!Other.Count) {
+    return;
+  }
+  Min = Count ? std::min(Min, Other.Min) : Other.Min;
+  Max = std::max(Max, Other.Max);
+  Count += Other.Count;
+  Sum += Other.Sum;
+  for (size_t I = 0; I < Buckets.size(); ++I) {
+    Buckets[I] += Other.Buckets[I];
+  }
+}
+
+uint64_t PAMM::RepeatingTimerStats::percentile(double P) const {
+  if (!Count) {
+    return 0;
+  }
+  auto Rank = static_cast<uint64_t>(P / 100.0 * Count + 0.5);
+  Rank = std::max<uint64_t>(1, std::min(Rank, Count));
+  uint64_t Seen = 0;
+  for (size_t I = 0; I < Buckets.size(); ++I) {
+    Seen += Buckets[I];
+    if (Seen >= Rank) {
+      // bucket I holds durations in [2^I, 2^(I+1)), report its upper bound
+      uint64_t Upper = I + 1 < 64 ? (uint64_t(1) << (I + 1)) - 1
+                                  : std::numeric_limits<uint64_t>::max();
+      return std::max(Min, std::min(Max, Upper));
+    }
+  }
+  return Max;
+}
+
 PAMM &PAMM::getInstance() {
   static PAMM instance;
   return instance;
 }
 
-void PAMM::startTimer(const std::string &TimerId) {
-  bool validTimerId =
-      !RunningTimer.count(TimerId) && !StoppedTimer.count(TimerId);
+PAMM::ThreadShard &PAMM::getThreadShard() {
+  thread_local std::unique_ptr<ThreadShard> Shard;
+  if (!Shard) {
+    std::lock_guard<std::mutex> Lock(Mtx);
+    Shard = std::make_unique<ThreadShard>();
+  }
+  return *Shard;
+}
+
+void PAMM::retireThreadShard(ThreadShard &Shard) {
+  std::lock_guard<std::mutex> Lock(Mtx);
+  std::lock_guard<std::mutex> ShardLock(Shard.Mtx);
+  for (Id_t Id = 0; Id < Shard.Counter.size(); ++Id) {
+    if (Counter.count(Id)) {
+      Counter[Id] += Shard.Counter[Id].load(std::memory_order_relaxed);
+    }
+  }
+  for (auto &Timer : Shard.RepeatingTimer) {
+    RetiredRepeatingTimer[Timer.first].merge(Timer.second);
+  }
+  Shards.erase(&Shard);
+}
+
+PAMM::Id_t PAMM::getIdUnlocked(const std::string &Name) {
+  auto Search = Ids.find(Name);
+  if (Search != Ids.end()) {
+    return Search->second;
+  }
+  Id_t Id = Names.size();
+  Names.push_back(Name);
+  Ids[Name] = Id;
+  return Id;
+}
+
+PAMM::Id_t PAMM::getId(const std::string &Name) {
+  std::lock_guard<std::mutex> Lock(Mtx);
+  return getIdUnlocked(Name);
+}
+
+void PAMM::startTimer(Id_t TimerId) {
+  auto &Shard = getThreadShard();
+  bool validTimerId;
+  {
+    std::lock_guard<std::mutex> Lock(Mtx);
+    validTimerId = !StoppedTimer.count(TimerId);
+  }
+  std::lock_guard<std::mutex> ShardLock(Shard.Mtx);
+  validTimerId = validTimerId && !Shard.RunningTimer.count(TimerId);
   assert(validTimerId && "startTimer failed due to an invalid timer id");
   if (validTimerId) {
-    PAMM::TimePoint_t start = std::chrono::high_resolution_clock::now();
-    RunningTimer[TimerId] = start;
+    Shard.RunningTimer[TimerId] = Clock_t::now();
   }
 }
 
-void PAMM::resetTimer(const std::string &TimerId) {
-  assert((RunningTimer.count(TimerId) && !StoppedTimer.count(TimerId)) ||
-         (!RunningTimer.count(TimerId) && StoppedTimer.count(TimerId)) &&
-             "resetTimer failed due to an invalid timer id");
-  if (RunningTimer.count(TimerId)) {
-    RunningTimer.erase(RunningTimer.find(TimerId));
-  } else if (StoppedTimer.count(TimerId)) {
-    StoppedTimer.erase(StoppedTimer.find(TimerId));
+void PAMM::resetTimer(Id_t TimerId) {
+  auto &Shard = getThreadShard();
+  std::lock_guard<std::mutex> Lock(Mtx);
+  std::lock_guard<std::mutex> ShardLock(Shard.Mtx);
+  bool runningTimer = Shard.RunningTimer.count(TimerId);
+  bool stoppedTimer = StoppedTimer.count(TimerId);
+  assert(runningTimer != stoppedTimer &&
+         "resetTimer failed due to an invalid timer id");
+  if (runningTimer) {
+    Shard.RunningTimer.erase(TimerId);
+  } else if (stoppedTimer) {
+    StoppedTimer.erase(TimerId);
   }
 }
 
-void PAMM::stopTimer(const std::string &TimerId, bool PauseTimer) {
-  bool runningTimer = RunningTimer.count(TimerId);
-  bool validTimerId = runningTimer || StoppedTimer.count(TimerId);
-  assert(validTimerId && "stopTimer failed due to an invalid timer id or timer "
-                         "was already stopped");
-  assert(runningTimer && "stopTimer failed because timer was already stopped");
-  if (validTimerId) {
-    auto timer = RunningTimer.find(TimerId);
-    PAMM::TimePoint_t end = std::chrono::high_resolution_clock::now();
-    PAMM::TimePoint_t start = timer->second;
-    RunningTimer.erase(timer);
-    auto p = make_pair(start, end);
+void PAMM::stopTimer(Id_t TimerId, bool PauseTimer) {
+  TimePoint_t end = Clock_t::now();
+  auto &Shard = getThreadShard();
+  uint64_t Duration;
+  {
+    std::lock_guard<std::mutex> ShardLock(Shard.Mtx);
+    auto timer = Shard.RunningTimer.find(TimerId);
+    assert(timer != Shard.RunningTimer.end() &&
+           "stopTimer failed due to an invalid timer id or timer was already "
+           "stopped");
+    if (timer == Shard.RunningTimer.end()) {
+      return;
+    }
+    Duration = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                   end - timer->second)
+                   .count();
+    Shard.RunningTimer.erase(timer);
     if (PauseTimer) {
-      RepeatingTimer[TimerId].push_back(p);
-    } else {
-      StoppedTimer[TimerId] = p;
+      Shard.RepeatingTimer[TimerId].add(Duration);
+      return;
     }
   }
+  std::lock_guard<std::mutex> Lock(Mtx);
+  StoppedTimer[TimerId] = Duration;
 }
 
-unsigned long PAMM::elapsedTime(const std::string &TimerId) {
-  assert((RunningTimer.count(TimerId) || StoppedTimer.count(TimerId)) &&
+void PAMM::stopAllTimers() {
+  std::lock_guard<std::mutex> Lock(Mtx);
+  TimePoint_t end = Clock_t::now();
+  for (auto *Shard : Shards) {
+    std::lock_guard<std::mutex> ShardLock(Shard->Mtx);
+    for (auto &Timer : Shard->RunningTimer) {
+      StoppedTimer[Timer.first] =
+          std::chrono::duration_cast<std::chrono::nanoseconds>(end -
+                                                               Timer.second)
+              .count();
+    }
+    Shard->RunningTimer.clear();
+  }
+}
+
+uint64_t PAMM::elapsedTimeNs(const std::string &TimerId) {
+  TimePoint_t end = Clock_t::now();
+  auto &Shard = getThreadShard();
+  std::lock_guard<std::mutex> Lock(Mtx);
+  Id_t Id = getIdUnlocked(TimerId);
+  {
+    std::lock_guard<std::mutex> ShardLock(Shard.Mtx);
+    auto Running = Shard.RunningTimer.find(Id);
+    if (Running != Shard.RunningTimer.end()) {
+      return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                 end - Running->second)
+          .count();
+    }
+  }
+  auto Stopped = StoppedTimer.find(Id);
+  assert(Stopped != StoppedTimer.end() &&
          "elapsedTime failed due to an invalid timer id");
-  if (RunningTimer.count(TimerId)) {
-    PAMM::TimePoint_t end = std::chrono::high_resolution_clock::now();
-    PAMM::TimePoint_t start = RunningTimer[TimerId];
-    auto duration = std::chrono::duration_cast<Duration_t>(end - start);
-    return duration.count();
-  } else if (StoppedTimer.count(TimerId)) {
-    auto duration = std::chrono::duration_cast<Duration_t>(
-        StoppedTimer[TimerId].second - StoppedTimer[TimerId].first);
-    return duration.count();
+  if (Stopped != StoppedTimer.end()) {
+    return Stopped->second;
   }
   return 0;
 }
 
-std::unordered_map<std::string, std::vector<unsigned long>>
-PAMM::elapsedTimeOfRepeatingTimer() {
-  std::unordered_map<std::string, std::vector<unsigned long>> accTimes;
-  for (auto timer : RepeatingTimer) {
-    std::vector<unsigned long> accTimeVec;
-    for (auto timepair : timer.second) {
-      auto duration = std::chrono::duration_cast<PAMM::Duration_t>(
-          timepair.second - timepair.first);
-      accTimeVec.push_back(duration.count());
+unsigned long PAMM::elapsedTime(const std::string &TimerId) {
+  return std::chrono::duration_cast<Duration_t>(
+             std::chrono::nanoseconds(elapsedTimeNs(TimerId)))
+      .count();
+}
+
+std::unordered_map<PAMM::Id_t, PAMM::RepeatingTimerStats>
+PAMM::getRepeatingTimerUnlocked() {
+  auto Result = RetiredRepeatingTimer;
+  for (auto *Shard : Shards) {
+    std::lock_guard<std::mutex> ShardLock(Shard->Mtx);
+    for (auto &Timer : Shard->RepeatingTimer) {
+      Result[Timer.first].merge(Timer.second);
     }
-    accTimes[timer.first] = accTimeVec;
   }
-  return accTimes;
+  return Result;
+}
+
+std::unordered_map<std::string, PAMM::RepeatingTimerStats>
+PAMM::getRepeatingTimer() {
+  std::lock_guard<std::mutex> Lock(Mtx);
+  std::unordered_map<std::string, RepeatingTimerStats> Result;
+  for (auto &Timer : getRepeatingTimerUnlocked()) {
+    Result[Names[Timer.first]] = Timer.second;
+  }
+  return Result;
 }
 
 std::string PAMM::getPrintableDuration(unsigned long Duration) {
@@ -129,7 +292,8 @@ std::string PAMM::getPrintableDuration(unsigned long Duration) {
   return oss.str();
 }
 
-void PAMM::regCounter(const std::string &CounterId, unsigned IntialValue) {
+void PAMM::regCounter(Id_t CounterId, unsigned IntialValue) {
+  std::lock_guard<std::mutex> Lock(Mtx);
   bool validCounterId = !Counter.count(CounterId);
   assert(validCounterId && "regCounter failed due to an invalid counter id");
   if (validCounterId) {
@@ -137,29 +301,36 @@ void PAMM::regCounter(const std::string &CounterId, unsigned IntialValue) {
   }
 }
 
-void PAMM::incCounter(const std::string &CounterId, unsigned CValue) {
-  bool validCounterId = Counter.count(CounterId);
-  assert(validCounterId && "incCounter failed due to an invalid counter id");
-  if (validCounterId) {
-    Counter[CounterId] += CValue;
-  }
+void PAMM::incCounter(Id_t CounterId, unsigned CValue) {
+  getThreadShard().getCounter(CounterId).fetch_add(CValue,
+                                                   std::memory_order_relaxed);
 }
 
-void PAMM::decCounter(const std::string &CounterId, unsigned CValue) {
-  bool validCounterId = Counter.count(CounterId);
-  assert(validCounterId && "decCounter failed due to an invalid counter id");
-  if (validCounterId) {
-    Counter[CounterId] -= CValue;
+void PAMM::decCounter(Id_t CounterId, unsigned CValue) {
+  getThreadShard().getCounter(CounterId).fetch_sub(CValue,
+                                                   std::memory_order_relaxed);
+}
+
+long PAMM::getCounterUnlocked(Id_t CounterId) const {
+  auto Search = Counter.find(CounterId);
+  if (Search == Counter.end()) {
+    return -1;
+  }
+  long Count = Search->second;
+  for (auto *Shard : Shards) {
+    std::lock_guard<std::mutex> ShardLock(Shard->Mtx);
+    if (CounterId < Shard->Counter.size()) {
+      Count += Shard->Counter[CounterId].load(std::memory_order_relaxed);
+    }
   }
+  return Count;
 }
 
 int PAMM::getCounter(const std::string &CounterId) {
-  bool validCounterId = Counter.count(CounterId);
-  assert(validCounterId && "getCounter failed due to an invalid counter id");
-  if (validCounterId) {
-    return Counter[CounterId];
-  }
-  return -1;
+  std::lock_guard<std::mutex> Lock(Mtx);
+  long Count = getCounterUnlocked(getIdUnlocked(CounterId));
+  assert(Count != -1 && "getCounter failed due to an invalid counter id");
+  return Count;
 }
 
 int PAMM::getSumCount(const std::set<std::string> &CounterIds) {
@@ -176,38 +347,35 @@ int PAMM::getSumCount(const std::set<std::string> &CounterIds) {
   return sum;
 }
 
-void PAMM::regHistogram(const std::string &HistogramId) {
+void PAMM::regHistogram(Id_t HistogramId) {
+  std::lock_guard<std::mutex> Lock(Mtx);
   bool validHID = !Histogram.count(HistogramId);
   assert(validHID && "failed to register new histogram due to an invalid id");
   if (validHID) {
-    std::unordered_map<std::string, unsigned long> H;
-    Histogram[HistogramId] = H;
+    Histogram[HistogramId];
   }
 }
 
-void PAMM::addToHistogram(const std::string &HistogramId,
-                          const std::string &DataPointId,
+void PAMM::addToHistogram(Id_t HistogramId, const std::string &DataPointId,
                           unsigned long DataPointValue) {
+  std::lock_guard<std::mutex> Lock(Mtx);
   bool validHistoID = Histogram.count(HistogramId);
   assert(validHistoID &&
          "adding data point to histogram failed due to invalid id");
-  if (Histogram[HistogramId].count(DataPointId)) {
-    Histogram[HistogramId][DataPointId] += DataPointValue;
-  } else {
-    Histogram[HistogramId][DataPointId] = DataPointValue;
-  }
+  Histogram[HistogramId][DataPointId] += DataPointValue;
 }
 
 void PAMM::printTimers(std::ostream &os) {
   // stop all running timer
-  while (!RunningTimer.empty()) {
-    stopTimer(RunningTimer.begin()->first);
-  }
+  stopAllTimers();
+  std::lock_guard<std::mutex> Lock(Mtx);
   os << "Single Timer\n";
   os << "------------\n";
   for (auto timer : StoppedTimer) {
-    unsigned long time = elapsedTime(timer.first);
-    os << timer.first << " : " << getPrintableDuration(time) << '\n';
+    unsigned long time = std::chrono::duration_cast<Duration_t>(
+                             std::chrono::nanoseconds(timer.second))
+                             .count();
+    os << Names[timer.first] << " : " << getPrintableDuration(time) << '\n';
   }
   if (StoppedTimer.empty()) {
     os << "No single Timer started!\n\n";
@@ -216,14 +384,17 @@ void PAMM::printTimers(std::ostream &os) {
   }
   os << "Repeating Timer\n";
   os << "---------------\n";
-  for (auto timer : elapsedTimeOfRepeatingTimer()) {
-    unsigned long sum = 0;
-    os << timer.first << " Timer:\n";
-    for (auto duration : timer.second) {
-      sum += duration;
-      os << duration << '\n';
-    }
-    os << "===\n" << sum << "\n\n";
+  auto RepeatingTimer = getRepeatingTimerUnlocked();
+  for (auto &timer : RepeatingTimer) {
+    const auto &Stats = timer.second;
+    os << Names[timer.first] << " Timer (ns):\n";
+    os << "count : " << Stats.Count << '\n';
+    os << "min   : " << Stats.Min << '\n';
+    os << "max   : " << Stats.Max << '\n';
+    os << "p50   : " << Stats.percentile(50) << '\n';
+    os << "p90   : " << Stats.percentile(90) << '\n';
+    os << "p99   : " << Stats.percentile(99) << '\n';
+    os << "===\n" << Stats.Sum << "\n\n";
   }
   if (RepeatingTimer.empty()) {
     os << "No repeating Timer found!\n";
@@ -233,10 +404,12 @@ void PAMM::printTimers(std::ostream &os) {
 }
 
 void PAMM::printCounters(std::ostream &os) {
+  std::lock_guard<std::mutex> Lock(Mtx);
   os << "\nCounter\n";
   os << "-------\n";
   for (auto counter : Counter) {
-    os << counter.first << " : " << counter.second << '\n';
+    os << Names[counter.first] << " : " << getCounterUnlocked(counter.first)
+       << '\n';
   }
   if (Counter.empty()) {
     os << "No Counter registered!\n";
@@ -246,10 +419,11 @@ void PAMM::printCounters(std::ostream &os) {
 }
 
 void PAMM::printHistograms(std::ostream &os) {
+  std::lock_guard<std::mutex> Lock(Mtx);
   os << "\nHistograms\n";
   os << "--------------\n";
   for (auto H : Histogram) {
-    os << H.first << " Histogram\n";
+    os << Names[H.first] << " Histogram\n";
     os << "Value : #Occurrences\n";
     for (auto entry : H.second) {
       os << entry.first << " : " << entry.second << '\n';
@@ -274,16 +448,21 @@ void PAMM::exportMeasuredData(std::string OutputPath) {
   json jsonData;
 
   // add timer data
-  while (!RunningTimer.empty()) {
-    stopTimer(std::string(RunningTimer.begin()->first));
-  }
+  stopAllTimers();
+  std::unique_lock<std::mutex> Lock(Mtx);
   json jTimer;
   for (auto timer : StoppedTimer) {
-    unsigned long time = elapsedTime(timer.first);
-    jTimer[timer.first] = time;
-  }
-  for (auto timer : elapsedTimeOfRepeatingTimer()) {
-    jTimer[timer.first] = timer.second;
+    jTimer[Names[timer.first]] = std::chrono::duration_cast<Duration_t>(
+                                     std::chrono::nanoseconds(timer.second))
+                                     .count();
+  }
+  for (auto &timer : getRepeatingTimerUnlocked()) {
+    const auto &Stats = timer.second;
+    jTimer[Names[timer.first]] = {
+        {"Count", Stats.Count},          {"Sum (ns)", Stats.Sum},
+        {"Min (ns)", Stats.Min},         {"Max (ns)", Stats.Max},
+        {"P50 (ns)", Stats.percentile(50)}, {"P90 (ns)", Stats.percentile(90)},
+        {"P99 (ns)", Stats.percentile(99)}};
   }
   jsonData["Timer"] = jTimer;
 
@@ -294,7 +473,7 @@ void PAMM::exportMeasuredData(std::string OutputPath) {
     for (auto entry : H.second) {
       jSetH[entry.first] = entry.second;
     }
-    jHistogram[H.first] = jSetH;
+    jHistogram[Names[H.first]] = jSetH;
   }
   if (!jHistogram.is_null()) {
     jsonData["Histogram"] = jHistogram;
@@ -302,9 +481,10 @@ void PAMM::exportMeasuredData(std::string OutputPath) {
   // add counter data
   json jCounter;
   for (auto counter : Counter) {
-    jCounter[counter.first] = counter.second;
+    jCounter[Names[counter.first]] = getCounterUnlocked(counter.first);
   }
   jsonData["Counter"] = jCounter;
+  Lock.unlock();
 
   // add analysis/project/source file information if available
   json jInfo;
@@ -340,9 +520,17 @@ void PAMM::exportMeasuredData(std::string OutputPath) {
 }
 
 void PAMM::reset() {
-  RunningTimer.clear();
+  std::lock_guard<std::mutex> Lock(Mtx);
+  for (auto *Shard : Shards) {
+    std::lock_guard<std::mutex> ShardLock(Shard->Mtx);
+    Shard->RunningTimer.clear();
+    Shard->RepeatingTimer.clear();
+    for (auto &Count : Shard->Counter) {
+      Count.store(0, std::memory_order_relaxed);
+    }
+  }
   StoppedTimer.clear();
-  RepeatingTimer.clear();
+  RetiredRepeatingTimer.clear();
   Counter.clear();
   Histogram.clear();
 }
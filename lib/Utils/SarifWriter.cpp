@@ -0,0 +1,123 @@
+/******************************************************************************
+ * Copyright (c) 2019 Philipp Schubert.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Philipp Schubert and others
+ *****************************************************************************/
+
+#include <cassert>
+#include <ostream>
+
+#include "phasar/Utils/LLVMIRToSrc.h"
+#include "phasar/Utils/SarifWriter.h"
+
+namespace psr {
+
+const std::string SarifWriter::Version = "2.1.0";
+const std::string SarifWriter::Schema =
+    "https://schemastore.azurewebsites.net/schemas/json/sarif-2.1.0.json";
+
+SarifWriter::SarifWriter(std::ostream &OS, const std::string &ToolName)
+    : OS(OS), W(OS) {
+  W.beginObject();
+  W.key("version");
+  W.value(Version);
+  W.key("$schema");
+  W.value(Schema);
+  W.key("runs");
+  W.beginArray();
+  W.beginObject();
+  W.key("tool");
+  W.beginObject();
+  W.key("driver");
+  W.beginObject();
+  W.key("name");
+  W.value(ToolName);
+  W.endObject();
+  W.endObject();
+  W.key("results");
+  W.beginArray();
+}
+
+SarifWriter::~SarifWriter() { close(); }
+
+void SarifWriter::addResult(const std::string &RuleId, Level L,
+                            const std::string &Message, const Location &Loc) {
+  assert(!Closed && "cannot add results to a closed log");
+  static const char *LevelNames[] = {"none", "note", "warning", "error"};
+  W.beginObject();
+  W.key("ruleId");
+  W.value(RuleId);
+  W.key("level");
+  W.value(LevelNames[static_cast<unsigned>(L)]);
+  W.key("message");
+  W.beginObject();
+  W.key("text");
+  W.value(Message);
+  W.endObject();
+  W.key("locations");
+  W.beginArray();
+  W.beginObject();
+  if (!Loc.File.empty()) {
+    W.key("physicalLocation");
+    W.beginObject();
+    W.key("artifactLocation");
+    W.beginObject();
+    W.key("uri");
+    W.value(Loc.File);
+    W.endObject();
+    if (Loc.Line != 0) {
+      W.key("region");
+      W.beginObject();
+      W.key("startLine");
+      W.value(Loc.Line);
+      if (Loc.Column != 0) {
+        W.key("startColumn");
+        W.value(Loc.Column);
+      }
+      W.endObject();
+    }
+    W.endObject();
+  }
+  if (!Loc.Function.empty()) {
+    W.key("logicalLocations");
+    W.beginArray();
+    W.beginObject();
+    W.key("fullyQualifiedName");
+    W.value(Loc.Function);
+    W.key("kind");
+    W.value("function");
+    W.endObject();
+    W.endArray();
+  }
+  W.endObject();
+  W.endArray();
+  W.endObject();
+  ++NumResults;
+}
+
+void SarifWriter::close() {
+  if (Closed) {
+    return;
+  }
+  Closed = true;
+  // results, run, runs and the log itself
+  W.endArray();
+  W.endObject();
+  W.endArray();
+  W.endObject();
+  OS << '\n';
+}
+
+SarifWriter::Location SarifWriter::getLocationOf(const llvm::Value *V) {
+  Location Loc;
+  Loc.File = getFilePathFromIR(V);
+  Loc.Line = getLineFromIR(V);
+  Loc.Column = getColumnFromIR(V);
+  Loc.Function = getFunctionNameFromIR(V);
+  return Loc;
+}
+
+} // namespace psr
@@ -0,0 +1,80 @@
+/******************************************************************************
+ * Copyright (c) 2017 Philipp Schubert.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Philipp Schubert and others
+ *****************************************************************************/
+
+#include <algorithm>
+#include <fstream>
+#include <ostream>
+
+#include "phasar/Utils/TraceRecorder.h"
+
+using json = nlohmann::json;
+
+namespace psr {
+
+TraceRecorder::TraceRecorder(unsigned SampleRate, size_t MaxEvents)
+    : SampleRate(std::max(SampleRate, 1u)), MaxEvents(MaxEvents),
+      Epoch(Clock_t::now()) {}
+
+void TraceRecorder::record(const char *Name, const char *Category,
+                           std::string Detail, Clock_t::time_point Start,
+                           Clock_t::time_point End) {
+  if (Events.size() >= MaxEvents) {
+    ++Dropped;
+    return;
+  }
+  auto ToNs = [](Clock_t::duration D) {
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(D).count());
+  };
+  Events.push_back({Name, Category, std::move(Detail), ToNs(Start - Epoch),
+                    ToNs(End - Start)});
+}
+
+void TraceRecorder::clear() {
+  Events.clear();
+  Seen = 0;
+  Dropped = 0;
+  Epoch = Clock_t::now();
+}
+
+json TraceRecorder::getAsJson() const {
+  json TraceEvents = json::array();
+  for (const auto &E : Events) {
+    // complete events ("X"), timestamps are given in microseconds
+    json JE = {{"name", E.Name},
+               {"cat", E.Category},
+               {"ph", "X"},
+               {"ts", static_cast<double>(E.StartNs) / 1000.0},
+               {"dur", static_cast<double>(E.DurationNs) / 1000.0},
+               {"pid", 0},
+               {"tid", 0}};
+    if (!E.Detail.empty()) {
+      JE["args"] = {{"detail", E.Detail}};
+    }
+    TraceEvents.push_back(std::move(JE));
+  }
+  return {{"traceEvents", std::move(TraceEvents)},
+          {"displayTimeUnit", "ns"},
+          {"otherData",
+           {{"sampleRate", SampleRate}, {"droppedEvents", Dropped}}}};
+}
+
+void TraceRecorder::exportChromeTrace(std::ostream &OS) const {
+  OS << getAsJson() << '\n';
+}
+
+void TraceRecorder::exportChromeTrace(const std::string &OutputPath) const {
+  std::ofstream File(OutputPath);
+  if (!File.is_open()) {
+    throw std::ios_base::failure("could not write file: " + OutputPath);
+  }
+  exportChromeTrace(File);
+}
+
+} // namespace psr
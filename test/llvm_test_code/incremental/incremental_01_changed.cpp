@@ -0,0 +1,18 @@
+int increment(int i) { return i + 2; }
+
+int uninit(int k) {
+  int j;
+  return j + k;
+}
+
+int compute(int a) {
+  int b = increment(a);
+  return b * 2;
+}
+
+int main() {
+  int x;
+  int y = compute(x);
+  int z = uninit(y);
+  return y + z;
+}
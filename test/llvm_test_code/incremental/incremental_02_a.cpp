@@ -0,0 +1,3 @@
+static int helper(int i) { return i + 1; }
+
+int first(int a) { return helper(a) * 2; }
@@ -0,0 +1,8 @@
+int first(int a);
+
+static int helper(int i) { return i + 2; }
+
+int main() {
+  int x = 1;
+  return first(x) + helper(x);
+}
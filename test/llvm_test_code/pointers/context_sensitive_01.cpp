@@ -0,0 +1,10 @@
+int *id(int *v) { return v; }
+
+int main() {
+  int x, y;
+  int *p = id(&x);
+  int *q = id(&y);
+  *p = 1;
+  *q = 2;
+  return 0;
+}
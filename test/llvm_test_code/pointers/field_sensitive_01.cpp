@@ -0,0 +1,16 @@
+struct S {
+  int *a;
+  int *b;
+};
+
+int main() {
+  int x, y;
+  S s;
+  s.a = &x;
+  s.b = &y;
+  int *p = s.a;
+  int *q = s.b;
+  *p = 1;
+  *q = 2;
+  return 0;
+}
@@ -0,0 +1,14 @@
+#include <cstdlib>
+
+void set(int **pp, int *v) { *pp = v; }
+
+int main() {
+  int *p, *q;
+  set(&p, static_cast<int *>(malloc(sizeof(int))));
+  set(&q, static_cast<int *>(malloc(sizeof(int))));
+  *p = 1;
+  *q = 2;
+  free(p);
+  free(q);
+  return 0;
+}
@@ -0,0 +1,10 @@
+extern int source();     // dummy source
+extern void sink(int p); // dummy sink
+
+int get() { return source(); }
+
+int main(int argc, char **argv) {
+	int a = get();
+	sink(a);
+	return 0;
+}
\ No newline at end of file
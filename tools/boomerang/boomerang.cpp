@@ -37,6 +37,7 @@ int main(int argc, char **argv) {
   LLVMTypeHierarchy H(DB);
   LLVMPointsToInfo P(DB);
   LLVMBasedICFG ICFG(DB, CallGraphAnalysisType::OTF, {"main"}, &H, &P);
+  SyncPDSSolver SPDS(ICFG);
   for (auto &F : *DB.getWPAModule()) {
     if (F.isDeclaration()) { continue; }
     llvm::outs() << "ANALYZE FUNCTION: " << F.getName() << '\n';
@@ -60,12 +61,12 @@ int main(int argc, char **argv) {
             Load->getPointerOperand()->print(llvm::outs());
             llvm::outs() << '\n';
             // query SPDS solver to find the aliases
-            // SyncPDSSolver SPDS(ICFG);
-            // set<const llvm::Value *> Aliases = SPDS.getAliasesOf(Load->getPointerOperand());
-            // llvm::outs() << "Found aliases:";
-            // for (auto A : Aliases) {
-            //   A->print(llvm::outs() << '\n');
-            // }
+            set<const llvm::Value *> Aliases =
+                SPDS.getAliasesOf(Load->getPointerOperand());
+            llvm::outs() << "Found aliases:";
+            for (const auto *A : Aliases) {
+              A->print(llvm::outs() << '\n');
+            }
             llvm::outs() << '\n';
           } else {
             llvm::outs() << "Ups!\n";
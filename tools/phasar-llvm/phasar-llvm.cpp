@@ -60,8 +60,10 @@ void validateParamModule(const std::vector<std::string> &Modules) {
 }
 
 void validateParamExport(const std::string &Export) {
-  throw boost::program_options::error_with_option_name(
-      "Parameter not supported, yet.");
+  if (Export != "JSON" && Export != "SARIF") {
+    throw boost::program_options::error_with_option_name(
+        "'" + Export + "' is not a valid export mode, use JSON or SARIF!");
+  }
 }
 
 void validateParamOutput(const std::string &Output) {
@@ -90,6 +92,15 @@ void validateParamAnalysisStrategy(const std::string &Strategy) {
   }
 }
 
+void validateParamLogCategory(const std::vector<std::string> &Categories) {
+  for (const auto &Category : Categories) {
+    if (!StringToLogCategory.count(Category)) {
+      throw boost::program_options::error_with_option_name(
+          "'" + Category + "' is not a valid log category!");
+    }
+  }
+}
+
 void validateParamPointerAnalysis(const std::string &Analysis) {
   if (to_PointerAnalysisType(Analysis) == PointerAnalysisType::Invalid) {
     throw boost::program_options::error_with_option_name(
@@ -166,6 +177,10 @@ int main(int argc, const char **argv) {
       ("entry-points,E", boost::program_options::value<std::vector<std::string>>()->multitoken()->zero_tokens()->composing(), "Set the entry point(s) to be used")
 			("data-flow-analysis,D", boost::program_options::value<std::vector<std::string>>()->multitoken()->zero_tokens()->composing()->notifier(&validateParamDataFlowAnalysis), "Set the analysis to be run")
 			("analysis-strategy", boost::program_options::value<std::string>()->default_value("WPA")->notifier(&validateParamAnalysisStrategy))
+      ("query-points", boost::program_options::value<std::vector<std::size_t>>()->multitoken()->zero_tokens()->composing(), "Set the instruction id(s) to be queried by the demand-driven analysis strategy (DD)")
+      ("incremental-state-dir", boost::program_options::value<std::string>(), "Set the directory in which the incremental analysis strategy (INC) persists its runs (default: output directory)")
+      ("module-summaries", boost::program_options::value<std::vector<std::string>>()->multitoken()->zero_tokens()->composing(), "Set the module summaries to be linked by the module-wise analysis strategy (MWA); if none are given, each module is summarized into the output directory instead")
+      ("analysis-jobs", boost::program_options::value<unsigned>()->default_value(1), "Set the number of data-flow analyses that are run concurrently by the whole-program analysis strategy (WPA); each analysis then emits its results into its own subdirectory <index>-<analysis> of the output directory, or prefixes its result store by <index>-<analysis> without one")
       ("analysis-config", boost::program_options::value<std::vector<std::string>>()->multitoken()->zero_tokens()->composing()->notifier(&validateParamAnalysisConfig), "Set the analysis's configuration (if required)")
       ("pointer-analysis,P", boost::program_options::value<std::string>()->notifier(&validateParamPointerAnalysis)->default_value("CFLAnders"), "Set the points-to analysis to be used (CFLSteens, CFLAnders)")
       ("call-graph-analysis,C", boost::program_options::value<std::string>()->notifier(&validateParamCallGraphAnalysis)->default_value("OTF"), "Set the call-graph algorithm to be used (NORESOLVE, CHA, RTA, DTA, VTA, OTF)")
@@ -175,14 +190,18 @@ int main(int argc, const char **argv) {
 			("mwa,M", "Enable Modulewise-program analysis mode")
 			("printedgerec,R", "Print exploded-super-graph edge recorder")
       ("log,L", "Enable logging")
-      ("export,E", boost::program_options::value<std::string>()->notifier(&validateParamExport), "Export mode (JSON, SARIF) (Not implemented yet!)")
+      ("log-disable-category", boost::program_options::value<std::vector<std::string>>()->multitoken()->zero_tokens()->composing()->notifier(&validateParamLogCategory), "Disable the log messages of the given categories (General, Solver, FlowEdgeFunctionCache)")
+      ("export,E", boost::program_options::value<std::string>()->notifier(&validateParamExport), "Export the data-flow results in the given format (JSON, SARIF)")
       ("project-id,I", boost::program_options::value<std::string>()->default_value("default-phasar-project"), "Project id used for output")
       ("out,O", boost::program_options::value<std::string>()->notifier(&validateParamOutput)->default_value(""), "Output directory; if specified all results are written to the output directory instead of stdout")
       ("emit-ir", "Emit preprocessed and annotated IR of analysis target")
       ("emit-raw-results", "Emit unprocessed/raw solver results")
+      ("emit-result-store", "Emit solver results as memory-mappable binary store (<analysis>-psr-results.bin) that supports lookups by instruction ID")
       ("emit-text-report", "Emit textual report of solver results")
       ("emit-graphical-report", "Emit graphical report of solver results")
       ("emit-esg-as-dot", "Emit the exploded super-graph (ESG) as DOT graph")
+      ("solver-trace", boost::program_options::value<std::string>(), "Export a sampled trace of the IFDS/IDE solver in the Chrome trace-event format to the given file")
+      ("solver-trace-sample-rate", boost::program_options::value<unsigned>()->default_value(1), "Record only every n-th solver trace event")
       ("emit-th-as-text", "Emit the type hierarchy as text")
       ("emit-th-as-dot", "Emit the type hierarchy as DOT graph")
       ("emit-th-as-json", "Emit the type hierarchy as JSON")
@@ -234,6 +253,13 @@ int main(int argc, const char **argv) {
     return 1;
   }
   initializeLogger(PhasarConfig::VariablesMap().count("log"));
+  if (PhasarConfig::VariablesMap().count("log-disable-category")) {
+    for (const auto &Category :
+         PhasarConfig::VariablesMap()["log-disable-category"]
+             .as<std::vector<std::string>>()) {
+      setLogCategoryEnabled(StringToLogCategory.at(Category), false);
+    }
+  }
   // print PhASER version
   if (PhasarConfig::VariablesMap().count("version")) {
     std::cout << "PhASAR " << PhasarConfig::PhasarVersion() << "\n";
@@ -273,6 +299,13 @@ int main(int argc, const char **argv) {
   } else {
     Strategy = AnalysisStrategy::WholeProgram;
   }
+  if (PhasarConfig::VariablesMap().count("mwa")) {
+    Strategy = AnalysisStrategy::ModuleWise;
+  }
+  // modules that are summarized must neither be linked nor require a 'main'
+  bool SummarizeModules =
+      Strategy == AnalysisStrategy::ModuleWise &&
+      !PhasarConfig::VariablesMap().count("module-summaries");
   if (!PhasarConfig::VariablesMap().count("module")) {
     std::cout << "At least on LLVM target module is required!\n"
                  "Specify a LLVM target module or re-run with '--help'\n";
@@ -280,7 +313,9 @@ int main(int argc, const char **argv) {
   }
   // setup IRDB as source code manager
   ProjectIRDB IRDB(
-      PhasarConfig::VariablesMap()["module"].as<std::vector<std::string>>());
+      PhasarConfig::VariablesMap()["module"].as<std::vector<std::string>>(),
+      SummarizeModules ? IRDBOptions::OWNS
+                       : (IRDBOptions::WPA | IRDBOptions::OWNS));
   // setup data-flow analyses
   std::vector<DataFlowAnalysisType> DataFlowAnalyses;
   if (PhasarConfig::VariablesMap().count("data-flow-analysis")) {
@@ -303,7 +338,7 @@ int main(int argc, const char **argv) {
     auto Entries = vectorToSet(PhasarConfig::VariablesMap()["entry-points"]
                                    .as<std::vector<std::string>>());
     EntryPoints.insert(Entries.begin(), Entries.end());
-  } else {
+  } else if (!SummarizeModules) {
     EntryPoints.insert("main");
   }
   // setup pointer algorithm to be used
@@ -324,6 +359,9 @@ int main(int argc, const char **argv) {
   if (PhasarConfig::VariablesMap().count("emit-raw-results")) {
     EmitterOptions |= AnalysisControllerEmitterOptions::EmitRawResults;
   }
+  if (PhasarConfig::VariablesMap().count("emit-result-store")) {
+    EmitterOptions |= AnalysisControllerEmitterOptions::EmitResultStore;
+  }
   if (PhasarConfig::VariablesMap().count("emit-text-report")) {
     EmitterOptions |= AnalysisControllerEmitterOptions::EmitTextReport;
   }
@@ -360,6 +398,13 @@ int main(int argc, const char **argv) {
   if (PhasarConfig::VariablesMap().count("emit-pta-as-json")) {
     EmitterOptions |= AnalysisControllerEmitterOptions::EmitPTAAsJson;
   }
+  if (PhasarConfig::VariablesMap().count("export")) {
+    if (PhasarConfig::VariablesMap()["export"].as<std::string>() == "JSON") {
+      EmitterOptions |= AnalysisControllerEmitterOptions::EmitJsonReport;
+    } else {
+      EmitterOptions |= AnalysisControllerEmitterOptions::EmitSarifReport;
+    }
+  }
   // setup output directory
   std::string OutDirectory;
   if (PhasarConfig::VariablesMap().count("out")) {
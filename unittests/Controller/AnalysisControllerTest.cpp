@@ -0,0 +1,71 @@
+#include <string>
+#include <vector>
+
+#include "boost/filesystem.hpp"
+
+#include "gtest/gtest.h"
+
+#include "phasar/Config/Configuration.h"
+#include "phasar/Controller/AnalysisController.h"
+#include "phasar/DB/ProjectIRDB.h"
+#include "phasar/PhasarLLVM/DataFlowSolver/IfdsIde/ResultStore.h"
+#include "phasar/Utils/Logger.h"
+
+using namespace psr;
+
+/* ============== TEST FIXTURE ============== */
+class AnalysisControllerTest : public ::testing::Test {
+protected:
+  const std::string pathToLLFiles =
+      PhasarConfig::getPhasarConfig().PhasarDirectory() +
+      "build/test/llvm_test_code/linear_constant/";
+  const std::string OutDirectory = "AnalysisControllerTest";
+
+  void SetUp() override {
+    boost::log::core::get()->set_logging_enabled(false);
+    boost::filesystem::remove_all(OutDirectory);
+    boost::filesystem::create_directory(OutDirectory);
+  }
+
+  void TearDown() override { boost::filesystem::remove_all(OutDirectory); }
+
+  /// Returns the result directory that the controller created for its run.
+  boost::filesystem::path getResultDirectory() {
+    std::vector<boost::filesystem::path> Dirs;
+    for (const auto &Entry :
+         boost::filesystem::directory_iterator(OutDirectory)) {
+      Dirs.push_back(Entry.path());
+    }
+    EXPECT_EQ(Dirs.size(), 1U);
+    return Dirs.empty() ? boost::filesystem::path() : Dirs.front();
+  }
+};
+
+TEST_F(AnalysisControllerTest, HandleResultStoresOfSeveralAnalyses) {
+  ProjectIRDB IRDB({pathToLLFiles + "call_01_cpp_dbg.ll"}, IRDBOptions::WPA);
+  std::vector<DataFlowAnalysisType> DataFlowAnalyses = {
+      DataFlowAnalysisType::IDELinearConstantAnalysis,
+      DataFlowAnalysisType::IFDSUninitializedVariables};
+  AnalysisController Controller(
+      IRDB, DataFlowAnalyses, {}, PointerAnalysisType::CFLAnders,
+      CallGraphAnalysisType::OTF, SoundnessFlag::SOUNDY, {"main"},
+      AnalysisStrategy::WholeProgram,
+      AnalysisControllerEmitterOptions::EmitResultStore, "test",
+      OutDirectory);
+  auto ResultDir = getResultDirectory();
+  // each analysis has its own store, the second one must not overwrite the
+  // first one
+  for (auto DataFlowAnalysis : DataFlowAnalyses) {
+    auto Path = ResultDir / (to_string(DataFlowAnalysis) + "-psr-results.bin");
+    ASSERT_TRUE(boost::filesystem::exists(Path)) << Path.string();
+    ResultStore Store(Path.string());
+    EXPECT_GT(Store.getNumNodes(), 0U);
+    EXPECT_GT(Store.getNumCells(), 0U);
+  }
+}
+
+// main function for the test case
+int main(int Argc, char **Argv) {
+  ::testing::InitGoogleTest(&Argc, Argv);
+  return RUN_ALL_TESTS();
+}
@@ -264,6 +264,80 @@ TEST(HexastoreTest, StoreGraphWithEdgeLabels) {
   ASSERT_TRUE(boost::isomorphism(I, J));
 }
 
+TEST(HexastoreTest, PutBatch) {
+  Hexastore H("PutBatch.sqlite", true);
+  std::vector<std::array<std::string, 3>> Edges;
+  for (unsigned I = 0; I < 100; ++I) {
+    Edges.push_back({{"s" + to_string(I), "p", "o" + to_string(I % 10)}});
+  }
+  // duplicates are silently ignored as for put()
+  Edges.push_back({{"s0", "p", "o0"}});
+  H.putBatch(Edges, 16);
+
+  auto Result = H.get({{"?", "p", "?"}});
+  ASSERT_EQ(Result.size(), 100);
+  Result = H.get({{"?", "?", "o3"}});
+  ASSERT_EQ(Result.size(), 10);
+  Result = H.get({{"s42", "p", "o2"}});
+  ASSERT_EQ(Result.size(), 1);
+  ASSERT_EQ(Result[0], hs_result("s42", "p", "o2"));
+}
+
+TEST(HexastoreTest, ExplicitTransaction) {
+  Hexastore H("ExplicitTransaction.sqlite");
+  H.beginTransaction();
+  H.put({{"mary", "likes", "hexastores"}});
+  H.putBatch({{{"mary", "likes", "apples"}}, {{"peter", "likes", "apples"}}});
+  H.commitTransaction();
+  H.beginTransaction();
+  H.put({{"frank", "admires", "bananas"}});
+  H.rollbackTransaction();
+
+  auto Result = H.get({{"?", "?", "?"}});
+  ASSERT_EQ(Result.size(), 3);
+  Result = H.get({{"frank", "?", "?"}});
+  ASSERT_TRUE(Result.empty());
+}
+
+TEST(HexastoreTest, StreamingQueries) {
+  Hexastore H("StreamingQueries.sqlite");
+  H.putBatch({{{"node_1", "calls", "node_2"}},
+              {{"node_19", "calls", "node_2"}},
+              {{"node_2", "calls", "node_3"}},
+              {{"\"name\"", "calls", "node_1"}}});
+
+  // cursors yield the same rows as get()
+  auto C = H.query({{"?", "calls", "?"}});
+  std::vector<hs_result> Result;
+  while (C.next()) {
+    Result.push_back(C.result());
+  }
+  ASSERT_EQ(Result, H.get({{"?", "calls", "?"}}));
+  ASSERT_EQ(Result.size(), 4);
+
+  // quotes in names are bound as values, not spliced into the query
+  Result = H.get({{"\"name\"", "?", "?"}});
+  ASSERT_EQ(Result.size(), 1);
+  ASSERT_EQ(Result[0], hs_result("\"name\"", "calls", "node_1"));
+
+  // prefix queries
+  std::set<std::string> Subjects;
+  H.forEach(
+      {{"node_1", "?", "?"}},
+      [&Subjects](llvm::StringRef S, llvm::StringRef P, llvm::StringRef O) {
+        Subjects.insert(S.str());
+      },
+      true);
+  ASSERT_EQ(Subjects, std::set<std::string>({"node_1", "node_19"}));
+
+  // batched lookups
+  unsigned Count = 0;
+  H.forEachBatch({{{"?", "?", "node_2"}}, {{"node_2", "?", "?"}}},
+                 [&Count](llvm::StringRef S, llvm::StringRef P,
+                          llvm::StringRef O) { ++Count; });
+  ASSERT_EQ(Count, 3);
+}
+
 int main(int argc, char **argv) {
   ::testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
@@ -0,0 +1,99 @@
+#include "llvm/IR/DerivedTypes.h"
+#include "llvm/IR/LLVMContext.h"
+#include "llvm/IR/Type.h"
+
+#include "phasar/PhasarLLVM/DataFlowSolver/IfdsIde/IFDSFieldSensTaintAnalysis/Utils/DataFlowUtils.h"
+#include "gtest/gtest.h"
+
+using namespace psr;
+
+/* ============== TEST FIXTURE ============== */
+class DataFlowUtilsTest : public ::testing::Test {
+protected:
+  llvm::LLVMContext Ctx;
+  llvm::Type *I32 = llvm::Type::getInt32Ty(Ctx);
+  llvm::StructType *VaList = llvm::StructType::create(
+      Ctx, {I32, I32, llvm::Type::getInt8PtrTy(Ctx)}, "struct.__va_list_tag");
+  llvm::StructType *Union = llvm::StructType::create(Ctx, {I32}, "union.U");
+
+  /// Returns the flags of type wrapped into a pointer, an array and a literal
+  /// struct, which are all printed together with type.
+  std::vector<unsigned> classifyWrapped(llvm::Type *Type) {
+    return {
+        DataFlowUtils::classifyType(llvm::PointerType::getUnqual(Type)),
+        DataFlowUtils::classifyType(llvm::ArrayType::get(Type, 2)),
+        DataFlowUtils::classifyType(llvm::StructType::get(Ctx, {I32, Type}))};
+  }
+};
+
+TEST_F(DataFlowUtilsTest, HandleVaListTypes) {
+  EXPECT_EQ(DataFlowUtils::classifyType(VaList), DataFlowUtils::VA_LIST_TYPE);
+  for (auto Flags : classifyWrapped(VaList)) {
+    EXPECT_EQ(Flags, DataFlowUtils::VA_LIST_TYPE);
+  }
+  // the names of identified structs are uniqued by a numeric suffix
+  auto *VaListCopy =
+      llvm::StructType::create(Ctx, {I32}, "struct.__va_list_tag");
+  EXPECT_EQ(VaListCopy->getName(), "struct.__va_list_tag.0");
+  EXPECT_EQ(DataFlowUtils::classifyType(VaListCopy),
+            DataFlowUtils::VA_LIST_TYPE);
+}
+
+TEST_F(DataFlowUtilsTest, HandleUnionTypes) {
+  EXPECT_EQ(DataFlowUtils::classifyType(Union), DataFlowUtils::UNION_TYPE);
+  for (auto Flags : classifyWrapped(Union)) {
+    EXPECT_EQ(Flags, DataFlowUtils::UNION_TYPE);
+  }
+  auto *AnonUnion = llvm::StructType::create(Ctx, {I32}, "union.anon");
+  auto *AnonUnionCopy = llvm::StructType::create(Ctx, {I32}, "union.anon");
+  EXPECT_EQ(AnonUnionCopy->getName(), "union.anon.0");
+  EXPECT_EQ(DataFlowUtils::classifyType(AnonUnion), DataFlowUtils::UNION_TYPE);
+  EXPECT_EQ(DataFlowUtils::classifyType(AnonUnionCopy),
+            DataFlowUtils::UNION_TYPE);
+  // both kinds of types may be contained in the same literal struct
+  EXPECT_EQ(
+      DataFlowUtils::classifyType(llvm::StructType::get(Ctx, {VaList, Union})),
+      DataFlowUtils::VA_LIST_TYPE | DataFlowUtils::UNION_TYPE);
+}
+
+TEST_F(DataFlowUtilsTest, HandleIdentifiedStructs) {
+  // identified structs are printed by name only, hence their elements are not
+  // taken into account
+  auto *Struct =
+      llvm::StructType::create(Ctx, {VaList, Union}, "struct.Wrapper");
+  EXPECT_EQ(DataFlowUtils::classifyType(Struct), 0U);
+  for (auto Flags : classifyWrapped(Struct)) {
+    EXPECT_EQ(Flags, 0U);
+  }
+  EXPECT_EQ(DataFlowUtils::classifyType(I32), 0U);
+}
+
+TEST_F(DataFlowUtilsTest, HandleMagicReturnType) {
+  auto *Magic = llvm::IntegerType::get(Ctx, 4711);
+  EXPECT_EQ(DataFlowUtils::classifyType(Magic),
+            DataFlowUtils::MAGIC_RETURN_TYPE);
+  // only the magic type itself is printed as "i4711"
+  for (auto Flags : classifyWrapped(Magic)) {
+    EXPECT_EQ(Flags, 0U);
+  }
+  EXPECT_EQ(DataFlowUtils::classifyType(llvm::IntegerType::get(Ctx, 47)), 0U);
+}
+
+TEST_F(DataFlowUtilsTest, HandleTypeCache) {
+  DataFlowUtils::TypeCache Cache;
+  auto *VaListPtr = llvm::PointerType::getUnqual(VaList);
+  EXPECT_TRUE(DataFlowUtils::isVaListType(VaListPtr, Cache));
+  EXPECT_FALSE(DataFlowUtils::isVaListType(Union, Cache));
+  EXPECT_EQ(Cache.size(), 2U);
+  EXPECT_EQ(DataFlowUtils::getTypeFlags(VaListPtr, Cache),
+            DataFlowUtils::VA_LIST_TYPE);
+  EXPECT_EQ(DataFlowUtils::getTypeFlags(Union, Cache),
+            DataFlowUtils::UNION_TYPE);
+  EXPECT_EQ(Cache.size(), 2U);
+}
+
+// main function for the test case
+int main(int Argc, char **Argv) {
+  ::testing::InitGoogleTest(&Argc, Argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,105 @@
+#include "phasar/PhasarLLVM/DataFlowSolver/IfdsIde/LibrarySummaries.h"
+#include "phasar/PhasarLLVM/DataFlowSolver/IfdsIde/LLVMFlowFunctions/LibrarySummaryFlow.h"
+#include "phasar/PhasarLLVM/DataFlowSolver/IfdsIde/LLVMZeroValue.h"
+#include "phasar/PhasarLLVM/DataFlowSolver/IfdsIde/SpecialSummaries.h"
+#include "llvm/AsmParser/Parser.h"
+#include "llvm/IR/InstIterator.h"
+#include "llvm/IR/Instructions.h"
+#include "llvm/IR/LLVMContext.h"
+#include "llvm/IR/Module.h"
+#include "llvm/Support/SourceMgr.h"
+#include "gtest/gtest.h"
+
+using namespace psr;
+
+/* ============== TEST FIXTURE ============== */
+class LibrarySummariesTest : public ::testing::Test {
+protected:
+  const nlohmann::json Summaries = {
+      {"Version", 1},
+      {"Functions",
+       {{"lib_copy",
+         {{"Flows",
+           {{{"From", "Arg1"}, {"To", {"Arg0", "Return"}}},
+            {{"From", "Zero"}, {"To", {"Global:lib_state"}}},
+            {{"From", "Arg2"}, {"To", {"Return"}}}}}}}}}};
+
+  const std::string IR = R"(
+@lib_state = external global i32
+declare i8* @lib_copy(i8*, i8*)
+define i8* @main(i8* %dst, i8* %src, i8* %other) {
+  %r = call i8* @lib_copy(i8* %dst, i8* %src)
+  ret i8* %r
+}
+)";
+
+  llvm::LLVMContext Ctx;
+  std::unique_ptr<llvm::Module> M;
+  const llvm::CallInst *Call = nullptr;
+
+  void SetUp() override {
+    llvm::SMDiagnostic Diag;
+    M = llvm::parseAssemblyString(IR, Diag, Ctx);
+    ASSERT_TRUE(M);
+    for (const auto &I : llvm::instructions(M->getFunction("main"))) {
+      if (const auto *CI = llvm::dyn_cast<llvm::CallInst>(&I)) {
+        Call = CI;
+      }
+    }
+    ASSERT_NE(Call, nullptr);
+  }
+}; // Test Fixture
+
+TEST_F(LibrarySummariesTest, HandleSummaryFlows) {
+  LibrarySummaries Library(Summaries);
+  const auto *Summary = Library.getSummary(M->getFunction("lib_copy"));
+  ASSERT_NE(Summary, nullptr);
+  EXPECT_EQ(Summary->size(), 3U);
+  LibrarySummaryFlow Flow(Call, *Summary);
+  const llvm::Function *Main = M->getFunction("main");
+  const llvm::Value *Dst = Main->getArg(0);
+  const llvm::Value *Src = Main->getArg(1);
+  const llvm::Value *Other = Main->getArg(2);
+  const llvm::Value *Zero = LLVMZeroValue::getInstance();
+  std::set<const llvm::Value *> Expected = {Src, Dst, Call};
+  EXPECT_EQ(Flow.computeTargets(Src), Expected);
+  Expected = {Dst};
+  EXPECT_EQ(Flow.computeTargets(Dst), Expected);
+  // the call site has no third argument
+  Expected = {Other};
+  EXPECT_EQ(Flow.computeTargets(Other), Expected);
+  Expected = {Zero, M->getNamedValue("lib_state")};
+  EXPECT_EQ(Flow.computeTargets(Zero), Expected);
+}
+
+TEST_F(LibrarySummariesTest, HandleSpecialSummaries) {
+  auto &SS = SpecialSummaries<const llvm::Value *>::getInstance();
+  const llvm::Function *Callee = M->getFunction("lib_copy");
+  EXPECT_FALSE(SS.containsSpecialSummary(Callee));
+  SS.provideLibrarySummaries(LibrarySummaries(Summaries));
+  EXPECT_TRUE(SS.containsSpecialSummary(Callee));
+  auto Flow = SS.getSpecialFlowFunctionSummary(Call, Callee);
+  ASSERT_NE(Flow, nullptr);
+  const llvm::Value *Src = M->getFunction("main")->getArg(1);
+  EXPECT_TRUE(Flow->computeTargets(Src).count(Call));
+}
+
+TEST_F(LibrarySummariesTest, HandleMalformedSummaries) {
+  EXPECT_THROW(LibrarySummaries(nlohmann::json{{"Version", 1}}),
+               std::runtime_error);
+  nlohmann::json InvalidLocation = {
+      {"Version", 1},
+      {"Functions",
+       {{"f", {{"Flows", {{{"From", "Argument0"}, {"To", {"Return"}}}}}}}}}};
+  EXPECT_THROW(LibrarySummaries{InvalidLocation}, std::runtime_error);
+  nlohmann::json ZeroTarget = {
+      {"Version", 1},
+      {"Functions",
+       {{"f", {{"Flows", {{{"From", "Arg0"}, {"To", {"Zero"}}}}}}}}}};
+  EXPECT_THROW(LibrarySummaries{ZeroTarget}, std::runtime_error);
+}
+
+int main(int Argc, char **Argv) {
+  ::testing::InitGoogleTest(&Argc, Argv);
+  return RUN_ALL_TESTS();
+}
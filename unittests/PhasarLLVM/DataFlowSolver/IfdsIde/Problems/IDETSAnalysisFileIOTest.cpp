@@ -11,6 +11,7 @@
 #include "phasar/PhasarLLVM/ControlFlow/LLVMBasedICFG.h"
 #include "phasar/PhasarLLVM/DataFlowSolver/IfdsIde/Problems/IDETypeStateAnalysis.h"
 #include "phasar/PhasarLLVM/DataFlowSolver/IfdsIde/Problems/TypeStateDescriptions/CSTDFILEIOTypeStateDescription.h"
+#include "phasar/PhasarLLVM/DataFlowSolver/IfdsIde/Problems/TypeStateDescriptions/CompiledTypeStateDescription.h"
 #include "phasar/PhasarLLVM/DataFlowSolver/IfdsIde/Solver/IDESolver.h"
 #include "phasar/PhasarLLVM/Passes/ValueAnnotationPass.h"
 #include "phasar/PhasarLLVM/Pointer/LLVMPointsToInfo.h"
@@ -615,6 +616,27 @@ TEST_F(IDETSAnalysisFileIOTest, HandleTypeState_19) {
   compareResults(gt, llvmtssolver);
 }
 
+TEST_F(IDETSAnalysisFileIOTest, HandleCompiledDescription) {
+  Initialize({pathToLLFiles + "typestate_01_c.ll"});
+  CompiledTypeStateDescription CTSD(*CSTDFILEIODesc, *IRDB);
+  const auto *Fopen = IRDB->getFunction("fopen");
+  const auto *Fclose = IRDB->getFunction("fclose");
+  ASSERT_TRUE(Fopen && Fclose);
+  EXPECT_EQ(CTSD.getNumFunctions(), 2U);
+  EXPECT_TRUE(CTSD.isFactoryFunction(Fopen));
+  EXPECT_TRUE(CTSD.isConsumingFunction(Fclose));
+  EXPECT_FALSE(CTSD.isAPIFunction(IRDB->getFunction("main")));
+  for (const auto *F : {Fopen, Fclose}) {
+    auto Id = CTSD.getFunctionId(F);
+    ASSERT_TRUE(Id.has_value());
+    for (int S : {IOSTATE::UNINIT, IOSTATE::OPENED, IOSTATE::CLOSED,
+                  IOSTATE::ERROR, IOSTATE::BOT}) {
+      EXPECT_EQ(CTSD.getNextState(*Id, S),
+                CSTDFILEIODesc->getNextState(F->getName().str(), S));
+    }
+  }
+}
+
 // main function for the test case
 int main(int argc, char **argv) {
   ::testing::InitGoogleTest(&argc, argv);
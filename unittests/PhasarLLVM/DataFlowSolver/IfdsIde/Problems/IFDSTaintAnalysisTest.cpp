@@ -156,6 +156,19 @@ TEST_F(IFDSTaintAnalysisTest, TaintTest_06) {
   compareResults(GroundTruth);
 }
 
+TEST_F(IFDSTaintAnalysisTest, TaintTest_07) {
+  Initialize({pathToLLFiles + "dummy_source_sink/taint_07_cpp_dbg.ll"});
+  IFDSSolver<IFDSTaintAnalysis::n_t, IFDSTaintAnalysis::d_t,
+             IFDSTaintAnalysis::f_t, IFDSTaintAnalysis::t_t,
+             IFDSTaintAnalysis::v_t, IFDSTaintAnalysis::i_t>
+      TaintSolver(*TaintProblem);
+  TaintSolver.solve();
+  // the source is called from get(), the taint must be returned to main()
+  map<int, set<string>> GroundTruth;
+  GroundTruth[15] = set<string>{"14"};
+  compareResults(GroundTruth);
+}
+
 int main(int argc, char **argv) {
   ::testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
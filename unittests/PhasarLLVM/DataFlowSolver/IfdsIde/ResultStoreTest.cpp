@@ -0,0 +1,64 @@
+#include <fstream>
+#include <ios>
+#include <stdexcept>
+#include <string>
+
+#include "gtest/gtest.h"
+
+#include "phasar/PhasarLLVM/DataFlowSolver/IfdsIde/ResultStore.h"
+
+using namespace psr;
+
+TEST(ResultStoreTest, HandleRoundtrip) {
+  const std::string Path = "ResultStoreTest.bin";
+  ResultStoreWriter Writer;
+  uint32_t Zero = Writer.addFact("zero");
+  uint32_t X = Writer.addFact("%x");
+  uint32_t Bottom = Writer.addValue("Bottom");
+  uint32_t Three = Writer.addValue("3");
+  // nodes are added in an order different from their sorted order
+  uint32_t Second = Writer.addNode("2", "main::ret i32 0");
+  uint32_t First = Writer.addNode("1", "main::store i32 3, i32* %x");
+  EXPECT_EQ(Writer.addNode("2", "unused"), Second);
+  Writer.addCell(Second, X, Three);
+  Writer.addCell(Second, Zero, Bottom);
+  Writer.addCell(First, Zero, Bottom);
+  EXPECT_EQ(Writer.size(), 3U);
+  Writer.write(Path);
+
+  ResultStore Store(Path);
+  EXPECT_EQ(Store.getNumNodes(), 2U);
+  EXPECT_EQ(Store.getNumFacts(), 2U);
+  EXPECT_EQ(Store.getNumCells(), 3U);
+  auto Node = Store.findNode("2");
+  ASSERT_TRUE(Node.has_value());
+  EXPECT_EQ(Store.getNodeKey(*Node), "2");
+  EXPECT_EQ(Store.getNodeLabel(*Node), "main::ret i32 0");
+  auto Facts = Store.getFactsAt(*Node);
+  ASSERT_EQ(Facts.size(), 2U);
+  EXPECT_EQ(Facts[0].first, "%x");
+  EXPECT_EQ(Facts[0].second, "3");
+  EXPECT_EQ(Facts[1].first, "zero");
+  EXPECT_EQ(Facts[1].second, "Bottom");
+  Facts = Store.getFactsAt(llvm::StringRef("1"));
+  ASSERT_EQ(Facts.size(), 1U);
+  EXPECT_EQ(Facts[0].first, "zero");
+  EXPECT_FALSE(Store.findNode("3").has_value());
+  EXPECT_TRUE(Store.getFactsAt(llvm::StringRef("0")).empty());
+}
+
+TEST(ResultStoreTest, HandleMalformedStore) {
+  const std::string Path = "ResultStoreTestMalformed.bin";
+  {
+    std::ofstream OFS(Path, std::ios::binary);
+    OFS << "PSRRESST but not a result store";
+  }
+  EXPECT_THROW(ResultStore Store(Path), std::runtime_error);
+  EXPECT_THROW(ResultStore Store("does/not/exist.bin"), std::runtime_error);
+}
+
+// main function for the test case
+int main(int Argc, char **Argv) {
+  ::testing::InitGoogleTest(&Argc, Argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,111 @@
+#include "phasar/PhasarLLVM/DataFlowSolver/IfdsIde/Solver/DemandDrivenSolver.h"
+#include "phasar/DB/ProjectIRDB.h"
+#include "phasar/PhasarLLVM/ControlFlow/LLVMBasedICFG.h"
+#include "phasar/PhasarLLVM/DataFlowSolver/IfdsIde/Problems/IDELinearConstantAnalysis.h"
+#include "phasar/PhasarLLVM/DataFlowSolver/IfdsIde/Problems/IFDSUninitializedVariables.h"
+#include "phasar/PhasarLLVM/DataFlowSolver/IfdsIde/Solver/IDESolver.h"
+#include "phasar/PhasarLLVM/DataFlowSolver/IfdsIde/Solver/IFDSSolver.h"
+#include "phasar/PhasarLLVM/Passes/ValueAnnotationPass.h"
+#include "phasar/PhasarLLVM/Pointer/LLVMPointsToInfo.h"
+#include "phasar/PhasarLLVM/TypeHierarchy/LLVMTypeHierarchy.h"
+#include "llvm/IR/InstIterator.h"
+#include "gtest/gtest.h"
+
+using namespace psr;
+
+/* ============== TEST FIXTURE ============== */
+class DemandDrivenSolverTest : public ::testing::Test {
+protected:
+  const std::string pathToLLFiles =
+      PhasarConfig::getPhasarConfig().PhasarDirectory() +
+      "build/test/llvm_test_code/";
+  const std::set<std::string> EntryPoints = {"main"};
+
+  ProjectIRDB *IRDB = nullptr;
+  LLVMTypeHierarchy *TH = nullptr;
+  LLVMPointsToInfo *PT = nullptr;
+  LLVMBasedICFG *ICFG = nullptr;
+
+  void SetUp() override { boost::log::core::get()->set_logging_enabled(false); }
+
+  void initialize(const std::string &llvmFilePath) {
+    IRDB = new ProjectIRDB({pathToLLFiles + llvmFilePath}, IRDBOptions::WPA);
+    ValueAnnotationPass::resetValueID();
+    TH = new LLVMTypeHierarchy(*IRDB);
+    PT = new LLVMPointsToInfo(*IRDB);
+    ICFG = new LLVMBasedICFG(*IRDB, CallGraphAnalysisType::OTF, EntryPoints,
+                             TH, PT);
+  }
+
+  void TearDown() override {
+    delete ICFG;
+    delete PT;
+    delete TH;
+    delete IRDB;
+  }
+
+  std::vector<const llvm::Instruction *> getAllInstructions() {
+    std::vector<const llvm::Instruction *> Insts;
+    for (const auto *F : IRDB->getAllFunctions()) {
+      for (const auto &I : llvm::instructions(F)) {
+        Insts.push_back(&I);
+      }
+    }
+    return Insts;
+  }
+
+  /**
+   * Queries every instruction one after another and compares the demand-driven
+   * results with the results of a whole-program run.
+   */
+  template <typename Problem, typename Solver>
+  void compareWithWholeProgram(Problem &ExhaustiveProblem,
+                               Problem &DemandProblem) {
+    Solver Exhaustive(ExhaustiveProblem);
+    Exhaustive.solve();
+    DemandDrivenSolver<Solver> Demand(DemandProblem);
+    for (const auto *Inst : getAllInstructions()) {
+      EXPECT_EQ(Demand.queryResultsAt(Inst, true),
+                Exhaustive.resultsAt(Inst, true))
+          << "Results differ at: " << llvmIRToString(Inst);
+      EXPECT_TRUE(Demand.isAnswered(Inst));
+    }
+  }
+}; // Test Fixture
+
+TEST_F(DemandDrivenSolverTest, HandleIDEQueries) {
+  initialize("linear_constant/call_07_cpp_dbg.ll");
+  IDELinearConstantAnalysis ExhaustiveProblem(IRDB, TH, ICFG, PT, EntryPoints);
+  IDELinearConstantAnalysis DemandProblem(IRDB, TH, ICFG, PT, EntryPoints);
+  compareWithWholeProgram<IDELinearConstantAnalysis,
+                          IDESolver_P<IDELinearConstantAnalysis>>(
+      ExhaustiveProblem, DemandProblem);
+}
+
+TEST_F(DemandDrivenSolverTest, HandleIFDSQueries) {
+  initialize("uninitialized_variables/callnoret_c_dbg.ll");
+  IFDSUninitializedVariables ExhaustiveProblem(IRDB, TH, ICFG, PT,
+                                               EntryPoints);
+  IFDSUninitializedVariables DemandProblem(IRDB, TH, ICFG, PT, EntryPoints);
+  compareWithWholeProgram<IFDSUninitializedVariables,
+                          IFDSSolver_P<IFDSUninitializedVariables>>(
+      ExhaustiveProblem, DemandProblem);
+}
+
+TEST_F(DemandDrivenSolverTest, HandlePartialExploration) {
+  initialize("linear_constant/call_07_cpp_dbg.ll");
+  IDELinearConstantAnalysis Problem(IRDB, TH, ICFG, PT, EntryPoints);
+  DemandDrivenSolver<IDESolver_P<IDELinearConstantAnalysis>> Demand(Problem);
+  // the first instruction of main only depends on itself
+  const auto *First = &*llvm::inst_begin(ICFG->getFunction("main"));
+  Demand.addQueryPoint(First);
+  Demand.solve();
+  EXPECT_TRUE(Demand.isAnswered(First));
+  EXPECT_EQ(Demand.getNumRelevantNodes(), 1U);
+  EXPECT_GT(Demand.getNumDeferredEdges(), 0U);
+}
+
+int main(int Argc, char **Argv) {
+  ::testing::InitGoogleTest(&Argc, Argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,73 @@
+#include "phasar/PhasarLLVM/AnalysisStrategy/HelperAnalyses.h"
+#include "phasar/DB/ProjectIRDB.h"
+#include "phasar/PhasarLLVM/AnalysisStrategy/WholeProgramAnalysis.h"
+#include "phasar/PhasarLLVM/ControlFlow/LLVMBasedICFG.h"
+#include "phasar/PhasarLLVM/DataFlowSolver/IfdsIde/Problems/IDELinearConstantAnalysis.h"
+#include "phasar/PhasarLLVM/DataFlowSolver/IfdsIde/Problems/IFDSUninitializedVariables.h"
+#include "phasar/PhasarLLVM/DataFlowSolver/IfdsIde/Solver/IDESolver.h"
+#include "phasar/PhasarLLVM/DataFlowSolver/IfdsIde/Solver/IFDSSolver.h"
+#include "phasar/PhasarLLVM/Passes/ValueAnnotationPass.h"
+#include "phasar/PhasarLLVM/Pointer/LLVMPointsToInfo.h"
+#include "phasar/PhasarLLVM/TypeHierarchy/LLVMTypeHierarchy.h"
+#include "gtest/gtest.h"
+
+using namespace psr;
+
+/* ============== TEST FIXTURE ============== */
+class HelperAnalysesTest : public ::testing::Test {
+protected:
+  using UninitTy =
+      WholeProgramAnalysis<IFDSSolver_P<IFDSUninitializedVariables>,
+                           IFDSUninitializedVariables>;
+  using LCATy = WholeProgramAnalysis<IDESolver_P<IDELinearConstantAnalysis>,
+                                     IDELinearConstantAnalysis>;
+
+  const std::string pathToLLFiles =
+      PhasarConfig::getPhasarConfig().PhasarDirectory() +
+      "build/test/llvm_test_code/uninitialized_variables/";
+  const std::set<std::string> EntryPoints = {"main"};
+
+  void SetUp() override { boost::log::core::get()->set_logging_enabled(false); }
+}; // Test Fixture
+
+TEST_F(HelperAnalysesTest, HandleSharedHelperAnalyses) {
+  ValueAnnotationPass::resetValueID();
+  ProjectIRDB IRDB({pathToLLFiles + "binop_uninit_cpp_dbg.ll"},
+                   IRDBOptions::WPA);
+  auto HA = std::make_shared<HelperAnalyses<>>(IRDB, EntryPoints);
+  auto *ICFG = &HA->getICFG();
+  {
+    UninitTy Uninit(HA);
+    LCATy LCA(HA);
+    EXPECT_EQ(HA.use_count(), 3);
+    // the helper analyses are built once and shared by both analyses
+    EXPECT_EQ(&HA->getICFG(), ICFG);
+    Uninit.solve();
+    LCA.solve();
+  }
+  EXPECT_EQ(HA.use_count(), 1);
+  EXPECT_EQ(&HA->getICFG(), ICFG);
+}
+
+TEST_F(HelperAnalysesTest, HandleLentHelperAnalyses) {
+  ValueAnnotationPass::resetValueID();
+  ProjectIRDB IRDB({pathToLLFiles + "binop_uninit_cpp_dbg.ll"},
+                   IRDBOptions::WPA);
+  LLVMTypeHierarchy TH(IRDB);
+  LLVMPointsToInfo PT(IRDB);
+  LLVMBasedICFG ICFG(IRDB, CallGraphAnalysisType::OTF, EntryPoints, &TH, &PT);
+  {
+    // the analysis borrows the helper analyses and must not free them
+    UninitTy Uninit(IRDB, EntryPoints, &PT, &ICFG, &TH);
+    Uninit.solve();
+  }
+  HelperAnalyses<> HA(IRDB, EntryPoints, &PT, &ICFG, &TH);
+  EXPECT_EQ(&HA.getTypeHierarchy(), &TH);
+  EXPECT_EQ(&HA.getPointsToInfo(), &PT);
+  EXPECT_EQ(&HA.getICFG(), &ICFG);
+}
+
+int main(int Argc, char **Argv) {
+  ::testing::InitGoogleTest(&Argc, Argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,68 @@
+#include <sstream>
+
+#include "phasar/DB/ProjectIRDB.h"
+#include "phasar/PhasarLLVM/ControlFlow/LLVMBasedICFG.h"
+#include "phasar/PhasarLLVM/DataFlowSolver/IfdsIde/Problems/IDELinearConstantAnalysis.h"
+#include "phasar/PhasarLLVM/DataFlowSolver/IfdsIde/Solver/IDESolver.h"
+#include "phasar/PhasarLLVM/Passes/ValueAnnotationPass.h"
+#include "phasar/PhasarLLVM/Pointer/LLVMPointsToInfo.h"
+#include "phasar/PhasarLLVM/TypeHierarchy/LLVMTypeHierarchy.h"
+#include "gtest/gtest.h"
+
+using namespace psr;
+
+/* ============== TEST FIXTURE ============== */
+class IDESolverReportTest : public ::testing::Test {
+protected:
+  const std::string pathToLLFiles =
+      PhasarConfig::getPhasarConfig().PhasarDirectory() +
+      "build/test/llvm_test_code/linear_constant/";
+  const std::set<std::string> EntryPoints = {"main"};
+
+  void SetUp() override { boost::log::core::get()->set_logging_enabled(false); }
+
+  /**
+   * Solves the linear constant analysis on the given file and checks that the
+   * streamed JSON report is the same document as the one built by getAsJson().
+   */
+  void compareReports(const std::string &llvmFilePath) {
+    ValueAnnotationPass::resetValueID();
+    ProjectIRDB IRDB({pathToLLFiles + llvmFilePath}, IRDBOptions::WPA);
+    LLVMTypeHierarchy TH(IRDB);
+    LLVMPointsToInfo PT(IRDB);
+    LLVMBasedICFG ICFG(IRDB, CallGraphAnalysisType::OTF, EntryPoints, &TH,
+                       &PT);
+    IDELinearConstantAnalysis LCAProblem(&IRDB, &TH, &ICFG, &PT, EntryPoints);
+    IDESolver<IDELinearConstantAnalysis::n_t, IDELinearConstantAnalysis::d_t,
+              IDELinearConstantAnalysis::f_t, IDELinearConstantAnalysis::t_t,
+              IDELinearConstantAnalysis::v_t, IDELinearConstantAnalysis::l_t,
+              IDELinearConstantAnalysis::i_t>
+        LCASolver(LCAProblem);
+    LCASolver.solve();
+    std::stringstream SS;
+    LCASolver.emitJsonReport(SS);
+    nlohmann::json Streamed = nlohmann::json::parse(SS.str());
+    nlohmann::json Built = LCASolver.getAsJson();
+    ASSERT_TRUE(Streamed["DataFlow"].is_object());
+    EXPECT_EQ(Streamed, Built);
+  }
+};
+
+/* ============== BASIC TESTS ============== */
+TEST_F(IDESolverReportTest, HandleBasicTest_01) {
+  compareReports("basic_01_cpp_dbg.ll");
+}
+
+TEST_F(IDESolverReportTest, HandleCallTest_01) {
+  compareReports("call_01_cpp_dbg.ll");
+}
+
+TEST_F(IDESolverReportTest, HandleBranchTest_01) {
+  compareReports("branch_01_cpp_dbg.ll");
+}
+
+// main function for the test case
+int main(int Argc, char **Argv) {
+  ::testing::InitGoogleTest(&Argc, Argv);
+  return RUN_ALL_TESTS();
+}
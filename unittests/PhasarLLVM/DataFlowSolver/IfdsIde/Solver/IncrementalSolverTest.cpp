@@ -0,0 +1,168 @@
+#include "phasar/PhasarLLVM/DataFlowSolver/IfdsIde/Solver/IncrementalSolver.h"
+#include "phasar/DB/ProjectIRDB.h"
+#include "phasar/PhasarLLVM/AnalysisStrategy/IRSnapshot.h"
+#include "phasar/PhasarLLVM/ControlFlow/LLVMBasedICFG.h"
+#include "phasar/PhasarLLVM/DataFlowSolver/IfdsIde/Problems/IFDSUninitializedVariables.h"
+#include "phasar/PhasarLLVM/DataFlowSolver/IfdsIde/Solver/IFDSSolver.h"
+#include "phasar/PhasarLLVM/Passes/ValueAnnotationPass.h"
+#include "phasar/PhasarLLVM/Pointer/LLVMPointsToInfo.h"
+#include "phasar/PhasarLLVM/TypeHierarchy/LLVMTypeHierarchy.h"
+#include "llvm/IR/Constants.h"
+#include "llvm/IR/InstIterator.h"
+#include "llvm/IR/Instructions.h"
+#include "llvm/IR/Module.h"
+#include "gtest/gtest.h"
+
+using namespace psr;
+
+/* ============== TEST FIXTURE ============== */
+class IncrementalSolverTest : public ::testing::Test {
+protected:
+  using SolverTy = IFDSSolver_P<IFDSUninitializedVariables>;
+
+  const std::string pathToLLFiles =
+      PhasarConfig::getPhasarConfig().PhasarDirectory() +
+      "build/test/llvm_test_code/incremental/";
+  const std::set<std::string> EntryPoints = {"main"};
+
+  struct Version {
+    std::unique_ptr<ProjectIRDB> IRDB;
+    std::unique_ptr<LLVMTypeHierarchy> TH;
+    std::unique_ptr<LLVMPointsToInfo> PT;
+    std::unique_ptr<LLVMBasedICFG> ICFG;
+    std::unique_ptr<IRSnapshot> Snapshot;
+  };
+
+  void SetUp() override { boost::log::core::get()->set_logging_enabled(false); }
+
+  Version load(const std::string &llvmFilePath) {
+    Version V;
+    ValueAnnotationPass::resetValueID();
+    V.IRDB = std::make_unique<ProjectIRDB>(
+        std::vector<std::string>{pathToLLFiles + llvmFilePath},
+        IRDBOptions::WPA);
+    V.TH = std::make_unique<LLVMTypeHierarchy>(*V.IRDB);
+    V.PT = std::make_unique<LLVMPointsToInfo>(*V.IRDB);
+    V.ICFG = std::make_unique<LLVMBasedICFG>(
+        *V.IRDB, CallGraphAnalysisType::OTF, EntryPoints, V.TH.get(),
+        V.PT.get());
+    V.Snapshot = std::make_unique<IRSnapshot>(*V.IRDB);
+    return V;
+  }
+
+  nlohmann::json solveFromScratch(Version &V) {
+    IFDSUninitializedVariables Problem(V.IRDB.get(), V.TH.get(), V.ICFG.get(),
+                                       V.PT.get(), EntryPoints);
+    IncrementalSolver<SolverTy> Solver(Problem, *V.Snapshot);
+    Solver.solve();
+    return Solver.getAsPersistedRun();
+  }
+
+  /**
+   * Solves V incrementally based on the given previous run and compares the
+   * results with a from-scratch run.
+   */
+  void compareWithFromScratch(Version &V, const nlohmann::json &PreviousRun,
+                              const std::set<std::string> &ExpectedDirty) {
+    IFDSUninitializedVariables ScratchProblem(V.IRDB.get(), V.TH.get(),
+                                              V.ICFG.get(), V.PT.get(),
+                                              EntryPoints);
+    SolverTy Scratch(ScratchProblem);
+    Scratch.solve();
+    IFDSUninitializedVariables Problem(V.IRDB.get(), V.TH.get(), V.ICFG.get(),
+                                       V.PT.get(), EntryPoints);
+    IncrementalSolver<SolverTy> Incremental(Problem, *V.Snapshot);
+    Incremental.setPreviousRun(PreviousRun);
+    Incremental.solve();
+    EXPECT_EQ(Incremental.getDirtyFunctions(), ExpectedDirty);
+    EXPECT_GT(Incremental.getNumReusedContexts(), 0U);
+    for (const auto *F : V.IRDB->getAllFunctions()) {
+      for (const auto &I : llvm::instructions(F)) {
+        EXPECT_EQ(Incremental.ifdsResultsAt(&I), Scratch.ifdsResultsAt(&I))
+            << "Results differ at: " << llvmIRToString(&I);
+      }
+    }
+    // the persisted state of an incremental run equals the one of a
+    // from-scratch run
+    EXPECT_EQ(Incremental.getAsPersistedRun(), solveFromScratch(V));
+  }
+}; // Test Fixture
+
+TEST_F(IncrementalSolverTest, HandleUnchangedProgram) {
+  auto Old = load("incremental_01_cpp_dbg.ll");
+  auto PreviousRun = solveFromScratch(Old);
+  auto New = load("incremental_01_cpp_dbg.ll");
+  compareWithFromScratch(New, PreviousRun, {});
+}
+
+TEST_F(IncrementalSolverTest, HandleChangedCallee) {
+  auto Old = load("incremental_01_cpp_dbg.ll");
+  auto PreviousRun = solveFromScratch(Old);
+  auto New = load("incremental_01_changed_cpp_dbg.ll");
+  auto Diff = New.Snapshot->diff(Old.Snapshot->getFunctionHashes(),
+                                 Old.Snapshot->getGlobalsHash());
+  EXPECT_EQ(Diff.Changed, std::set<std::string>{"_Z9incrementi"});
+  EXPECT_TRUE(Diff.Added.empty());
+  EXPECT_TRUE(Diff.Removed.empty());
+  // all transitive callers of a changed function are invalidated
+  compareWithFromScratch(New, PreviousRun,
+                         {"_Z9incrementi", "_Z7computei", "main"});
+}
+
+TEST_F(IncrementalSolverTest, HandleLocalFunctionsOfSeveralModules) {
+  // both modules define a local function 'helper'
+  std::vector<std::string> Files = {
+      pathToLLFiles + "incremental_02_a_cpp_dbg.ll",
+      pathToLLFiles + "incremental_02_b_cpp_dbg.ll"};
+  ProjectIRDB OldIRDB(Files, IRDBOptions::NONE);
+  IRSnapshot Old(OldIRDB);
+  ProjectIRDB NewIRDB(Files, IRDBOptions::NONE);
+  const llvm::Function *HelperA =
+      NewIRDB.getModule(Files[0])->getFunction("_ZL6helperi");
+  llvm::Function *HelperB =
+      NewIRDB.getModule(Files[1])->getFunction("_ZL6helperi");
+  ASSERT_TRUE(HelperA && HelperB);
+  // change the helper of the second module only
+  for (auto &I : llvm::instructions(HelperB)) {
+    if (llvm::isa<llvm::BinaryOperator>(I)) {
+      I.setOperand(1, llvm::ConstantInt::get(I.getType(), 3));
+      break;
+    }
+  }
+  IRSnapshot New(NewIRDB);
+  std::string KeyA = IRSnapshot::getGlobalKey(HelperA);
+  std::string KeyB = IRSnapshot::getGlobalKey(HelperB);
+  EXPECT_NE(KeyA, KeyB);
+  EXPECT_EQ(New.getFunction(KeyA), HelperA);
+  EXPECT_EQ(New.getFunction(KeyB), HelperB);
+  auto Diff = New.diff(Old.getFunctionHashes(), Old.getGlobalsHash());
+  EXPECT_EQ(Diff.Changed, std::set<std::string>{KeyB});
+  EXPECT_TRUE(Diff.Added.empty());
+  EXPECT_TRUE(Diff.Removed.empty());
+  // the stable ids of both helpers resolve to their own values
+  for (const auto *Helper :
+       std::vector<const llvm::Function *>{HelperA, HelperB}) {
+    const auto &Entry = Helper->front().front();
+    EXPECT_EQ(New.getValue(New.getStableId(&Entry)), &Entry);
+    EXPECT_EQ(New.getValue(New.getStableId(Helper->arg_begin())),
+              Helper->arg_begin());
+    EXPECT_EQ(New.getValue(New.getStableId(Helper)), Helper);
+  }
+}
+
+TEST_F(IncrementalSolverTest, HandleIncompatiblePreviousRun) {
+  auto V = load("incremental_01_cpp_dbg.ll");
+  IFDSUninitializedVariables Problem(V.IRDB.get(), V.TH.get(), V.ICFG.get(),
+                                     V.PT.get(), EntryPoints);
+  IncrementalSolver<SolverTy> Solver(Problem, *V.Snapshot);
+  Solver.setPreviousRun({{"version", 0}});
+  Solver.solve();
+  EXPECT_EQ(Solver.getNumReusedContexts(), 0U);
+  EXPECT_EQ(Solver.getDirtyFunctions().size(),
+            V.Snapshot->getFunctionHashes().size());
+}
+
+int main(int Argc, char **Argv) {
+  ::testing::InitGoogleTest(&Argc, Argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,100 @@
+#include "phasar/PhasarLLVM/AnalysisStrategy/ModuleWiseAnalysis.h"
+#include "phasar/DB/ProjectIRDB.h"
+#include "phasar/PhasarLLVM/ControlFlow/LLVMBasedICFG.h"
+#include "phasar/PhasarLLVM/DataFlowSolver/IfdsIde/Problems/IFDSUninitializedVariables.h"
+#include "phasar/PhasarLLVM/DataFlowSolver/IfdsIde/Solver/IFDSSolver.h"
+#include "phasar/PhasarLLVM/Passes/ValueAnnotationPass.h"
+#include "phasar/PhasarLLVM/Pointer/LLVMPointsToInfo.h"
+#include "phasar/PhasarLLVM/TypeHierarchy/LLVMTypeHierarchy.h"
+#include "boost/filesystem.hpp"
+#include "llvm/IR/InstIterator.h"
+#include "gtest/gtest.h"
+
+using namespace psr;
+
+/* ============== TEST FIXTURE ============== */
+class ModuleWiseAnalysisTest : public ::testing::Test {
+protected:
+  using MWATy = ModuleWiseAnalysis<IFDSSolver_P<IFDSUninitializedVariables>,
+                                   IFDSUninitializedVariables>;
+
+  const std::string pathToLLFiles =
+      PhasarConfig::getPhasarConfig().PhasarDirectory() +
+      "build/test/llvm_test_code/module_wise/module_wise_1/";
+  const std::vector<std::string> Libraries = {"src1_cpp.ll", "src2_cpp.ll"};
+  boost::filesystem::path SummaryDir;
+
+  void SetUp() override {
+    boost::log::core::get()->set_logging_enabled(false);
+    SummaryDir = boost::filesystem::temp_directory_path() /
+                 boost::filesystem::unique_path();
+    boost::filesystem::create_directories(SummaryDir);
+  }
+
+  void TearDown() override { boost::filesystem::remove_all(SummaryDir); }
+
+  std::vector<std::string> summarizeLibraries() {
+    std::vector<std::string> SummaryPaths;
+    for (const auto &Library : Libraries) {
+      ValueAnnotationPass::resetValueID();
+      ProjectIRDB IRDB({pathToLLFiles + Library}, IRDBOptions::NONE);
+      auto *M = *IRDB.getAllModules().begin();
+      MWATy MWA(IRDB, MWATy::getModuleInterface(*M));
+      MWA.summarize();
+      SummaryPaths.push_back((SummaryDir / (Library + ".summary")).string());
+      MWA.storeSummaries(SummaryPaths.back());
+    }
+    return SummaryPaths;
+  }
+}; // Test Fixture
+
+TEST_F(ModuleWiseAnalysisTest, HandleModuleInterface) {
+  ProjectIRDB IRDB({pathToLLFiles + "src1_cpp.ll"}, IRDBOptions::NONE);
+  auto *M = *IRDB.getAllModules().begin();
+  std::set<std::string> Expected = {"_Z14generate_taintv",
+                                    "_Z14do_computationi"};
+  EXPECT_EQ(MWATy::getModuleInterface(*M), Expected);
+}
+
+TEST_F(ModuleWiseAnalysisTest, HandleLinkedSummaries) {
+  auto SummaryPaths = summarizeLibraries();
+  ValueAnnotationPass::resetValueID();
+  ProjectIRDB IRDB({pathToLLFiles + "main_cpp.ll",
+                    pathToLLFiles + "src1_cpp.ll",
+                    pathToLLFiles + "src2_cpp.ll"},
+                   IRDBOptions::WPA);
+  const std::set<std::string> EntryPoints = {"main"};
+  LLVMTypeHierarchy TH(IRDB);
+  LLVMPointsToInfo PT(IRDB);
+  LLVMBasedICFG ICFG(IRDB, CallGraphAnalysisType::OTF, EntryPoints, &TH, &PT);
+  IFDSUninitializedVariables ScratchProblem(&IRDB, &TH, &ICFG, &PT,
+                                            EntryPoints);
+  IFDSSolver_P<IFDSUninitializedVariables> Scratch(ScratchProblem);
+  Scratch.solve();
+  MWATy MWA(IRDB, EntryPoints, &PT, &ICFG, &TH);
+  EXPECT_EQ(MWA.linkSummaries(SummaryPaths), 2U);
+  EXPECT_TRUE(MWA.getLinkedSummaries().count("_Z14generate_taintv"));
+  MWA.solve();
+  EXPECT_GT(MWA.getSolver().getNumReusedContexts(), 0U);
+  for (const auto *F : IRDB.getAllFunctions()) {
+    for (const auto &I : llvm::instructions(F)) {
+      EXPECT_EQ(MWA.getSolver().ifdsResultsAt(&I), Scratch.ifdsResultsAt(&I))
+          << "Results differ at: " << llvmIRToString(&I);
+    }
+  }
+}
+
+TEST_F(ModuleWiseAnalysisTest, HandleMalformedSummaries) {
+  std::string Path = (SummaryDir / "malformed.summary").string();
+  std::ofstream(Path) << "not a summary";
+  ProjectIRDB IRDB({pathToLLFiles + "src1_cpp.ll"}, IRDBOptions::NONE);
+  auto *M = *IRDB.getAllModules().begin();
+  MWATy MWA(IRDB, MWATy::getModuleInterface(*M));
+  EXPECT_EQ(MWA.linkSummaries({Path, Path + ".missing"}), 0U);
+  EXPECT_TRUE(MWA.getLinkedSummaries().empty());
+}
+
+int main(int Argc, char **Argv) {
+  ::testing::InitGoogleTest(&Argc, Argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,119 @@
+#include "phasar/PhasarLLVM/DataFlowSolver/IfdsIde/Solver/SummaryStoreSolver.h"
+#include "phasar/DB/ProjectIRDB.h"
+#include "phasar/PhasarLLVM/AnalysisStrategy/IRSnapshot.h"
+#include "phasar/PhasarLLVM/ControlFlow/LLVMBasedICFG.h"
+#include "phasar/PhasarLLVM/DataFlowSolver/IfdsIde/Problems/IFDSUninitializedVariables.h"
+#include "phasar/PhasarLLVM/DataFlowSolver/IfdsIde/Solver/IFDSSolver.h"
+#include "phasar/PhasarLLVM/DataFlowSolver/IfdsIde/SummaryStore.h"
+#include "phasar/PhasarLLVM/Passes/ValueAnnotationPass.h"
+#include "phasar/PhasarLLVM/Pointer/LLVMPointsToInfo.h"
+#include "phasar/PhasarLLVM/TypeHierarchy/LLVMTypeHierarchy.h"
+#include "boost/filesystem.hpp"
+#include "llvm/IR/InstIterator.h"
+#include "gtest/gtest.h"
+
+using namespace psr;
+
+/* ============== TEST FIXTURE ============== */
+class SummaryStoreSolverTest : public ::testing::Test {
+protected:
+  using SolverTy = IFDSSolver_P<IFDSUninitializedVariables>;
+
+  const std::string pathToLLFiles =
+      PhasarConfig::getPhasarConfig().PhasarDirectory() +
+      "build/test/llvm_test_code/module_wise/module_wise_1/";
+  boost::filesystem::path StoreDir;
+
+  void SetUp() override {
+    boost::log::core::get()->set_logging_enabled(false);
+    StoreDir = boost::filesystem::temp_directory_path() /
+               boost::filesystem::unique_path();
+    boost::filesystem::create_directories(StoreDir);
+  }
+
+  void TearDown() override { boost::filesystem::remove_all(StoreDir); }
+
+  // summarizes the library's interface offline
+  std::string summarizeLibrary() {
+    const std::set<std::string> Interface = {"_Z14generate_taintv",
+                                             "_Z14do_computationi"};
+    ValueAnnotationPass::resetValueID();
+    ProjectIRDB IRDB({pathToLLFiles + "src1_cpp.ll"}, IRDBOptions::NONE);
+    IRSnapshot Snapshot(IRDB);
+    LLVMTypeHierarchy TH(IRDB);
+    LLVMPointsToInfo PT(IRDB);
+    LLVMBasedICFG ICFG(IRDB, CallGraphAnalysisType::OTF, Interface, &TH, &PT);
+    IFDSUninitializedVariables Problem(&IRDB, &TH, &ICFG, &PT, Interface);
+    IFDSIDESolverConfig Config = Problem.getIFDSIDESolverConfig();
+    Config.computePersistedSummaries = true;
+    Problem.setIFDSIDESolverConfig(Config);
+    SummaryStoreSolver<SolverTy> Solver(Problem, Snapshot);
+    Solver.solve();
+    SummaryStoreWriter Writer;
+    EXPECT_GT(Solver.addSummariesTo(Writer), 0U);
+    std::string Path = (StoreDir / "src1.store").string();
+    Writer.write(Path);
+    return Path;
+  }
+}; // Test Fixture
+
+TEST_F(SummaryStoreSolverTest, HandleStoreRoundtrip) {
+  SummaryStoreWriter Writer;
+  std::vector<SummaryStore::Exit> Exits = {{3, "i:1", true},
+                                           {3, "zero", false}};
+  Writer.add("uninit", "hash", "a:0", Exits);
+  Writer.add("uninit", "hash", "zero", {});
+  Writer.add("taint", "hash", "a:0", {{1, "g:x", true}});
+  std::string Path = (StoreDir / "roundtrip.store").string();
+  Writer.write(Path);
+  SummaryStore Store(Path);
+  EXPECT_EQ(Store.size(), 3U);
+  std::vector<SummaryStore::Exit> Stored;
+  ASSERT_TRUE(Store.lookup("uninit", "hash", "a:0", Stored));
+  std::sort(Exits.begin(), Exits.end());
+  EXPECT_EQ(Stored, Exits);
+  ASSERT_TRUE(Store.lookup("uninit", "hash", "zero", Stored));
+  EXPECT_TRUE(Stored.empty());
+  EXPECT_FALSE(Store.lookup("uninit", "other", "a:0", Stored));
+  EXPECT_FALSE(Store.lookup("taint", "hash", "zero", Stored));
+}
+
+TEST_F(SummaryStoreSolverTest, HandleMalformedStore) {
+  std::string Path = (StoreDir / "malformed.store").string();
+  std::ofstream(Path) << "not a summary store";
+  EXPECT_THROW(SummaryStore Store(Path), std::runtime_error);
+  EXPECT_THROW(SummaryStore Store(Path + ".missing"), std::runtime_error);
+}
+
+TEST_F(SummaryStoreSolverTest, HandleStoredSummaries) {
+  SummaryStore Store(summarizeLibrary());
+  ValueAnnotationPass::resetValueID();
+  ProjectIRDB IRDB({pathToLLFiles + "main_cpp.ll",
+                    pathToLLFiles + "src1_cpp.ll",
+                    pathToLLFiles + "src2_cpp.ll"},
+                   IRDBOptions::WPA);
+  const std::set<std::string> EntryPoints = {"main"};
+  IRSnapshot Snapshot(IRDB);
+  LLVMTypeHierarchy TH(IRDB);
+  LLVMPointsToInfo PT(IRDB);
+  LLVMBasedICFG ICFG(IRDB, CallGraphAnalysisType::OTF, EntryPoints, &TH, &PT);
+  IFDSUninitializedVariables ScratchProblem(&IRDB, &TH, &ICFG, &PT,
+                                            EntryPoints);
+  SolverTy Scratch(ScratchProblem);
+  Scratch.solve();
+  IFDSUninitializedVariables Problem(&IRDB, &TH, &ICFG, &PT, EntryPoints);
+  SummaryStoreSolver<SolverTy> Solver(Problem, Snapshot, &Store);
+  Solver.solve();
+  EXPECT_GT(Solver.getNumAppliedSummaries(), 0U);
+  const auto *Main = IRDB.getFunctionDefinition("main");
+  ASSERT_NE(Main, nullptr);
+  for (const auto &I : llvm::instructions(Main)) {
+    EXPECT_EQ(Solver.ifdsResultsAt(&I), Scratch.ifdsResultsAt(&I))
+        << "Results differ at: " << llvmIRToString(&I);
+  }
+}
+
+int main(int Argc, char **Argv) {
+  ::testing::InitGoogleTest(&Argc, Argv);
+  return RUN_ALL_TESTS();
+}
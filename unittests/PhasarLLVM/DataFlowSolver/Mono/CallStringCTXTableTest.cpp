@@ -0,0 +1,36 @@
+#include "phasar/PhasarLLVM/DataFlowSolver/Mono/Contexts/CallStringCTXTable.h"
+#include "gtest/gtest.h"
+
+using namespace psr;
+
+TEST(CallStringCTXTableTest, HandleInterning) {
+  CallStringCTXTable<int, 2> Table;
+  EXPECT_EQ(Table.size(), 1U);
+  EXPECT_TRUE(Table.getContext(Table.EmptyContext).empty());
+  unsigned A = Table.push(Table.EmptyContext, 1);
+  unsigned AB = Table.push(A, 2);
+  EXPECT_EQ(Table.push(Table.EmptyContext, 1), A);
+  EXPECT_EQ(Table.getId(CallStringCTX<int, 2>{1, 2}), AB);
+  EXPECT_TRUE(Table.getContext(AB) == (CallStringCTX<int, 2>{1, 2}));
+  EXPECT_EQ(Table.size(), 3U);
+  auto [CallSite, Caller] = Table.pop(AB);
+  EXPECT_EQ(CallSite, 2);
+  EXPECT_EQ(Caller, A);
+}
+
+TEST(CallStringCTXTableTest, HandleKLimiting) {
+  CallStringCTXTable<int, 2> Table;
+  unsigned AB = Table.push(Table.push(Table.EmptyContext, 1), 2);
+  unsigned BC = Table.push(AB, 3);
+  EXPECT_TRUE(Table.getContext(BC) == (CallStringCTX<int, 2>{2, 3}));
+  EXPECT_EQ(Table.getContext(BC).size(), 2U);
+  unsigned B = Table.pop(BC).second;
+  EXPECT_TRUE(Table.getContext(B) == (CallStringCTX<int, 2>{2}));
+  EXPECT_EQ(Table.pop(B).second, Table.EmptyContext);
+  EXPECT_THROW((CallStringCTX<int, 2>{1, 2, 3}), std::runtime_error);
+}
+
+int main(int Argc, char **Argv) {
+  ::testing::InitGoogleTest(&Argc, Argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,76 @@
+#include "phasar/PhasarLLVM/DataFlowSolver/Mono/Solver/MonoWorklist.h"
+#include "gtest/gtest.h"
+
+#include <map>
+#include <utility>
+#include <vector>
+
+using namespace psr;
+
+namespace {
+
+// a minimal CFG over integer nodes, functions are identified by name
+struct TestCFG {
+  std::map<std::string, std::vector<std::pair<int, int>>> Edges;
+
+  std::vector<std::pair<int, int>>
+  getAllControlFlowEdges(const std::string &Fun) const {
+    return Edges.at(Fun);
+  }
+
+  std::vector<int> getAllInstructionsOf(const std::string &Fun) const {
+    std::set<int> Nodes;
+    for (const auto &[Src, Dst] : Edges.at(Fun)) {
+      Nodes.insert(Src);
+      Nodes.insert(Dst);
+    }
+    return {Nodes.begin(), Nodes.end()};
+  }
+
+  bool isStartPoint(int Node) const { return Node % 10 == 0; }
+};
+
+} // anonymous namespace
+
+TEST(MonoWorklistTest, HandleDuplicates) {
+  MonoWorklist<int> Worklist;
+  EXPECT_TRUE(Worklist.push({0, 1}));
+  EXPECT_FALSE(Worklist.push({0, 1}));
+  EXPECT_TRUE(Worklist.push({1, 2}));
+  EXPECT_EQ(Worklist.size(), 2U);
+  EXPECT_EQ(Worklist.getNumDuplicates(), 1U);
+  EXPECT_EQ(Worklist.pop(), std::make_pair(0, 1));
+  // an edge may be queued again once it has been popped
+  EXPECT_TRUE(Worklist.push({0, 1}));
+  Worklist.pop();
+  Worklist.pop();
+  EXPECT_TRUE(Worklist.empty());
+  EXPECT_EQ(Worklist.getNumIterations(), 3U);
+  EXPECT_EQ(Worklist.getNumRevisits(), 1U);
+}
+
+TEST(MonoWorklistTest, HandleReversePostorder) {
+  // 10 -> 11 -> 12 -> 13 with a loop 12 -> 11, edges listed backwards
+  TestCFG CFG;
+  CFG.Edges["loop"] = {{12, 13}, {12, 11}, {11, 12}, {10, 11}};
+  CFG.Edges["callee"] = {{21, 22}, {20, 21}};
+  MonoWorklist<int> Worklist;
+  Worklist.addFunction(CFG, std::string("loop"));
+  Worklist.addFunction(CFG, std::string("callee"));
+  for (const auto &Fun : {"callee", "loop"}) {
+    auto Edges = CFG.getAllControlFlowEdges(Fun);
+    Worklist.push(Edges.begin(), Edges.end());
+  }
+  std::vector<std::pair<int, int>> Order;
+  while (!Worklist.empty()) {
+    Order.push_back(Worklist.pop());
+  }
+  std::vector<std::pair<int, int>> Expected = {
+      {10, 11}, {11, 12}, {12, 11}, {12, 13}, {20, 21}, {21, 22}};
+  EXPECT_EQ(Order, Expected);
+}
+
+int main(int Argc, char **Argv) {
+  ::testing::InitGoogleTest(&Argc, Argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,118 @@
+#include "phasar/PhasarLLVM/DataFlowSolver/SyncPDS/Solver/SyncPDSSolver.h"
+#include "phasar/DB/ProjectIRDB.h"
+#include "phasar/PhasarLLVM/ControlFlow/LLVMBasedICFG.h"
+#include "phasar/PhasarLLVM/Passes/ValueAnnotationPass.h"
+#include "phasar/PhasarLLVM/Pointer/LLVMPointsToInfo.h"
+#include "phasar/PhasarLLVM/TypeHierarchy/LLVMTypeHierarchy.h"
+#include "phasar/Utils/Logger.h"
+#include "llvm/IR/InstIterator.h"
+#include "gtest/gtest.h"
+
+using namespace psr;
+
+/* ============== TEST FIXTURE ============== */
+class SyncPDSSolverTest : public ::testing::Test {
+protected:
+  const std::string pathToLLFiles =
+      PhasarConfig::getPhasarConfig().PhasarDirectory() +
+      "build/test/llvm_test_code/pointers/";
+  const std::set<std::string> EntryPoints = {"main"};
+
+  ProjectIRDB *IRDB = nullptr;
+  LLVMTypeHierarchy *TH = nullptr;
+  LLVMPointsToInfo *PT = nullptr;
+  LLVMBasedICFG *ICFG = nullptr;
+  SyncPDSSolver *Solver = nullptr;
+
+  void SetUp() override { boost::log::core::get()->set_logging_enabled(false); }
+
+  void TearDown() override {
+    delete Solver;
+    delete ICFG;
+    delete PT;
+    delete TH;
+    delete IRDB;
+  }
+
+  void Initialize(const std::string &LlvmFilePath) {
+    ValueAnnotationPass::resetValueID();
+    IRDB = new ProjectIRDB({pathToLLFiles + LlvmFilePath}, IRDBOptions::WPA);
+    TH = new LLVMTypeHierarchy(*IRDB);
+    PT = new LLVMPointsToInfo(*IRDB);
+    ICFG = new LLVMBasedICFG(*IRDB, CallGraphAnalysisType::OTF, EntryPoints,
+                             TH, PT);
+    Solver = new SyncPDSSolver(*ICFG);
+  }
+
+  const llvm::Value *getLocal(const std::string &Name) {
+    for (const auto &I :
+         llvm::instructions(IRDB->getFunctionDefinition("main"))) {
+      if (I.getName() == Name) {
+        return &I;
+      }
+    }
+    ADD_FAILURE() << "no local " << Name << " in main";
+    return nullptr;
+  }
+
+  // returns the first pointer that is loaded from the given local
+  const llvm::Value *getLoadOf(const std::string &Name) {
+    const auto *Local = getLocal(Name);
+    for (const auto &I :
+         llvm::instructions(IRDB->getFunctionDefinition("main"))) {
+      const auto *Load = llvm::dyn_cast<llvm::LoadInst>(&I);
+      if (Load && Load->getPointerOperand() == Local) {
+        return Load;
+      }
+    }
+    ADD_FAILURE() << "no load of " << Name << " in main";
+    return nullptr;
+  }
+}; // Test Fixture
+
+TEST_F(SyncPDSSolverTest, HandleFields) {
+  Initialize("field_sensitive_01_cpp_dbg.ll");
+  const auto *P = getLoadOf("p");
+  const auto *Q = getLoadOf("q");
+  std::set<const llvm::Value *> X = {getLocal("x")};
+  std::set<const llvm::Value *> Y = {getLocal("y")};
+  EXPECT_EQ(Solver->getAllocationSitesOf(P), X);
+  EXPECT_EQ(Solver->getAllocationSitesOf(Q), Y);
+  EXPECT_FALSE(Solver->alias(P, Q));
+  EXPECT_TRUE(Solver->alias(P, getLocal("x")));
+  auto Aliases = Solver->getAliasesOf(P);
+  EXPECT_TRUE(Aliases.count(getLocal("x")));
+  EXPECT_FALSE(Aliases.count(getLocal("y")));
+  EXPECT_FALSE(Aliases.count(Q));
+}
+
+TEST_F(SyncPDSSolverTest, HandleContexts) {
+  Initialize("context_sensitive_01_cpp_dbg.ll");
+  const auto *P = getLoadOf("p");
+  const auto *Q = getLoadOf("q");
+  std::set<const llvm::Value *> X = {getLocal("x")};
+  std::set<const llvm::Value *> Y = {getLocal("y")};
+  EXPECT_EQ(Solver->getAllocationSitesOf(P), X);
+  EXPECT_EQ(Solver->getAllocationSitesOf(Q), Y);
+  EXPECT_FALSE(Solver->alias(P, Q));
+  auto Aliases = Solver->getAliasesOf(P);
+  EXPECT_TRUE(Aliases.count(getLocal("call")));
+  EXPECT_FALSE(Aliases.count(getLocal("call1")));
+}
+
+TEST_F(SyncPDSSolverTest, HandleHeap) {
+  Initialize("heap_01_cpp_dbg.ll");
+  const auto *P = getLoadOf("p");
+  const auto *Q = getLoadOf("q");
+  std::set<const llvm::Value *> First = {getLocal("call")};
+  std::set<const llvm::Value *> Second = {getLocal("call1")};
+  EXPECT_EQ(Solver->getAllocationSitesOf(P), First);
+  EXPECT_EQ(Solver->getAllocationSitesOf(Q), Second);
+  EXPECT_FALSE(Solver->alias(P, Q));
+  EXPECT_EQ(Solver->getNumTruncatedFlows(), 0U);
+}
+
+int main(int Argc, char **Argv) {
+  ::testing::InitGoogleTest(&Argc, Argv);
+  return RUN_ALL_TESTS();
+}
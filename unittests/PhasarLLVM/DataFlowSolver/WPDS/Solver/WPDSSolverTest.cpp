@@ -9,17 +9,21 @@
 #include "gtest/gtest.h"
 
 #include <iostream>
+#include <memory>
+#include <optional>
 
 #include "phasar/DB/ProjectIRDB.h"
 #include "phasar/PhasarLLVM/ControlFlow/LLVMBasedICFG.h"
 #include "phasar/PhasarLLVM/DataFlowSolver/WPDS/Problems/WPDSLinearConstantAnalysis.h"
 #include "phasar/PhasarLLVM/DataFlowSolver/WPDS/Problems/WPDSSolverTest.h"
 #include "phasar/PhasarLLVM/DataFlowSolver/WPDS/Solver/WPDSSolver.h"
+#include "phasar/PhasarLLVM/Passes/ValueAnnotationPass.h"
 #include "phasar/PhasarLLVM/Pointer/LLVMPointsToInfo.h"
 #include "phasar/PhasarLLVM/TypeHierarchy/LLVMTypeHierarchy.h"
 #include "phasar/PhasarLLVM/Utils/BinaryDomain.h"
 #include "phasar/Utils/Logger.h"
 
+#include "llvm/IR/InstIterator.h"
 #include "llvm/Support/raw_ostream.h"
 
 #include "boost/filesystem/operations.hpp"
@@ -28,6 +32,131 @@ using namespace std;
 using namespace psr;
 namespace bfs = boost::filesystem;
 
+/* ============== TEST FIXTURE ============== */
+class WPDSSolverTest : public ::testing::Test {
+protected:
+  using SolverTy =
+      WPDSSolver<WPDSLinearConstantAnalysis::n_t,
+                 WPDSLinearConstantAnalysis::d_t,
+                 WPDSLinearConstantAnalysis::f_t,
+                 WPDSLinearConstantAnalysis::t_t,
+                 WPDSLinearConstantAnalysis::v_t,
+                 WPDSLinearConstantAnalysis::l_t,
+                 WPDSLinearConstantAnalysis::i_t>;
+
+  const std::string pathToLLFiles =
+      PhasarConfig::getPhasarConfig().PhasarDirectory() +
+      "build/test/llvm_test_code/linear_constant/";
+  const std::set<std::string> EntryPoints = {"main"};
+
+  std::unique_ptr<ProjectIRDB> IRDB;
+  std::unique_ptr<LLVMTypeHierarchy> TH;
+  std::unique_ptr<LLVMPointsToInfo> PT;
+  std::unique_ptr<LLVMBasedICFG> ICFG;
+  std::unique_ptr<WPDSLinearConstantAnalysis> LCAProblem;
+
+  void SetUp() override {
+    boost::log::core::get()->set_logging_enabled(false);
+    ValueAnnotationPass::resetValueID();
+  }
+
+  void initialize(const std::string &llvmFilePath,
+                  const WPDSSolverConfig &Config) {
+    IRDB = std::make_unique<ProjectIRDB>(
+        std::vector<std::string>{pathToLLFiles + llvmFilePath},
+        IRDBOptions::WPA);
+    TH = std::make_unique<LLVMTypeHierarchy>(*IRDB);
+    PT = std::make_unique<LLVMPointsToInfo>(*IRDB);
+    ICFG = std::make_unique<LLVMBasedICFG>(*IRDB, CallGraphAnalysisType::OTF,
+                                           EntryPoints, TH.get(), PT.get());
+    LCAProblem = std::make_unique<WPDSLinearConstantAnalysis>(
+        IRDB.get(), TH.get(), ICFG.get(), PT.get(), EntryPoints);
+    // the solver reads its configuration from the problem on construction
+    LCAProblem->setWPDSSolverConfig(Config);
+  }
+
+  std::vector<const llvm::Instruction *> getInstructionsOfMain() {
+    std::vector<const llvm::Instruction *> Insts;
+    for (const auto &I :
+         llvm::instructions(IRDB->getFunctionDefinition("main"))) {
+      Insts.push_back(&I);
+    }
+    return Insts;
+  }
+
+  /**
+   * Checks that resultsAt(N), resultAt(N, D) and the batch resultsAt() agree
+   * at the given nodes, also for facts that do not hold.
+   */
+  void compareQueries(SolverTy &Solver,
+                      const std::vector<const llvm::Instruction *> &Nodes) {
+    std::vector<std::pair<WPDSLinearConstantAnalysis::n_t,
+                          WPDSLinearConstantAnalysis::d_t>>
+        Queries;
+    std::vector<std::optional<WPDSLinearConstantAnalysis::l_t>> Expected;
+    for (const auto *Node : Nodes) {
+      auto Results = Solver.resultsAt(Node);
+      for (const auto &[Fact, Value] : Results) {
+        EXPECT_EQ(Solver.resultAt(Node, Fact), Value);
+        Queries.emplace_back(Node, Fact);
+        Expected.emplace_back(Value);
+      }
+      // a node is never a fact that holds at itself
+      if (!Results.count(Node)) {
+        EXPECT_THROW(Solver.resultAt(Node, Node), std::runtime_error);
+        Queries.emplace_back(Node, Node);
+        Expected.emplace_back(std::nullopt);
+      }
+    }
+    EXPECT_EQ(Solver.resultsAt(Queries), Expected);
+  }
+};
+
+TEST_F(WPDSSolverTest, HandleForwardQueries) {
+  WPDSSolverConfig Config;
+  Config.searchDirection = WPDSSearchDirection::FORWARD;
+  initialize("call_01_cpp_dbg.ll", Config);
+  SolverTy Solver(*LCAProblem);
+  Solver.solve();
+  auto Insts = getInstructionsOfMain();
+  EXPECT_FALSE(Solver.resultsAt(Insts.back()).empty());
+  compareQueries(Solver, Insts);
+}
+
+TEST_F(WPDSSolverTest, HandleBackwardQueries) {
+  WPDSSolverConfig Config;
+  Config.searchDirection = WPDSSearchDirection::BACKWARD;
+  initialize("call_01_cpp_dbg.ll", Config);
+  SolverTy Solver(*LCAProblem);
+  auto Insts = getInstructionsOfMain();
+  // several targets are answered by a single backward search
+  std::vector<const llvm::Instruction *> Targets = {
+      Insts[Insts.size() / 2], Insts.back()};
+  Solver.setBackwardQueryTargets({Targets.begin(), Targets.end()});
+  Solver.solve();
+  compareQueries(Solver, Targets);
+}
+
+TEST_F(WPDSSolverTest, HandleDiagnostics) {
+  WPDSSolverConfig Config;
+  Config.emitPDS = true;
+  Config.pdsFile = "WPDSSolverTest.pds.dot";
+  Config.emitAutomata = true;
+  bfs::remove(Config.pdsFile);
+  bfs::remove("before_poststar.dot");
+  bfs::remove("after_poststar.dot");
+  initialize("call_01_cpp_dbg.ll", Config);
+  {
+    SolverTy Solver(*LCAProblem);
+    Solver.solve();
+    // the solver waits for the asynchronous dump of the PDS when destroyed
+  }
+  ASSERT_TRUE(bfs::exists(Config.pdsFile));
+  EXPECT_GT(bfs::file_size(Config.pdsFile), 0U);
+  EXPECT_TRUE(bfs::exists("before_poststar.dot"));
+  EXPECT_TRUE(bfs::exists("after_poststar.dot"));
+}
+
 // int main(int argc, char **argv) {
 //   initializeLogger(false);
 //   auto &lg = lg::get();
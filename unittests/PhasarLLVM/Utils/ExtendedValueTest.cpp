@@ -0,0 +1,102 @@
+#include "llvm/IR/Constants.h"
+#include "llvm/IR/LLVMContext.h"
+#include "llvm/IR/Type.h"
+
+#include "phasar/PhasarLLVM/Domain/ExtendedValue.h"
+#include "gtest/gtest.h"
+
+using namespace psr;
+
+class ExtendedValueTest : public ::testing::Test {
+protected:
+  llvm::LLVMContext Ctx;
+  const llvm::Value *A =
+      llvm::ConstantInt::get(llvm::Type::getInt32Ty(Ctx), 1);
+  const llvm::Value *B =
+      llvm::ConstantInt::get(llvm::Type::getInt32Ty(Ctx), 2);
+  ExtendedValue::InternTable Table;
+};
+
+TEST_F(ExtendedValueTest, HandleInterning) {
+  ExtendedValue EV1(Table, A);
+  ExtendedValue EV2(Table, A);
+  EXPECT_TRUE(EV1 == EV2);
+  EXPECT_EQ(EV1.getId(), EV2.getId());
+  EV1.setMemLocationSeq({A, B});
+  EXPECT_FALSE(EV1 == EV2);
+  EV2.setMemLocationSeq({A, B});
+  EXPECT_TRUE(EV1 == EV2);
+  EXPECT_EQ(std::hash<ExtendedValue>{}(EV1), std::hash<ExtendedValue>{}(EV2));
+  EXPECT_EQ(EV1.getMemLocationSeq(),
+            std::vector<const llvm::Value *>({A, B}));
+  EV2.setEndOfTaintedBlockLabel("label");
+  EXPECT_FALSE(EV1 == EV2);
+  EXPECT_EQ(EV2.getEndOfTaintedBlockLabel(), "label");
+  EV2.setEndOfTaintedBlockLabel("");
+  EXPECT_TRUE(EV1 == EV2);
+  // interning the same facts again does not create new ones
+  size_t NumFacts = Table.getNumFacts();
+  ExtendedValue EV3(Table, A);
+  EV3.setMemLocationSeq({A, B});
+  EXPECT_TRUE(EV1 == EV3);
+  EXPECT_EQ(NumFacts, Table.getNumFacts());
+}
+
+TEST_F(ExtendedValueTest, HandleSharedPrefixes) {
+  ExtendedValue EV(Table, B);
+  EV.setMemLocationSeq({A});
+  EXPECT_EQ(EV.getMemLocationSeq(), std::vector<const llvm::Value *>({A}));
+  EV.setMemLocationSeq({A, B, A});
+  EXPECT_EQ(EV.getMemLocationSeq(),
+            std::vector<const llvm::Value *>({A, B, A}));
+  EV.setMemLocationSeq({});
+  EXPECT_TRUE(EV.getMemLocationSeq().empty());
+  EXPECT_TRUE(EV == ExtendedValue(Table, B));
+}
+
+TEST_F(ExtendedValueTest, HandleVarArgs) {
+  ExtendedValue EV(Table, A);
+  EXPECT_FALSE(EV.isVarArg());
+  EV.setVarArgIndex(1);
+  EXPECT_TRUE(EV.isVarArgTemplate());
+  // templates are not advanced
+  EV.incrementCurrentVarArgIndex();
+  EXPECT_EQ(EV.getCurrentVarArgIndex(), -1L);
+  EV.setVaListMemLocationSeq({B});
+  EXPECT_FALSE(EV.isVarArgTemplate());
+  EV.incrementCurrentVarArgIndex();
+  EXPECT_EQ(EV.getCurrentVarArgIndex(), 0L);
+  EXPECT_EQ(EV.getVaListMemLocationSeq(),
+            std::vector<const llvm::Value *>({B}));
+  EV.resetVarArgIndex();
+  EXPECT_FALSE(EV.isVarArg());
+}
+
+TEST_F(ExtendedValueTest, HandleSeparateTables) {
+  auto internFacts = [this](ExtendedValue::InternTable &T) {
+    ExtendedValue EV1(T, B);
+    ExtendedValue EV2(T, A);
+    EV2.setMemLocationSeq({A, B});
+    EV2.setEndOfTaintedBlockLabel("label");
+    return std::make_pair(EV1, EV2);
+  };
+  auto First = internFacts(Table);
+  size_t NumFacts = Table.getNumFacts();
+  // the ids, and thus the order of facts, do not depend on other tables
+  ExtendedValue::InternTable Other;
+  EXPECT_EQ(Other.getNumFacts(), 0U);
+  auto Second = internFacts(Other);
+  EXPECT_EQ(Other.getNumFacts(), NumFacts);
+  EXPECT_EQ(First.first.getId(), Second.first.getId());
+  EXPECT_EQ(First.second.getId(), Second.second.getId());
+  EXPECT_EQ(&Second.second.getInternTable(), &Other);
+  // facts of another table are interned again on import
+  EXPECT_TRUE(Table.import(Second.second) == First.second);
+  EXPECT_TRUE(Table.import(First.second) == First.second);
+  EXPECT_EQ(Table.getNumFacts(), NumFacts);
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
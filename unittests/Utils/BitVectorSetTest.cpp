@@ -2,7 +2,9 @@
 
 #include <iostream>
 #include <set>
+#include <thread>
 #include <utility>
+#include <vector>
 
 #include "phasar/Utils/BitVectorSet.h"
 
@@ -376,6 +378,65 @@ TEST(BitVectorSet, rangeFor) {
   EXPECT_EQ(DS, DSGT);
 }
 
+TEST(BitVectorSet, dense) {
+  // more elements than a sparse set holds
+  std::vector<int> Elements;
+  for (int I = 100; I < 300; I += 3) {
+    Elements.push_back(I);
+  }
+  BitVectorSet<int> A(Elements.begin(), Elements.end());
+  BitVectorSet<int> B({100, 103, 1000});
+  EXPECT_EQ(A.size(), Elements.size());
+  EXPECT_EQ(std::set<int>(A.begin(), A.end()),
+            std::set<int>(Elements.begin(), Elements.end()));
+  EXPECT_FALSE(A.includes(B));
+  EXPECT_FALSE(B.includes(A));
+  BitVectorSet<int> C = A.setIntersect(B);
+  EXPECT_EQ(C, BitVectorSet<int>({100, 103}));
+  EXPECT_TRUE(A.includes(C));
+  BitVectorSet<int> D = A.setUnion(B);
+  EXPECT_EQ(D.size(), A.size() + 1);
+  EXPECT_TRUE(D.includes(A));
+  EXPECT_TRUE(D.includes(B));
+  D.erase(1000);
+  EXPECT_EQ(D, A);
+  EXPECT_NE(D, B);
+}
+
+TEST(BitVectorSet, ownIndex) {
+  BitVectorIndex<int> Index;
+  BitVectorSet<int> A(Index, {7, 8, 9});
+  BitVectorSet<int> B;
+  B.insert(A);
+  B.insert(10);
+  EXPECT_EQ(Index.size(), 4U);
+  EXPECT_TRUE(B.includes(A));
+  EXPECT_EQ(B.count(10), 1U);
+  // elements that are only known to the default index are not contained
+  EXPECT_EQ(B.count(1), 0U);
+}
+
+TEST(BitVectorSet, concurrentIndex) {
+  BitVectorIndex<int> Index;
+  std::vector<std::thread> Threads;
+  std::vector<BitVectorSet<int>> Sets(4, BitVectorSet<int>(Index));
+  for (size_t T = 0; T < Sets.size(); ++T) {
+    Threads.emplace_back([&Sets, T] {
+      for (int I = 0; I < 1000; ++I) {
+        Sets[T].insert(I);
+      }
+    });
+  }
+  for (auto &Thread : Threads) {
+    Thread.join();
+  }
+  EXPECT_EQ(Index.size(), 1000U);
+  for (const auto &Set : Sets) {
+    EXPECT_EQ(Set, Sets.front());
+    EXPECT_EQ(Set.size(), 1000U);
+  }
+}
+
 int main(int argc, char **argv) {
   ::testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
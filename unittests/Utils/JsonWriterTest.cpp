@@ -0,0 +1,95 @@
+#include <sstream>
+#include <string>
+
+#include "gtest/gtest.h"
+
+#include "nlohmann/json.hpp"
+
+#include "phasar/Utils/JsonWriter.h"
+#include "phasar/Utils/SarifWriter.h"
+
+using namespace psr;
+
+TEST(JsonWriterTest, HandleNesting) {
+  std::stringstream SS;
+  JsonWriter W(SS);
+  W.beginObject();
+  W.key("CallGraph");
+  W.beginObject();
+  W.key("main");
+  W.beginArray();
+  W.value("foo");
+  W.value(std::string("bar"));
+  W.endArray();
+  W.key("foo");
+  W.null();
+  W.endObject();
+  W.key("numbers");
+  W.beginArray();
+  W.value(42);
+  W.value(-1L);
+  W.value(0.5);
+  W.value(true);
+  W.beginArray();
+  W.endArray();
+  W.beginObject();
+  W.endObject();
+  W.endArray();
+  W.endObject();
+  EXPECT_EQ(W.depth(), 0U);
+  nlohmann::json Expected = {
+      {"CallGraph", {{"main", {"foo", "bar"}}, {"foo", nullptr}}},
+      {"numbers",
+       {42, -1, 0.5, true, nlohmann::json::array(), nlohmann::json::object()}}};
+  EXPECT_EQ(nlohmann::json::parse(SS.str()), Expected);
+}
+
+TEST(JsonWriterTest, HandleEscaping) {
+  std::string Str = "a \"quoted\" \\ string\n\twith\x01 control characters";
+  std::stringstream SS;
+  JsonWriter W(SS);
+  W.beginObject();
+  W.key(Str);
+  W.value(Str);
+  W.endObject();
+  auto J = nlohmann::json::parse(SS.str());
+  EXPECT_EQ(J[Str], Str);
+}
+
+TEST(SarifWriterTest, HandleResults) {
+  std::stringstream SS;
+  {
+    SarifWriter SW(SS);
+    SarifWriter::Location Loc;
+    Loc.File = "main.cpp";
+    Loc.Line = 12;
+    Loc.Column = 3;
+    Loc.Function = "main";
+    SW.addResult("taint", SarifWriter::Level::Warning, "leak of x", Loc);
+    SW.addResult("taint", SarifWriter::Level::Note, "no location", {});
+    EXPECT_EQ(SW.getNumResults(), 2U);
+  }
+  auto J = nlohmann::json::parse(SS.str());
+  EXPECT_EQ(J["version"], SarifWriter::Version);
+  ASSERT_EQ(J["runs"].size(), 1U);
+  EXPECT_EQ(J["runs"][0]["tool"]["driver"]["name"], "phasar");
+  auto &Results = J["runs"][0]["results"];
+  ASSERT_EQ(Results.size(), 2U);
+  EXPECT_EQ(Results[0]["ruleId"], "taint");
+  EXPECT_EQ(Results[0]["level"], "warning");
+  EXPECT_EQ(Results[0]["message"]["text"], "leak of x");
+  auto &Physical = Results[0]["locations"][0]["physicalLocation"];
+  EXPECT_EQ(Physical["artifactLocation"]["uri"], "main.cpp");
+  EXPECT_EQ(Physical["region"]["startLine"], 12);
+  EXPECT_EQ(Physical["region"]["startColumn"], 3);
+  EXPECT_EQ(
+      Results[0]["locations"][0]["logicalLocations"][0]["fullyQualifiedName"],
+      "main");
+  EXPECT_EQ(Results[1]["level"], "note");
+  EXPECT_FALSE(Results[1]["locations"][0].count("physicalLocation"));
+}
+
+int main(int Argc, char **Argv) {
+  ::testing::InitGoogleTest(&Argc, Argv);
+  return RUN_ALL_TESTS();
+}
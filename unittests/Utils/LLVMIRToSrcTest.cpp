@@ -94,6 +94,22 @@ protected:
 //   }
 // }
 
+TEST(LLVMIRToSrcCacheTest, HandleSrcCodeLines) {
+  const std::string SrcFile =
+      PhasarConfig::getPhasarConfig().PhasarDirectory() +
+      "test/llvm_test_code/llvmIRtoSrc/function_call.cpp";
+  EXPECT_EQ(getSrcCodeLineFromFile(SrcFile, 1), "int mult(int a, int b) {");
+  EXPECT_EQ(getSrcCodeLineFromFile(SrcFile, 2), "return a * b;");
+  EXPECT_EQ(getSrcCodeLineFromFile(SrcFile, 9), "int j = i + global;");
+  // served from the cache
+  EXPECT_EQ(getSrcCodeLineFromFile(SrcFile, 2), "return a * b;");
+  EXPECT_EQ(getSrcCodeLineFromFile(SrcFile, 0), "");
+  EXPECT_EQ(getSrcCodeLineFromFile(SrcFile, 1000), "");
+  EXPECT_EQ(getSrcCodeLineFromFile(SrcFile + ".missing", 1), "");
+  clearSrcCodeCache();
+  EXPECT_EQ(getSrcCodeLineFromFile(SrcFile, 8), "int i = mult(2, 4);");
+}
+
 int main(int argc, char **argv) {
   ::testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
@@ -195,6 +195,43 @@ TEST_F(PAMMTest, DISABLED_PerformanceTimerBasic) {
   std::cout << "timer_15 : " << duration.count() << std::endl;
 }
 
+TEST_F(PAMMTest, HandleRepeatingTimer) {
+  PAMM &pamm = PAMM::getInstance();
+  for (unsigned I = 0; I < 10; ++I) {
+    pamm.startTimer("repeating");
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    pamm.stopTimer("repeating", true);
+  }
+  auto Timers = pamm.getRepeatingTimer();
+  ASSERT_EQ(Timers.count("repeating"), 1);
+  const auto &Stats = Timers["repeating"];
+  EXPECT_EQ(Stats.Count, 10);
+  EXPECT_GE(Stats.Min, 2000000);
+  EXPECT_GE(Stats.Max, Stats.Min);
+  EXPECT_GE(Stats.Sum, 10 * Stats.Min);
+  EXPECT_GE(Stats.percentile(50), Stats.Min);
+  EXPECT_LE(Stats.percentile(99), Stats.Max);
+}
+
+TEST_F(PAMMTest, HandleConcurrentCounter) {
+  PAMM &pamm = PAMM::getInstance();
+  pamm.regCounter("concurrent", 3);
+  std::vector<std::thread> Threads;
+  for (unsigned I = 0; I < 4; ++I) {
+    Threads.emplace_back([&pamm]() {
+      auto Id = pamm.getId("concurrent");
+      for (unsigned J = 0; J < 10000; ++J) {
+        pamm.incCounter(Id);
+      }
+    });
+  }
+  pamm.incCounter("concurrent", 2);
+  for (auto &T : Threads) {
+    T.join();
+  }
+  EXPECT_EQ(pamm.getCounter("concurrent"), 40005);
+}
+
 // main function for the test case
 int main(int argc, char **argv) {
   ::testing::InitGoogleTest(&argc, argv);
@@ -0,0 +1,74 @@
+#include "phasar/Utils/TraceRecorder.h"
+#include "gtest/gtest.h"
+#include <sstream>
+
+using namespace psr;
+
+TEST(TraceRecorderTest, HandleSampling) {
+  TraceRecorder Trace(3);
+  for (unsigned I = 0; I < 9; ++I) {
+    TraceRecorder::Scope TS(&Trace, "Process Normal", "solver");
+    if (TS) {
+      TS.setDetail("main");
+    }
+  }
+  ASSERT_EQ(Trace.getEvents().size(), 3U);
+  for (const auto &E : Trace.getEvents()) {
+    EXPECT_STREQ(E.Name, "Process Normal");
+    EXPECT_STREQ(E.Category, "solver");
+    EXPECT_EQ(E.Detail, "main");
+  }
+  // a null recorder disables the scope
+  TraceRecorder::Scope TS(nullptr, "Process Call", "solver");
+  EXPECT_FALSE(TS);
+}
+
+TEST(TraceRecorderTest, HandleNestedScopesAndLimit) {
+  TraceRecorder Trace(1, 2);
+  {
+    TraceRecorder::Scope Outer(&Trace, "Process Call", "solver");
+    {
+      TraceRecorder::Scope Inner(&Trace, "Call-FF Construction",
+                                 "flow function");
+    }
+  }
+  {
+    TraceRecorder::Scope Dropped(&Trace, "Normal-FF Construction",
+                                 "flow function");
+  }
+  ASSERT_EQ(Trace.getEvents().size(), 2U);
+  EXPECT_EQ(Trace.getNumDroppedEvents(), 1U);
+  const auto &Inner = Trace.getEvents()[0];
+  const auto &Outer = Trace.getEvents()[1];
+  EXPECT_STREQ(Inner.Name, "Call-FF Construction");
+  EXPECT_LE(Outer.StartNs, Inner.StartNs);
+  EXPECT_GE(Outer.StartNs + Outer.DurationNs, Inner.StartNs + Inner.DurationNs);
+  Trace.clear();
+  EXPECT_TRUE(Trace.getEvents().empty());
+  EXPECT_EQ(Trace.getNumDroppedEvents(), 0U);
+}
+
+TEST(TraceRecorderTest, HandleChromeTraceExport) {
+  TraceRecorder Trace;
+  {
+    TraceRecorder::Scope TS(&Trace, "Process Exit", "solver");
+    TS.setDetail("foo");
+  }
+  std::stringstream SS;
+  Trace.exportChromeTrace(SS);
+  auto J = nlohmann::json::parse(SS.str());
+  ASSERT_EQ(J["traceEvents"].size(), 1U);
+  const auto &E = J["traceEvents"][0];
+  EXPECT_EQ(E["name"], "Process Exit");
+  EXPECT_EQ(E["cat"], "solver");
+  EXPECT_EQ(E["ph"], "X");
+  EXPECT_EQ(E["args"]["detail"], "foo");
+  EXPECT_TRUE(E.count("ts"));
+  EXPECT_TRUE(E.count("dur"));
+  EXPECT_EQ(J["otherData"]["sampleRate"], 1);
+}
+
+int main(int Argc, char **Argv) {
+  ::testing::InitGoogleTest(&Argc, Argv);
+  return RUN_ALL_TESTS();
+}